@@ -0,0 +1,66 @@
+/*
+  -----------------------
+  ElegantOTA - Dedicated Listener Example
+  -----------------------
+
+  Skill Level: Intermediate
+
+  The application keeps its own AsyncWebServer on port 80, ElegantOTA runs a second
+  server on port 8266 for the OTA endpoints. While an update runs, the application's
+  server stops accepting connections, so its traffic does not slow the upload down.
+
+  Upload with: python scripts/elegantota_client.py http://<ip>:8266 firmware.bin
+
+  Github: https://github.com/ayushsharma82/ElegantOTA
+  WiKi: https://docs.elegantota.pro
+
+  Works with both ESP8266 & ESP32
+
+  -------------------------------
+
+  Upgrade to ElegantOTA Pro: https://elegantota.pro
+
+*/
+
+#if defined(ESP8266)
+  #include <ESP8266WiFi.h>
+#elif defined(ESP32)
+  #include <WiFi.h>
+#endif
+
+#include <ESPAsyncWebServer.h>
+#include <ElegantOTA.h>
+
+const char* ssid = "........";
+const char* password = "........";
+
+AsyncWebServer server(80);
+
+void setup(void) {
+  Serial.begin(115200);
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(ssid, password);
+  Serial.println("");
+
+  // Wait for connection
+  while (WiFi.status() != WL_CONNECTED) {
+    delay(500);
+    Serial.print(".");
+  }
+  Serial.println("");
+  Serial.print("IP address: ");
+  Serial.println(WiFi.localIP());
+
+  server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
+    request->send(200, "text/plain", "Hi! The OTA page is on port 8266.");
+  });
+  server.begin();
+
+  ElegantOTA.begin(8266);                 // OTA endpoints on their own listener
+  ElegantOTA.setQuiesceServer(&server);   // pause the application's server during updates
+  Serial.println("HTTP servers started");
+}
+
+void loop(void) {
+  ElegantOTA.loop();
+}
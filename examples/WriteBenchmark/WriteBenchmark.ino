@@ -0,0 +1,125 @@
+/*
+  -----------------------
+  ElegantOTA - Write Benchmark Example
+  -----------------------
+
+  Skill Level: Advanced
+
+  Measures how fast the update partition is written for different fragment sizes (what
+  AsyncWebServer hands to the upload handler), source alignments and write chunks of
+  ElegantOTAWriter (the stage between upload and Update.write, see
+  ElegantOTA.setWriteChunk()). Prints one line per combination:
+
+    chip  fragment  align  chunk  MB/s  p99 ms  max ms
+
+  p99 and max are the times a single write call blocks, i.e. how long the TCP task would
+  stall. scripts/write_benchmark.py models the same sweep on the host, put the numbers of
+  your board next to it before changing the defaults in src/ElegantOTAWriter.cpp.
+
+  The partition is erased and written, but never activated: every run ends with an
+  incomplete update that is discarded. No WiFi needed.
+
+  Works with both ESP8266 & ESP32
+
+  -------------------------------
+
+  Upgrade to ElegantOTA Pro: https://elegantota.pro
+
+*/
+
+#if defined(ESP8266)
+  #include <Updater.h>
+#elif defined(ESP32)
+  #include <Update.h>
+#endif
+
+#include <ElegantOTAWriter.h>
+
+#define BENCH_SIZE    (256 * 1024)
+#define MAX_FRAGMENT  2920
+#define BUCKETS       64            // 1 ms latency buckets, the last one collects the rest
+
+const size_t fragments[] = { 256, 536, 1460, 2920 };
+const size_t alignments[] = { 0, 2 };
+const size_t chunks[] = { 0, 1024, 4096 };
+
+uint8_t source[MAX_FRAGMENT + 4];
+uint16_t histogram[BUCKETS];
+
+const char * chipFamily() {
+  #if defined(ESP8266)
+    return "ESP8266";
+  #else
+    return ESP.getChipModel();
+  #endif
+}
+
+void runOnce(size_t fragment, size_t align, size_t chunk) {
+  ElegantOTAWriter writer;
+  writer.setChunk(chunk);
+
+  // one sector more than written, so the update can never be completed
+  if (!Update.begin(BENCH_SIZE + 4096, U_FLASH)) {
+    Update.printError(Serial);
+    return;
+  }
+  writer.begin();
+  memset(histogram, 0, sizeof(histogram));
+  uint32_t longest = 0;
+  uint32_t calls = 0;
+
+  uint32_t started = micros();
+  for (size_t written = 0; written < BENCH_SIZE; written += fragment) {
+    size_t n = BENCH_SIZE - written < fragment ? BENCH_SIZE - written : fragment;
+    uint32_t t = micros();
+    bool ok = writer.write(source + align, n);
+    t = micros() - t;
+    if (!ok) {
+      Update.printError(Serial);
+      break;
+    }
+    histogram[t / 1000 < BUCKETS ? t / 1000 : BUCKETS - 1]++;
+    if (t > longest) longest = t;
+    calls++;
+    yield();
+  }
+  writer.flush();
+  uint32_t elapsed = micros() - started;
+
+  #if defined(ESP32)
+    Update.abort();
+  #else
+    Update.end(false);  // data is missing, the updater only resets
+  #endif
+
+  uint32_t p99 = 0;
+  for (uint32_t seen = 0; p99 < BUCKETS; p99++) {
+    seen += histogram[p99];
+    if (seen * 100 >= calls * 99) break;
+  }
+
+  Serial.printf("%-9s %5u %5u %5u %7.3f %7u %7.2f\n", chipFamily(), (unsigned)fragment, (unsigned)align, (unsigned)chunk,
+                (double)BENCH_SIZE / elapsed, (unsigned)(p99 + 1), longest / 1000.0);
+}
+
+void setup(void) {
+  Serial.begin(115200);
+  delay(1000);
+
+  // a valid image starts with the magic byte, the updaters check the first one
+  memset(source, 0xE9, sizeof(source));
+
+  Serial.println();
+  Serial.printf("%-9s %5s %5s %5s %7s %7s %7s\n", "chip", "frag", "align", "chunk", "MB/s", "p99 ms", "max ms");
+  for (size_t f : fragments) {
+    for (size_t a : alignments) {
+      for (size_t c : chunks) {
+        runOnce(f, a, c);
+      }
+    }
+  }
+  Serial.println("done");
+}
+
+void loop(void) {
+}
@@ -81,9 +81,12 @@ def on_upload(source, target, env):
             except Exception as e:
                 return 'Error while authenticating: ' + repr(e)
 
+            if doUpdateAuth.status_code == 409:
+                return "Device busy with another OTA session, retry in " + doUpdateAuth.headers.get('Retry-After', '?') + "s"
             if doUpdateAuth.status_code != 200:
                 return "Authentication failed " + str(doUpdateAuth.status_code)
             print("Authentication successful")
+            session = doUpdateAuth.headers.get('X-OTA-Session')
         else:
             auth = None
             print("Serverconfiguration: authentication not needed.")
@@ -92,8 +95,11 @@ def on_upload(source, target, env):
             except Exception as e:
                 return 'Error while starting upload: ' + repr(e)
 
+            if doUpdate.status_code == 409:
+                return "Device busy with another OTA session, retry in " + doUpdate.headers.get('Retry-After', '?') + "s"
             if doUpdate.status_code != 200:
                 return "Start request failed " + str(doUpdate.status_code)
+            session = doUpdate.headers.get('X-OTA-Session')
 
         firmware.seek(0)
         encoder = MultipartEncoder(fields={
@@ -123,6 +129,8 @@ def on_upload(source, target, env):
             'Content-Length': str(monitor.len),
             'Origin': f'{upload_url}'
         }
+        if session:
+            post_headers['X-OTA-Session'] = session
 
         try:
             response = requests.post(f"{upload_url}/ota/upload", data=monitor, headers=post_headers, auth=auth)
@@ -0,0 +1,113 @@
+# Pack firmware and filesystem image into one ElegantOTA update bundle
+#
+#   python scripts/bundle_firmware.py --app .pio/build/esp32dev/firmware.bin --fs .pio/build/esp32dev/littlefs.bin -o update.eotb
+#   python scripts/bundle_firmware.py --list update.eotb
+#   python scripts/elegantota_client.py http://192.168.1.123 update.eotb
+#
+# The device writes both partitions from the single upload and reboots once. The firmware
+# section has to come first, the device rejects bundles starting with anything else: if the
+# filesystem section fails, the device keeps booting the running firmware (the filesystem
+# partition is overwritten by then and has to be uploaded again).
+#
+# Bundle format, see src/ElegantOTABundle.h:
+#   "EOTB" | version 1 | section count | 2 reserved
+#   per section: type (1 firmware, 2 filesystem) | 3 reserved | size LE32 | MD5 16 | image
+#
+# A bundle can be encrypted like any image (scripts/encrypt_firmware.py), upload it with --bundle then.
+
+import argparse
+import hashlib
+import logging
+import struct
+import sys
+
+logging.basicConfig(level=logging.INFO)
+
+MAGIC = b"EOTB"
+VERSION = 1
+SECTION_APP = 1
+SECTION_FS = 2
+SECTION_NAMES = {SECTION_APP: "firmware", SECTION_FS: "filesystem"}
+HEADER = struct.Struct("<4sBB2x")
+SECTION_HEADER = struct.Struct("<B3xI16s")
+
+
+def pack(app=None, fs=None):
+    """Build a bundle from the firmware and an optional filesystem image."""
+    if app is None:
+        raise ValueError("a bundle needs the firmware image")
+    sections = [(t, image) for t, image in ((SECTION_APP, app), (SECTION_FS, fs)) if image is not None]
+    out = bytearray(HEADER.pack(MAGIC, VERSION, len(sections)))
+    for section_type, image in sections:
+        out += SECTION_HEADER.pack(section_type, len(image), hashlib.md5(image).digest())
+        out += image
+    return bytes(out)
+
+
+def unpack(bundle):
+    """Split a bundle into (type, image) tuples, checks structure and hashes."""
+    if len(bundle) < HEADER.size:
+        raise ValueError("bundle too short")
+    magic, version, count = HEADER.unpack_from(bundle)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("not an update bundle")
+    offset = HEADER.size
+    sections = []
+    for _ in range(count):
+        if offset + SECTION_HEADER.size > len(bundle):
+            raise ValueError("bundle truncated")
+        section_type, size, md5 = SECTION_HEADER.unpack_from(bundle, offset)
+        offset += SECTION_HEADER.size
+        image = bundle[offset:offset + size]
+        if len(image) != size:
+            raise ValueError("bundle truncated")
+        if not sections and section_type != SECTION_APP:
+            raise ValueError("bundle does not start with the firmware")
+        if hashlib.md5(image).digest() != md5:
+            raise ValueError(f"MD5 mismatch in {SECTION_NAMES.get(section_type, section_type)} section")
+        sections.append((section_type, image))
+        offset += size
+    if offset != len(bundle):
+        raise ValueError("unexpected data after bundle")
+    return sections
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Pack firmware and filesystem image into one ElegantOTA update bundle")
+    parser.add_argument("--app", help="firmware image")
+    parser.add_argument("--fs", help="filesystem image, optional")
+    parser.add_argument("-o", "--output", help="bundle file to write")
+    parser.add_argument("--list", metavar="BUNDLE", help="check a bundle and print its sections")
+    args = parser.parse_args(argv)
+
+    if args.list:
+        with open(args.list, "rb") as f:
+            bundle = f.read()
+        try:
+            sections = unpack(bundle)
+        except ValueError as e:
+            logging.error("%s: %s", args.list, e)
+            return 1
+        for section_type, image in sections:
+            print(f"{SECTION_NAMES.get(section_type, section_type):10s} {len(image):9d} bytes  md5 {hashlib.md5(image).hexdigest()}")
+        return 0
+
+    if not args.output or not args.app:
+        parser.error("--output and --app are required")
+
+    images = {}
+    for name in ("app", "fs"):
+        path = getattr(args, name)
+        if path:
+            with open(path, "rb") as f:
+                images[name] = f.read()
+    bundle = pack(images.get("app"), images.get("fs"))
+    with open(args.output, "wb") as f:
+        f.write(bundle)
+    logging.info("%s: %d bytes (%s)", args.output, len(bundle),
+                 ", ".join(f"{name} {len(image)}" for name, image in images.items()))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,311 @@
+# Streaming upload client for ElegantOTA devices
+#
+# Usable as module or from the command line:
+#
+#   python scripts/elegantota_client.py http://192.168.1.123 .pio/build/esp32/firmware.bin
+#   python scripts/elegantota_client.py http://192.168.1.123 spiffs.bin --fs --user admin --password secret
+#   python scripts/elegantota_client.py http://192.168.1.123 update.eotb
+#   python scripts/elegantota_client.py http://192.168.1.123 --info
+#
+# Compared to platformio_upload.py this client
+# - keeps a single HTTP connection for the auth probe, /ota/start and /ota/upload
+#   (as long as the device does not close it),
+# - reads the image exactly once and hashes and sends from the same buffer,
+# - adapts the send chunk size to the time the device needs to accept data,
+# - only needs the python standard library.
+
+import argparse
+import hashlib
+import http.client
+import json
+import os
+import socket
+import sys
+import time
+import uuid
+from urllib.parse import urlparse
+
+MIN_CHUNK = 1024
+MAX_CHUNK = 64 * 1024
+# a send taking longer than this means the device (flash write) is the bottleneck
+TARGET_SEND_SECONDS = 0.05
+
+
+class OTAError(Exception):
+    pass
+
+
+class OTABusyError(OTAError):
+    """Another client owns the OTA session of the device."""
+
+    def __init__(self, retry_after):
+        super().__init__(f"device busy with another OTA session, retry in {retry_after}s")
+        self.retry_after = retry_after
+
+
+class AdaptiveChunker:
+    """AIMD style chunk sizing driven by the measured blocking time of each send."""
+
+    def __init__(self, initial=4096, minimum=MIN_CHUNK, maximum=MAX_CHUNK, target=TARGET_SEND_SECONDS):
+        self.size = initial
+        self.minimum = minimum
+        self.maximum = maximum
+        self.target = target
+
+    def update(self, seconds):
+        if seconds > self.target:
+            self.size = max(self.minimum, self.size // 2)
+        elif seconds < self.target / 4:
+            self.size = min(self.maximum, self.size * 2)
+        return self.size
+
+
+class ElegantOTAClient:
+    def __init__(self, url, username=None, password=None, timeout=30, send_buffer=16 * 1024):
+        parsed = urlparse(url if "://" in url else "http://" + url)
+        self.host = parsed.hostname
+        self.port = parsed.port or 80
+        self.base = parsed.path.rstrip("/")
+        if self.base.endswith("/update"):
+            self.base = self.base[: -len("/update")]
+        self.username = username
+        self.password = password
+        self.timeout = timeout
+        self.send_buffer = send_buffer
+        self.session = None
+        self._conn = None
+        self._digest = None
+        self._nc = 0
+
+    # -- connection handling -------------------------------------------------
+
+    def _connection(self):
+        if self._conn is None:
+            self._conn = http.client.HTTPConnection(self.host, self.port, timeout=self.timeout)
+            self._conn.connect()
+            # a small send buffer makes the blocking time of send() follow the device
+            self._conn.sock.setsockopt(socket.SOL_SOCKET, socket.SO_SNDBUF, self.send_buffer)
+            self._conn.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        return self._conn
+
+    def close(self):
+        if self._conn is not None:
+            self._conn.close()
+            self._conn = None
+
+    def _finish(self, response):
+        body = response.read()
+        if response.will_close:
+            self.close()
+        return response.status, response.headers, body
+
+    def _request(self, method, path, body=None, headers=None):
+        headers = dict(headers or {})
+        for attempt in range(2):
+            auth = self._authorization(method, path)
+            if auth:
+                headers["Authorization"] = auth
+            try:
+                conn = self._connection()
+                conn.request(method, path, body=body, headers=headers)
+                status, response_headers, data = self._finish(conn.getresponse())
+            except (ConnectionError, http.client.HTTPException, OSError) as e:
+                # the device closed the kept-alive connection, retry once on a new one
+                self.close()
+                if attempt:
+                    raise OTAError(f"connection to {self.host}:{self.port} failed: {e!r}") from e
+                continue
+            if status == 401 and self._challenge(response_headers) and attempt == 0:
+                continue
+            return status, response_headers, data
+        return status, response_headers, data
+
+    # -- digest authentication -----------------------------------------------
+
+    def _challenge(self, headers):
+        value = headers.get("WWW-Authenticate", "")
+        if not value.lower().startswith("digest") or not self.username:
+            return False
+        params = {}
+        for part in value[6:].split(","):
+            if "=" in part:
+                key, val = part.strip().split("=", 1)
+                params[key.lower()] = val.strip('"')
+        self._digest = params
+        self._nc = 0
+        return True
+
+    def _authorization(self, method, path):
+        if not self._digest:
+            return None
+        d = self._digest
+        self._nc += 1
+        nc = f"{self._nc:08x}"
+        cnonce = uuid.uuid4().hex[:16]
+        md5 = lambda s: hashlib.md5(s.encode()).hexdigest()
+        ha1 = md5(f"{self.username}:{d.get('realm', '')}:{self.password}")
+        ha2 = md5(f"{method}:{path}")
+        if "qop" in d:
+            response = md5(f"{ha1}:{d['nonce']}:{nc}:{cnonce}:auth:{ha2}")
+            extra = f', qop=auth, nc={nc}, cnonce="{cnonce}"'
+        else:
+            response = md5(f"{ha1}:{d['nonce']}:{ha2}")
+            extra = ""
+        header = (f'Digest username="{self.username}", realm="{d.get("realm", "")}", nonce="{d["nonce"]}", '
+                  f'uri="{path}", response="{response}"{extra}')
+        if "opaque" in d:
+            header += f', opaque="{d["opaque"]}"'
+        return header
+
+    # -- API -------------------------------------------------------------------
+
+    def device_info(self):
+        status, _, body = self._request("GET", f"{self.base}/getdeviceinfo")
+        if status != 200:
+            raise OTAError(f"/getdeviceinfo failed with {status}")
+        return json.loads(body)
+
+    def start(self, md5, mode="fr"):
+        query = f"mode={mode}" + (f"&hash={md5}" if md5 else "")
+        status, headers, body = self._request("GET", f"{self.base}/ota/start?{query}")
+        if status == 409:
+            raise OTABusyError(headers.get("Retry-After", "?"))
+        if status == 401:
+            raise OTAError("authentication required or failed")
+        if status != 200:
+            raise OTAError(f"/ota/start failed with {status}: {body.decode(errors='replace').strip()}")
+        self.session = headers.get("X-OTA-Session")
+
+    def upload(self, image, mode="fr", progress=None, chunker=None):
+        """Upload an image (path or bytes). Returns the device answer, raises OTAError on failure."""
+        if isinstance(image, (str, os.PathLike)):
+            with open(image, "rb") as f:
+                image = f.read()
+        data = memoryview(image)
+        md5 = hashlib.md5(data).hexdigest()
+        if bytes(data[:4]) == b"EOTB":
+            # firmware + filesystem bundle (scripts/bundle_firmware.py), it carries the hash of every section
+            self.start(None, "bundle")
+        elif bytes(data[:4]) == b"EOTA":
+            # encrypted container (scripts/encrypt_firmware.py), its MAC protects the plaintext
+            self.start(None, mode + "&enc=1")
+        elif bytes(data[:4]) == b"EOTS":
+            # sparse image (scripts/sparse_image.py), the device verifies the hash of the full image
+            md5 = bytes(data[16:32]).hex()
+            self.start(md5, mode + "&sparse=1")
+        else:
+            self.start(md5, mode)
+        return self.post_file(f"{self.base}/ota/upload", data, md5, progress, chunker)
+
+    def post_file(self, path, data, md5=None, progress=None, chunker=None):
+        """Stream data as multipart file upload to path. Returns the device answer."""
+        data = memoryview(data)
+        boundary = uuid.uuid4().hex
+        head = b""
+        if md5:
+            head += f"--{boundary}\r\nContent-Disposition: form-data; name=\"MD5\"\r\n\r\n{md5}\r\n".encode()
+        head += (f"--{boundary}\r\nContent-Disposition: form-data; name=\"firmware\"; filename=\"firmware\"\r\n"
+                 f"Content-Type: application/octet-stream\r\n\r\n").encode()
+        tail = f"\r\n--{boundary}--\r\n".encode()
+
+        conn = self._connection()
+        conn.putrequest("POST", path, skip_accept_encoding=True)
+        conn.putheader("Content-Type", f"multipart/form-data; boundary={boundary}")
+        conn.putheader("Content-Length", str(len(head) + len(data) + len(tail)))
+        auth = self._authorization("POST", path)
+        if auth:
+            conn.putheader("Authorization", auth)
+        if self.session:
+            conn.putheader("X-OTA-Session", self.session)
+        conn.endheaders(head)
+
+        chunker = chunker or AdaptiveChunker()
+        sent = 0
+        try:
+            while sent < len(data):
+                chunk = data[sent:sent + chunker.size]
+                t0 = time.monotonic()
+                conn.sock.sendall(chunk)
+                chunker.update(time.monotonic() - t0)
+                sent += len(chunk)
+                if progress:
+                    progress(sent, len(data), chunker.size)
+            conn.sock.sendall(tail)
+            status, _, body = self._finish(conn.getresponse())
+        except (ConnectionError, http.client.HTTPException, OSError) as e:
+            self.close()
+            raise OTAError(f"upload interrupted after {sent} bytes: {e!r}") from e
+        answer = body.decode(errors="replace").strip()
+        if status == 409:
+            raise OTABusyError("?")
+        if status != 200:
+            raise OTAError(f"upload failed with {status}: {answer}")
+        return answer
+
+    def call(self, method, path, body=None, content_type="application/json"):
+        """Plain request within the current session, returns the decoded answer or raises OTAError."""
+        headers = {"Content-Type": content_type} if body is not None else {}
+        if self.session:
+            headers["X-OTA-Session"] = self.session
+        status, response_headers, data = self._request(method, f"{self.base}{path}", body, headers)
+        if status == 409:
+            raise OTABusyError(response_headers.get("Retry-After", "?"))
+        if not 200 <= status < 300:
+            raise OTAError(f"{path} failed with {status}: {data.decode(errors='replace').strip()}")
+        return data.decode(errors="replace")
+
+    def download(self, path):
+        """GET path, returns the answer as bytes or raises OTAError."""
+        status, _, data = self._request("GET", f"{self.base}{path}")
+        if status != 200:
+            raise OTAError(f"{path} failed with {status}: {data.decode(errors='replace').strip()}")
+        return data
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Upload firmware or filesystem images to an ElegantOTA device")
+    parser.add_argument("url", help="device url, e.g. http://192.168.1.123")
+    parser.add_argument("image", nargs="?", help="image file to upload")
+    parser.add_argument("--fs", action="store_true", help="upload a filesystem image")
+    parser.add_argument("--bundle", action="store_true",
+                        help="the (encrypted) image is a firmware + filesystem bundle, detected for plain bundles")
+    parser.add_argument("--user", help="username")
+    parser.add_argument("--password", help="password")
+    parser.add_argument("--info", action="store_true", help="print /getdeviceinfo and exit")
+    parser.add_argument("--wait", type=int, default=0, metavar="SECONDS",
+                        help="keep retrying for this long while the device is busy")
+    args = parser.parse_args(argv)
+
+    client = ElegantOTAClient(args.url, args.user, args.password)
+    if args.info or not args.image:
+        print(json.dumps(client.device_info(), indent=2))
+        return 0
+
+    started = time.monotonic()
+    deadline = started + args.wait
+
+    def progress(sent, total, chunk):
+        elapsed = max(time.monotonic() - started, 1e-6)
+        sys.stdout.write(f"\r{sent * 100 // total:3d}%  {sent / elapsed / 1024:7.1f} KiB/s  chunk {chunk // 1024:3d} KiB")
+        sys.stdout.flush()
+
+    while True:
+        try:
+            answer = client.upload(args.image, "bundle" if args.bundle else "fs" if args.fs else "fr", progress)
+            break
+        except OTABusyError as e:
+            if time.monotonic() >= deadline:
+                print(f"\n{e}")
+                return 2
+            retry = int(e.retry_after) if str(e.retry_after).isdigit() else 5
+            time.sleep(min(retry, max(deadline - time.monotonic(), 0)))
+        except OTAError as e:
+            print(f"\n{e}")
+            return 1
+
+    print(f"\nUpload successful in {time.monotonic() - started:.1f}s. Server response: {answer}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,200 @@
+# Find ElegantOTA devices advertising _elegantota._tcp via mDNS
+#
+# Sends one multicast PTR query and collects all answers for a short window,
+# instead of polling /getdeviceinfo on every address. Devices enable the
+# advertisement with ElegantOTA.enableDiscovery().
+#
+#   python scripts/elegantota_discover.py
+#   python scripts/elegantota_discover.py --json --timeout 2
+#   python scripts/elegantota_discover.py --chip ESP32-S3 --variant display
+#
+# --group/--port allow a stand-in multicast group, e.g. for the emulator
+# (python scripts/elegantota_emulator.py serve --devices 50 --mdns).
+
+import argparse
+import json
+import socket
+import struct
+import sys
+import time
+
+MDNS_GROUP = "224.0.0.251"
+MDNS_PORT = 5353
+SERVICE = "_elegantota._tcp.local"
+
+TYPE_A, TYPE_PTR, TYPE_TXT, TYPE_SRV = 1, 12, 16, 33
+CLASS_IN = 1
+UNICAST_RESPONSE = 0x8000
+
+
+# -- DNS message encoding ------------------------------------------------------------------
+
+def encode_name(name):
+    out = b""
+    for label in name.rstrip(".").split("."):
+        raw = label.encode()
+        out += bytes([len(raw)]) + raw
+    return out + b"\0"
+
+
+def decode_name(msg, offset):
+    labels = []
+    jumped = False
+    end = offset
+    for _ in range(128):
+        length = msg[offset]
+        if length & 0xC0 == 0xC0:
+            if not jumped:
+                end = offset + 2
+            offset = ((length & 0x3F) << 8) | msg[offset + 1]
+            jumped = True
+            continue
+        offset += 1
+        if length == 0:
+            break
+        labels.append(msg[offset:offset + length].decode(errors="replace"))
+        offset += length
+    if not jumped:
+        end = offset
+    return ".".join(labels), end
+
+
+def build_query(name=SERVICE, qtype=TYPE_PTR, unicast=True):
+    header = struct.pack(">HHHHHH", 0, 0, 1, 0, 0, 0)
+    return header + encode_name(name) + struct.pack(">HH", qtype, CLASS_IN | (UNICAST_RESPONSE if unicast else 0))
+
+
+def build_record(name, rtype, data, ttl=120):
+    return encode_name(name) + struct.pack(">HHIH", rtype, CLASS_IN, ttl, len(data)) + data
+
+
+def build_response(instance, host, address, port, txt):
+    """Answer of one device: PTR with SRV, TXT and A as additional records."""
+    full = f"{instance}.{SERVICE}"
+    txt_data = b"".join(bytes([len(e)]) + e for e in (f"{k}={v}".encode() for k, v in txt.items()))
+    answers = [build_record(SERVICE, TYPE_PTR, encode_name(full))]
+    additional = [
+        build_record(full, TYPE_SRV, struct.pack(">HHH", 0, 0, port) + encode_name(host)),
+        build_record(full, TYPE_TXT, txt_data or b"\0"),
+        build_record(host, TYPE_A, socket.inet_aton(address)),
+    ]
+    header = struct.pack(">HHHHHH", 0, 0x8400, 0, len(answers), 0, len(additional))
+    return header + b"".join(answers) + b"".join(additional)
+
+
+def parse_message(msg):
+    """Return (questions, records) of a DNS message, records as (name, type, value)."""
+    _, flags, qd, an, ns, ar = struct.unpack_from(">HHHHHH", msg)
+    offset = 12
+    questions = []
+    for _ in range(qd):
+        name, offset = decode_name(msg, offset)
+        qtype, _ = struct.unpack_from(">HH", msg, offset)
+        offset += 4
+        questions.append((name, qtype))
+    records = []
+    for _ in range(an + ns + ar):
+        name, offset = decode_name(msg, offset)
+        rtype, _, _, length = struct.unpack_from(">HHIH", msg, offset)
+        offset += 10
+        data = msg[offset:offset + length]
+        if rtype == TYPE_PTR:
+            value = decode_name(msg, offset)[0]
+        elif rtype == TYPE_SRV:
+            value = (struct.unpack_from(">H", data, 4)[0], decode_name(msg, offset + 6)[0])
+        elif rtype == TYPE_TXT:
+            value, i = {}, 0
+            while i < len(data):
+                entry = data[i + 1:i + 1 + data[i]].decode(errors="replace")
+                i += 1 + data[i]
+                if "=" in entry:
+                    key, val = entry.split("=", 1)
+                    value[key] = val
+        elif rtype == TYPE_A:
+            value = socket.inet_ntoa(data)
+        else:
+            value = data
+        records.append((name, rtype, value))
+        offset += length
+    return flags, questions, records
+
+
+# -- discovery -------------------------------------------------------------------------------
+
+def discover(timeout=1.5, group=MDNS_GROUP, port=MDNS_PORT, interface="0.0.0.0"):
+    """One multicast round, returns a list of device dicts."""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, 255)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(interface))
+    sock.bind((interface, 0))
+    # a query from a port other than 5353 is a legacy unicast query, answers come back to us
+    sock.sendto(build_query(), (group, port))
+
+    devices = {}
+    addresses = {}
+    deadline = time.monotonic() + timeout
+    while True:
+        remaining = deadline - time.monotonic()
+        if remaining <= 0:
+            break
+        sock.settimeout(remaining)
+        try:
+            msg, sender = sock.recvfrom(9000)
+        except socket.timeout:
+            break
+        try:
+            flags, _, records = parse_message(msg)
+        except (struct.error, IndexError):
+            continue
+        if not flags & 0x8000:
+            continue
+        for name, rtype, value in records:
+            if rtype == TYPE_PTR and name.lower() == SERVICE:
+                devices.setdefault(value, {"instance": value.split(".")[0], "address": sender[0]})
+            elif rtype == TYPE_SRV:
+                devices.setdefault(name, {"instance": name.split(".")[0], "address": sender[0]})
+                devices[name]["port"], devices[name]["host"] = value
+            elif rtype == TYPE_TXT:
+                devices.setdefault(name, {"instance": name.split(".")[0], "address": sender[0]}).update(value)
+            elif rtype == TYPE_A:
+                addresses[name] = value
+    sock.close()
+
+    result = []
+    for entry in devices.values():
+        entry["address"] = addresses.get(entry.get("host"), entry["address"])
+        entry.setdefault("port", 80)
+        entry["url"] = f"http://{entry['address']}:{entry['port']}"
+        result.append(entry)
+    return sorted(result, key=lambda d: (d.get("chip", ""), d["url"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Discover ElegantOTA devices via mDNS")
+    parser.add_argument("--timeout", type=float, default=1.5, help="seconds to collect answers")
+    parser.add_argument("--group", default=MDNS_GROUP)
+    parser.add_argument("--port", type=int, default=MDNS_PORT)
+    parser.add_argument("--interface", default="0.0.0.0", help="address of the interface to query on")
+    parser.add_argument("--chip", help="only devices of this chip family")
+    parser.add_argument("--variant", help="only devices of this firmware variant")
+    parser.add_argument("--json", action="store_true", help="print JSON instead of a table")
+    args = parser.parse_args()
+
+    started = time.monotonic()
+    devices = discover(args.timeout, args.group, args.port, args.interface)
+    devices = [d for d in devices if (not args.chip or d.get("chip") == args.chip)
+               and (not args.variant or d.get("variant") == args.variant)]
+
+    if args.json:
+        print(json.dumps(devices, indent=2))
+        return 0
+    print(f"{'url':28s} {'chip':9s} {'version':12s} {'variant':12s} {'build':6s} {'id':16s} modes")
+    for d in devices:
+        print(f"{d['url']:28s} {d.get('chip', ''):9s} {d.get('version', ''):12s} {d.get('variant', ''):12s} "
+              f"{d.get('build', ''):6s} {d.get('id', ''):16s} {d.get('modes', '')}")
+    print(f"{len(devices)} devices in {time.monotonic() - started:.2f}s")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
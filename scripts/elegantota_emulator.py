@@ -0,0 +1,2093 @@
+# Emulator of ElegantOTA devices for tooling tests and load benchmarks
+#
+# Speaks the HTTP contract of ElegantOTAClass (/update, /getdeviceinfo,
+# /ota/start, /ota/upload, /ota/fs/...) including digest auth, single-flight sessions
+# (409 + Retry-After), image header validation, MD5 verification and firmware +
+# filesystem bundles, multicast receive (src/ElegantOTAMulticast.cpp), the background
+# prefetch (src/ElegantOTAPrefetch.cpp), the update history (/ota/history), the upload
+# trace (/ota/trace.bin, with --trace), sparse images (src/ElegantOTASparse.h) and
+# optionally the raw TCP upload (src/ElegantOTATcp.cpp).
+# Flash is a file per device and partition, erase/program times follow a per chip
+# family timing model, as does the byte wise multipart parsing of AsyncWebServer.
+#
+#   # one device on port 8080
+#   python scripts/elegantota_emulator.py serve --chip ESP32-S3
+#
+#   # 200 devices on ports 9000..9199, each uploaded concurrently by elegantota_client
+#   python scripts/elegantota_emulator.py loadtest --devices 200 --size 1000000
+#
+#   # 50 devices answering _elegantota._tcp queries, see elegantota_discover.py
+#   python scripts/elegantota_emulator.py serve --devices 50 --mdns
+#
+# Only the python standard library is needed.
+
+import argparse
+import base64
+import collections
+import gzip
+import hashlib
+import hmac
+import http.server
+import json
+import os
+import queue
+import random
+import re
+import socket
+import socketserver
+import struct
+import sys
+import tempfile
+import threading
+import time
+import urllib.error
+import urllib.request
+import uuid
+from urllib.parse import unquote
+from concurrent.futures import ThreadPoolExecutor
+
+# flash timing model per chip family:
+#   erase_ms  erase of one 4 KiB sector
+#   page_us   programming of one 256 byte page
+#   app/fs    partition sizes of the default partition scheme
+#   mhz       default CPU clock, scales the per byte cost of the multipart parser
+CHIPS = {
+    "ESP8266":  {"id": None,   "erase_ms": 45, "page_us": 700, "app": 0x0FB000, "fs": 0x0FA000, "mhz": 80},
+    "ESP32":    {"id": 0x0000, "erase_ms": 35, "page_us": 500, "app": 0x140000, "fs": 0x160000, "mhz": 240},
+    "ESP32-S2": {"id": 0x0002, "erase_ms": 35, "page_us": 500, "app": 0x140000, "fs": 0x160000, "mhz": 240},
+    "ESP32-C3": {"id": 0x0005, "erase_ms": 35, "page_us": 500, "app": 0x140000, "fs": 0x160000, "mhz": 160},
+    "ESP32-S3": {"id": 0x0009, "erase_ms": 30, "page_us": 400, "app": 0x140000, "fs": 0x160000, "mhz": 240},
+    "ESP32-C6": {"id": 0x000D, "erase_ms": 30, "page_us": 450, "app": 0x140000, "fs": 0x160000, "mhz": 160},
+    "ESP32-H2": {"id": 0x0010, "erase_ms": 35, "page_us": 500, "app": 0x140000, "fs": 0x160000, "mhz": 96},
+    "ESP32-C2": {"id": 0x000C, "erase_ms": 35, "page_us": 500, "app": 0x140000, "fs": 0x160000, "mhz": 120},
+    "ESP32-P4": {"id": 0x0012, "erase_ms": 30, "page_us": 400, "app": 0x140000, "fs": 0x160000, "mhz": 360},
+    "ESP32-C61": {"id": 0x0014, "erase_ms": 30, "page_us": 450, "app": 0x140000, "fs": 0x160000, "mhz": 160},
+    "ESP32-C5": {"id": 0x0017, "erase_ms": 30, "page_us": 450, "app": 0x140000, "fs": 0x160000, "mhz": 240},
+}
+CHIP_BY_ID = {v["id"]: k for k, v in CHIPS.items() if v["id"] is not None}
+
+SECTOR = 4096
+PAGE = 256
+APP_DESC_MAGIC = 0xABCD5432
+SESSION_TIMEOUT = 30.0
+# ELEGANTOTA_HISTORY_FILE and ELEGANTOTA_PREFETCH_FILE, never touched by a file sync
+LIBRARY_FILES = {"/ota_history.bin", "/ota_prefetch.json"}
+REBOOT_DELAY = 2.0
+PEER_MAX_DOWNLOADS = 1      # ELEGANTOTA_PEER_MAX_DOWNLOADS
+PEER_TX_RATE = 1024 * 1024  # bytes/s a device sends /ota/self.bin with
+PULL_RETRY = 1.0
+PULL_PEER_WAIT = 60.0
+APP_COST = 0.005            # seconds an application request busies the AsyncTCP task
+# AsyncWebServer runs multipart bodies through _parseMultipartPostByte() one byte at a
+# time and copies them into its item buffer, estimated CPU cycles per byte
+MULTIPART_CYCLES = 60
+RAW_HEADER = struct.Struct("<4sBBBBI16s")   # src/ElegantOTATcp.cpp
+RAW_MODES = {0: "fr", 1: "fs", 3: "bundle"}
+MCAST_HEADER = struct.Struct("<4sBBHI")     # src/ElegantOTAMulticast.cpp
+MCAST_MAX_BLOCK = 1024                      # ELEGANTOTA_MULTICAST_BLOCK
+MCAST_FEC_SLOTS = 2                         # ELEGANTOTA_MULTICAST_FEC_SLOTS
+MCAST_MAX_RANGES = 64
+# datagrams lwIP queues for a UDP socket until loop() reads them, more are dropped
+# (CONFIG_LWIP_UDP_RECVMBOX_SIZE on ESP32, the pbuf chain of WiFiUDP on ESP8266)
+MCAST_RX_QUEUE = {"ESP8266": 8}
+MCAST_RX_QUEUE_DEFAULT = 6
+PREFETCH_BLOCK = 1024                       # ELEGANTOTA_MULTICAST_BLOCK
+PREFETCH_SAVE = 65536                       # ELEGANTOTA_PREFETCH_SAVE
+PREFETCH_RATE = 8192                        # ELEGANTOTA_PREFETCH_RATE
+PREFETCH_RETRY = 30.0
+HISTORY_LEN = 16                            # ELEGANTOTA_HISTORY_LEN
+HISTORY_MODES = {"fr": "firmware", "fs": "fs", "files": "files", "bundle": "bundle", "multicast": "multicast"}
+# src/ElegantOTATrace.h, header and entry of /ota/trace.bin
+TRACE_HEADER = struct.Struct("<4sBBBB12sIIIII")
+TRACE_ENTRY = struct.Struct("<IIHHI")
+TRACE_MODES = {"fr": 0, "fs": 1, "files": 2, "bundle": 3, "multicast": 4}
+TRACE_TCP = 0x0002
+# src/ElegantOTASparse.h, header and extent header of a sparse image
+SPARSE_HEADER = struct.Struct("<4sB3xII16s")
+SPARSE_EXTENT = struct.Struct("<II")
+
+UI_HTML = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "include", "ElegantOTA.html")
+
+
+def make_image(chip="ESP32", size=1000000, version="1.0.0", project="app", seed=0):
+    """Build a synthetic firmware image with a valid header (and app descriptor on ESP32)."""
+    rnd = bytes((i * 131 + seed) & 0xFF for i in range(256))
+    if chip == "ESP8266":
+        header = bytes([0xE9, 1, 0x02, 0x20]) + struct.pack("<I", 0x40100000)
+        header += struct.pack("<II", 0x40100000, size - 16)
+    else:
+        header = bytes([0xE9, 4, 0x02, 0x20]) + struct.pack("<I", 0x40080000)
+        header += bytes([0xEE, 0, 0, 0]) + struct.pack("<H", CHIPS[chip]["id"]) + bytes(10)
+        header += struct.pack("<II", 0x3F400020, 256)
+        header += struct.pack("<II", APP_DESC_MAGIC, 0) + bytes(8)
+        header += version.encode()[:32].ljust(32, b"\0") + project.encode()[:32].ljust(32, b"\0")
+    body = (rnd * (size // 256 + 1))[: max(size - len(header), 0)]
+    return header + body
+
+
+def check_image(header, chip, project="", running_version=""):
+    """Python twin of ElegantOTAImageCheck::validate(), returns an error string or None."""
+    if len(header) < 16:
+        return "Image too small"
+    if chip == "ESP8266" and header[:2] == b"\x1f\x8b":
+        return None
+    if header[0] != 0xE9:
+        return f"Invalid image magic 0x{header[0]:02X}"
+    if header[1] == 0 or header[1] > 16:
+        return f"Invalid image segment count {header[1]}"
+    if chip == "ESP8266":
+        load = struct.unpack_from("<I", header, 8)[0]
+        return None if 0x3FFE8000 <= load < 0x40300000 else "Image is not built for ESP8266"
+    if len(header) < 32:
+        return "Image too small"
+    family = CHIP_BY_ID.get(struct.unpack_from("<H", header, 12)[0])
+    if family != chip:
+        return f"Image built for {family or 'unknown chip'}, device is {chip}"
+    if len(header) < 112 or struct.unpack_from("<I", header, 32)[0] != APP_DESC_MAGIC:
+        return None
+    image_version = header[48:80].split(b"\0")[0].decode(errors="replace")
+    image_project = header[80:112].split(b"\0")[0].decode(errors="replace")
+    if project and image_project != project:
+        return f"Image project {image_project} does not match {project}"
+    if running_version and image_version == running_version:
+        return f"Image version {image_version} is already running"
+    return None
+
+
+class FlashPartition:
+    """File backed stand-in for the Update object, sector buffered like the real one."""
+
+    def __init__(self, path, size, chip, time_scale):
+        self.path = path
+        self.size = size
+        self.timing = CHIPS[chip]
+        self.time_scale = time_scale
+        self.buffer = bytearray()
+        self.written = 0
+        self.md5 = hashlib.md5()
+        self.expected_md5 = None
+        self.error = None
+        self.file = None
+        self.busy_seconds = 0.0
+        self.meter = RateMeter()
+
+    @property
+    def received(self):
+        return self.written + len(self.buffer)
+
+    def begin(self, expected_md5):
+        self.file = open(self.path, "wb")
+        self.expected_md5 = expected_md5
+        self.buffer.clear()
+        self.written = 0
+        self.md5 = hashlib.md5()
+        self.error = None
+        self.meter = RateMeter()
+
+    def _flush(self, final=False):
+        # whole sectors like the buffer of the Updater, the rest with end()
+        length = len(self.buffer) if final else len(self.buffer) - len(self.buffer) % SECTOR
+        if not length:
+            return
+        cost = 0.0
+        for offset in range(0, length, SECTOR):
+            sector = self.buffer[offset:min(offset + SECTOR, length)]
+            cost += self.timing["erase_ms"] / 1000
+            # the ESP32 Updater skips programming a sector that stays erased, ESP8266 programs every page
+            if self.timing["id"] is None or sector.count(0xFF) != len(sector):
+                cost += (len(sector) + PAGE - 1) // PAGE * self.timing["page_us"] / 1e6
+        self.busy_seconds += cost
+        if self.time_scale:
+            time.sleep(cost * self.time_scale)
+        self.file.write(self.buffer[:length])
+        self.written += length
+        del self.buffer[:length]
+
+    def write(self, data):
+        if self.error or self.file is None:
+            return 0
+        if self.written + len(self.buffer) + len(data) > self.size:
+            self.error = "Not Enough Space"
+            return 0
+        self.md5.update(data)
+        self.buffer += data
+        if len(self.buffer) >= SECTOR:
+            self._flush()
+        self.meter.progress(self.received)
+        return len(data)
+
+    def end(self):
+        if self.file is None:
+            return False
+        self._flush(True)
+        self.file.close()
+        self.file = None
+        if self.error:
+            return False
+        if self.expected_md5 and self.md5.hexdigest() != self.expected_md5:
+            self.error = "MD5 Check Failed"
+            return False
+        return True
+
+    def abort(self):
+        if self.file is not None:
+            self.file.close()
+            self.file = None
+        self.error = self.error or "Aborted"
+
+
+class SparseWriter:
+    """Expands a sparse image into a partition while it streams in, mirrors src/ElegantOTASparse.cpp."""
+
+    def __init__(self, device, partition):
+        self.device = device
+        self.partition = partition
+        self.pending = b""        # header bytes not parsed yet
+        self.image_size = None
+        self.extents = 0
+        self.remaining = 0
+        self.position = 0
+        self.head = bytearray()   # first bytes of the expanded image for the header check
+        self._error = None
+
+    def __getattr__(self, name):
+        return getattr(self.partition, name)
+
+    @property
+    def error(self):
+        return self._error or self.partition.error
+
+    def _emit(self, data):
+        if self.device.mode == "fr" and len(self.head) < 112:
+            self.head += data[:112 - len(self.head)]
+            if len(self.head) >= 112:
+                self._error = check_image(bytes(self.head), self.device.chip)
+                if self._error:
+                    return False
+        self.position += len(data)
+        return self.partition.write(data) == len(data)
+
+    def _fill(self, end):
+        while self.position < end:
+            if not self._emit(b"\xff" * min(end - self.position, 65536)):
+                return False
+        return True
+
+    def write(self, data):
+        received = len(data)
+        data = self.pending + bytes(data)
+        self.pending = b""
+        while data:
+            if self.image_size is None:
+                if len(data) < SPARSE_HEADER.size:
+                    break
+                magic, version, size, count, md5 = SPARSE_HEADER.unpack_from(data)
+                data = data[SPARSE_HEADER.size:]
+                if magic != b"EOTS" or version != 1:
+                    self._error = "Not a sparse image"
+                    return 0
+                if size > self.partition.size:
+                    self._error = f"Image of {size} bytes exceeds partition size {self.partition.size}"
+                    return 0
+                self.image_size, self.extents = size, count
+                if self.partition.expected_md5 is not None and any(md5) and md5.hex() != self.partition.expected_md5:
+                    self._error = "MD5 of sparse image does not match"
+                    return 0
+                if self.partition.expected_md5 is None and any(md5):
+                    self.partition.expected_md5 = md5.hex()
+                if count == 0 and not self._fill(size):
+                    return 0
+            elif self.remaining == 0:
+                if self.extents == 0:
+                    self._error = "Unexpected data after sparse image"
+                    return 0
+                if len(data) < SPARSE_EXTENT.size:
+                    break
+                offset, self.remaining = SPARSE_EXTENT.unpack_from(data)
+                data = data[SPARSE_EXTENT.size:]
+                self.extents -= 1
+                if offset < self.position or offset + self.remaining > self.image_size:
+                    self._error = "Invalid sparse extent"
+                    return 0
+                if not self._fill(offset):
+                    return 0
+            else:
+                n = min(self.remaining, len(data))
+                if not self._emit(data[:n]):
+                    return 0
+                self.remaining -= n
+                data = data[n:]
+            if self.image_size is not None and self.remaining == 0 and self.extents == 0 and not self._fill(self.image_size):
+                return 0
+        self.pending = data
+        return received
+
+    def end(self):
+        if self.image_size is None or self.extents or self.remaining or self.pending or self.position != self.image_size:
+            self._error = self._error or "Sparse image incomplete"
+            self.partition.abort()
+            return False
+        if self.device.mode == "fr" and len(self.head) < 112:
+            self._error = check_image(bytes(self.head), self.device.chip)
+            if self._error:
+                self.partition.abort()
+                return False
+        return self.partition.end()
+
+
+class RateMeter:
+    """Slowest full second of a session, mirrors ElegantOTAHistory::progress()."""
+
+    def __init__(self):
+        self.window_start = time.monotonic()
+        self.window_bytes = 0
+        self.min_rate = 0
+        self.measured = False
+
+    def progress(self, received):
+        now = time.monotonic()
+        elapsed = now - self.window_start
+        if elapsed < 1.0:
+            return
+        rate = int((received - self.window_bytes) / elapsed)
+        self.min_rate = rate if not self.measured else min(self.min_rate, rate)
+        self.measured = True
+        self.window_start, self.window_bytes = now, received
+
+
+class Trace:
+    """Ring of the fragments of the last upload, mirrors src/ElegantOTATrace.cpp."""
+
+    def __init__(self, capacity):
+        self.capacity = capacity
+        self.entries = collections.deque(maxlen=capacity or 1)
+        self.header = None
+        self.start = 0.0
+        self.dropped = 0
+
+    def begin(self, device, total):
+        self.entries.clear()
+        self.dropped = 0
+        self.start = time.monotonic()
+        # the emulator writes every fragment as it arrives, like a write chunk of 0
+        self.header = {"mode": TRACE_MODES.get(device.mode, 0), "chip": device.chip,
+                       "mhz": CHIPS[device.chip]["mhz"], "chunk": 0, "total": total, "result": 0}
+
+    def add(self, index, length, started, latency, flags=0):
+        if not self.capacity or self.header is None:
+            return
+        if len(self.entries) == self.capacity:
+            self.dropped += 1
+        self.entries.append((int((started - self.start) * 1e6), index, min(length, 0xFFFF), flags, int(latency * 1e6)))
+
+    def finish(self, ok):
+        if self.header is not None and self.header["result"] == 0:
+            self.header["result"] = 1 if ok else 2
+
+    def to_bytes(self):
+        h = self.header or {"mode": 0, "chip": "", "mhz": 0, "chunk": 0, "total": 0, "result": 0}
+        data = TRACE_HEADER.pack(b"EOTR" if self.header else b"\0" * 4, 1 if self.header else 0, h["mode"], h["result"], 0,
+                                 h["chip"].encode(), h["mhz"], h["chunk"], h["total"], len(self.entries), self.dropped)
+        return data + b"".join(TRACE_ENTRY.pack(*e) for e in self.entries)
+
+
+class TaskQueue:
+    """Lock granted in arrival order, like the event queue of the AsyncTCP task."""
+
+    def __init__(self):
+        self.cond = threading.Condition()
+        self.next_ticket = 0
+        self.serving = 0
+
+    def __enter__(self):
+        with self.cond:
+            ticket = self.next_ticket
+            self.next_ticket += 1
+            while self.serving != ticket:
+                self.cond.wait()
+
+    def __exit__(self, *exc):
+        with self.cond:
+            self.serving += 1
+            self.cond.notify_all()
+
+
+class BundleWriter:
+    """Update bundle (scripts/bundle_firmware.py) split onto the partitions, mirrors src/ElegantOTABundle.cpp.
+
+    The firmware only becomes the boot image once every section was committed, a
+    filesystem section that fails leaves the partition written up to that point."""
+
+    HEADER = struct.Struct("<4sBB2x")
+    SECTION = struct.Struct("<B3xI16s")
+
+    def __init__(self, device):
+        self.device = device
+        self.size = CHIPS[device.chip]["app"] + CHIPS[device.chip]["fs"] + 256
+        self.pending = b""
+        self.count = None
+        self.sections = []
+        self.partition = None
+        self.remaining = 0
+        self.header = bytearray()
+        self.error = None
+        self.busy_seconds = 0.0
+        self.path = None
+        self.received = 0
+        self.meter = RateMeter()
+
+    def _begin_section(self, section_type, size, md5):
+        dev = self.device
+        name = {1: "fr", 2: "fs"}.get(section_type)
+        if name is None:
+            return "Unknown bundle section"
+        if not self.sections and name != "fr":
+            return "Bundle must start with the firmware"
+        if name in self.sections:
+            return "Duplicate bundle section"
+        if size > CHIPS[dev.chip]["app" if name == "fr" else "fs"]:
+            return "Not Enough Space"
+        self.sections.append(name)
+        self.partition = FlashPartition(os.path.join(dev.flash_dir, f"{dev.port}-{name}.bin"), size, dev.chip, dev.time_scale)
+        self.partition.begin(md5.hex())
+        self.remaining = size
+        self.header.clear()
+        if name == "fr":
+            self.path = self.partition.path
+        return None
+
+    def _end_section(self):
+        part, self.partition = self.partition, None
+        if self.sections[-1] == "fr" and len(self.header) < 112:
+            error = check_image(bytes(self.header), self.device.chip)
+            if error:
+                part.abort()
+                return error
+        ok = part.end()
+        self.busy_seconds += part.busy_seconds
+        if self.path is None:
+            self.path = part.path
+        return None if ok else part.error
+
+    def write(self, data):
+        if self.error:
+            return 0
+        total = len(data)
+        data = memoryview(data)
+        while len(data):
+            if self.count is None or (self.partition is None and len(self.sections) < self.count):
+                need = self.HEADER.size if self.count is None else self.SECTION.size
+                take = need - len(self.pending)
+                self.pending += bytes(data[:take])
+                data = data[take:]
+                if len(self.pending) < need:
+                    break
+                if self.count is None:
+                    magic, version, self.count = self.HEADER.unpack(self.pending)
+                    if magic != b"EOTB" or version != 1:
+                        self.error = "Not an update bundle"
+                    elif self.count == 0:
+                        self.error = "Empty bundle"
+                else:
+                    self.error = self._begin_section(*self.SECTION.unpack(self.pending))
+                self.pending = b""
+                if self.error:
+                    return 0
+                continue
+            if self.partition is None:
+                self.error = "Unexpected data after bundle"
+                return 0
+            chunk = data[:self.remaining]
+            data = data[len(chunk):]
+            if self.sections[-1] == "fr" and len(self.header) < 112:
+                self.header += chunk[: 112 - len(self.header)]
+                if len(self.header) >= 112:
+                    self.error = check_image(bytes(self.header), self.device.chip)
+            if self.error or self.partition.write(bytes(chunk)) != len(chunk):
+                self.error = self.error or self.partition.error
+                return 0
+            self.remaining -= len(chunk)
+            if self.remaining == 0:
+                self.error = self._end_section()
+                if self.error:
+                    return 0
+        self.received += total
+        self.meter.progress(self.received)
+        return total
+
+    def end(self):
+        if not self.error and (self.count is None or len(self.sections) < self.count or self.partition is not None):
+            self.error = "Bundle incomplete"
+        return self.error is None
+
+    def abort(self):
+        if self.partition is not None:
+            self.partition.abort()
+        self.error = self.error or "Aborted"
+
+
+class MulticastReceiver:
+    """Multicast receive of one device, mirrors src/ElegantOTABlocks.cpp and src/ElegantOTAMulticast.cpp.
+
+    Datagrams pass a bounded queue like the lwIP receive mailbox and are written by a
+    second thread standing in for loop(), out of order at their offset, a sector erased
+    when its first block arrives. loss drops every datagram with that probability."""
+
+    def __init__(self, device, query, interface=None, loss=0.0):
+        self.device = device
+        self.size = int(query.get("size") or 0)
+        self.md5 = (query.get("hash") or "").lower()
+        self.group = query.get("group", "239.255.51.51")
+        self.port = int(query.get("port", 3233))
+        self.transfer_id = int(query.get("id", 0))
+        self.block = int(query.get("block", MCAST_MAX_BLOCK))
+        self.k = int(query.get("k", 8))
+        if self.size == 0:
+            raise ValueError("Image size missing")
+        if not re.fullmatch(r"[0-9a-f]{32}", self.md5):
+            raise ValueError("MD5 parameter invalid")
+        try:
+            first_octet = int(socket.inet_aton(self.group)[0])
+        except OSError:
+            first_octet = 0
+        if not 224 <= first_octet <= 239:
+            raise ValueError("Invalid multicast group")
+        if not 0 <= self.k <= 64:
+            raise ValueError("Invalid parity group")
+        if self.block < 256 or self.block > MCAST_MAX_BLOCK or self.block % 16 or SECTOR % self.block:
+            raise ValueError("Invalid block size")
+        if (self.size + SECTOR - 1) // SECTOR * SECTOR > CHIPS[device.chip]["app"]:
+            raise ValueError("Not enough space")
+        self.blocks = (self.size + self.block - 1) // self.block
+        self.have = bytearray(self.blocks)
+        self.missing = self.blocks
+        self.recovered = 0
+        self.erased = set()
+        self.parity = [None] * MCAST_FEC_SLOTS
+        self.error = None
+        self.busy_seconds = 0.0
+        self.overflows = 0
+        self.verifying = False
+        self.received = 0
+        self.meter = RateMeter()
+        self.timing = CHIPS[device.chip]
+        self.path = os.path.join(device.flash_dir, f"{device.port}-fr.bin")
+        self.file = open(self.path, "w+b")
+        self.file.truncate((self.size + SECTOR - 1) // SECTOR * SECTOR)
+        self.rng = random.Random(device.port)
+        self.loss = loss
+        self.queue = queue.Queue(MCAST_RX_QUEUE.get(device.chip, MCAST_RX_QUEUE_DEFAULT))
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.sock.bind((self.group, self.port))
+        self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP,
+                             socket.inet_aton(self.group) + socket.inet_aton(interface or device.host))
+        self.sock.settimeout(0.2)
+        self.running = True
+        threading.Thread(target=self._receive, daemon=True).start()
+        threading.Thread(target=self._poll, daemon=True).start()
+
+    def _receive(self):
+        while self.running:
+            try:
+                packet = self.sock.recv(MCAST_HEADER.size + MCAST_MAX_BLOCK + 64)
+            except socket.timeout:
+                continue
+            except OSError:
+                return
+            if self.loss and self.rng.random() < self.loss:
+                continue
+            try:
+                self.queue.put_nowait(packet)
+            except queue.Full:
+                self.overflows += 1
+
+    def _poll(self):
+        """pollMulticast() in loop(), a failed block or a timed out session ends the session."""
+        dev = self.device
+        while self.running:
+            if self.verifying:
+                return self._verify()
+            try:
+                packet = self.queue.get(timeout=0.2)
+            except queue.Empty:
+                if dev.session_stale() and dev.partition is self:
+                    with dev.lock:
+                        self.error = self.error or "OTA session timed out"
+                        dev.error = self.error
+                        dev.close_session(True)
+                        dev.stats["failures"] += 1
+                continue
+            if len(packet) < MCAST_HEADER.size:
+                continue
+            magic, kind, _, transfer_id, index = MCAST_HEADER.unpack_from(packet)
+            if magic != b"EOTM" or transfer_id != self.transfer_id or self.error:
+                continue
+            dev.session_activity = time.monotonic()
+            payload = packet[MCAST_HEADER.size:]
+            if kind == 0:
+                self.data(index, payload)
+            elif kind == 1:
+                self.repair(index, payload)
+            if self.error and dev.partition is self:
+                with dev.lock:
+                    dev.error = self.error
+                    dev.close_session(True)
+                    dev.stats["failures"] += 1
+
+    def _verify(self):
+        """verifyMulticast() in loop(), the image is read back and checked after /ota/multicast/finish."""
+        dev = self.device
+        error = self.error or self.commit()
+        with dev.lock:
+            if dev.partition is not self:
+                return
+            dev.close_session(bool(error), error)
+            dev.stats["flash_seconds"] += self.busy_seconds
+            if error:
+                dev.error = error
+                dev.stats["failures"] += 1
+                return
+            dev.stats["uploads"] += 1
+            dev.mcast_committed = self.path
+
+    def block_len(self, index):
+        return self.block if index + 1 < self.blocks else self.size - index * self.block
+
+    def data(self, index, payload):
+        if index >= self.blocks or len(payload) != self.block_len(index) or self.have[index]:
+            return
+        self.write_block(index, payload)
+        if self.k and not self.error:
+            self.recover(index // self.k)
+
+    def repair(self, group, payload):
+        if not self.k or len(payload) != self.block or group * self.k >= self.blocks:
+            return
+        slot = group % MCAST_FEC_SLOTS
+        if self.parity[slot] is not None and self.parity[slot][0] == group:
+            return
+        self.parity[slot] = (group, payload)
+        self.recover(group)
+
+    def recover(self, group):
+        slot = group % MCAST_FEC_SLOTS
+        if self.parity[slot] is None or self.parity[slot][0] != group:
+            return
+        first, last = group * self.k, min(group * self.k + self.k, self.blocks)
+        lost = [i for i in range(first, last) if not self.have[i]]
+        if len(lost) > 1:
+            return
+        parity = self.parity[slot][1]
+        self.parity[slot] = None
+        if not lost:
+            return
+        # the lost block is the parity XOR all other blocks of the group, read back from flash
+        value = int.from_bytes(parity, "little")
+        for i in range(first, last):
+            if i != lost[0]:
+                self.file.seek(i * self.block)
+                value ^= int.from_bytes(self.file.read(self.block_len(i)).ljust(self.block, b"\0"), "little")
+        self.recovered += 1
+        self.write_block(lost[0], value.to_bytes(self.block, "little")[:self.block_len(lost[0])])
+
+    def write_block(self, index, payload):
+        if index == 0:
+            self.error = check_image(bytes(payload[:112]), self.device.chip)
+            if self.error:
+                return
+        offset = index * self.block
+        cost = (len(payload) + PAGE - 1) // PAGE * self.timing["page_us"] / 1e6
+        if offset // SECTOR not in self.erased:
+            self.erased.add(offset // SECTOR)
+            cost += self.timing["erase_ms"] / 1000
+        self.busy_seconds += cost
+        if self.device.time_scale:
+            time.sleep(cost * self.device.time_scale)
+        self.file.seek(offset)
+        self.file.write(payload)
+        self.have[index] = 1
+        self.missing -= 1
+        self.received += len(payload)
+        self.meter.progress(self.received)
+
+    def status(self):
+        ranges = []
+        i = self.have.find(0)
+        while i >= 0 and len(ranges) < MCAST_MAX_RANGES:
+            end = self.have.find(1, i)
+            end = self.blocks if end < 0 else end
+            ranges.append([i, end - 1])
+            i = self.have.find(0, end)
+        return {"blocks": self.blocks, "missing": self.missing, "recovered": self.recovered,
+                "ranges": ranges, "truncated": i >= 0}
+
+    def commit(self):
+        """MD5 of what the flash holds, returns an error or None."""
+        self.file.seek(0)
+        if hashlib.md5(self.file.read(self.size)).hexdigest() != self.md5:
+            return "MD5 Check Failed"
+        return None
+
+    def stop(self):
+        self.running = False
+        self.sock.close()
+        self.file.close()
+
+    def abort(self):
+        self.stop()
+        self.error = self.error or "Aborted"
+
+
+class Prefetch:
+    """Background prefetch of one device, mirrors src/ElegantOTAPrefetch.cpp and src/ElegantOTARateLimiter.cpp.
+
+    A thread stands in for the slices in loop(): it reads what the token bucket allows
+    from a Range request, writes whole blocks and saves the progress every PREFETCH_SAVE
+    bytes to a state file next to the flash files. A device started again with the same
+    port and flash_dir resumes from it. The CPU share is not modelled."""
+
+    STATES = ("idle", "downloading", "verifying", "staged", "failed")
+
+    def __init__(self, device, url, md5, rate, size=0, done=0, state="downloading"):
+        self.device = device
+        self.url = url
+        self.md5 = md5.lower()
+        self.rate = rate
+        self.size = size
+        self.done = done
+        self.state = state
+        self.error = ""
+        self.requests = 0
+        self.path = os.path.join(device.flash_dir, f"{device.port}-fr.bin")
+        self.state_path = os.path.join(device.flash_dir, f"{device.port}-prefetch.json")
+        self.credit = self.capacity()
+        self.refilled = time.monotonic()
+        self.running = True
+        self.response = None
+        self.save()
+        threading.Thread(target=self._run, daemon=True).start()
+
+    @classmethod
+    def load(cls, device):
+        path = os.path.join(device.flash_dir, f"{device.port}-prefetch.json")
+        try:
+            with open(path) as f:
+                saved = json.load(f)
+        except (OSError, ValueError):
+            return None
+        state = "staged" if saved["staged"] else "verifying" if saved["size"] and saved["done"] == saved["size"] else "downloading"
+        return cls(device, saved["url"], saved["hash"], saved["rate"], saved["size"], saved["done"], state)
+
+    def save(self):
+        # a reboot continues at the last sector boundary
+        done = self.done if self.done == self.size else self.done // SECTOR * SECTOR
+        with open(self.state_path, "w") as f:
+            json.dump({"url": self.url, "hash": self.md5, "size": self.size, "done": done, "rate": self.rate,
+                       "staged": self.state == "staged"}, f)
+
+    def capacity(self):
+        return max(self.rate // 4, 1024)
+
+    def allowance(self):
+        """Token bucket of ElegantOTARateLimiter, at most a quarter second of the rate."""
+        if not self.rate:
+            return 1 << 20
+        now = time.monotonic()
+        self.credit = min(self.credit + (now - self.refilled) * self.rate, self.capacity())
+        self.refilled = now
+        return int(self.credit) if self.credit >= 256 else 0
+
+    def status(self):
+        return {"state": self.state, "size": self.size, "done": self.done, "rate": self.rate, "error": self.error}
+
+    def _run(self):
+        dev = self.device
+        while self.running and self.state in ("downloading", "verifying"):
+            if dev.session is not None:
+                # a session writing firmware overwrites the partition, other sessions only pause the prefetch
+                if dev.mode not in ("fs", "files"):
+                    self.cancel()
+                    return
+                time.sleep(0.05)
+                continue
+            if self.state == "verifying":
+                self._verify()
+                continue
+            if self.response is None and not self._connect():
+                continue
+            allowance = self.allowance()
+            if not allowance:
+                time.sleep(0.01)
+                continue
+            index = self.done // PREFETCH_BLOCK
+            length = min(PREFETCH_BLOCK, self.size - self.done)
+            try:
+                block = self.response.read(length)
+            except OSError:
+                block = b""
+            if len(block) != length:
+                self._retry("Connection closed")
+                continue
+            self.credit -= length
+            if index == 0:
+                error = check_image(block[:112], dev.chip)
+                if error:
+                    self.fail(error)
+                    return
+            self._write(self.done, block)
+            self.done += length
+            if self.done == self.size:
+                self._close()
+                self.state = "verifying"
+                self.save()
+            elif self.done // PREFETCH_SAVE != (self.done - length) // PREFETCH_SAVE:
+                self.save()
+
+    def _connect(self):
+        request = urllib.request.Request(self.url)
+        if self.done:
+            request.add_header("Range", f"bytes={self.done}-")
+        self.requests += 1
+        try:
+            response = urllib.request.urlopen(request, timeout=10)
+        except urllib.error.HTTPError as e:
+            self._retry(f"Download failed with {e.code}")
+            return False
+        except OSError:
+            self._retry("Download failed with -1")
+            return False
+        if response.status == 206 and self.done:
+            total = int(response.headers.get("Content-Range", "/0").rpartition("/")[2] or 0)
+        else:
+            # the server ignores Range, the prefetch starts over
+            self.done = 0
+            total = int(response.headers.get("Content-Length") or 0)
+        if not total:
+            response.close()
+            self.fail("Image size unknown")
+            return False
+        if self.size and total != self.size:
+            response.close()
+            self.fail("Image on the server changed")
+            return False
+        if total > CHIPS[self.device.chip]["app"]:
+            response.close()
+            self.fail("Not enough space")
+            return False
+        if not self.size:
+            with open(self.path, "wb") as f:
+                f.truncate((total + SECTOR - 1) // SECTOR * SECTOR)
+        self.size = total
+        self.response = response
+        return True
+
+    def _write(self, offset, data):
+        timing = CHIPS[self.device.chip]
+        cost = (len(data) + PAGE - 1) // PAGE * timing["page_us"] / 1e6
+        if offset % SECTOR == 0:
+            cost += timing["erase_ms"] / 1000
+        if self.device.time_scale:
+            time.sleep(cost * self.device.time_scale)
+        with open(self.path, "r+b") as f:
+            f.seek(offset)
+            f.write(data)
+
+    def _verify(self):
+        with open(self.path, "rb") as f:
+            digest = hashlib.md5(f.read(self.size)).hexdigest()
+        if digest != self.md5:
+            self.fail("MD5 Check Failed")
+            return
+        self.state = "staged"
+        self.save()
+
+    def _retry(self, reason):
+        self.error = reason
+        self._close()
+        self.save()
+        deadline = time.monotonic() + PREFETCH_RETRY * (self.device.time_scale or 0.01)
+        while self.running and time.monotonic() < deadline:
+            time.sleep(0.05)
+
+    def _close(self):
+        if self.response is not None:
+            self.response.close()
+            self.response = None
+
+    def fail(self, reason):
+        self.cancel()
+        self.error = reason
+        self.state = "failed"
+
+    def cancel(self):
+        self.running = False
+        self._close()
+        if os.path.exists(self.state_path):
+            os.remove(self.state_path)
+        self.state = "idle"
+
+    def apply(self):
+        """applyStaged(): only the boot switch and the reboot are left."""
+        if self.state != "staged":
+            return False
+        os.remove(self.state_path)
+        self.state = "idle"
+        dev = self.device
+        with dev.lock:
+            dev.mode = "fr"
+            dev.stats["uploads"] += 1
+            dev.reboot(self.path)
+        return True
+
+    def stop(self):
+        """Power off: the thread ends, the state file stays."""
+        self.running = False
+        self._close()
+
+
+class EmulatedDevice:
+    def __init__(self, chip="ESP32", port=8080, host="127.0.0.1", flash_dir=None, time_scale=1.0,
+                 username="", password="", info=None, reboot_delay=REBOOT_DELAY, boot_fail=False,
+                 peer_lookup=None, peer_rate=PEER_TX_RATE, ota_port=None, quiesce=False, app_cost=APP_COST,
+                 tcp_port=None, mcast_loss=0.0, mcast_interface=None, trace=0):
+        if chip not in CHIPS:
+            raise ValueError(f"unknown chip family {chip}")
+        self.chip = chip
+        self.host = host
+        self.port = port
+        self.username = username
+        self.password = password
+        self.time_scale = time_scale
+        self.reboot_delay = reboot_delay
+        self.boot_fail = boot_fail
+        # stand-in for the mDNS query of pull(): returns dicts with url, chip, variant, version
+        self.peer_lookup = peer_lookup
+        self.peer_rate = peer_rate
+        self.peer_downloads = 0
+        self.pulled_from = None
+        # ElegantOTA.begin(port): OTA endpoints on their own listener, the application keeps port
+        self.ota_port = ota_port
+        self.quiesce = quiesce
+        # AsyncTCP runs every server in one task: upload data and application handlers take turns
+        self.tcp_task = TaskQueue()
+        self.app_cost = app_cost
+        self.app_requests = 0
+        # ElegantOTA.enableTcpUpload(port)
+        self.tcp_port = tcp_port
+        self.tcp_server = None
+        self.tcp_connection = threading.Lock()
+        # multicast receive: drop probability per datagram and interface of the group membership
+        self.mcast_loss = mcast_loss
+        self.mcast_interface = mcast_interface
+        self.prefetch = None
+        self.flash_dir = flash_dir or tempfile.mkdtemp(prefix="elegantota-")
+        self.history_path = os.path.join(self.flash_dir, f"{port}-history.json")
+        self.history = []
+        # ElegantOTA.enableTrace(entries), 0 leaves /ota/trace.bin off
+        self.trace = Trace(trace)
+        self.info = {"owner": "", "repository": "", "branch": "", "build": 0,
+                     "FWVersion": "1.0.0", "HwId": f"emu-{port}", "FWVariant": ""}
+        self.info.update(info or {})
+        self.lock = threading.Lock()
+        self.session = None
+        self.session_client = None
+        self.session_activity = 0.0
+        self.session_opened = 0.0
+        self.session_md5 = ""
+        self.session_tcp = None
+        # files to upload and delete of the last /ota/fs/manifest, and the client of a dry run
+        self.sync_plan = None
+        self.sync_plan_client = None
+        self.mode = "fr"
+        self.error = ""
+        self.partition = None
+        self.rebooting_until = 0.0
+        self.running_image = None
+        # multicast image that passed the check in the receive loop, booted once the sender polled the result
+        self.mcast_committed = None
+        self.stats = {"uploads": 0, "failures": 0, "rejected_busy": 0, "flash_seconds": 0.0}
+        self.nonce = uuid.uuid4().hex
+        self.server = None
+        self.ota_server = None
+
+    # -- lifecycle ---------------------------------------------------------------
+
+    def start(self):
+        device = self
+
+        class Handler(DeviceRequestHandler):
+            serves_ota = self.ota_port is None
+
+        Handler.device = device
+        self.server = ThreadingServer((self.host, self.port), Handler)
+        self.port = self.server.server_address[1]
+        threading.Thread(target=self.server.serve_forever, daemon=True).start()
+        if self.ota_port is not None:
+            class OtaHandler(DeviceRequestHandler):
+                serves_app = False
+
+            OtaHandler.device = device
+            self.ota_server = ThreadingServer((self.host, self.ota_port), OtaHandler)
+            self.ota_port = self.ota_server.server_address[1]
+            threading.Thread(target=self.ota_server.serve_forever, daemon=True).start()
+        if self.tcp_port is not None:
+            class TcpHandler(RawUploadHandler):
+                pass
+
+            TcpHandler.device = device
+            self.tcp_server = RawUploadServer((self.host, self.tcp_port), TcpHandler)
+            self.tcp_port = self.tcp_server.server_address[1]
+            threading.Thread(target=self.tcp_server.serve_forever, daemon=True).start()
+        self.prefetch = Prefetch.load(self)
+        self.history_path = os.path.join(self.flash_dir, f"{self.port}-history.json")
+        try:
+            with open(self.history_path) as f:
+                self.history = json.load(f)
+        except (OSError, ValueError):
+            self.history = []
+        return self
+
+    def stop(self):
+        if self.prefetch is not None:
+            self.prefetch.stop()
+        for server in (self.server, self.ota_server, self.tcp_server):
+            if server:
+                server.shutdown()
+                server.server_close()
+
+    @property
+    def url(self):
+        """Url of the OTA endpoints."""
+        return f"http://{self.host}:{self.ota_port if self.ota_port is not None else self.port}"
+
+    @property
+    def app_url(self):
+        return f"http://{self.host}:{self.port}"
+
+    def device_info(self):
+        info = dict(self.info)
+        info["chipfamily"] = self.chip
+        return info
+
+    # -- session handling, mirrors ElegantOTAClass -------------------------------
+
+    def session_stale(self):
+        return self.session is not None and time.monotonic() - self.session_activity > SESSION_TIMEOUT
+
+    def session_owner(self, handler):
+        if self.session is None:
+            return False
+        token = handler.headers.get("X-OTA-Session") or handler.query.get("session")
+        if token:
+            return token == self.session
+        return handler.client_address[0] == self.session_client
+
+    def session_busy(self, handler):
+        return self.session is not None and not self.session_stale() and not self.session_owner(handler)
+
+    def retry_after(self):
+        idle = time.monotonic() - self.session_activity
+        return int(max(SESSION_TIMEOUT - idle, 0)) + 1
+
+    def open_partition(self, md5):
+        size = CHIPS[self.chip]["app" if self.mode == "fr" else "fs"]
+        self.partition = FlashPartition(os.path.join(self.flash_dir, f"{self.port}-{self.mode}.bin"), size, self.chip, self.time_scale)
+        self.partition.begin(md5.lower() if md5 else None)
+
+    def parse_cost(self, length):
+        """Time the AsyncTCP task spends in the multipart parser for length bytes."""
+        if self.time_scale:
+            with self.tcp_task:
+                time.sleep(length * MULTIPART_CYCLES / (CHIPS[self.chip]["mhz"] * 1e6) * self.time_scale)
+
+    def open_session(self, client, md5=None, tcp_client=None):
+        """client owns the session over HTTP, None for pull() and the raw TCP upload (tcp_client)."""
+        self.session = uuid.uuid4().hex[:16]
+        self.session_client = client
+        self.session_tcp = tcp_client
+        self.session_activity = self.session_opened = time.monotonic()
+        self.session_md5 = (md5 or "").lower()
+        self.sync_plan = self.sync_plan_client = None
+        self.mcast_committed = None
+
+    def close_session(self, abort, error=None):
+        if self.session is not None:
+            self.record_history(abort, self.error if error is None else error)
+        self.trace.finish(not abort)
+        if abort and self.partition is not None:
+            self.partition.abort()
+        elif isinstance(self.partition, MulticastReceiver):
+            self.partition.stop()
+        self.session = None
+        self.session_client = None
+        self.sync_plan = self.sync_plan_client = None
+
+    def record_history(self, abort, error):
+        """History record of the session, mirrors ElegantOTAClass::recordHistory() and saveHistory()."""
+        part = self.partition
+        size = getattr(part, "received", 0)
+        duration = int((time.monotonic() - self.session_opened) * 1000)
+        # the filesystem holding the history may have been replaced, the record stays in RAM
+        replaced = self.mode == "fs" or (self.mode == "bundle" and "fs" in getattr(part, "sections", []))
+        entry = {"seq": 0, "time": int(time.time()), "mode": HISTORY_MODES[self.mode],
+                 "result": "ok" if not abort else "failed" if error else "aborted",
+                 "size": size, "duration": duration, "avg_rate": size * 1000 // max(duration, 1),
+                 "min_rate": part.meter.min_rate if part is not None else 0, "md5": self.session_md5,
+                 "client": self.session_tcp or self.session_client or "pull", "version": self.info["FWVersion"],
+                 "error": (error or "")[:31], "code": 0, "profile": True, "tcp": self.session_tcp is not None,
+                 "saved": not replaced}
+        saved = [e for e in self.history if e["saved"]]
+        held = [e for e in self.history if not e["saved"]]
+        entry["seq"] = (saved[0]["seq"] + 1) if saved else 0
+        if replaced:
+            held = [entry]
+        else:
+            # a held record is written first
+            for e in held:
+                e["seq"], e["saved"] = entry["seq"], True
+                entry["seq"] += 1
+            saved = [entry] + held + saved
+            held = []
+            saved = saved[:HISTORY_LEN]
+            with open(self.history_path, "w") as f:
+                json.dump(saved, f)
+        self.history = held + saved
+
+    def reboot(self, image_path):
+        self.rebooting_until = time.monotonic() + self.reboot_delay * (self.time_scale or 0)
+        if self.boot_fail:
+            # the new image does not boot, the bootloader falls back to the old one
+            return
+        self.running_image = image_path
+        with open(image_path, "rb") as f:
+            header = f.read(112)
+        if self.mode in ("fr", "bundle", "multicast") and len(header) >= 112 and struct.unpack_from("<I", header, 32)[0] == APP_DESC_MAGIC:
+            self.info["FWVersion"] = header[48:80].split(b"\0")[0].decode(errors="replace")
+
+    # -- pull(), mirrors src/ElegantOTAPeer.cpp ------------------------------------
+
+    def pull(self, url, md5, version):
+        with self.lock:
+            if self.session is not None and not self.session_stale():
+                return False
+            self.close_session(True)
+            self.mode = "fr"
+            self.error = ""
+            self.open_session(None, md5)
+        threading.Thread(target=self.run_pull, args=(url, md5, version), daemon=True).start()
+        return True
+
+    def run_pull(self, url, md5, version):
+        started = time.monotonic()
+        retry = max(PULL_RETRY * (self.time_scale or 0), 0.05)
+        result = "failed"
+        # peers are only asked with a hash to check their image against, the url is trusted without one
+        while md5:
+            self.session_activity = time.monotonic()
+            peers = [p for p in (self.peer_lookup() if self.peer_lookup else [])
+                     if p["url"] != self.url and p.get("chip") == self.chip
+                     and p.get("variant", "") == self.info["FWVariant"] and (not version or p.get("version") == version)]
+            busy = False
+            result = "failed"
+            for peer in peers:
+                result = self.fetch(peer["url"] + "/ota/self.bin", md5, version, True)
+                if result == "ok":
+                    self.pulled_from = "peer"
+                    break
+                busy = busy or result == "busy"
+            if result == "ok" or not busy or time.monotonic() - started > PULL_PEER_WAIT:
+                break
+            time.sleep(retry)
+        if result != "ok":
+            result = self.fetch(url, md5, version, False)
+            self.pulled_from = "origin"
+        with self.lock:
+            self.close_session(result != "ok")
+            if result != "ok":
+                self.stats["failures"] += 1
+                return
+            self.stats["uploads"] += 1
+            self.reboot(self.partition.path)
+
+    def fetch(self, url, md5, version, peer):
+        request = urllib.request.Request(url)
+        try:
+            response = urllib.request.urlopen(request, timeout=10)
+        except urllib.error.HTTPError as e:
+            if e.code == 503 and peer:
+                return "busy"
+            self.error = f"Download failed with {e.code}"
+            return "failed"
+        except OSError as e:
+            self.error = f"Download failed: {e}"
+            return "failed"
+        with response:
+            headers = response.headers
+            if peer and (headers.get("X-Chip-Family") != self.chip or headers.get("X-FW-Variant", "") != self.info["FWVariant"]
+                         or (version and headers.get("X-FW-Version") != version)
+                         or (headers.get("X-Image-MD5") or "").lower() != md5.lower()):
+                return "mismatch"
+            size = CHIPS[self.chip]["app"]
+            self.partition = FlashPartition(os.path.join(self.flash_dir, f"{self.port}-fr.bin"), size, self.chip, self.time_scale)
+            self.partition.begin(md5.lower() if md5 else None)
+            header = b""
+            try:
+                while True:
+                    chunk = response.read(4096)
+                    if not chunk:
+                        break
+                    self.session_activity = time.monotonic()
+                    if len(header) < 112:
+                        header += chunk[:112 - len(header)]
+                        if len(header) == 112:
+                            error = check_image(header, self.chip)
+                            if error:
+                                self.error = error
+                                self.partition.abort()
+                                return "failed"
+                    if self.partition.write(chunk) != len(chunk):
+                        self.error = self.partition.error
+                        return "failed"
+            except OSError as e:
+                self.partition.abort()
+                self.error = f"Download interrupted: {e}"
+                return "failed"
+        if not self.partition.end():
+            self.error = self.partition.error
+            return "failed"
+        return "ok"
+
+
+class ThreadingServer(socketserver.ThreadingMixIn, http.server.HTTPServer):
+    daemon_threads = True
+    allow_reuse_address = True
+    request_queue_size = 64
+
+
+class DeviceRequestHandler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    device = None
+    # routes of the application (/api) and of ElegantOTA, both on a shared server
+    serves_app = True
+    serves_ota = True
+
+    def log_message(self, *args):
+        pass
+
+    # -- helpers -------------------------------------------------------------------
+
+    def reply(self, code, body="", content_type="text/plain", headers=None, close=False):
+        data = body.encode() if isinstance(body, str) else body
+        self.send_response(code)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(data)))
+        for key, value in (headers or {}).items():
+            self.send_header(key, value)
+        if close:
+            self.send_header("Connection", "close")
+            self.close_connection = True
+        self.end_headers()
+        self.wfile.write(data)
+
+    def parse(self):
+        path, _, query = self.path.partition("?")
+        self.route = path
+        self.query = dict(p.split("=", 1) if "=" in p else (p, "") for p in query.split("&") if p)
+
+    def authenticated(self):
+        dev = self.device
+        if not (dev.username and dev.password):
+            return True
+        value = self.headers.get("Authorization", "")
+        if value.startswith("Basic "):
+            return base64.b64decode(value[6:]).decode(errors="replace") == f"{dev.username}:{dev.password}"
+        if value.startswith("Digest "):
+            params = dict((k.strip().lower(), v.strip().strip('"'))
+                          for k, v in (p.split("=", 1) for p in re.split(r",\s*(?=\w+=)", value[7:]) if "=" in p))
+            md5 = lambda s: hashlib.md5(s.encode()).hexdigest()
+            ha1 = md5(f"{dev.username}:{params.get('realm', '')}:{dev.password}")
+            ha2 = md5(f"{self.command}:{params.get('uri', '')}")
+            if "qop" in params:
+                expected = md5(f"{ha1}:{params.get('nonce')}:{params.get('nc')}:{params.get('cnonce')}:{params.get('qop')}:{ha2}")
+            else:
+                expected = md5(f"{ha1}:{params.get('nonce')}:{ha2}")
+            return params.get("username") == dev.username and params.get("response") == expected
+        return False
+
+    def require_auth(self):
+        self.drain()
+        self.reply(401, "", headers={"WWW-Authenticate": f'Digest realm="Login Required", qop="auth", nonce="{self.device.nonce}", opaque="{uuid.uuid4().hex}"'})
+
+    def drain(self):
+        remaining = int(self.headers.get("Content-Length") or 0)
+        while remaining > 0:
+            chunk = self.rfile.read(min(remaining, 65536))
+            if not chunk:
+                break
+            remaining -= len(chunk)
+
+    def offline(self):
+        if time.monotonic() < self.device.rebooting_until:
+            # a rebooting device does not answer at all
+            self.close_connection = True
+            return True
+        return False
+
+    # -- routes --------------------------------------------------------------------
+
+    def do_GET(self):
+        if self.offline():
+            return
+        self.parse()
+        # /ota/self.bin is open to every device, pulling devices send no credentials
+        if self.route != "/ota/self.bin" and not self.authenticated():
+            return self.require_auth()
+        handler = getattr(self, "get_" + self.route.strip("/").replace("/", "_").replace(".", "_"), None)
+        if handler is None or not (self.serves_app if self.route == "/api" else self.serves_ota):
+            return self.reply(404, "Not found")
+        handler()
+
+    def do_POST(self):
+        if self.offline():
+            return
+        self.parse()
+        if not self.authenticated():
+            return self.require_auth()
+        handler = getattr(self, "post_" + self.route.strip("/").replace("/", "_").replace(".", "_"), None)
+        if handler is None or not self.serves_ota:
+            self.drain()
+            return self.reply(404, "Not found")
+        handler()
+
+    def get_api(self):
+        """Stand-in for an application route, busies the AsyncTCP task for app_cost seconds."""
+        dev = self.device
+        if dev.quiesce and dev.ota_port is not None and dev.session is not None:
+            # setQuiesceServer(): the application's listener is closed during the session
+            self.close_connection = True
+            return
+        with dev.tcp_task:
+            if dev.app_cost:
+                time.sleep(dev.app_cost)
+            dev.app_requests += 1
+        self.reply(200, '{"ok":true}', "application/json")
+
+    def get_update(self):
+        try:
+            with open(UI_HTML, "rb") as f:
+                html = gzip.compress(f.read())
+        except OSError:
+            html = gzip.compress(b"<html><body>ElegantOTA emulator</body></html>")
+        self.reply(200, html, "text/html", {"Content-Encoding": "gzip"})
+
+    def get_getdeviceinfo(self):
+        self.reply(200, json.dumps(self.device.device_info()), "application/json",
+                   {"Cache-Control": "no-cache, no-store, must-revalidate"})
+
+    def get_ota_start(self):
+        dev = self.device
+        with dev.lock:
+            if dev.session_busy(self):
+                dev.stats["rejected_busy"] += 1
+                return self.reply(409, "Another OTA session is in progress", headers={"Retry-After": str(dev.retry_after())})
+            if dev.session is not None:
+                dev.close_session(True)
+            dev.error = ""
+            md5 = self.query.get("hash")
+            if md5 is not None and not re.fullmatch(r"[0-9a-fA-F]{32}", md5):
+                return self.reply(400, "MD5 parameter invalid")
+            dev.mode = self.query.get("mode") if self.query.get("mode") in ("fs", "files", "bundle", "multicast") else "fr"
+            if dev.mode == "files":
+                dev.partition = None
+            elif dev.mode == "bundle":
+                dev.partition = BundleWriter(dev)
+            elif dev.mode == "multicast":
+                try:
+                    dev.partition = MulticastReceiver(dev, self.query, dev.mcast_interface, dev.mcast_loss)
+                except ValueError as e:
+                    dev.partition = None
+                    return self.reply(400, str(e))
+            else:
+                dev.open_partition(md5)
+            if "sparse" in self.query:
+                if dev.mode not in ("fr", "fs"):
+                    dev.partition = None
+                    return self.reply(400, "Sparse images are firmware or filesystem images")
+                dev.partition = SparseWriter(dev, dev.partition)
+            dev.open_session(self.client_address[0], md5 if dev.mode != "multicast" else self.query.get("hash"))
+            token = dev.session
+        self.reply(200, "OK", headers={"X-OTA-Session": token})
+
+    def post_ota_upload(self):
+        dev = self.device
+        owner = dev.session_owner(self)
+        length = int(self.headers.get("Content-Length") or 0)
+        part = dev.partition
+        boundary = re.search(r"boundary=([^;]+)", self.headers.get("Content-Type", ""))
+
+        if not owner or boundary is None or part is None:
+            self.drain()
+            if dev.session_busy(self):
+                dev.stats["rejected_busy"] += 1
+                return self.reply(409, "Another OTA session is in progress", headers={"Retry-After": str(dev.retry_after())}, close=True)
+            return self.reply(400, "No session started", close=True)
+
+        if length > part.size + 4096:
+            self.drain()
+            dev.error = f"Image of {length} bytes exceeds partition size {part.size}"
+            dev.close_session(True)
+            dev.stats["failures"] += 1
+            return self.reply(400, dev.error, close=True)
+
+        error = self.receive_multipart(length, boundary.group(1).strip('"').encode(), part)
+        with dev.lock:
+            if not error and not part.end():
+                error = part.error
+            dev.close_session(bool(error), error)
+            dev.stats["flash_seconds"] += part.busy_seconds
+            if error:
+                dev.error = error
+                dev.stats["failures"] += 1
+                return self.reply(400, error + "\n", close=True)
+            dev.stats["uploads"] += 1
+            self.reply(200, "OK", close=True, headers={"Access-Control-Allow-Origin": "*"})
+            dev.reboot(part.path)
+
+    def receive_multipart(self, length, boundary, part, check_header=True):
+        """Stream the file part of a multipart body into the partition, returns an error or None."""
+        dev = self.device
+        # a sparse image is checked once it is expanded
+        check_header = check_header and dev.mode == "fr" and not isinstance(part, SparseWriter)
+        delimiter = b"\r\n--" + boundary
+        pending = b""
+        in_file = False
+        done = False
+        header = bytearray()
+        error = None
+        remaining = length
+        offset = 0
+        while remaining > 0:
+            chunk = self.rfile.read(min(remaining, 1460))
+            if not chunk:
+                return "Connection lost"
+            remaining -= len(chunk)
+            dev.session_activity = time.monotonic()
+            if error or done:
+                continue
+            dev.parse_cost(len(chunk))
+            pending += chunk
+            while not done:
+                if not in_file:
+                    head_end = pending.find(b"\r\n\r\n")
+                    if head_end < 0:
+                        break
+                    part_head = pending[:head_end]
+                    pending = pending[head_end + 4:]
+                    if b"filename=" in part_head:
+                        in_file = True
+                    else:
+                        end = pending.find(delimiter)
+                        if end < 0:
+                            pending = part_head + b"\r\n\r\n" + pending
+                            break
+                        pending = pending[end + 2:]
+                    continue
+                end = pending.find(delimiter)
+                data = pending if end < 0 else pending[:end]
+                if end < 0:
+                    # keep a possible partial delimiter for the next read
+                    keep = len(delimiter)
+                    data, pending = pending[:-keep] if len(pending) > keep else b"", pending[-keep:]
+                else:
+                    pending = b""
+                    done = True
+                if data:
+                    if check_header and len(header) < 112:
+                        header += data[: 112 - len(header)]
+                        if len(header) >= 112 or done:
+                            error = check_image(bytes(header), dev.chip)
+                            if error:
+                                break
+                    if offset == 0:
+                        dev.trace.begin(dev, length)
+                    started = time.monotonic()
+                    with dev.tcp_task:
+                        written = part.write(data)
+                    dev.trace.add(offset, len(data), started, time.monotonic() - started)
+                    offset += len(data)
+                    if written != len(data):
+                        error = part.error or "Failed to write chunked data to free space"
+                        break
+                if end < 0:
+                    break
+        if not error and check_header and len(header) < 112:
+            error = check_image(bytes(header), dev.chip)
+        return error
+
+    # -- file sync mode, see src/ElegantOTAFsSync.cpp ---------------------------------
+
+    def fs_root(self):
+        root = os.path.join(self.device.flash_dir, f"{self.device.port}-files")
+        os.makedirs(root, exist_ok=True)
+        return root
+
+    def fs_path(self):
+        path = unquote(self.query.get("path", ""))
+        if not path.startswith("/") or ".." in path or len(path) >= 60 or path in LIBRARY_FILES:
+            return None
+        return os.path.join(self.fs_root(), path.lstrip("/"))
+
+    def fs_session(self):
+        dev = self.device
+        if dev.session_busy(self):
+            self.drain()
+            self.reply(409, "Another OTA session is in progress", headers={"Retry-After": str(dev.retry_after())})
+            return False
+        if not dev.session_owner(self) or dev.mode != "files":
+            self.drain()
+            self.reply(400, "No file sync session started")
+            return False
+        dev.session_activity = time.monotonic()
+        return True
+
+    def fs_manifest_session(self, post):
+        """A dry run needs no session, see ElegantOTAClass::checkFsManifestRequest()."""
+        dev = self.device
+        dry = "dry" in self.query if post else dev.sync_plan_client == self.client_address[0]
+        if dev.session is None and dry:
+            if dev.session_busy(self):
+                self.drain()
+                self.reply(409, "Another OTA session is in progress", headers={"Retry-After": str(dev.retry_after())})
+                return False
+            return True
+        return self.fs_session()
+
+    def post_ota_fs_manifest(self):
+        if not self.fs_manifest_session(True):
+            return
+        dev = self.device
+        try:
+            wanted = json.loads(self.rfile.read(int(self.headers.get("Content-Length") or 0)))["files"]
+        except (ValueError, KeyError):
+            dev.sync_plan = dev.sync_plan_client = None
+            return self.reply(400, "Invalid manifest")
+        root = self.fs_root()
+        upload = []
+        for entry in wanted:
+            if entry["path"] in LIBRARY_FILES:
+                continue
+            local = os.path.join(root, entry["path"].lstrip("/"))
+            if not os.path.isfile(local) or hashlib.md5(open(local, "rb").read()).hexdigest() != entry.get("md5", "").lower():
+                upload.append(entry["path"])
+        paths = {e["path"] for e in wanted}
+        delete = []
+        for base, _, names in os.walk(root):
+            for name in names:
+                path = "/" + os.path.relpath(os.path.join(base, name), root).replace(os.sep, "/")
+                if path not in paths and path not in LIBRARY_FILES:
+                    delete.append(path)
+        # the device hashes in loop(), the plan is fetched with GET /ota/fs/manifest
+        dev.sync_plan = {"upload": upload, "delete": delete}
+        dev.sync_plan_client = self.client_address[0]
+        self.reply(202, json.dumps({"status": "hashing"}), "application/json")
+
+    def get_ota_fs_manifest(self):
+        if not self.fs_manifest_session(False):
+            return
+        dev = self.device
+        if dev.sync_plan is None:
+            return self.reply(400, "No manifest posted")
+        self.reply(200, json.dumps(dev.sync_plan), "application/json")
+        if dev.session is None:
+            dev.sync_plan = dev.sync_plan_client = None
+
+    def post_ota_fs_file(self):
+        if not self.fs_session():
+            return
+        local = self.fs_path()
+        boundary = re.search(r"boundary=([^;]+)", self.headers.get("Content-Type", ""))
+        if local is None or boundary is None:
+            self.drain()
+            return self.reply(400, "Invalid path")
+        os.makedirs(os.path.dirname(local), exist_ok=True)
+        sink = FileSink(local + ".tmp", self.device.time_scale, self.device.chip)
+        error = self.receive_multipart(int(self.headers.get("Content-Length") or 0),
+                                       boundary.group(1).strip('"').encode(), sink, check_header=False)
+        sink.close()
+        if not error and self.query.get("hash") and sink.md5.hexdigest() != self.query["hash"].lower():
+            error = "MD5 Check Failed"
+        if error:
+            os.remove(local + ".tmp")
+            return self.reply(400, error)
+        os.replace(local + ".tmp", local)
+        self.reply(200, "OK")
+
+    def post_ota_fs_delete(self):
+        if not self.fs_session():
+            return
+        local = self.fs_path()
+        if local is None:
+            return self.reply(400, "Invalid path")
+        if os.path.isfile(local):
+            os.remove(local)
+        self.reply(200, "OK")
+
+    def get_ota_fs_commit(self):
+        if not self.fs_session():
+            return
+        self.device.close_session(False)
+        self.reply(200, "OK")
+
+    # -- multicast receive, see src/ElegantOTAMulticast.cpp -----------------------------
+
+    def multicast_session(self):
+        dev = self.device
+        if dev.session_busy(self):
+            self.reply(409, "Another OTA session is in progress", headers={"Retry-After": str(dev.retry_after())})
+            return None
+        receiver = dev.partition
+        if not dev.session_owner(self) or not isinstance(receiver, MulticastReceiver):
+            self.reply(400, dev.error if dev.mode == "multicast" and dev.error else "No multicast session started")
+            return None
+        dev.session_activity = time.monotonic()
+        return receiver
+
+    def get_ota_multicast_status(self):
+        receiver = self.multicast_session()
+        if receiver is not None:
+            self.reply(200, json.dumps(receiver.status()), "application/json")
+
+    def get_ota_multicast_finish(self):
+        dev = self.device
+        with dev.lock:
+            if dev.mcast_committed and dev.mode == "multicast" and dev.session is None:
+                # the answer leaves before the device reboots into the image
+                path, dev.mcast_committed = dev.mcast_committed, None
+                self.reply(200, "OK", close=True)
+                return dev.reboot(path)
+        receiver = self.multicast_session()
+        if receiver is None:
+            return
+        with dev.lock:
+            if not receiver.verifying:
+                if receiver.missing:
+                    # the session stays open for another repair round
+                    return self.reply(400, f"{receiver.missing} blocks missing")
+                receiver.verifying = True
+            self.reply(202, "Verifying", headers={"Retry-After": "1"})
+
+    def get_ota_self_bin(self):
+        dev = self.device
+        if dev.running_image is None:
+            return self.reply(404, "Not found")
+        with dev.lock:
+            if dev.peer_downloads >= PEER_MAX_DOWNLOADS:
+                return self.reply(503, "Busy", headers={"Retry-After": "2"})
+            dev.peer_downloads += 1
+        try:
+            with open(dev.running_image, "rb") as f:
+                image = f.read()
+            self.send_response(200)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Content-Length", str(len(image)))
+            self.send_header("X-Image-MD5", hashlib.md5(image).hexdigest())
+            self.send_header("X-Chip-Family", dev.chip)
+            self.send_header("X-FW-Variant", dev.info["FWVariant"])
+            self.send_header("X-FW-Version", dev.info["FWVersion"])
+            self.end_headers()
+            step = 16 * 1460
+            for offset in range(0, len(image), step):
+                t0 = time.monotonic()
+                self.wfile.write(image[offset:offset + step])
+                delay = step / dev.peer_rate - (time.monotonic() - t0)
+                if delay > 0:
+                    time.sleep(delay)
+        except OSError:
+            self.close_connection = True
+        finally:
+            with dev.lock:
+                dev.peer_downloads -= 1
+
+    # -- background prefetch, see src/ElegantOTAPrefetch.cpp -----------------------------
+
+    def get_ota_prefetch(self):
+        dev = self.device
+        url = unquote(self.query.get("url", ""))
+        md5 = self.query.get("hash", "").lower()
+        if not url or not md5:
+            return self.reply(400, "url and hash parameters required")
+        if dev.session is not None and not dev.session_stale():
+            return self.reply(409, "Another OTA session is in progress", headers={"Retry-After": str(dev.retry_after())})
+        if not re.fullmatch(r"[0-9a-f]{32}", md5):
+            return self.reply(400, "Invalid url or hash")
+        rate = int(self.query.get("rate") or 0) or PREFETCH_RATE
+        current = dev.prefetch
+        if current is not None and current.state not in ("idle", "failed") and current.url == url and current.md5 == md5:
+            # the same image again keeps its progress
+            current.rate = rate
+        else:
+            if current is not None:
+                current.cancel()
+            dev.prefetch = Prefetch(dev, url, md5, rate)
+        self.reply(202, "OK")
+
+    def get_ota_prefetch_status(self):
+        prefetch = self.device.prefetch
+        status = prefetch.status() if prefetch else {"state": "idle", "size": 0, "done": 0, "rate": 0, "error": ""}
+        self.reply(200, json.dumps(status), "application/json")
+
+    def get_ota_prefetch_apply(self):
+        dev = self.device
+        if dev.session_busy(self):
+            return self.reply(409, "Another OTA session is in progress", headers={"Retry-After": str(dev.retry_after())})
+        if dev.prefetch is None or not dev.prefetch.apply():
+            error = dev.prefetch.error if dev.prefetch else ""
+            return self.reply(400, error or "No image staged")
+        self.reply(200, "OK", close=True)
+
+    def get_ota_history(self):
+        self.reply(200, json.dumps(self.device.history), "application/json", {"Cache-Control": "no-cache"})
+
+    def get_ota_trace_bin(self):
+        dev = self.device
+        if not dev.trace.capacity:
+            return self.reply(404, "Trace not enabled")
+        if dev.session is not None and not dev.session_stale():
+            return self.reply(409, "Update in progress")
+        self.reply(200, dev.trace.to_bytes(), "application/octet-stream",
+                   {"Content-Disposition": 'attachment; filename="trace.bin"', "Cache-Control": "no-cache"})
+
+    def get_ota_pull(self):
+        dev = self.device
+        url = unquote(self.query.get("url", ""))
+        if not url:
+            return self.reply(400, "url parameter missing")
+        md5 = self.query.get("hash") or None
+        if md5 and not re.fullmatch(r"[0-9a-fA-F]{32}", md5):
+            return self.reply(400, "MD5 parameter invalid")
+        if dev.session_busy(self) or not dev.pull(url, md5, unquote(self.query.get("version", ""))):
+            dev.stats["rejected_busy"] += 1
+            return self.reply(409, "Another OTA session is in progress", headers={"Retry-After": str(dev.retry_after())})
+        self.reply(202, "OK")
+
+
+class RawUploadServer(socketserver.ThreadingMixIn, socketserver.TCPServer):
+    daemon_threads = True
+    allow_reuse_address = True
+
+
+class RawUploadHandler(socketserver.StreamRequestHandler):
+    """Raw TCP upload, mirrors src/ElegantOTATcp.cpp: header, "100 Ready", payload, result line."""
+
+    device = None
+
+    def reply(self, code, text):
+        try:
+            self.wfile.write(f"{code} {text.strip()}\n".encode())
+            self.wfile.flush()
+        except OSError:
+            pass
+
+    def handle(self):
+        dev = self.device
+        if time.monotonic() < dev.rebooting_until:
+            return
+        # the device serves one connection at a time
+        if not dev.tcp_connection.acquire(blocking=False):
+            return self.reply(409, "Another OTA connection is open")
+        try:
+            result = self.serve()
+        finally:
+            # like endTcp(), the connection is released before the answer goes out
+            dev.tcp_connection.release()
+        if result:
+            self.reply(*result)
+            if result[0] == 200:
+                dev.reboot(dev.partition.path)
+
+    def serve(self):
+        """Run the session, returns the final answer as (code, text) or None."""
+        dev = self.device
+        head = self.rfile.read(RAW_HEADER.size)
+        if len(head) < RAW_HEADER.size:
+            return None
+        magic, version, mode, flags, _, size, md5 = RAW_HEADER.unpack(head)
+        if magic != b"EOTU" or version != 2:
+            return 400, "Bad header"
+        if dev.username and dev.password:
+            # a fresh nonce per connection, the client answers with HMAC(password, nonce || header || username)
+            nonce = os.urandom(16)
+            self.reply(101, nonce.hex())
+            answer = self.rfile.read(32)
+            expected = hmac.new(dev.password.encode(), nonce + head + dev.username.encode(), hashlib.sha256).digest()
+            if not hmac.compare_digest(answer, expected):
+                return 401, "Unauthorized"
+        if mode not in RAW_MODES:
+            return 400, "Mode not supported"
+        if size == 0:
+            return 400, "Empty image"
+        if flags & 0x01:
+            return 400, "Encryption not configured"
+
+        with dev.lock:
+            if dev.session is not None and not dev.session_stale():
+                dev.stats["rejected_busy"] += 1
+                return 409, f"{dev.retry_after()} Another OTA session is in progress"
+            if dev.session is not None:
+                dev.close_session(True)
+            dev.error = ""
+            dev.mode = RAW_MODES[mode]
+            if dev.mode == "bundle":
+                if flags & 0x02:
+                    return 400, "Sparse images are firmware or filesystem images"
+                dev.partition = BundleWriter(dev)
+            else:
+                dev.open_partition(md5.hex() if any(md5) else None)
+            if flags & 0x02:
+                dev.partition = SparseWriter(dev, dev.partition)
+            part = dev.partition
+            if size > part.size:
+                part.abort()
+                dev.error = f"Image of {size} bytes exceeds partition size {part.size}"
+                dev.stats["failures"] += 1
+                return 400, dev.error
+            # nobody owns the session over HTTP, uploads there get 409 meanwhile
+            dev.open_session(None, md5.hex() if any(md5) else None, self.client_address[0])
+        self.reply(100, "Ready")
+
+        error = self.receive(size, part)
+        with dev.lock:
+            if not error and not part.end():
+                error = part.error
+            dev.close_session(bool(error), error)
+            dev.stats["flash_seconds"] += part.busy_seconds
+            if error:
+                dev.error = error
+                dev.stats["failures"] += 1
+                return 400, error
+            dev.stats["uploads"] += 1
+        return 200, "OK"
+
+    def receive(self, size, part):
+        """Write size bytes of payload to the partition, returns an error or None."""
+        dev = self.device
+        check_header = dev.mode == "fr" and not isinstance(part, SparseWriter)
+        header = bytearray()
+        remaining = size
+        while remaining > 0:
+            # one TCP segment per onData() call on the device
+            chunk = self.rfile.read1(min(remaining, 1460))
+            if not chunk:
+                return "Connection closed"
+            remaining -= len(chunk)
+            dev.session_activity = time.monotonic()
+            if check_header and len(header) < 112:
+                header += chunk[:112 - len(header)]
+                if len(header) >= 112:
+                    error = check_image(bytes(header), dev.chip)
+                    if error:
+                        return error
+            if remaining + len(chunk) == size:
+                dev.trace.begin(dev, size)
+            started = time.monotonic()
+            with dev.tcp_task:
+                written = part.write(chunk)
+            dev.trace.add(size - remaining - len(chunk), len(chunk), started, time.monotonic() - started, TRACE_TCP)
+            if written != len(chunk):
+                return part.error or "Failed to write chunked data to free space"
+        if check_header and len(header) < 112:
+            return check_image(bytes(header), dev.chip)
+        return None
+
+
+class FileSink:
+    """Write target of the file sync mode, LittleFS write cost follows the flash timing model."""
+
+    def __init__(self, path, time_scale, chip):
+        self.file = open(path, "wb")
+        self.md5 = hashlib.md5()
+        self.error = None
+        self.time_scale = time_scale
+        self.timing = CHIPS[chip]
+
+    def write(self, data):
+        if self.time_scale:
+            time.sleep(len(data) / PAGE * self.timing["page_us"] / 1e6 * self.time_scale)
+        self.md5.update(data)
+        self.file.write(data)
+        return len(data)
+
+    def close(self):
+        self.file.close()
+
+
+# -- mDNS ------------------------------------------------------------------------------
+
+class MdnsResponder:
+    """One socket answering _elegantota._tcp PTR queries for all emulated devices,
+    with the TXT records of ElegantOTAClass::advertise()."""
+
+    def __init__(self, devices, group="224.0.0.251", port=5353, interface="127.0.0.1"):
+        sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+        import elegantota_discover
+        self.dns = elegantota_discover
+        self.devices = devices
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.sock.bind(("", port))
+        self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP,
+                             socket.inet_aton(group) + socket.inet_aton(interface))
+        self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(interface))
+        self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+        self.group = group
+        self.port = port
+        self.running = True
+        threading.Thread(target=self.serve, daemon=True).start()
+
+    def txt(self, device):
+        return {"chip": device.chip, "version": device.info["FWVersion"], "variant": device.info["FWVariant"],
+                "build": device.info["build"], "id": device.info["HwId"], "modes": "fr,fs,files,mcast,sparse"}
+
+    def serve(self):
+        while self.running:
+            try:
+                msg, sender = self.sock.recvfrom(9000)
+                flags, questions, _ = self.dns.parse_message(msg)
+            except (OSError, struct.error, IndexError):
+                continue
+            if flags & 0x8000 or not any(q[0].lower() == self.dns.SERVICE for q in questions):
+                continue
+            for device in self.devices:
+                answer = self.dns.build_response(f"elegantota-{device.port}", f"emu-{device.port}.local",
+                                                 device.host, device.port, self.txt(device))
+                # legacy unicast queries (source port != 5353) get a unicast answer
+                self.sock.sendto(answer, sender if sender[1] != self.port else (self.group, self.port))
+
+    def stop(self):
+        self.running = False
+        self.sock.close()
+
+
+# -- load test ------------------------------------------------------------------------
+
+def run_devices(count, chip, base_port, time_scale, flash_dir=None, ota_port=None, tcp_port=None, **kwargs):
+    devices = []
+    for i in range(count):
+        chip_name = chip[i % len(chip)] if isinstance(chip, (list, tuple)) else chip
+        devices.append(EmulatedDevice(chip_name, base_port + i if base_port else 0, flash_dir=flash_dir,
+                                      time_scale=time_scale, ota_port=ota_port + i if ota_port else ota_port,
+                                      tcp_port=tcp_port + i if tcp_port else tcp_port, **kwargs).start())
+    return devices
+
+
+def stop_devices(devices):
+    with ThreadPoolExecutor(max_workers=64) as pool:
+        list(pool.map(EmulatedDevice.stop, devices))
+
+
+def percentile(values, p):
+    values = sorted(values)
+    if not values:
+        return 0.0
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+def loadtest(args):
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    from elegantota_client import ElegantOTAClient, OTAError
+
+    chips = args.chip.split(",")
+    flash_dir = tempfile.mkdtemp(prefix="elegantota-load-")
+    devices = run_devices(args.devices, chips, args.base_port, args.time_scale, flash_dir)
+    images = {c: make_image(c, args.size, version="2.0.0") for c in chips}
+
+    def upload(device):
+        client = ElegantOTAClient(device.url)
+        t0 = time.monotonic()
+        try:
+            client.upload(images[device.chip])
+            return time.monotonic() - t0, None
+        except (OTAError, OSError) as e:
+            return time.monotonic() - t0, str(e)
+
+    started = time.monotonic()
+    with ThreadPoolExecutor(max_workers=args.concurrency or args.devices) as pool:
+        results = list(pool.map(upload, devices))
+    wall = time.monotonic() - started
+
+    durations = [d for d, e in results if e is None]
+    errors = [e for _, e in results if e is not None]
+    print(f"devices        {args.devices} ({', '.join(chips)})")
+    print(f"image size     {args.size} bytes")
+    print(f"wall time      {wall:.2f}s")
+    print(f"succeeded      {len(durations)}")
+    print(f"failed         {len(errors)}")
+    if durations:
+        print(f"upload p50/p95 {percentile(durations, 50):.2f}s / {percentile(durations, 95):.2f}s")
+        print(f"aggregate      {args.size * len(durations) / wall / 1024 / 1024:.2f} MiB/s")
+    for e in sorted(set(errors))[:10]:
+        print(f"  error: {e}")
+    stop_devices(devices)
+    return 0 if not errors else 1
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Emulate ElegantOTA devices")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    serve = sub.add_parser("serve", help="run emulated devices until interrupted")
+    serve.add_argument("--chip", default="ESP32", help="chip family, comma separated list for several devices")
+    serve.add_argument("--devices", type=int, default=1)
+    serve.add_argument("--port", type=int, default=8080, help="port of the first device")
+    serve.add_argument("--host", default="127.0.0.1")
+    serve.add_argument("--user", default="")
+    serve.add_argument("--password", default="")
+    serve.add_argument("--version", default="1.0.0", help="initial FWVersion")
+    serve.add_argument("--variant", default="")
+    serve.add_argument("--time-scale", type=float, default=1.0, help="scale of the flash timing model, 0 disables delays")
+    serve.add_argument("--flash-dir", help="directory for the flash files")
+    serve.add_argument("--mdns", action="store_true", help="answer _elegantota._tcp mDNS queries")
+    serve.add_argument("--mdns-group", default="224.0.0.251")
+    serve.add_argument("--mdns-port", type=int, default=5353)
+    serve.add_argument("--ota-port", type=int, help="OTA endpoints on their own listener, like ElegantOTA.begin(port)")
+    serve.add_argument("--quiesce", action="store_true", help="close the application listener during OTA sessions")
+    serve.add_argument("--app-cost", type=float, default=APP_COST, help="seconds a GET /api busies the AsyncTCP task")
+    serve.add_argument("--tcp-port", type=int, help="raw TCP upload listener, like ElegantOTA.enableTcpUpload(port)")
+    serve.add_argument("--trace", type=int, default=0, help="entries of the upload trace, like ElegantOTA.enableTrace(entries)")
+
+    load = sub.add_parser("loadtest", help="upload to many emulated devices at once")
+    load.add_argument("--devices", type=int, default=100)
+    load.add_argument("--chip", default="ESP32,ESP32-S3,ESP32-C3,ESP8266")
+    load.add_argument("--size", type=int, default=1000000)
+    load.add_argument("--concurrency", type=int, default=0, help="parallel uploads, default all devices")
+    load.add_argument("--base-port", type=int, default=0, help="0 picks free ports")
+    load.add_argument("--time-scale", type=float, default=1.0)
+
+    args = parser.parse_args(argv)
+    if args.command == "loadtest":
+        return loadtest(args)
+
+    chips = args.chip.split(",")
+    devices = run_devices(args.devices, chips, args.port, args.time_scale, args.flash_dir,
+                          host=args.host, username=args.user, password=args.password,
+                          info={"FWVersion": args.version, "FWVariant": args.variant},
+                          ota_port=args.ota_port, quiesce=args.quiesce, app_cost=args.app_cost, tcp_port=args.tcp_port,
+                          trace=args.trace)
+    for d in devices:
+        print(f"{d.chip:9s} {d.url}  flash in {d.flash_dir}" + (f"  app {d.app_url}" if d.ota_port is not None else "")
+              + (f"  tcp {d.host}:{d.tcp_port}" if d.tcp_port is not None else ""))
+    responder = MdnsResponder(devices, args.mdns_group, args.mdns_port, args.host) if args.mdns else None
+    try:
+        while True:
+            time.sleep(1)
+    except KeyboardInterrupt:
+        pass
+    if responder:
+        responder.stop()
+    stop_devices(devices)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
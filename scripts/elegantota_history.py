@@ -0,0 +1,171 @@
+# OTA performance trends of a fleet from the update history of its devices
+#
+# Every device keeps its last sessions in a ring file on its state filesystem (mode,
+# size, MD5, duration, average and slowest throughput, result, client) and serves them
+# at GET /ota/history, newest first. This tool collects them and groups them, e.g. by
+# firmware version to see whether a release made updates slower or less reliable.
+#
+#   python scripts/elegantota_history.py show devices.txt
+#   python scripts/elegantota_history.py show --discover --by mode --user admin --password secret
+#   python scripts/elegantota_history.py show devices.txt --json history.json
+#
+#   # emulated fleet: uploads with a share of failures, then the trends
+#   python scripts/elegantota_history.py simulate --devices 20 --uploads 3
+#
+# Only the python standard library is needed.
+
+import argparse
+import json
+import os
+import statistics
+import sys
+import tempfile
+import time
+from collections import defaultdict
+from concurrent.futures import ThreadPoolExecutor
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient, OTAError  # noqa: E402
+
+
+def collect(urls, username=None, password=None, concurrency=64):
+    """Returns {url: (records, error)}."""
+    def run(url):
+        client = ElegantOTAClient(url, username, password)
+        try:
+            return json.loads(client.call("GET", "/ota/history")), None
+        except (OTAError, OSError, ValueError) as e:
+            return [], str(e)
+        finally:
+            client.close()
+
+    with ThreadPoolExecutor(max_workers=concurrency) as pool:
+        return dict(zip(urls, pool.map(run, urls)))
+
+
+def group_key(record, by):
+    if by == "day":
+        return time.strftime("%Y-%m-%d", time.localtime(record["time"])) if record["time"] else "no time"
+    return str(record.get(by, ""))
+
+
+def trends(results, by):
+    """Rows of (key, sessions, failed, median avg_rate, 10th percentile min_rate, median duration)."""
+    groups = defaultdict(list)
+    for records, _ in results.values():
+        for record in records:
+            groups[group_key(record, by)].append(record)
+    rows = []
+    for key in sorted(groups):
+        records = groups[key]
+        done = [r for r in records if r["result"] == "ok" and r["size"]]
+        slowest = sorted(r["min_rate"] for r in done if r["min_rate"])
+        rows.append((key, len(records), sum(1 for r in records if r["result"] != "ok"),
+                     statistics.median(r["avg_rate"] for r in done) if done else 0,
+                     slowest[len(slowest) // 10] if slowest else 0,
+                     statistics.median(r["duration"] for r in done) / 1000 if done else 0))
+    return rows
+
+
+def print_trends(results, by):
+    print(f"{by:16s} {'sessions':>8s} {'failed':>6s} {'avg B/s':>10s} {'slow 10%':>10s} {'duration':>9s}")
+    for key, sessions, failed, avg, slow, duration in trends(results, by):
+        print(f"{key[:16]:16s} {sessions:8d} {failed:6d} {avg:10.0f} {slow:10d} {duration:8.1f}s")
+    errors = defaultdict(int)
+    for records, _ in results.values():
+        for record in records:
+            if record["result"] == "failed":
+                errors[record["error"].strip()] += 1
+    for error, count in sorted(errors.items(), key=lambda e: -e[1])[:5]:
+        print(f"  {count:4d} x {error}")
+    unreachable = [u for u, (_, e) in results.items() if e]
+    if unreachable:
+        print(f"{len(unreachable)} devices without history: {results[unreachable[0]][1]}")
+
+
+def read_urls(path, discover):
+    urls = []
+    if path:
+        with open(path) as f:
+            urls = [line.strip() for line in f if line.strip() and not line.startswith("#")]
+    if discover:
+        from elegantota_discover import discover as mdns_discover
+        urls += [d["url"] for d in mdns_discover()]
+    return urls
+
+
+def simulate(args):
+    from elegantota_emulator import make_image, run_devices, stop_devices
+
+    flash_dir = tempfile.mkdtemp(prefix="elegantota-history-")
+    devices = run_devices(args.devices, args.chip, 0, args.time_scale, flash_dir, reboot_delay=0)
+    urls = [d.url for d in devices]
+    images = [make_image(args.chip, args.size, version=f"1.{i + 1}.0", seed=i) for i in range(args.uploads)]
+    wrong = make_image("ESP8266" if args.chip != "ESP8266" else "ESP32", args.size, seed=99)
+
+    def update(url):
+        client = ElegantOTAClient(url)
+        try:
+            for n, image in enumerate(images):
+                # every fifth device gets an image of the wrong chip family first
+                if n == 0 and urls.index(url) % 5 == 0:
+                    try:
+                        client.upload(wrong)
+                    except OTAError:
+                        pass
+                client.upload(image)
+                time.sleep(0.05)
+        finally:
+            client.close()
+
+    with ThreadPoolExecutor(max_workers=args.concurrency) as pool:
+        list(pool.map(update, urls))
+    results = collect(urls)
+    stored = sum(len(r) for r, _ in results.values())
+    print(f"{args.devices} x {args.chip}, {args.uploads} updates of {args.size} bytes each, {stored} records collected")
+    print_trends(results, args.by)
+    expected = args.devices * args.uploads + (args.devices + 4) // 5
+    stop_devices(devices)
+    return 0 if stored == min(expected, args.devices * 16) else 1
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="OTA performance trends from the update history of a fleet")
+    sub = parser.add_subparsers(dest="command", required=True)
+    groups = ["version", "mode", "result", "client", "day"]
+
+    show = sub.add_parser("show", help="collect the history of real devices")
+    show.add_argument("devices", nargs="?", help="file with one device url per line")
+    show.add_argument("--discover", action="store_true", help="add devices found via mDNS")
+    show.add_argument("--user", help="username")
+    show.add_argument("--password", help="password")
+    show.add_argument("--by", default="version", choices=groups, help="group the records by this field")
+    show.add_argument("--json", help="write the collected records to this file")
+
+    sim = sub.add_parser("simulate", help="updates and history of emulated devices")
+    sim.add_argument("--devices", type=int, default=20)
+    sim.add_argument("--chip", default="ESP32")
+    sim.add_argument("--size", type=int, default=256 * 1024)
+    sim.add_argument("--uploads", type=int, default=3, help="updates per device")
+    sim.add_argument("--concurrency", type=int, default=8)
+    sim.add_argument("--time-scale", type=float, default=0.1, help="scale of the flash timing model")
+    sim.add_argument("--by", default="version", choices=groups)
+
+    args = parser.parse_args(argv)
+    if args.command == "simulate":
+        return simulate(args)
+
+    urls = read_urls(args.devices, args.discover)
+    if not urls:
+        print("No devices")
+        return 1
+    results = collect(urls, args.user, args.password)
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({url: records for url, (records, _) in results.items()}, f, indent=1)
+    print_trends(results, args.by)
+    return 0 if all(e is None for _, e in results.values()) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
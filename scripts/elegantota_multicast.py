@@ -0,0 +1,274 @@
+# One-to-many firmware distribution over UDP multicast (src/ElegantOTAMulticast.cpp)
+#
+# Every device joins the group via /ota/start?mode=multicast, the image is sent once in
+# numbered blocks, each group of k blocks followed by its XOR parity block, so a device
+# missing one block of a group rebuilds it without asking. Afterwards every device lists
+# its missing blocks on /ota/multicast/status (unicast), the union is sent again until
+# all are complete or the rounds are used up, then /ota/multicast/finish has the device
+# read the image back and check its MD5 in loop(), polled until it answers OK and reboots. The air time is spent once for the whole fleet instead of once per device.
+#
+#   python scripts/elegantota_multicast.py send .pio/build/esp32dev/firmware.bin devices.txt
+#   python scripts/elegantota_multicast.py send firmware.bin --discover --rate 48 --user admin --password secret
+#
+#   # 300 emulated receivers losing 5% of the datagrams, against a unicast estimate
+#   python scripts/elegantota_multicast.py simulate --devices 300 --loss 5
+#
+# WiFi sends multicast at a basic rate and without retries, keep --rate below what the
+# slowest device writes to flash (about 60-90 KiB/s) and give the devices WiFi.setSleep(false).
+# Only the python standard library is needed.
+
+import argparse
+import hashlib
+import json
+import os
+import random
+import socket
+import struct
+import sys
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient, OTAError  # noqa: E402
+
+HEADER = struct.Struct("<4sBBHI")
+MAGIC = b"EOTM"
+DATA = 0
+PARITY = 1
+DEFAULT_GROUP = "239.255.51.51"
+DEFAULT_PORT = 3233
+DEFAULT_BLOCK = 1024
+DEFAULT_K = 8
+DEFAULT_RATE = 64 * 1024
+
+
+class MulticastSender:
+    """Paced sender of the blocks of one image."""
+
+    def __init__(self, group=DEFAULT_GROUP, port=DEFAULT_PORT, interface=None, ttl=1, rate=DEFAULT_RATE,
+                 block=DEFAULT_BLOCK, k=DEFAULT_K):
+        self.group = group
+        self.port = port
+        self.rate = rate
+        self.block = block
+        self.k = k
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+        self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, ttl)
+        self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+        if interface:
+            self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(interface))
+        self.next_send = 0.0
+        self.packets = 0
+        self.bytes = 0
+
+    def _send(self, kind, transfer_id, index, payload):
+        packet = HEADER.pack(MAGIC, kind, 0, transfer_id, index) + payload
+        now = time.monotonic()
+        if self.next_send > now:
+            time.sleep(self.next_send - now)
+        self.next_send = max(self.next_send, now) + len(packet) / self.rate
+        self.sock.sendto(packet, (self.group, self.port))
+        self.packets += 1
+        self.bytes += len(packet)
+
+    def parity(self, data, group):
+        value = 0
+        for i in range(group * self.k, min(group * self.k + self.k, self.count(data))):
+            value ^= int.from_bytes(bytes(data[i * self.block:(i + 1) * self.block]).ljust(self.block, b"\0"), "little")
+        return value.to_bytes(self.block, "little")
+
+    def count(self, data):
+        return (len(data) + self.block - 1) // self.block
+
+    def send(self, image, transfer_id, indices=None):
+        """One round: every block, or the given ones, each group followed by its parity block."""
+        data = memoryview(image)
+        group = None
+        for i in (range(self.count(data)) if indices is None else indices):
+            if self.k and group is not None and i // self.k != group:
+                self._send(PARITY, transfer_id, group, self.parity(data, group))
+            group = i // self.k if self.k else None
+            self._send(DATA, transfer_id, i, bytes(data[i * self.block:(i + 1) * self.block]))
+        if self.k and group is not None:
+            self._send(PARITY, transfer_id, group, self.parity(data, group))
+
+    def close(self):
+        self.sock.close()
+
+
+def distribute(urls, image, username=None, password=None, group=DEFAULT_GROUP, port=DEFAULT_PORT, interface=None,
+               ttl=1, rate=DEFAULT_RATE, block=DEFAULT_BLOCK, k=DEFAULT_K, rounds=10, concurrency=64, log=print):
+    """Send image to all devices at once. Returns {url: None or the error} and the sender."""
+    md5 = hashlib.md5(image).hexdigest()
+    transfer_id = random.getrandbits(16)
+    clients = {url: ElegantOTAClient(url, username, password) for url in urls}
+    results = {}
+    sender = MulticastSender(group, port, interface, ttl, rate, block, k)
+
+    def call(url, path):
+        try:
+            return clients[url].call("GET", path), None
+        except OTAError as e:
+            return None, str(e)
+
+    def start(url):
+        try:
+            clients[url].start(md5, f"multicast&size={len(image)}&group={group}&port={port}&id={transfer_id}&block={block}&k={k}")
+        except OTAError as e:
+            return str(e)
+        return None
+
+    def finish(url, timeout=120.0):
+        # 202 while loop() reads the image back, the device reboots about 2s after the check passed
+        deadline = time.monotonic() + timeout
+        while True:
+            answer, error = call(url, "/ota/multicast/finish")
+            if error or answer.strip() == "OK":
+                return error
+            if time.monotonic() > deadline:
+                return "device did not finish checking the image"
+            time.sleep(0.25)
+
+    with ThreadPoolExecutor(max_workers=concurrency) as pool:
+        for url, error in zip(urls, pool.map(start, urls)):
+            if error:
+                results[url] = error
+        active = [u for u in urls if u not in results]
+        log(f"{len(active)}/{len(urls)} devices joined {group}:{port}, {sender.count(image)} blocks of {block} bytes, k={k}")
+
+        started = time.monotonic()
+        if active:
+            sender.send(image, transfer_id)
+            log(f"pass      {sender.bytes / 1024:8.0f} KiB sent in {time.monotonic() - started:6.1f}s")
+        for round_no in range(1, rounds + 1):
+            if not active:
+                break
+            wanted = set()
+            incomplete = 0
+            recovered = 0
+            for url, (answer, error) in zip(list(active), pool.map(lambda u: call(u, "/ota/multicast/status"), active)):
+                if error:
+                    results[url] = error
+                    active.remove(url)
+                    continue
+                status = json.loads(answer)
+                recovered += status["recovered"]
+                incomplete += status["missing"] > 0
+                for first, last in status["ranges"]:
+                    wanted.update(range(first, last + 1))
+            log(f"round {round_no:2d}  {incomplete} devices incomplete, {len(wanted)} blocks to resend, "
+                f"{recovered} blocks rebuilt from parity so far")
+            if not wanted:
+                break
+            sender.send(image, transfer_id, sorted(wanted))
+
+        for url, error in zip(active, pool.map(finish, active)):
+            results[url] = error
+    for client in clients.values():
+        client.close()
+    sender.close()
+    return results, sender
+
+
+def read_urls(path, discover):
+    urls = []
+    if path:
+        with open(path) as f:
+            urls = [line.strip() for line in f if line.strip() and not line.startswith("#")]
+    if discover:
+        from elegantota_discover import discover as mdns_discover
+        urls += [d["url"] for d in mdns_discover() if "mcast" in d.get("modes", "")]
+    return urls
+
+
+def send(args):
+    urls = read_urls(args.devices, args.discover)
+    if not urls:
+        print("No devices")
+        return 1
+    with open(args.image, "rb") as f:
+        image = f.read()
+    started = time.monotonic()
+    results, sender = distribute(urls, image, args.user, args.password, args.group, args.port, args.interface,
+                                 args.ttl, args.rate * 1024, args.block, args.k, args.rounds)
+    failed = {u: e for u, e in results.items() if e is not None}
+    print(f"{len(results) - len(failed)}/{len(results)} devices updated in {time.monotonic() - started:.1f}s, "
+          f"{sender.bytes / len(image):.2f}x the image size sent")
+    for url, error in failed.items():
+        print(f"  {url}: {error}")
+    return 0 if not failed else 1
+
+
+def simulate(args):
+    from elegantota_emulator import EmulatedDevice, make_image, run_devices, stop_devices
+
+    image = make_image(args.chip, args.size, version="2.0.0", seed=5)
+    flash_dir = tempfile.mkdtemp(prefix="elegantota-mcast-")
+    print(f"{args.devices} x {args.chip}, image {args.size} bytes, {args.loss:.1f}% datagram loss, "
+          f"sender {args.rate} KiB/s, air time {args.airtime / 1e6:.1f} MB/s")
+
+    # unicast: one upload measured, the fleet shares the air time
+    probe = EmulatedDevice(args.chip, 0, flash_dir=flash_dir, time_scale=args.time_scale, reboot_delay=0).start()
+    t0 = time.monotonic()
+    ElegantOTAClient(probe.url).upload(image)
+    single = time.monotonic() - t0
+    probe.stop()
+    unicast = max(args.devices * single / args.concurrency, args.devices * args.size / args.airtime)
+
+    devices = run_devices(args.devices, args.chip, 0, args.time_scale, flash_dir, reboot_delay=0,
+                          mcast_loss=args.loss / 100, mcast_interface="127.0.0.1")
+    port = random.randint(20000, 40000)
+    started = time.monotonic()
+    results, sender = distribute([d.url for d in devices], image, port=port, interface="127.0.0.1",
+                                 rate=args.rate * 1024, block=args.block, k=args.k, rounds=args.rounds)
+    wall = time.monotonic() - started
+    updated = sum(1 for d in devices if d.stats["uploads"] == 1)
+    errors = sorted({e for e in results.values() if e})
+    print(f"multicast  {updated}/{args.devices} updated in {wall:7.1f}s, {sender.bytes / args.size:.2f}x the image on air")
+    print(f"unicast    {single:.1f}s per device, {args.concurrency} at a time: about {unicast:7.1f}s, "
+          f"{args.devices:.0f}x the image on air")
+    for error in errors[:5]:
+        print(f"  error: {error}")
+    stop_devices(devices)
+    return 0 if updated == args.devices else 1
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Multicast firmware distribution for ElegantOTA")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    def add_transfer_options(p):
+        p.add_argument("--rate", type=float, default=DEFAULT_RATE / 1024, help="KiB/s sent to the group")
+        p.add_argument("--block", type=int, default=DEFAULT_BLOCK, help="bytes per block, 256, 512 or 1024")
+        p.add_argument("--k", type=int, default=DEFAULT_K, help="blocks per parity block, 0 disables parity")
+        p.add_argument("--rounds", type=int, default=10, help="repair rounds before giving up")
+
+    run = sub.add_parser("send", help="update real devices")
+    run.add_argument("image", help="firmware image")
+    run.add_argument("devices", nargs="?", help="file with one device url per line")
+    run.add_argument("--discover", action="store_true", help="add devices found via mDNS")
+    run.add_argument("--group", default=DEFAULT_GROUP)
+    run.add_argument("--port", type=int, default=DEFAULT_PORT)
+    run.add_argument("--interface", help="address of the interface to send on")
+    run.add_argument("--ttl", type=int, default=1)
+    run.add_argument("--user", help="username")
+    run.add_argument("--password", help="password")
+    add_transfer_options(run)
+
+    sim = sub.add_parser("simulate", help="benchmark against emulated devices")
+    sim.add_argument("--devices", type=int, default=100)
+    sim.add_argument("--chip", default="ESP32")
+    sim.add_argument("--size", type=int, default=256 * 1024)
+    sim.add_argument("--loss", type=float, default=2.0, help="percent of datagrams each device loses")
+    sim.add_argument("--airtime", type=float, default=1.5e6, help="bytes/s the WiFi carries for all unicast uploads")
+    sim.add_argument("--concurrency", type=int, default=8, help="parallel unicast uploads of the estimate")
+    sim.add_argument("--time-scale", type=float, default=1.0, help="scale of the flash timing model")
+    add_transfer_options(sim)
+
+    args = parser.parse_args(argv)
+    return simulate(args) if args.command == "simulate" else send(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
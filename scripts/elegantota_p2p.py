@@ -0,0 +1,238 @@
+# Peer-to-peer firmware distribution for ElegantOTA fleets
+#
+# Devices with ElegantOTA.setPeerServing(true) serve their running image at /ota/self.bin,
+# GET /ota/pull makes a device fetch an image, preferring peers found via mDNS that run the
+# wanted version. This tool seeds a few devices from the origin url and then triggers the
+# rest, which fan the image out among themselves instead of pulling every copy through the
+# site uplink.
+#
+#   python scripts/elegantota_p2p.py pull http://files.local/fw-2.0.0.bin devices.txt --version 2.0.0
+#   python scripts/elegantota_p2p.py pull http://files.local/fw-2.0.0.bin --discover --version 2.0.0 --seeds 2
+#
+#   # emulated fleet behind a 2 MB/s uplink, origin only vs. peer distribution
+#   python scripts/elegantota_p2p.py simulate --devices 32 --uplink 2000000
+#
+# The origin must be plain http, devices do not verify certificates. Devices only ask peers
+# when they know the MD5 of the image, without --hash it is computed from the origin first.
+
+import argparse
+import hashlib
+import http.server
+import os
+import re
+import sys
+import tempfile
+import threading
+import time
+import urllib.request
+from concurrent.futures import ThreadPoolExecutor
+from urllib.parse import quote
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient, OTAError  # noqa: E402
+
+
+def trigger(client, url, md5=None, version=None):
+    query = f"/ota/pull?url={quote(url, safe='')}"
+    if md5:
+        query += f"&hash={md5}"
+    if version:
+        query += f"&version={quote(version)}"
+    client.call("GET", query)
+
+
+def image_md5(url):
+    """MD5 of the image at url, read in pieces."""
+    md5 = hashlib.md5()
+    with urllib.request.urlopen(url, timeout=30) as response:
+        for chunk in iter(lambda: response.read(65536), b""):
+            md5.update(chunk)
+    return md5.hexdigest()
+
+
+def wait_version(client, version, timeout):
+    """Wait until the device runs version, returns the seconds waited or None."""
+    started = time.monotonic()
+    while time.monotonic() - started < timeout:
+        try:
+            if client.device_info().get("FWVersion") == version:
+                return time.monotonic() - started
+        except (OTAError, ValueError):
+            pass
+        time.sleep(0.25)
+    return None
+
+
+def distribute(urls, image_url, version, md5=None, seeds=1, concurrency=64, timeout=600,
+               username=None, password=None, log=print):
+    """Seed the first devices from image_url, then trigger the rest. Returns {url: seconds or None}."""
+    def run(url):
+        client = ElegantOTAClient(url, username, password, timeout=30)
+        try:
+            trigger(client, image_url, md5, version)
+        except OTAError as e:
+            log(f"  {url}: {e}")
+            return url, None
+        return url, wait_version(client, version, timeout)
+
+    results = {}
+    started = time.monotonic()
+    with ThreadPoolExecutor(max_workers=concurrency) as pool:
+        # the seeds are the first devices with the image, everything else can reach them via mDNS
+        for url, seconds in pool.map(run, urls[:seeds]):
+            results[url] = seconds
+        log(f"seeded {sum(1 for s in results.values() if s is not None)}/{seeds} devices "
+            f"in {time.monotonic() - started:.1f}s")
+        for url, seconds in pool.map(run, urls[seeds:]):
+            results[url] = seconds
+    return results
+
+
+# -- simulation -----------------------------------------------------------------------------
+
+class OriginServer:
+    """http server for one image, all downloads share a bandwidth limit like a site uplink."""
+
+    def __init__(self, image, uplink):
+        self.image = image
+        self.uplink = uplink
+        self.lock = threading.Lock()
+        self.next_slot = time.monotonic()
+        self.served = 0
+        origin = self
+
+        class Handler(http.server.BaseHTTPRequestHandler):
+            protocol_version = "HTTP/1.1"
+
+            def log_message(self, *args):
+                pass
+
+            def do_GET(self):
+                # Range requests of a resumed prefetch (elegantota_prefetch.py) get the rest of the image
+                size = len(origin.image)
+                first = re.fullmatch(r"bytes=(\d+)-", self.headers.get("Range", ""))
+                first = int(first.group(1)) if first and int(first.group(1)) < size else 0
+                self.send_response(206 if first else 200)
+                self.send_header("Content-Type", "application/octet-stream")
+                self.send_header("Content-Length", str(size - first))
+                if first:
+                    self.send_header("Content-Range", f"bytes {first}-{size - 1}/{size}")
+                self.end_headers()
+                step = 8 * 1460
+                try:
+                    for offset in range(first, size, step):
+                        origin.throttle(step)
+                        self.wfile.write(origin.image[offset:offset + step])
+                        origin.served += len(origin.image[offset:offset + step])
+                except (BrokenPipeError, ConnectionResetError):
+                    self.close_connection = True
+
+        self.server = http.server.ThreadingHTTPServer(("127.0.0.1", 0), Handler)
+        self.server.daemon_threads = True
+        threading.Thread(target=self.server.serve_forever, daemon=True).start()
+        self.url = f"http://127.0.0.1:{self.server.server_address[1]}/firmware.bin"
+
+    def throttle(self, size):
+        with self.lock:
+            now = time.monotonic()
+            self.next_slot = max(self.next_slot, now) + size / self.uplink
+            delay = self.next_slot - now
+        time.sleep(delay)
+
+    def stop(self):
+        self.server.shutdown()
+        self.server.server_close()
+
+
+def simulate_once(args, peers):
+    from elegantota_emulator import make_image, run_devices, stop_devices
+
+    image = make_image(args.chip, args.size, version="2.0.0", seed=3)
+    origin = OriginServer(image, args.uplink)
+    devices = []
+    lookup = (lambda: [{"url": d.url, "chip": d.chip, "variant": d.info["FWVariant"], "version": d.info["FWVersion"]}
+                       for d in devices]) if peers else None
+    devices += run_devices(args.devices, args.chip, 0, args.time_scale, tempfile.mkdtemp(prefix="elegantota-p2p-"),
+                           peer_lookup=lookup, peer_rate=args.peer_rate)
+
+    started = time.monotonic()
+    results = distribute([d.url for d in devices], origin.url, "2.0.0", hashlib.md5(image).hexdigest(),
+                         seeds=args.seeds if peers else args.devices, log=lambda *_: None)
+    wall = time.monotonic() - started
+    updated = sum(1 for s in results.values() if s is not None)
+    from_peer = sum(1 for d in devices if d.pulled_from == "peer")
+    print(f"{'peer' if peers else 'origin':6s}  {updated}/{args.devices} updated in {wall:6.1f}s  "
+          f"{from_peer:4d} from peers  {origin.served / 1e6:7.1f} MB over the uplink")
+    origin.stop()
+    stop_devices(devices)
+
+
+def simulate(args):
+    print(f"{args.devices} x {args.chip}, image {args.size} bytes, uplink {args.uplink / 1e6:.1f} MB/s, "
+          f"peers send {args.peer_rate / 1e6:.1f} MB/s")
+    if args.mode in ("origin", "both"):
+        simulate_once(args, False)
+    if args.mode in ("p2p", "both"):
+        simulate_once(args, True)
+    return 0
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Peer-to-peer firmware distribution for ElegantOTA")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    run = sub.add_parser("pull", help="distribute an image to real devices")
+    run.add_argument("image_url", help="plain http url of the image")
+    run.add_argument("devices", nargs="?", help="file with one device url per line")
+    run.add_argument("--discover", action="store_true", help="add devices found via mDNS")
+    run.add_argument("--version", required=True, help="FWVersion of the image, devices report it after the reboot")
+    run.add_argument("--hash", help="MD5 of the image, computed from image_url if not given")
+    run.add_argument("--seeds", type=int, default=1, help="devices that download from the origin first")
+    run.add_argument("--concurrency", type=int, default=64)
+    run.add_argument("--timeout", type=float, default=600.0, help="seconds a device may take")
+    run.add_argument("--user", help="username")
+    run.add_argument("--password", help="password")
+
+    sim = sub.add_parser("simulate", help="benchmark against emulated devices")
+    sim.add_argument("--devices", type=int, default=32)
+    sim.add_argument("--chip", default="ESP32")
+    sim.add_argument("--size", type=int, default=1000000)
+    sim.add_argument("--uplink", type=float, default=2e6, help="origin bandwidth in bytes/s")
+    sim.add_argument("--peer-rate", type=float, default=1e6, help="bytes/s a device serves /ota/self.bin with")
+    sim.add_argument("--seeds", type=int, default=1)
+    sim.add_argument("--time-scale", type=float, default=0.1, help="scale of the flash timing model")
+    sim.add_argument("--mode", choices=("origin", "p2p", "both"), default="both")
+
+    args = parser.parse_args(argv)
+    if args.command == "simulate":
+        return simulate(args)
+
+    urls = []
+    if args.devices:
+        with open(args.devices) as f:
+            urls = [line.strip() for line in f if line.strip() and not line.startswith("#")]
+    if args.discover:
+        from elegantota_discover import discover
+        urls += [d["url"] for d in discover()]
+    if not urls:
+        print("No devices")
+        return 1
+
+    md5 = args.hash
+    if not md5:
+        # without it every device would download from the origin
+        md5 = image_md5(args.image_url)
+        print(f"MD5 of the image: {md5}")
+
+    started = time.monotonic()
+    results = distribute(urls, args.image_url, args.version, md5, args.seeds, args.concurrency,
+                         args.timeout, args.user, args.password)
+    failed = [u for u, s in results.items() if s is None]
+    print(f"{len(results) - len(failed)}/{len(results)} devices on {args.version} in {time.monotonic() - started:.1f}s")
+    for url in failed:
+        print(f"  not updated: {url}")
+    return 0 if not failed else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
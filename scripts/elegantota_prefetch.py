@@ -0,0 +1,189 @@
+# Background prefetch for ElegantOTA fleets (src/ElegantOTAPrefetch.cpp)
+#
+# GET /ota/prefetch makes a device download an image into its update partition at a low
+# rate while the application keeps running. The image is verified and waits there until
+# it is applied, by ElegantOTA.applyStaged(), the apply window of the device or the apply
+# command of this tool, e.g. at night. Power cycles in between continue the download.
+#
+#   python scripts/elegantota_prefetch.py start http://files.local/fw-2.0.0.bin devices.txt --rate 4096
+#   python scripts/elegantota_prefetch.py status devices.txt
+#   python scripts/elegantota_prefetch.py apply devices.txt --user admin --password secret
+#
+#   # emulated fleet: rate cap, half of the devices power cycled halfway, then applied
+#   python scripts/elegantota_prefetch.py simulate --devices 20 --rate 32768
+#
+# The origin must be plain http and answer Range requests for the resume.
+# Only the python standard library is needed.
+
+import argparse
+import hashlib
+import json
+import os
+import statistics
+import sys
+import tempfile
+import time
+import urllib.request
+from concurrent.futures import ThreadPoolExecutor
+from urllib.parse import quote
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient, OTAError  # noqa: E402
+
+
+def for_all(urls, action, username=None, password=None, concurrency=64):
+    """Run action(client) on every device, returns {url: (answer, error)}."""
+    def run(url):
+        client = ElegantOTAClient(url, username, password)
+        try:
+            return action(client), None
+        except (OTAError, OSError, ValueError) as e:
+            return None, str(e)
+        finally:
+            client.close()
+
+    with ThreadPoolExecutor(max_workers=concurrency) as pool:
+        return dict(zip(urls, pool.map(run, urls)))
+
+
+def start(urls, image_url, md5, rate=0, **kwargs):
+    query = f"/ota/prefetch?url={quote(image_url, safe='')}&hash={md5}" + (f"&rate={rate}" if rate else "")
+    return for_all(urls, lambda c: c.call("GET", query), **kwargs)
+
+
+def status(urls, **kwargs):
+    return for_all(urls, lambda c: json.loads(c.call("GET", "/ota/prefetch/status")), **kwargs)
+
+
+def apply(urls, **kwargs):
+    return for_all(urls, lambda c: c.call("GET", "/ota/prefetch/apply"), **kwargs)
+
+
+def read_urls(path, discover):
+    urls = []
+    if path:
+        with open(path) as f:
+            urls = [line.strip() for line in f if line.strip() and not line.startswith("#")]
+    if discover:
+        from elegantota_discover import discover as mdns_discover
+        urls += [d["url"] for d in mdns_discover()]
+    return urls
+
+
+def print_status(results):
+    for url, (answer, error) in results.items():
+        if error:
+            print(f"{url:32s} {error}")
+            continue
+        percent = answer["done"] * 100 // answer["size"] if answer["size"] else 0
+        print(f"{url:32s} {answer['state']:12s} {percent:3d}%  {answer['size']:8d} bytes  {answer['rate']:6d} B/s  {answer['error']}")
+
+
+def simulate(args):
+    from elegantota_emulator import EmulatedDevice, make_image, run_devices, stop_devices
+    from elegantota_p2p import OriginServer
+
+    image = make_image(args.chip, args.size, version="2.0.0", seed=9)
+    md5 = hashlib.md5(image).hexdigest()
+    origin = OriginServer(image, args.uplink)
+    flash_dir = tempfile.mkdtemp(prefix="elegantota-prefetch-")
+    devices = run_devices(args.devices, args.chip, 0, args.time_scale, flash_dir)
+    urls = [d.url for d in devices]
+    print(f"{args.devices} x {args.chip}, image {args.size} bytes at {args.rate} B/s per device, "
+          f"expected {args.size / args.rate:.1f}s")
+
+    started = time.monotonic()
+    errors = [e for _, e in start(urls, origin.url, md5, args.rate).values() if e]
+    time.sleep(args.size / args.rate / 2)
+
+    # the rate over the first half, then half of the fleet loses power
+    done = [d.prefetch.done for d in devices]
+    measured = statistics.median(done) / (time.monotonic() - started)
+    cycled = range(0, len(devices), 2)
+    refetched = 0
+    for i in cycled:
+        before = devices[i].prefetch.done
+        devices[i].stop()
+        devices[i] = EmulatedDevice(args.chip, devices[i].port, flash_dir=flash_dir, time_scale=args.time_scale).start()
+        refetched += before - devices[i].prefetch.done
+
+    while time.monotonic() - started < args.size / args.rate * 3:
+        states = [d.prefetch.state if d.prefetch else "idle" for d in devices]
+        if all(s in ("staged", "failed") for s in states):
+            break
+        time.sleep(0.2)
+    staged = sum(1 for d in devices if d.prefetch and d.prefetch.state == "staged")
+    wall = time.monotonic() - started
+    errors += [d.prefetch.error for d in devices if d.prefetch and d.prefetch.state == "failed"]
+
+    errors += [e for _, e in apply(urls).values() if e]
+    time.sleep(0.5)
+    updated = sum(1 for d in devices if d.stats["uploads"] == 1)
+    print(f"rate       {measured:8.0f} B/s per device (median over the first half)")
+    print(f"resume     {len(cycled)} devices power cycled at about {statistics.median(done) * 100 // args.size}%, "
+          f"{refetched // max(len(cycled), 1)} bytes per device fetched again (progress saved every 64 KiB)")
+    print(f"staged     {staged}/{args.devices} in {wall:.1f}s, {updated}/{args.devices} booted the image after apply")
+    for error in sorted(set(errors))[:5]:
+        print(f"  error: {error}")
+    origin.stop()
+    stop_devices(devices)
+    return 0 if updated == args.devices else 1
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Background prefetch for ElegantOTA fleets")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    def add_device_options(p):
+        p.add_argument("devices", nargs="?", help="file with one device url per line")
+        p.add_argument("--discover", action="store_true", help="add devices found via mDNS")
+        p.add_argument("--user", help="username")
+        p.add_argument("--password", help="password")
+
+    run = sub.add_parser("start", help="start the prefetch of an image")
+    run.add_argument("image_url", help="plain http url of the image")
+    add_device_options(run)
+    run.add_argument("--hash", help="MD5 of the image, downloaded once to compute it if missing")
+    run.add_argument("--rate", type=int, default=0, help="bytes/s per device, default of the device if 0")
+    add_device_options(sub.add_parser("status", help="show the prefetch state"))
+    add_device_options(sub.add_parser("apply", help="boot the staged images"))
+
+    sim = sub.add_parser("simulate", help="rate cap and resume against emulated devices")
+    sim.add_argument("--devices", type=int, default=20)
+    sim.add_argument("--chip", default="ESP32")
+    sim.add_argument("--size", type=int, default=256 * 1024)
+    sim.add_argument("--rate", type=int, default=32768, help="bytes/s per device")
+    sim.add_argument("--uplink", type=float, default=20e6, help="origin bandwidth in bytes/s")
+    sim.add_argument("--time-scale", type=float, default=0.1, help="scale of the flash timing model")
+
+    args = parser.parse_args(argv)
+    if args.command == "simulate":
+        return simulate(args)
+
+    urls = read_urls(args.devices, args.discover)
+    if not urls:
+        print("No devices")
+        return 1
+    auth = {"username": args.user, "password": args.password}
+    if args.command == "start":
+        md5 = args.hash
+        if not md5:
+            with urllib.request.urlopen(args.image_url) as response:
+                md5 = hashlib.md5(response.read()).hexdigest()
+        results = start(urls, args.image_url, md5, args.rate, **auth)
+    elif args.command == "apply":
+        results = apply(urls, **auth)
+    else:
+        results = status(urls, **auth)
+        print_status(results)
+        return 0 if all(e is None for _, e in results.values()) else 1
+
+    failed = {u: e for u, (_, e) in results.items() if e}
+    print(f"{len(results) - len(failed)}/{len(results)} devices accepted")
+    for url, error in failed.items():
+        print(f"  {url}: {error}")
+    return 0 if not failed else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,305 @@
+# Staged rollout of firmware to a fleet of ElegantOTA devices
+#
+# Devices are grouped by the /getdeviceinfo contract (owner, repository, branch,
+# chipfamily, FWVariant), each group gets its own image. Every group is pushed to a
+# canary share first, then in growing waves. After each upload the device has to come
+# back on /getdeviceinfo with the new FWVersion (read from the image's app descriptor,
+# ESP8266 images only need to answer again). A wave whose failure rate exceeds the
+# threshold halts the rollout of all groups.
+#
+#   python scripts/elegantota_rollout.py rollout devices.txt --image ESP32=fw32.bin --image ESP8266=fw8266.bin
+#   python scripts/elegantota_rollout.py rollout --discover --image ESP32-S3:display=display.bin --canary 2
+#
+#   # 1000 emulated devices, 1% of them fail to boot the new image
+#   python scripts/elegantota_rollout.py simulate --devices 1000 --boot-failures 1
+#
+# devices.txt holds one device url per line.
+
+import argparse
+import os
+import random
+import struct
+import sys
+import tempfile
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient, OTABusyError, OTAError  # noqa: E402
+
+APP_DESC_MAGIC = 0xABCD5432
+
+
+class Device:
+    def __init__(self, url, info):
+        self.url = url
+        self.info = info
+        self.state = "pending"
+        self.error = ""
+        self.seconds = 0.0
+
+    @property
+    def group(self):
+        i = self.info
+        return (i.get("owner", ""), i.get("repository", ""), i.get("branch", ""),
+                i.get("chipfamily", ""), i.get("FWVariant", ""))
+
+
+def image_version(image):
+    """FWVersion a device reports after booting image, None if the image has no app descriptor."""
+    if len(image) >= 112 and image[0] == 0xE9 and struct.unpack_from("<I", image, 32)[0] == APP_DESC_MAGIC:
+        return image[48:80].split(b"\0")[0].decode(errors="replace")
+    return None
+
+
+def select_image(images, info):
+    """Most specific match of chip:variant, chip or '*'."""
+    for key in (f"{info.get('chipfamily')}:{info.get('FWVariant')}", info.get("chipfamily"), "*"):
+        if key in images:
+            return images[key]
+    return None
+
+
+def plan_waves(count, canary, factor):
+    """Wave sizes: the canary share, then growing by factor until the group is covered."""
+    waves = []
+    size = max(1, round(count * canary / 100)) if count else 0
+    done = 0
+    while done < count:
+        size = min(size, count - done)
+        waves.append(size)
+        done += size
+        size = max(size + 1, int(size * factor))
+    return waves
+
+
+class Rollout:
+    def __init__(self, images, username=None, password=None, canary=5.0, factor=4.0, concurrency=32,
+                 max_failure_rate=10.0, health_timeout=120.0, busy_retries=3, poll_interval=0.5, log=print):
+        self.images = images
+        self.username = username
+        self.password = password
+        self.canary = canary
+        self.factor = factor
+        self.concurrency = concurrency
+        self.max_failure_rate = max_failure_rate
+        self.health_timeout = health_timeout
+        self.busy_retries = busy_retries
+        self.poll_interval = poll_interval
+        self.log = log
+        self.halted = threading.Event()
+
+    def client(self, url):
+        return ElegantOTAClient(url, self.username, self.password, timeout=30)
+
+    def inventory(self, urls):
+        def fetch(url):
+            try:
+                return Device(url, self.client(url).device_info())
+            except (OTAError, ValueError) as e:
+                self.log(f"  {url}: unreachable ({e})")
+                return None
+
+        with ThreadPoolExecutor(max_workers=self.concurrency) as pool:
+            return [d for d in pool.map(fetch, urls) if d is not None]
+
+    def wait_healthy(self, device, expected_version):
+        """Poll /getdeviceinfo until the device runs expected_version. The device keeps answering
+        with the old version until it reboots, the old version after it was offline means the
+        bootloader rolled back."""
+        deadline = time.monotonic() + self.health_timeout
+        was_offline = False
+        while time.monotonic() < deadline and not self.halted.is_set():
+            try:
+                info = self.client(device.url).device_info()
+            except (OTAError, ValueError):
+                was_offline = True
+                time.sleep(self.poll_interval)
+                continue
+            device.info = info
+            if expected_version is None:
+                if was_offline:
+                    return True
+            elif info.get("FWVersion") == expected_version:
+                return True
+            elif was_offline:
+                return False
+            time.sleep(self.poll_interval)
+        return False
+
+    def update(self, device, image, expected_version):
+        t0 = time.monotonic()
+        client = self.client(device.url)
+        try:
+            for attempt in range(self.busy_retries + 1):
+                try:
+                    client.upload(image)
+                    break
+                except OTABusyError as e:
+                    if attempt == self.busy_retries:
+                        raise
+                    retry = int(e.retry_after) if str(e.retry_after).isdigit() else 5
+                    time.sleep(min(retry, 30))
+            client.close()
+            if not self.wait_healthy(device, expected_version):
+                device.state = "failed"
+                device.error = f"running {device.info.get('FWVersion')} after reboot, expected {expected_version}"
+            else:
+                device.state = "updated"
+        except OTAError as e:
+            device.state, device.error = "failed", str(e)
+        device.seconds = time.monotonic() - t0
+        return device
+
+    def run_wave(self, devices, image, expected_version):
+        with ThreadPoolExecutor(max_workers=min(self.concurrency, len(devices))) as pool:
+            return list(pool.map(lambda d: self.update(d, image, expected_version), devices))
+
+    def run(self, devices):
+        groups = {}
+        for d in devices:
+            groups.setdefault(d.group, []).append(d)
+
+        plans = []
+        for key, members in sorted(groups.items()):
+            image = select_image(self.images, members[0].info)
+            name = "/".join(k for k in key if k) or "default"
+            if image is None:
+                self.log(f"group {name}: no image, {len(members)} devices skipped")
+                for d in members:
+                    d.state = "skipped"
+                continue
+            version = image_version(image)
+            todo = [d for d in members if version is None or d.info.get("FWVersion") != version]
+            for d in members:
+                if d not in todo:
+                    d.state = "current"
+            waves = plan_waves(len(todo), self.canary, self.factor)
+            self.log(f"group {name}: {len(members)} devices, {len(todo)} to update to {version or '?'}, waves {waves}")
+            plans.append((name, todo, image, version, waves))
+
+        # all groups advance wave by wave together, the canaries of every group go first
+        wave = 0
+        while not self.halted.is_set() and any(wave < len(p[4]) for p in plans):
+            for name, todo, image, version, waves in plans:
+                if wave >= len(waves) or self.halted.is_set():
+                    continue
+                start = sum(waves[:wave])
+                batch = todo[start:start + waves[wave]]
+                t0 = time.monotonic()
+                results = self.run_wave(batch, image, version)
+                failed = [d for d in results if d.state == "failed"]
+                rate = 100.0 * len(failed) / len(results)
+                self.log(f"{name} wave {wave + 1}/{len(waves)}: {len(results) - len(failed)}/{len(results)} ok "
+                         f"in {time.monotonic() - t0:.1f}s ({rate:.1f}% failed)")
+                for d in failed[:5]:
+                    self.log(f"  {d.url}: {d.error}")
+                if rate > self.max_failure_rate:
+                    self.log(f"{name}: failure rate above {self.max_failure_rate}%, halting rollout")
+                    self.halted.set()
+            wave += 1
+        return not self.halted.is_set()
+
+
+def summary(devices, wall, log=print):
+    states = {}
+    for d in devices:
+        states[d.state] = states.get(d.state, 0) + 1
+    log("result: " + ", ".join(f"{n} {s}" for s, n in sorted(states.items())) + f" in {wall:.1f}s")
+    durations = sorted(d.seconds for d in devices if d.state == "updated")
+    if durations:
+        log(f"per device p50/p95 {durations[len(durations) // 2]:.2f}s / {durations[int(len(durations) * 0.95)]:.2f}s")
+
+
+def parse_images(values):
+    images = {}
+    for value in values or []:
+        key, _, path = value.rpartition("=")
+        with open(path, "rb") as f:
+            images[key or "*"] = f.read()
+    return images
+
+
+def add_rollout_options(parser):
+    parser.add_argument("--canary", type=float, default=5.0, help="percent of each group in the first wave")
+    parser.add_argument("--factor", type=float, default=4.0, help="growth of the following waves")
+    parser.add_argument("--concurrency", type=int, default=32, help="parallel uploads per wave")
+    parser.add_argument("--max-failure-rate", type=float, default=10.0, help="percent, halts the rollout above")
+    parser.add_argument("--health-timeout", type=float, default=120.0, help="seconds until a rebooted device must answer")
+
+
+def rollout(args):
+    urls = []
+    if args.devices:
+        with open(args.devices) as f:
+            urls = [line.strip() for line in f if line.strip() and not line.startswith("#")]
+    if args.discover:
+        from elegantota_discover import discover
+        urls += [d["url"] for d in discover()]
+    if not urls:
+        print("No devices")
+        return 1
+
+    engine = Rollout(parse_images(args.image), args.user, args.password, args.canary, args.factor,
+                     args.concurrency, args.max_failure_rate, args.health_timeout)
+    started = time.monotonic()
+    devices = engine.inventory(urls)
+    ok = engine.run(devices)
+    summary(devices, time.monotonic() - started)
+    return 0 if ok else 1
+
+
+def simulate(args):
+    from elegantota_emulator import make_image, run_devices, stop_devices
+
+    chips = args.chip.split(",")
+    flash_dir = tempfile.mkdtemp(prefix="elegantota-rollout-")
+    failing = set(random.Random(1).sample(range(args.devices), int(args.devices * args.boot_failures / 100)))
+    devices = []
+    for i in range(args.devices):
+        devices += run_devices(1, chips[i % len(chips)], 0, args.time_scale, flash_dir,
+                               reboot_delay=args.reboot_delay, boot_fail=i in failing,
+                               info={"owner": "acme", "repository": "sensor", "branch": "main", "FWVersion": "1.0.0"})
+    images = {c: make_image(c, args.size, version="2.0.0", seed=1) for c in chips}
+    print(f"{args.devices} emulated devices ({', '.join(chips)}), {len(failing)} fail to boot the new image")
+
+    engine = Rollout(images, canary=args.canary, factor=args.factor, concurrency=args.concurrency,
+                     max_failure_rate=args.max_failure_rate, health_timeout=args.health_timeout,
+                     poll_interval=0.05)
+    started = time.monotonic()
+    inventory = engine.inventory([d.url for d in devices])
+    engine.run(inventory)
+    summary(inventory, time.monotonic() - started)
+    stop_devices(devices)
+    return 0
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Staged rollout to ElegantOTA devices")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    run = sub.add_parser("rollout", help="roll out to real devices")
+    run.add_argument("devices", nargs="?", help="file with one device url per line")
+    run.add_argument("--discover", action="store_true", help="add devices found via mDNS")
+    run.add_argument("--image", action="append", required=True,
+                     help="CHIP[:VARIANT]=image.bin, or image.bin for all devices")
+    run.add_argument("--user", help="username")
+    run.add_argument("--password", help="password")
+    add_rollout_options(run)
+
+    sim = sub.add_parser("simulate", help="benchmark a rollout against emulated devices")
+    sim.add_argument("--devices", type=int, default=1000)
+    sim.add_argument("--chip", default="ESP32,ESP32-S3,ESP32-C3")
+    sim.add_argument("--size", type=int, default=200000)
+    sim.add_argument("--boot-failures", type=float, default=0.0, help="percent of devices that fail to boot")
+    sim.add_argument("--reboot-delay", type=float, default=2.0, help="seconds offline after an update, scaled by --time-scale")
+    sim.add_argument("--time-scale", type=float, default=0.1, help="scale of the flash timing model")
+    add_rollout_options(sim)
+
+    args = parser.parse_args(argv)
+    return simulate(args) if args.command == "simulate" else rollout(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
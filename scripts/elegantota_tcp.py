@@ -0,0 +1,167 @@
+# Upload client for the raw TCP listener of ElegantOTA (ElegantOTA.enableTcpUpload(port))
+#
+# One connection, a 28 byte header and the image as it is, no HTTP and no multipart. With
+# credentials the device answers the header with a nonce and the client proves the password
+# with an HMAC over nonce, header and username; the password never goes over the wire.
+# Protocol described in src/ElegantOTATcp.cpp.
+#
+#   python scripts/elegantota_tcp.py 192.168.1.123:3232 .pio/build/esp32dev/firmware.bin
+#   python scripts/elegantota_tcp.py 192.168.1.123:3232 littlefs.bin --fs --user admin --password secret
+#   python scripts/elegantota_tcp.py 192.168.1.123:3232 update.eotb
+#
+# Only the python standard library is needed.
+
+import argparse
+import hashlib
+import hmac
+import os
+import socket
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import OTABusyError, OTAError  # noqa: E402
+
+HEADER = struct.Struct("<4sBBBBI16s")
+MAGIC = b"EOTU"
+VERSION = 2
+MODES = {"fr": 0, "fs": 1, "bundle": 3}
+FLAG_ENC = 0x01
+FLAG_SPARSE = 0x02
+SEND_CHUNK = 64 * 1024
+DEFAULT_PORT = 3232
+
+
+def pack_header(size, mode="fr", md5=None, encrypted=False, sparse=False):
+    digest = bytes.fromhex(md5) if md5 else bytes(16)
+    flags = (FLAG_ENC if encrypted else 0) | (FLAG_SPARSE if sparse else 0)
+    return HEADER.pack(MAGIC, VERSION, MODES[mode], flags, 0, size, digest)
+
+
+def answer_challenge(nonce, header, username, password):
+    """MAC the device expects for its nonce: HMAC-SHA256(password, nonce || header || username)."""
+    return hmac.new((password or "").encode(), nonce + header + (username or "").encode(), hashlib.sha256).digest()
+
+
+class ElegantOTATcpClient:
+    def __init__(self, address, username=None, password=None, timeout=30):
+        host, _, port = address.rpartition(":") if ":" in address else (address, "", "")
+        self.host = host or address
+        self.port = int(port) if port else DEFAULT_PORT
+        self.username = username
+        self.password = password
+        self.timeout = timeout
+
+    def _read_line(self, reader):
+        line = reader.readline(512)
+        if not line:
+            raise OTAError("connection closed by the device")
+        code, _, text = line.decode(errors="replace").strip().partition(" ")
+        if not code.isdigit():
+            raise OTAError(f"unexpected answer: {line!r}")
+        return int(code), text
+
+    def _check(self, code, text):
+        if code == 409:
+            retry, _, _ = text.partition(" ")
+            raise OTABusyError(retry if retry.isdigit() else "?")
+        if code == 401:
+            raise OTAError("authentication required or failed")
+        if code >= 400:
+            raise OTAError(f"upload failed with {code}: {text}")
+
+    def upload(self, image, mode="fr", progress=None, chunk=SEND_CHUNK):
+        """Upload an image (path or bytes). Returns the device answer, raises OTAError on failure."""
+        if isinstance(image, (str, os.PathLike)):
+            with open(image, "rb") as f:
+                image = f.read()
+        data = memoryview(image)
+        encrypted = bytes(data[:4]) == b"EOTA"
+        sparse = bytes(data[:4]) == b"EOTS"
+        md5 = None
+        if bytes(data[:4]) == b"EOTB":
+            # the bundle carries the hash of every section
+            mode = "bundle"
+        elif sparse:
+            # the sparse header carries the hash of the full image (scripts/sparse_image.py)
+            md5 = bytes(data[16:32]).hex()
+        elif not encrypted:
+            md5 = hashlib.md5(data).hexdigest()
+
+        header = pack_header(len(data), mode, md5, encrypted, sparse)
+        try:
+            sock = socket.create_connection((self.host, self.port), timeout=self.timeout)
+        except OSError as e:
+            raise OTAError(f"connection to {self.host}:{self.port} failed: {e!r}") from e
+        with sock, sock.makefile("rb") as reader:
+            sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            sent = 0
+            try:
+                sock.sendall(header)
+                code, text = self._read_line(reader)
+                if code == 101:
+                    if not self.username and not self.password:
+                        raise OTAError("authentication required or failed")
+                    sock.sendall(answer_challenge(bytes.fromhex(text), header, self.username, self.password))
+                    code, text = self._read_line(reader)
+                self._check(code, text)
+                while sent < len(data):
+                    part = data[sent:sent + chunk]
+                    sock.sendall(part)
+                    sent += len(part)
+                    if progress:
+                        progress(sent, len(data), chunk)
+                code, text = self._read_line(reader)
+            except OSError as e:
+                # the device answers a rejected upload and closes, the answer may still be readable
+                try:
+                    code, text = self._read_line(reader)
+                except (OSError, OTAError):
+                    raise OTAError(f"upload interrupted after {sent} bytes: {e!r}") from e
+            self._check(code, text)
+            return text
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Upload images over the raw TCP listener of an ElegantOTA device")
+    parser.add_argument("address", help=f"host[:port] of the device, default port {DEFAULT_PORT}")
+    parser.add_argument("image", help="image file to upload")
+    parser.add_argument("--fs", action="store_true", help="upload a filesystem image")
+    parser.add_argument("--bundle", action="store_true",
+                        help="the encrypted image is a firmware + filesystem bundle, detected for plain bundles")
+    parser.add_argument("--user", help="username")
+    parser.add_argument("--password", help="password")
+    parser.add_argument("--wait", type=int, default=0, metavar="SECONDS",
+                        help="keep retrying for this long while the device is busy")
+    args = parser.parse_args(argv)
+
+    client = ElegantOTATcpClient(args.address, args.user, args.password)
+    started = time.monotonic()
+    deadline = started + args.wait
+
+    def progress(sent, total, chunk):
+        elapsed = max(time.monotonic() - started, 1e-6)
+        sys.stdout.write(f"\r{sent * 100 // total:3d}%  {sent / elapsed / 1024:7.1f} KiB/s")
+        sys.stdout.flush()
+
+    while True:
+        try:
+            answer = client.upload(args.image, "bundle" if args.bundle else "fs" if args.fs else "fr", progress)
+            break
+        except OTABusyError as e:
+            if time.monotonic() >= deadline:
+                print(f"\n{e}")
+                return 2
+            retry = int(e.retry_after) if str(e.retry_after).isdigit() else 5
+            time.sleep(min(retry, max(deadline - time.monotonic(), 0)))
+        except OTAError as e:
+            print(f"\n{e}")
+            return 1
+
+    print(f"\nUpload successful in {time.monotonic() - started:.1f}s. Server response: {answer}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
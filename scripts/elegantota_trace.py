@@ -0,0 +1,233 @@
+# Show and replay the upload trace of an ElegantOTA device (ElegantOTA.enableTrace(entries))
+#
+# The device records every fragment of the last upload with its arrival time, offset,
+# length and the time the write path took, and serves the ring at GET /ota/trace.bin.
+# "replay" feeds exactly that fragment pattern, with the recorded network gaps between
+# fragments, through the host model of the write path (ElegantOTAWriter and the sector
+# buffered Update.write of write_benchmark.py) for several write chunks. The comparison
+# shows what a different chunk would have done to the same upload, without a board.
+#
+#   python scripts/elegantota_trace.py show http://192.168.1.123 --user admin --password secret
+#   python scripts/elegantota_trace.py show http://192.168.1.123 --out trace.bin
+#   python scripts/elegantota_trace.py replay trace.bin
+#   python scripts/elegantota_trace.py replay trace.bin --chip ESP8266 --chunk 0 --chunk 4096
+#
+#   # upload to an emulated device with the trace enabled, then show and replay it
+#   python scripts/elegantota_trace.py simulate --chip ESP32-C3 --size 500000
+#
+# Only the python standard library is needed.
+
+import argparse
+import os
+import sys
+import tempfile
+from collections import Counter
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient, OTAError  # noqa: E402
+from elegantota_emulator import TRACE_ENTRY, TRACE_HEADER  # noqa: E402
+from write_benchmark import CHUNKS, CPU, Model, Writer  # noqa: E402
+
+MODES = ("firmware", "fs", "files", "bundle", "multicast")
+RESULTS = ("running", "ok", "failed")
+THROTTLED = 0x0001
+TCP = 0x0002
+# a write taking longer than this holds the AsyncTCP task long enough to be noticed
+STALL_US = 20000
+
+
+def parse(data):
+    """Returns (header dict, [(time_us, index, len, flags, latency_us)]) of a trace file."""
+    if len(data) < TRACE_HEADER.size or data[:4] != b"EOTR":
+        raise ValueError("not an ElegantOTA trace")
+    _, version, mode, result, _, chip, mhz, chunk, total, count, dropped = TRACE_HEADER.unpack_from(data)
+    if version != 1:
+        raise ValueError(f"trace version {version} not supported")
+    if len(data) < TRACE_HEADER.size + count * TRACE_ENTRY.size:
+        raise ValueError("trace truncated")
+    header = {"mode": MODES[mode] if mode < len(MODES) else "unknown",
+              "result": RESULTS[result] if result < len(RESULTS) else "unknown",
+              "chip": chip.split(b"\0")[0].decode(errors="replace"), "mhz": mhz, "chunk": chunk,
+              "total": total, "count": count, "dropped": dropped}
+    entries = [TRACE_ENTRY.unpack_from(data, TRACE_HEADER.size + i * TRACE_ENTRY.size) for i in range(count)]
+    return header, entries
+
+
+def load(source, username=None, password=None):
+    """Trace file bytes from a path or from the /ota/trace.bin endpoint of a device url."""
+    if source.startswith(("http://", "https://")):
+        client = ElegantOTAClient(source, username, password)
+        try:
+            return client.download("/ota/trace.bin")
+        finally:
+            client.close()
+    with open(source, "rb") as f:
+        return f.read()
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))] if values else 0
+
+
+def stats(entries, latencies, duration):
+    size = sum(e[2] for e in entries)
+    return {"bytes": size, "duration": duration, "rate": size / duration * 1e6 if duration else 0,
+            "p50": percentile(latencies, 50), "p99": percentile(latencies, 99),
+            "max": max(latencies, default=0), "stalls": sum(1 for v in latencies if v > STALL_US)}
+
+
+def recorded(entries):
+    if not entries:
+        return stats(entries, [], 0)
+    last = entries[-1]
+    return stats(entries, [e[4] for e in entries], last[0] + last[4] - entries[0][0])
+
+
+def replay(entries, chip, chunk, timing="gap", align=0):
+    """Feed the recorded fragments through the write path model, returns the stats of the replay.
+
+    timing "gap" keeps the idle time between the end of a write and the next fragment, the
+    network delay, so a faster write path also receives sooner. "arrival" keeps the recorded
+    arrival times, a fragment waits while the previous write is still running.
+    """
+    model = Model(chip)
+    writer = Writer(model, chunk)
+    latencies = []
+    end = prev_end = None
+    for t, _, length, _, latency in entries:
+        if end is None:
+            start = t
+        elif timing == "arrival":
+            start = max(t, end)
+        else:
+            start = end + max(0, t - prev_end)
+        cost = writer.write(length, align)
+        latencies.append(cost)
+        end = start + cost
+        prev_end = t + latency
+    if end is None:
+        return stats(entries, [], 0)
+    # flush() of the writer and Update.end() write the buffered rest
+    if writer.len:
+        end += model.update_write(writer.len, 0)
+    if model.buffered:
+        end += model.flush()
+    return stats(entries, latencies, end - entries[0][0])
+
+
+def show(header, entries):
+    print(f"{header['chip']} at {header['mhz']} MHz, {header['mode']} upload of {header['total']} bytes, {header['result']}, "
+          f"write chunk {header['chunk']}")
+    print(f"{header['count']} fragments recorded" + (f", {header['dropped']} older ones overwritten" if header["dropped"] else "")
+          + (", raw TCP" if entries and entries[0][3] & TCP else ""))
+    if not entries:
+        return
+    r = recorded(entries)
+    print(f"{r['bytes']} bytes in {r['duration'] / 1e6:.2f} s, {r['rate'] / 1000:.1f} kB/s")
+    sizes = Counter(e[2] for e in entries)
+    print("fragment sizes: " + ", ".join(f"{n} x {size}" for size, n in sizes.most_common(5)))
+    gaps = [b[0] - (a[0] + a[4]) for a, b in zip(entries, entries[1:])]
+    print(f"gap before a fragment: p50 {percentile(gaps, 50) / 1000:.2f} ms, p99 {percentile(gaps, 99) / 1000:.2f} ms, "
+          f"max {max(gaps, default=0) / 1000:.2f} ms")
+    print(f"write latency: p50 {r['p50'] / 1000:.2f} ms, p99 {r['p99'] / 1000:.2f} ms, max {r['max'] / 1000:.2f} ms, "
+          f"{r['stalls']} over {STALL_US // 1000} ms")
+    throttled = sum(1 for e in entries if e[3] & THROTTLED)
+    if throttled:
+        print(f"{throttled} fragments acknowledged late by the resource governor")
+    for t, index, length, _, latency in sorted(entries, key=lambda e: -e[4])[:3]:
+        print(f"  slowest: offset {index:8d}, {length:5d} bytes at {t / 1e6:7.3f} s, {latency / 1000:.2f} ms")
+
+
+def print_replay(header, entries, chip, chunks, timing, align):
+    print(f"replay on the {chip} model, timing {timing}")
+    print(f"{'':10s} {'chunk':>6s} {'kB/s':>8s} {'time s':>7s} {'p50 ms':>7s} {'p99 ms':>7s} {'max ms':>7s} {'stalls':>6s}")
+    rows = [("recorded", header["chunk"], recorded(entries))]
+    rows += [("model", chunk, replay(entries, chip, chunk, timing, align)) for chunk in chunks]
+    for name, chunk, r in rows:
+        print(f"{name:10s} {chunk:6d} {r['rate'] / 1000:8.1f} {r['duration'] / 1e6:7.2f} {r['p50'] / 1000:7.2f} "
+              f"{r['p99'] / 1000:7.2f} {r['max'] / 1000:7.2f} {r['stalls']:6d}")
+    return rows
+
+
+def chip_model(header, chip):
+    chip = chip or header["chip"]
+    if chip not in CPU:
+        raise ValueError(f"no model for chip {chip!r}, pick one with --chip: {', '.join(sorted(CPU))}")
+    return chip
+
+
+def simulate(args):
+    from elegantota_emulator import make_image, run_devices, stop_devices
+
+    device = run_devices(1, args.chip, 0, args.time_scale, tempfile.mkdtemp(prefix="elegantota-trace-"),
+                         tcp_port=0 if args.tcp else None, trace=args.entries, reboot_delay=0)[0]
+    image = make_image(args.chip, args.size)
+    try:
+        if args.tcp:
+            from elegantota_tcp import ElegantOTATcpClient
+            ElegantOTATcpClient(f"{device.host}:{device.tcp_port}").upload(image)
+        else:
+            client = ElegantOTAClient(device.url)
+            client.upload(image)
+            client.close()
+        header, entries = parse(load(device.url))
+    finally:
+        stop_devices([device])
+    show(header, entries)
+    print()
+    rows = print_replay(header, entries, args.chip, args.chunk or CHUNKS, args.timing, 0)
+    # the emulator forwards every fragment, its replay with chunk 0 follows the same flash model
+    return 0 if header["result"] == "ok" and header["count"] and all(r["rate"] for _, _, r in rows) else 1
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Show and replay the upload trace of an ElegantOTA device")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    for name, text in (("show", "decode a trace"), ("replay", "replay a trace through the write path model")):
+        p = sub.add_parser(name, help=text)
+        p.add_argument("source", help="trace file or device url (GET /ota/trace.bin)")
+        p.add_argument("--user", help="username")
+        p.add_argument("--password", help="password")
+        p.add_argument("--out", help="save the trace to this file")
+        if name == "replay":
+            p.add_argument("--chip", choices=sorted(CPU), help="chip model, default the chip of the trace")
+            p.add_argument("--chunk", type=int, action="append", help="write chunks to compare, default a sweep")
+            p.add_argument("--timing", default="gap", choices=("gap", "arrival"),
+                           help="keep the network gaps between fragments or their arrival times")
+            p.add_argument("--align", type=int, default=0, help="word alignment of the fragment buffers")
+
+    sim = sub.add_parser("simulate", help="trace an upload to an emulated device and replay it")
+    sim.add_argument("--chip", default="ESP32", choices=sorted(CPU))
+    sim.add_argument("--size", type=int, default=300000)
+    sim.add_argument("--entries", type=int, default=512, help="entries of the trace ring")
+    sim.add_argument("--tcp", action="store_true", help="upload over the raw TCP listener")
+    sim.add_argument("--chunk", type=int, action="append", help="write chunks to compare, default a sweep")
+    sim.add_argument("--timing", default="gap", choices=("gap", "arrival"))
+    sim.add_argument("--time-scale", type=float, default=1.0, help="scale of the flash timing model, 1 compares with the replay")
+
+    args = parser.parse_args(argv)
+    if args.command == "simulate":
+        return simulate(args)
+
+    try:
+        data = load(args.source, args.user, args.password)
+        header, entries = parse(data)
+        if args.command == "replay":
+            chip = chip_model(header, args.chip)
+    except (OTAError, OSError, ValueError) as e:
+        print(e)
+        return 1
+    if args.out:
+        with open(args.out, "wb") as f:
+            f.write(data)
+    if args.command == "show":
+        show(header, entries)
+    else:
+        print_replay(header, entries, chip, args.chunk or sorted({header["chunk"], *CHUNKS}), args.timing, args.align)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
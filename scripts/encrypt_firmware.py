@@ -0,0 +1,188 @@
+# Pack a firmware or filesystem image for encrypted upload to ElegantOTA
+#
+#   python scripts/encrypt_firmware.py --keygen ota.key
+#   python scripts/encrypt_firmware.py --key ota.key firmware.bin firmware.bin.enc
+#
+# The device needs the same 32 byte key, e.g. generated into a header:
+#   python scripts/encrypt_firmware.py --key ota.key --header include/ota_key.h
+# and ElegantOTA.setEncryptionKey(OTA_KEY) in setup().
+#
+# Container format, see src/ElegantOTACrypto.h:
+#   "EOTA" | version 1 | alg 1 | 2 reserved | plaintext size LE32 | 4 reserved | nonce 12 | 4 reserved
+#   AES-256-CTR ciphertext
+#   HMAC-SHA256 over header and ciphertext
+# Encryption key = SHA256(key || 0x01), MAC key = SHA256(key || 0x02).
+#
+# Uses the 'cryptography' package when installed, otherwise a (slow) pure python AES.
+
+import argparse
+import hashlib
+import hmac
+import logging
+import os
+import struct
+import sys
+
+logging.basicConfig(level=logging.INFO)
+
+MAGIC = b"EOTA"
+VERSION = 1
+ALG_CTR_HMAC = 1
+HEADER_LEN = 32
+
+
+# -- pure python AES (encryption direction only, CTR needs nothing else) ------------------
+
+def _xtime(a):
+    return ((a << 1) ^ 0x1B) & 0xFF if a & 0x80 else a << 1
+
+
+def _sbox():
+    sbox = [0] * 256
+    p = q = 1
+    while True:
+        p = p ^ _xtime(p)
+        q ^= q << 1
+        q ^= q << 2
+        q ^= q << 4
+        q &= 0xFF
+        if q & 0x80:
+            q ^= 0x09
+        x = q ^ ((q << 1) | (q >> 7)) ^ ((q << 2) | (q >> 6)) ^ ((q << 3) | (q >> 5)) ^ ((q << 4) | (q >> 4))
+        sbox[p] = (x ^ 0x63) & 0xFF
+        if p == 1:
+            break
+    sbox[0] = 0x63
+    return sbox
+
+
+SBOX = _sbox()
+
+
+class _PyAES:
+    def __init__(self, key):
+        nk, rounds = len(key) // 4, len(key) // 4 + 6
+        w = [list(key[i:i + 4]) for i in range(0, len(key), 4)]
+        rcon = 1
+        for i in range(nk, 4 * (rounds + 1)):
+            t = list(w[i - 1])
+            if i % nk == 0:
+                t = [SBOX[b] for b in t[1:] + t[:1]]
+                t[0] ^= rcon
+                rcon = _xtime(rcon)
+            elif nk > 6 and i % nk == 4:
+                t = [SBOX[b] for b in t]
+            w.append([a ^ b for a, b in zip(w[i - nk], t)])
+        self.round_keys = [sum(w[r * 4:r * 4 + 4], []) for r in range(rounds + 1)]
+
+    def encrypt_block(self, block):
+        s = [b ^ k for b, k in zip(block, self.round_keys[0])]
+        for r in range(1, len(self.round_keys)):
+            s = [SBOX[b] for b in s]
+            s = [s[(i + 4 * (i % 4)) % 16] for i in range(16)]  # ShiftRows on column major state
+            if r != len(self.round_keys) - 1:
+                m = []
+                for c in range(4):
+                    a = s[4 * c:4 * c + 4]
+                    t = a[0] ^ a[1] ^ a[2] ^ a[3]
+                    m += [a[i] ^ t ^ _xtime(a[i] ^ a[(i + 1) % 4]) for i in range(4)]
+                s = m
+            s = [b ^ k for b, k in zip(s, self.round_keys[r])]
+        return bytes(s)
+
+
+def aes_ctr(key, nonce, data):
+    """AES-256-CTR with counter block nonce(12) || big endian 32 bit block counter from 0."""
+    try:
+        from cryptography.hazmat.primitives.ciphers import Cipher, algorithms, modes
+        encryptor = Cipher(algorithms.AES(key), modes.CTR(nonce + b"\0\0\0\0")).encryptor()
+        return encryptor.update(data) + encryptor.finalize()
+    except ImportError:
+        pass
+    aes = _PyAES(key)
+    out = bytearray(len(data))
+    for block in range((len(data) + 15) // 16):
+        stream = aes.encrypt_block(nonce + struct.pack(">I", block))
+        chunk = data[block * 16:block * 16 + 16]
+        out[block * 16:block * 16 + len(chunk)] = bytes(a ^ b for a, b in zip(chunk, stream))
+    return bytes(out)
+
+
+def derive_keys(key):
+    return hashlib.sha256(key + b"\x01").digest(), hashlib.sha256(key + b"\x02").digest()
+
+
+def encrypt(key, plaintext, nonce=None):
+    enc_key, mac_key = derive_keys(key)
+    nonce = nonce or os.urandom(12)
+    header = MAGIC + bytes([VERSION, ALG_CTR_HMAC, 0, 0]) + struct.pack("<I", len(plaintext)) + bytes(4) + nonce + bytes(4)
+    ciphertext = aes_ctr(enc_key, nonce, plaintext)
+    mac = hmac.new(mac_key, header + ciphertext, hashlib.sha256).digest()
+    return header + ciphertext + mac
+
+
+def decrypt(key, container):
+    enc_key, mac_key = derive_keys(key)
+    header, body = container[:HEADER_LEN], container[HEADER_LEN:]
+    if header[:4] != MAGIC or header[4] != VERSION or header[5] != ALG_CTR_HMAC:
+        raise ValueError("not an encrypted ElegantOTA image")
+    size = struct.unpack_from("<I", header, 8)[0]
+    ciphertext, mac = body[:size], body[size:]
+    if not hmac.compare_digest(mac, hmac.new(mac_key, header + ciphertext, hashlib.sha256).digest()):
+        raise ValueError("authentication failed")
+    return aes_ctr(enc_key, header[16:28], ciphertext)
+
+
+def read_key(path):
+    with open(path, "rb") as f:
+        key = f.read()
+    if len(key) != 32:
+        key = bytes.fromhex(key.decode().strip())
+    if len(key) != 32:
+        raise ValueError("key must be 32 bytes (raw or hex)")
+    return key
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Encrypt images for ElegantOTA encrypted uploads")
+    parser.add_argument("--keygen", metavar="KEYFILE", help="write a new random key (hex) and exit")
+    parser.add_argument("--key", metavar="KEYFILE", help="key file, 32 raw bytes or 64 hex digits")
+    parser.add_argument("--header", metavar="FILE", help="write the key as C header for the device")
+    parser.add_argument("--decrypt", action="store_true", help="verify and decrypt instead")
+    parser.add_argument("source", nargs="?")
+    parser.add_argument("output", nargs="?")
+    args = parser.parse_args()
+
+    if args.keygen:
+        with open(args.keygen, "w") as f:
+            f.write(os.urandom(32).hex() + "\n")
+        logging.info("Generated key: %s", args.keygen)
+        return 0
+
+    if not args.key:
+        parser.error("--key is required")
+    key = read_key(args.key)
+
+    if args.header:
+        with open(args.header, "w") as f:
+            f.write("#pragma once\n\nstatic const uint8_t OTA_KEY[32] = {\n  ")
+            f.write(", ".join(f"0x{b:02x}" for b in key) + "\n};\n")
+        logging.info("Generated key header: %s", args.header)
+        if not args.source:
+            return 0
+
+    if not args.source:
+        parser.error("source image is required")
+    output = args.output or args.source + (".dec" if args.decrypt else ".enc")
+    with open(args.source, "rb") as f:
+        data = f.read()
+    result = decrypt(key, data) if args.decrypt else encrypt(key, data)
+    with open(output, "wb") as f:
+        f.write(result)
+    logging.info("%s %s -> %s (%d bytes, plaintext md5 %s)", "Decrypted" if args.decrypt else "Encrypted",
+                 args.source, output, len(result), hashlib.md5(result if args.decrypt else data).hexdigest())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,107 @@
+# File level filesystem sync for ElegantOTA devices
+#
+# Instead of replacing the whole LittleFS image (/ota/start?mode=fs), only files
+# whose MD5 differs are uploaded, files missing in the source directory are deleted
+# afterwards. No reboot is needed.
+#
+#   python scripts/fs_sync.py http://192.168.1.123 data
+#   python scripts/fs_sync.py http://192.168.1.123 data --dry-run
+#
+# --dry-run only lists the changes, it opens no session on the device.
+#
+# Protocol: see src/ElegantOTAFsSync.cpp
+
+import argparse
+import hashlib
+import json
+import os
+import sys
+import time
+from urllib.parse import quote
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient, OTAError  # noqa: E402
+
+
+def build_manifest(directory):
+    """Map of device path -> (md5, local file) for all files below directory."""
+    files = {}
+    for root, _, names in os.walk(directory):
+        for name in sorted(names):
+            local = os.path.join(root, name)
+            path = "/" + os.path.relpath(local, directory).replace(os.sep, "/")
+            with open(local, "rb") as f:
+                files[path] = (hashlib.md5(f.read()).hexdigest(), local)
+    return files
+
+
+def fetch_plan(client, manifest, dry_run=False, timeout=120.0):
+    """Post the manifest and poll until the device hashed its files, returns the plan."""
+    client.call("POST", "/ota/fs/manifest" + ("?dry=1" if dry_run else ""), manifest)
+    deadline = time.monotonic() + timeout
+    while True:
+        answer = json.loads(client.call("GET", "/ota/fs/manifest"))
+        if "upload" in answer:
+            return answer
+        if time.monotonic() > deadline:
+            raise OTAError("device did not finish checking the manifest")
+        time.sleep(0.5)
+
+
+def sync(client, directory, dry_run=False, log=print):
+    files = build_manifest(directory)
+    manifest = json.dumps({"files": [{"path": p, "md5": m} for p, (m, _) in files.items()]})
+
+    # a dry run opens no session, the device neither calls onStart/onEnd nor changes a file
+    if not dry_run:
+        client.start(None, "files")
+    plan = fetch_plan(client, manifest, dry_run)
+    upload, delete = plan.get("upload", []), plan.get("delete", [])
+
+    total = sum(os.path.getsize(local) for _, local in files.values())
+    transferred = 0
+    for path in upload:
+        md5, local = files[path]
+        with open(local, "rb") as f:
+            data = f.read()
+        log(f"upload {path} ({len(data)} bytes)")
+        if not dry_run:
+            client.post_file(f"{client.base}/ota/fs/file?path={quote(path)}&hash={md5}", data)
+        transferred += len(data)
+
+    # deletes go last so the device never misses a file that is still referenced
+    for path in delete:
+        log(f"delete {path}")
+        if not dry_run:
+            client.call("POST", f"/ota/fs/delete?path={quote(path)}")
+
+    if not dry_run:
+        client.call("GET", "/ota/fs/commit")
+    return {"files": len(files), "uploaded": len(upload), "deleted": len(delete),
+            "transferred": transferred, "total": total}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Sync a directory to the filesystem of an ElegantOTA device")
+    parser.add_argument("url", help="device url, e.g. http://192.168.1.123")
+    parser.add_argument("directory", help="local directory, e.g. the PlatformIO data folder")
+    parser.add_argument("--user", help="username")
+    parser.add_argument("--password", help="password")
+    parser.add_argument("--dry-run", action="store_true", help="only show what would change")
+    args = parser.parse_args()
+
+    client = ElegantOTAClient(args.url, args.user, args.password)
+    started = time.monotonic()
+    try:
+        result = sync(client, args.directory, args.dry_run)
+    except OTAError as e:
+        print(f"Sync failed: {e}")
+        return 1
+    print(f"Synced {result['files']} files in {time.monotonic() - started:.1f}s: "
+          f"{result['uploaded']} uploaded, {result['deleted']} deleted, "
+          f"{result['transferred']} of {result['total']} bytes transferred")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
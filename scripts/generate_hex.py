@@ -1,37 +1,137 @@
+# Builds src/ElegantOTAAssets.cpp from the files in ASSETS
+#
+# Every asset is gzipped (zopfli when available, otherwise gzip -9, without name and
+# timestamp so the output only changes with the source) and emitted as a 4 byte aligned
+# const PROGMEM array, plus one table entry with path, content type, length and an ETag
+# (md5 of the gzipped bytes). The table is declared in src/ElegantOTAAssets.h.
+#
+#   python scripts/generate_hex.py            regenerate when a source changed
+#   python scripts/generate_hex.py --force    always regenerate
+#   python scripts/generate_hex.py --check    exit 1 if the generated file is stale
+#
+# PlatformIO runs it before every build through scripts/pio_assets.py (library.json).
+# zopfli is used from the "zopfli" python package or a zopfli binary on the PATH.
+
+import argparse
+import gzip
+import hashlib
+import io
+import logging
 import os
-import subprocess, logging
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
 
 logging.basicConfig(level=logging.INFO)
 
-def generate_gzip_hex(source_file, output_file):
-    # Gzip the HTML file
-    gzip_file = source_file + '.gz'
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = "src/ElegantOTAAssets.cpp"
+
+# source, served path, content type
+ASSETS = [
+    ("include/ElegantOTA.html", "/update", "text/html"),
+]
+
+BYTES_PER_LINE = 12
+
+
+def sources_digest():
+    """md5 over all sources and their table entries, stored in the generated file."""
+    digest = hashlib.md5()
+    for source, path, content_type in ASSETS:
+        digest.update(f"{source}\0{path}\0{content_type}\0".encode())
+        with open(os.path.join(ROOT, source), "rb") as f:
+            digest.update(f.read())
+    return digest.hexdigest()
+
+
+def stored_digest():
+    try:
+        with open(os.path.join(ROOT, OUTPUT), encoding="utf-8") as f:
+            match = re.search(r"^// sources md5: ([0-9a-f]{32})$", f.read(4096), re.M)
+    except OSError:
+        return None
+    return match.group(1) if match else None
+
+
+def compress(data, name):
+    """gzip with the best ratio available, returns (bytes, method)."""
+    try:
+        import zopfli.gzip  # type: ignore
+        return zopfli.gzip.compress(data), "zopfli"
+    except ImportError:
+        pass
+    if shutil.which("zopfli"):
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, os.path.basename(name))
+            with open(path, "wb") as f:
+                f.write(data)
+            result = subprocess.run(["zopfli", "--i50", "-c", path], stdout=subprocess.PIPE)
+            if result.returncode == 0 and result.stdout:
+                return result.stdout, "zopfli"
+    if shutil.which("gzip"):
+        result = subprocess.run(["gzip", "-9", "-n", "-c"], input=data, stdout=subprocess.PIPE)
+        if result.returncode == 0 and result.stdout:
+            return result.stdout, "gzip -9"
+    out = io.BytesIO()
+    with gzip.GzipFile(filename="", mode="wb", fileobj=out, compresslevel=9, mtime=0) as f:
+        f.write(data)
+    return out.getvalue(), "gzip -9"
+
+
+def c_array(name, data):
+    lines = []
+    for i in range(0, len(data), BYTES_PER_LINE):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + BYTES_PER_LINE]) + ",")
+    body = "\n".join(lines)[:-1] if lines else ""
+    return f"alignas(4) static const uint8_t {name}[] PROGMEM = {{\n{body}\n}};\n"
+
+
+def generate(digest):
+    arrays = []
+    entries = []
+    for index, (source, path, content_type) in enumerate(ASSETS):
+        with open(os.path.join(ROOT, source), "rb") as f:
+            raw = f.read()
+        data, method = compress(raw, source)
+        etag = hashlib.md5(data).hexdigest()
+        name = f"asset_{index}"
+        logging.info("%s -> %s: %u -> %u bytes (%s)", source, path, len(raw), len(data), method)
+        arrays.append(f"// {source}, {len(raw)} bytes, {method}\n" + c_array(name, data))
+        entries.append(f'  {{ "{path}", "{content_type}", {name}, {len(data)}, "\\"{etag}\\"" }},')
 
-    if os.path.exists(gzip_file):
-        os.remove(gzip_file)
+    return ("// generated by scripts/generate_hex.py, do not edit\n"
+            f"// sources md5: {digest}\n\n"
+            '#include "ElegantOTAAssets.h"\n\n'
+            + "\n".join(arrays) + "\n"
+            "const ElegantOTAAsset elegantota_assets[] = {\n"
+            + "\n".join(entries) + "\n"
+            "};\n\n"
+            "const size_t elegantota_assets_count = sizeof(elegantota_assets) / sizeof(elegantota_assets[0]);\n")
 
-    if os.name == 'nt':
-        subprocess.run(['7z', 'a', '-tgzip', gzip_file, source_file], stdout=subprocess.DEVNULL)
-    else:
-        subprocess.run(['gzip', '-c', source_file], stdout=open(gzip_file, 'wb'))
 
-    if (not os.path.exists(gzip_file)):
-        logging.error('Failed writing into gzip file: %s', gzip_file)
-        return
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Generate the flash resident UI assets")
+    parser.add_argument("--force", action="store_true", help="regenerate even if the sources did not change")
+    parser.add_argument("--check", action="store_true", help="only check, exit 1 if the generated file is stale")
+    args = parser.parse_args(argv)
 
-    # Convert the gzip file to hex
-    with open(output_file, 'w') as f:
-        subprocess.run(['xxd', '-i', gzip_file], stdout=f) # '-nELEGANT_HTML' not longer supported in newer xxd versions
+    digest = sources_digest()
+    if digest == stored_digest() and not args.force:
+        logging.info("%s is up to date", OUTPUT)
+        return 0
+    if args.check:
+        logging.error("%s is stale, run scripts/generate_hex.py", OUTPUT)
+        return 1
 
-    # Clean up the gzip file
-    os.remove(gzip_file)
+    source = generate(digest)
+    with open(os.path.join(ROOT, OUTPUT), "w", encoding="utf-8", newline="\n") as f:
+        f.write(source)
+    logging.info("Generated %s", OUTPUT)
+    return 0
 
-def main():
-    source_file = 'include/ElegantOTA.html'
-    output_file = 'src/elop.cpp'
-    logging.info('Generating hex file: %s -> %s', source_file, output_file)
-    
-    generate_gzip_hex(source_file, output_file)
 
-if __name__ == '__main__':
-    main()
\ No newline at end of file
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,98 @@
+# Upload throughput of an emulated device while its application server is under load
+#
+# Compares three setups of the device:
+#   shared     OTA endpoints on the application's server (ElegantOTA.begin(&server))
+#   dedicated  OTA endpoints on their own listener (ElegantOTA.begin(port))
+#   quiesce    dedicated listener + ElegantOTA.setQuiesceServer(&server)
+# and uploads one image per setup and number of concurrent application clients, each
+# looping GET /api. The emulator runs upload data and application handlers through one
+# queue, like the single AsyncTCP task serves every server on the device, flash writes
+# follow its timing model.
+#
+#   python scripts/listener_benchmark.py
+#   python scripts/listener_benchmark.py --clients 0 8 32 --app-cost 0.01 --size 500000
+#
+# Only the python standard library is needed.
+
+import argparse
+import http.client
+import os
+import sys
+import threading
+import time
+from urllib.parse import urlparse
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient  # noqa: E402
+from elegantota_emulator import APP_COST, EmulatedDevice, make_image  # noqa: E402
+
+SETUPS = {
+    "shared": {"ota_port": None, "quiesce": False},
+    "dedicated": {"ota_port": 0, "quiesce": False},
+    "quiesce": {"ota_port": 0, "quiesce": True},
+}
+
+
+def app_client(url, stop, counts):
+    """Loop GET /api on one keep-alive connection, reconnect when refused."""
+    parsed = urlparse(url)
+    conn = None
+    while not stop.is_set():
+        try:
+            if conn is None:
+                conn = http.client.HTTPConnection(parsed.hostname, parsed.port, timeout=5)
+            conn.request("GET", "/api")
+            response = conn.getresponse()
+            response.read()
+            counts["ok"] += 1
+        except (OSError, http.client.HTTPException):
+            counts["refused"] += 1
+            if conn is not None:
+                conn.close()
+            conn = None
+            time.sleep(0.01)
+    if conn is not None:
+        conn.close()
+
+
+def run(setup, clients, image, chip, app_cost):
+    device = EmulatedDevice(chip, 0, time_scale=1.0, reboot_delay=0, app_cost=app_cost, **SETUPS[setup]).start()
+    stop = threading.Event()
+    counts = {"ok": 0, "refused": 0}
+    threads = [threading.Thread(target=app_client, args=(device.app_url, stop, counts), daemon=True) for _ in range(clients)]
+    for t in threads:
+        t.start()
+    time.sleep(0.2)
+    try:
+        started = time.monotonic()
+        ElegantOTAClient(device.url).upload(image)
+        seconds = time.monotonic() - started
+    finally:
+        stop.set()
+        for t in threads:
+            t.join()
+        device.stop()
+    return {"setup": setup, "clients": clients, "kbps": len(image) / seconds / 1024, "seconds": seconds,
+            "app_rps": device.app_requests / seconds}
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Upload throughput under application load, shared vs. dedicated OTA listener")
+    parser.add_argument("--clients", type=int, nargs="+", default=[0, 4, 16, 32], help="concurrent application clients")
+    parser.add_argument("--setup", nargs="+", choices=list(SETUPS), default=list(SETUPS))
+    parser.add_argument("--size", type=int, default=256 * 1024, help="image size in bytes")
+    parser.add_argument("--chip", default="ESP32")
+    parser.add_argument("--app-cost", type=float, default=APP_COST, help="seconds one application request busies the AsyncTCP task")
+    args = parser.parse_args(argv)
+
+    image = make_image(args.chip, args.size, "2.0.0")
+    print(f"{'setup':10s} {'clients':>7s} {'KiB/s':>8s} {'seconds':>8s} {'app req/s':>9s}")
+    for setup in args.setup:
+        for clients in args.clients:
+            r = run(setup, clients, image, args.chip, args.app_cost)
+            print(f"{r['setup']:10s} {r['clients']:7d} {r['kbps']:8.1f} {r['seconds']:8.2f} {r['app_rps']:9.1f}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
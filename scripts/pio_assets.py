@@ -0,0 +1,18 @@
+# PlatformIO pre-build step of the library (library.json "build.extraScript")
+#
+# Regenerates src/ElegantOTAAssets.cpp when include/ElegantOTA.html or another asset in
+# scripts/generate_hex.py changed, before the library sources are compiled.
+
+import inspect
+import os
+import sys
+
+Import("env")  # noqa: F821
+
+SCRIPTS = os.path.dirname(os.path.abspath(inspect.getfile(inspect.currentframe())))
+sys.path.insert(0, SCRIPTS)
+import generate_hex  # noqa: E402
+
+if generate_hex.main([]) != 0:
+    sys.stderr.write("ElegantOTA: generating the UI assets failed\n")
+    env.Exit(1)  # noqa: F821
@@ -0,0 +1,229 @@
+# Sparse form of firmware and filesystem images for ElegantOTA uploads
+#
+# LittleFS images and padded application binaries consist mostly of erased flash
+# (0xFF). The sparse form keeps only the pages holding data, as (offset, length, data)
+# extents behind a 32 byte header with the size and MD5 of the full image. The device
+# expands it while it streams in (src/ElegantOTASparse.h): the holes are erased and
+# the MD5 of the full image is verified before the update is committed.
+#
+#   python scripts/sparse_image.py convert .pio/build/esp32dev/littlefs.bin littlefs.eots
+#   python scripts/sparse_image.py stats .pio/build/esp32dev/littlefs.bin .pio/build/esp32dev/firmware.bin
+#   python scripts/sparse_image.py expand littlefs.eots littlefs.bin
+#
+#   # upload the sparse image (the clients recognize it by its magic)
+#   python scripts/elegantota_client.py http://192.168.1.123 littlefs.eots --fs
+#
+#   # synthetic LittleFS images of several fill levels, full and sparse upload to an emulated device
+#   python scripts/sparse_image.py simulate --chip ESP32 --size 1441792
+#
+# Only the python standard library is needed.
+
+import argparse
+import hashlib
+import os
+import random
+import struct
+import sys
+import tempfile
+import time
+
+MAGIC = b"EOTS"
+VERSION = 1
+HEADER = struct.Struct("<4sB3xII16s")
+EXTENT = struct.Struct("<II")
+# a hole is a run of erased pages, the unit the flash programs
+PAGE = 256
+
+
+def extents(data, page=PAGE):
+    """[(offset, length)] of the runs of pages that are not completely erased."""
+    runs = []
+    start = None
+    for offset in range(0, len(data), page):
+        chunk = data[offset:offset + page]
+        empty = chunk.count(0xFF) == len(chunk)
+        if not empty and start is None:
+            start = offset
+        elif empty and start is not None:
+            runs.append((start, offset - start))
+            start = None
+    if start is not None:
+        runs.append((start, len(data) - start))
+    return runs
+
+
+def to_sparse(data, page=PAGE):
+    runs = extents(data, page)
+    out = [HEADER.pack(MAGIC, VERSION, len(data), len(runs), hashlib.md5(data).digest())]
+    for offset, length in runs:
+        out.append(EXTENT.pack(offset, length))
+        out.append(data[offset:offset + length])
+    return b"".join(out)
+
+
+def is_sparse(data):
+    return bytes(data[:4]) == MAGIC
+
+
+def header(data):
+    """(size, extent count, md5 hex or None) of a sparse image."""
+    magic, version, size, count, md5 = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("not a sparse image")
+    return size, count, md5.hex() if any(md5) else None
+
+
+def expand(data):
+    size, count, md5 = header(data)
+    image = bytearray(b"\xff" * size)
+    pos = HEADER.size
+    end = 0
+    for _ in range(count):
+        offset, length = EXTENT.unpack_from(data, pos)
+        pos += EXTENT.size
+        if offset < end or offset + length > size:
+            raise ValueError("invalid extent")
+        image[offset:offset + length] = data[pos:pos + length]
+        pos += length
+        end = offset + length
+    if pos != len(data):
+        raise ValueError("unexpected data after sparse image")
+    if md5 and hashlib.md5(image).hexdigest() != md5:
+        raise ValueError("MD5 of the expanded image does not match")
+    return bytes(image)
+
+
+def make_littlefs(size, fill, seed=0, block=4096):
+    """Synthetic LittleFS image: metadata pairs at blocks 0/1, fill % of the blocks hold file data.
+
+    Like mklittlefs output, every block that is not used stays erased, metadata blocks and the
+    last block of a file are only partly written.
+    """
+    rnd = random.Random(seed)
+    image = bytearray(b"\xff" * size)
+    blocks = size // block
+    for b in (0, 1):
+        image[b * block:b * block + 600] = rnd.randbytes(600)
+    used = 2
+    target = max(2, blocks * fill // 100)
+    b = 2
+    while used < target and b < blocks:
+        file_blocks = min(rnd.randint(1, 24), target - used, blocks - b)
+        for i in range(file_blocks):
+            length = block if i < file_blocks - 1 else rnd.randint(64, block)
+            image[(b + i) * block:(b + i) * block + length] = rnd.randbytes(length)
+        used += file_blocks
+        b += file_blocks + (rnd.randint(0, 2) if fill < 90 else 0)
+    return bytes(image)
+
+
+def report(name, data, page=PAGE):
+    runs = extents(data, page)
+    sparse = to_sparse(data, page)
+    pages = (len(data) + page - 1) // page
+    programmed = sum((length + page - 1) // page for _, length in runs)
+    print(f"{name[:40]:40s} {len(data):9d} {len(sparse):9d} {100 - len(sparse) * 100 / max(len(data), 1):6.1f}% "
+          f"{len(runs):7d} {programmed:6d}/{pages}")
+    return len(data), len(sparse)
+
+
+def print_header():
+    print(f"{'image':40s} {'bytes':>9s} {'sparse':>9s} {'saved':>7s} {'extents':>7s} {'pages':>6s}")
+
+
+def simulate(args):
+    from elegantota_client import ElegantOTAClient
+    from elegantota_emulator import run_devices, stop_devices
+
+    print_header()
+    images = {f"littlefs {fill}% used": make_littlefs(args.size, fill, seed=fill) for fill in args.fill}
+    for name, data in images.items():
+        report(name, data)
+    print()
+    print(f"upload to an emulated {args.chip}, time scale {args.time_scale}")
+    print(f"{'image':24s} {'full s':>7s} {'sparse s':>8s} {'sent':>9s} {'flash':>6s}")
+    device = run_devices(1, args.chip, 0, args.time_scale, tempfile.mkdtemp(prefix="elegantota-sparse-"), reboot_delay=0)[0]
+    ok = True
+    try:
+        for name, data in images.items():
+            sparse = to_sparse(data)
+            timings = []
+            for payload in (data, sparse):
+                client = ElegantOTAClient(device.url)
+                started = time.monotonic()
+                client.upload(payload, mode="fs")
+                timings.append(time.monotonic() - started)
+                client.close()
+                with open(os.path.join(device.flash_dir, f"{device.port}-fs.bin"), "rb") as f:
+                    same = f.read() == data
+                ok = ok and same
+            print(f"{name:24s} {timings[0]:7.2f} {timings[1]:8.2f} {len(sparse):9d} {'same' if same else 'DIFFERS':>6s}")
+    finally:
+        stop_devices([device])
+    return 0 if ok else 1
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Sparse form of firmware and filesystem images")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    convert = sub.add_parser("convert", help="write the sparse form of an image")
+    convert.add_argument("image")
+    convert.add_argument("output")
+
+    stats = sub.add_parser("stats", help="transfer reduction of images")
+    stats.add_argument("images", nargs="+")
+
+    exp = sub.add_parser("expand", help="restore the full image of a sparse one, checks its MD5")
+    exp.add_argument("sparse")
+    exp.add_argument("output")
+
+    sim = sub.add_parser("simulate", help="synthetic LittleFS images, full and sparse upload to an emulated device")
+    sim.add_argument("--chip", default="ESP32")
+    sim.add_argument("--size", type=int, default=0x160000, help="filesystem size, default the ESP32 4 MB layout")
+    sim.add_argument("--fill", type=int, action="append", help="percent of used blocks, default 5, 25 and 60")
+    sim.add_argument("--time-scale", type=float, default=0.2, help="scale of the flash timing model")
+
+    args = parser.parse_args(argv)
+    if args.command == "simulate":
+        args.fill = args.fill or [5, 25, 60]
+        return simulate(args)
+
+    if args.command == "convert":
+        with open(args.image, "rb") as f:
+            data = f.read()
+        if is_sparse(data):
+            print(f"{args.image} is sparse already")
+            return 1
+        with open(args.output, "wb") as f:
+            f.write(to_sparse(data))
+        print_header()
+        report(os.path.basename(args.image), data)
+        return 0
+
+    if args.command == "expand":
+        with open(args.sparse, "rb") as f:
+            data = f.read()
+        try:
+            image = expand(data)
+        except (ValueError, struct.error) as e:
+            print(f"{args.sparse}: {e}")
+            return 1
+        with open(args.output, "wb") as f:
+            f.write(image)
+        return 0
+
+    print_header()
+    total = sparse = 0
+    for path in args.images:
+        with open(path, "rb") as f:
+            full, small = report(path, f.read())
+        total += full
+        sparse += small
+    if len(args.images) > 1:
+        print(f"{'total':40s} {total:9d} {sparse:9d} {100 - sparse * 100 / max(total, 1):6.1f}%")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
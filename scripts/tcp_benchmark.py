@@ -0,0 +1,75 @@
+# Upload time over HTTP (/ota/start + multipart /ota/upload) against the raw TCP listener
+#
+# Uploads the same image to an emulated device once per path and prints seconds and
+# KiB/s. The emulator charges the byte wise multipart parsing of AsyncWebServer to the
+# HTTP path and the flash timing model to both; --time-scale 0 leaves only the protocol
+# cost (round trips, framing) on the host.
+#
+#   python scripts/tcp_benchmark.py
+#   python scripts/tcp_benchmark.py --chip ESP8266 --size 300000 --user admin --password secret
+#   python scripts/tcp_benchmark.py --time-scale 0 --size 100000 1000000 --repeat 5
+#
+# Only the python standard library is needed.
+
+import argparse
+import os
+import statistics
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_client import ElegantOTAClient  # noqa: E402
+from elegantota_emulator import EmulatedDevice, make_image  # noqa: E402
+from elegantota_tcp import ElegantOTATcpClient  # noqa: E402
+
+
+def upload(device, path, image, username, password):
+    if path == "http":
+        client = ElegantOTAClient(device.url, username, password)
+    else:
+        client = ElegantOTATcpClient(f"{device.host}:{device.tcp_port}", username, password)
+    started = time.monotonic()
+    try:
+        client.upload(image)
+    finally:
+        if path == "http":
+            client.close()
+    return time.monotonic() - started
+
+
+def run(chip, size, repeat, time_scale, username, password):
+    image = make_image(chip, size, "2.0.0")
+    device = EmulatedDevice(chip, 0, time_scale=time_scale, reboot_delay=0, tcp_port=0,
+                            username=username, password=password).start()
+    rows = []
+    try:
+        for path in ("http", "tcp"):
+            seconds = statistics.median(upload(device, path, image, username, password) for _ in range(repeat))
+            rows.append({"chip": chip, "size": size, "path": path, "seconds": seconds, "kbps": size / seconds / 1024})
+    finally:
+        device.stop()
+    return rows
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Raw TCP upload against HTTP multipart upload on an emulated device")
+    parser.add_argument("--chip", nargs="+", default=["ESP32", "ESP8266"])
+    parser.add_argument("--size", type=int, nargs="+", default=[64 * 1024, 512 * 1024], help="image sizes in bytes")
+    parser.add_argument("--repeat", type=int, default=3, help="uploads per path, the median is printed")
+    parser.add_argument("--time-scale", type=float, default=1.0, help="scale of the device timing model, 0 disables it")
+    parser.add_argument("--user", default="")
+    parser.add_argument("--password", default="")
+    args = parser.parse_args(argv)
+
+    print(f"{'chip':9s} {'size':>8s} {'path':5s} {'seconds':>8s} {'KiB/s':>8s} {'gain':>6s}")
+    for chip in args.chip:
+        for size in args.size:
+            http, tcp = run(chip, size, args.repeat, args.time_scale, args.user or None, args.password or None)
+            for r in (http, tcp):
+                gain = f"{(http['seconds'] / r['seconds'] - 1) * 100:+5.1f}%" if r is tcp else ""
+                print(f"{r['chip']:9s} {r['size']:8d} {r['path']:5s} {r['seconds']:8.3f} {r['kbps']:8.1f} {gain:>6s}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
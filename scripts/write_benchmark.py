@@ -0,0 +1,185 @@
+# Host model of the ElegantOTA write path, counterpart of examples/WriteBenchmark
+#
+# Sweeps fragment size (what AsyncWebServer hands to the upload handler), source
+# alignment of the fragments and the write chunk of ElegantOTAWriter (0 = fragments
+# go to Update.write unchanged, N = coalesced to N byte blocks) and prints MB/s and
+# the latency of a single upload handler call per chip family.
+#
+#   python scripts/write_benchmark.py
+#   python scripts/write_benchmark.py --chip ESP8266 --size 500000
+#   python scripts/write_benchmark.py --defaults
+#
+# Flash erase/program times come from the emulator (elegantota_emulator.CHIPS), call
+# overhead and memcpy rates from the CPU table below. Both are models; replace them with
+# the numbers examples/WriteBenchmark prints on real boards before setting ELEGANTOTA_WRITE_CHUNK
+# or calling setWriteChunk() (--defaults prints the choice of this model).
+
+import argparse
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from elegantota_emulator import CHIPS, SECTOR, PAGE  # noqa: E402
+
+# per chip family:
+#   update_us   fixed cost of one Update.write call (checks, call, memcpy setup)
+#   writer_us   fixed cost of one ElegantOTAWriter::write call
+#   copy        memcpy MB/s when source and destination share the word alignment
+#   copy_u      memcpy MB/s otherwise (byte loop)
+#   ram         free heap at the start of a typical session, the write chunk is taken from it
+CPU = {
+    "ESP8266":  {"update_us": 6.0, "writer_us": 1.5, "copy": 40,  "copy_u": 11, "ram": 40000},
+    "ESP32":    {"update_us": 2.0, "writer_us": 0.5, "copy": 160, "copy_u": 45, "ram": 200000},
+    "ESP32-S2": {"update_us": 2.2, "writer_us": 0.6, "copy": 140, "copy_u": 40, "ram": 150000},
+    "ESP32-S3": {"update_us": 1.8, "writer_us": 0.5, "copy": 180, "copy_u": 50, "ram": 250000},
+    "ESP32-C3": {"update_us": 3.0, "writer_us": 0.8, "copy": 110, "copy_u": 30, "ram": 180000},
+    "ESP32-C6": {"update_us": 3.0, "writer_us": 0.8, "copy": 110, "copy_u": 30, "ram": 250000},
+    "ESP32-H2": {"update_us": 5.0, "writer_us": 1.3, "copy": 60,  "copy_u": 16, "ram": 200000},
+}
+
+FRAGMENTS = (256, 536, 1072, 1436, 1460, 2920, 5744)
+ALIGNMENTS = (0, 2, 1)
+CHUNKS = (0, 512, 1024, 2048, 4096)
+# a default needs to beat plain forwarding by this much, the buffer costs heap
+MIN_GAIN = 0.03
+
+
+class Model:
+    """Timing of Update.write, sector buffered like the Arduino cores."""
+
+    def __init__(self, chip):
+        self.cpu = CPU[chip]
+        self.flash = CHIPS[chip]
+        self.buffered = 0
+        self.flushes = 0
+
+    def copy(self, n, src_align, dst_align):
+        rate = self.cpu["copy"] if src_align % 4 == dst_align % 4 else self.cpu["copy_u"]
+        return n / rate  # bytes / (MB/s) = us
+
+    def flush(self):
+        return self.flash["erase_ms"] * 1000 + SECTOR // PAGE * self.flash["page_us"]
+
+    def update_write(self, n, src_align):
+        cost = self.cpu["update_us"]
+        while n:
+            take = min(n, SECTOR - self.buffered)
+            cost += self.copy(take, src_align, self.buffered)
+            self.buffered += take
+            src_align += take
+            n -= take
+            if self.buffered == SECTOR:
+                cost += self.flush()
+                self.flushes += 1
+                self.buffered = 0
+        return cost
+
+
+class Writer:
+    """Mirror of ElegantOTAWriter::write()."""
+
+    def __init__(self, model, chunk):
+        self.model = model
+        self.chunk = chunk
+        self.len = 0
+
+    def write(self, n, align):
+        m = self.model
+        if not self.chunk:
+            return m.update_write(n, align)
+        cost = m.cpu["writer_us"]
+        while n:
+            if self.len == 0 and n >= self.chunk:
+                # whole blocks go straight from the fragment
+                direct = n - n % self.chunk
+                cost += m.update_write(direct, align)
+                align += direct
+                n -= direct
+                continue
+            take = min(n, self.chunk - self.len)
+            cost += m.copy(take, align, self.len)
+            self.len += take
+            align += take
+            n -= take
+            if self.len == self.chunk:
+                cost += m.update_write(self.chunk, 0)
+                self.len = 0
+        return cost
+
+
+def run(chip, fragment, align, chunk, size):
+    model = Model(chip)
+    writer = Writer(model, chunk)
+    calls = []
+    left = size
+    while left:
+        n = min(fragment, left)
+        calls.append(writer.write(n, align))
+        left -= n
+    total = sum(calls) / 1e6
+    flash = model.flushes * model.flush() / 1e6
+    calls.sort()
+    return {"chip": chip, "fragment": fragment, "align": align, "chunk": chunk,
+            "mbps": size / total / 1e6, "p99_ms": calls[int(len(calls) * 0.99) - 1] / 1000,
+            "max_ms": calls[-1] / 1000, "cpu_ms": (total - flash) * 1000, "heap": chunk}
+
+
+def sweep(chips, size):
+    return [run(chip, fragment, align, chunk, size)
+            for chip in chips for fragment in FRAGMENTS for align in ALIGNMENTS for chunk in CHUNKS]
+
+
+def choose_defaults(results):
+    """Pick the chunk per chip that is fastest over all fragment sizes and alignments."""
+    defaults = {}
+    for chip in dict.fromkeys(r["chip"] for r in results):
+        rows = [r for r in results if r["chip"] == chip]
+        score = {}
+        for chunk in CHUNKS:
+            # geometric mean of the speed-up against plain forwarding
+            product, count = 1.0, 0
+            for r in rows:
+                if r["chunk"] != chunk:
+                    continue
+                base = next(b for b in rows if b["chunk"] == 0 and b["fragment"] == r["fragment"] and b["align"] == r["align"])
+                product *= r["mbps"] / base["mbps"]
+                count += 1
+            score[chunk] = product ** (1 / count)
+        best = max(score, key=score.get)
+        if best and (score[best] - 1 < MIN_GAIN or best * 10 > CPU[chip]["ram"]):
+            best = 0
+        defaults[chip] = {"chunk": best, "gain": score[best] - 1}
+    return defaults
+
+
+def print_table(results):
+    print(f"{'chip':9s} {'frag':>5s} {'align':>5s} {'chunk':>5s} {'MB/s':>7s} {'p99 ms':>7s} {'max ms':>7s} {'cpu ms':>7s}")
+    for r in results:
+        print(f"{r['chip']:9s} {r['fragment']:5d} {r['align']:5d} {r['chunk']:5d} {r['mbps']:7.3f} "
+              f"{r['p99_ms']:7.2f} {r['max_ms']:7.2f} {r['cpu_ms']:7.1f}")
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Model of the ElegantOTA write path per chip family")
+    parser.add_argument("--chip", action="append", choices=sorted(CPU), help="chip families, default all")
+    parser.add_argument("--size", type=int, default=1000000, help="image size in bytes")
+    parser.add_argument("--defaults", action="store_true", help="only print the chosen write chunk per chip")
+    parser.add_argument("--json", action="store_true", help="print the results as json")
+    args = parser.parse_args(argv)
+
+    results = sweep(args.chip or list(CPU), args.size)
+    defaults = choose_defaults(results)
+    if args.json:
+        print(json.dumps({"results": results, "defaults": defaults}, indent=2))
+        return 0
+    if not args.defaults:
+        print_table(results)
+        print()
+    for chip, d in defaults.items():
+        print(f"{chip:9s} write chunk {d['chunk']:5d}  ({d['gain'] * 100:+.1f}% against forwarding)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,33 +1,32 @@
 #include "ElegantOTA.h"
+#include <time.h>
+
+ElegantOTAClass * ElegantOTAClass::_update_owner = NULL;
 
 ElegantOTAClass::ElegantOTAClass(){}
 
+void ElegantOTAClass::begin(uint16_t port, const char * username, const char * password) {
+  if (_own_server == NULL) {
+    _own_server = new ELEGANTOTA_WEBSERVER(port);
+  }
+  this->begin(_own_server, username, password);
+  _own_server->begin();
+  this->logf("OTA listener on port %u", port);
+}
+
+void ElegantOTAClass::setQuiesceServer(ELEGANTOTA_WEBSERVER *server) {
+  this->_quiesce_server = server;
+}
+
 void ElegantOTAClass::begin(ELEGANTOTA_WEBSERVER *server, const char * username, const char * password) {
   _server = server;
   this->setAuth(username, password);
 
   // determine chip family
-  #ifdef ESP32
-    String variantString = ARDUINO_VARIANT;
-  #else
-    String variantString = "esp8266";
-  #endif
+  this->ChipFamily = ElegantOTAImageCheck::deviceChipFamily();
 
-  if (variantString == "esp32s3") {
-      this->ChipFamily = "ESP32-S3";
-  } else if (variantString == "esp32c3") {
-      this->ChipFamily = "ESP32-C3";
-  } else if (variantString == "esp32s2") {
-      this->ChipFamily = "ESP32-S2";
-  } else if (variantString == "esp32c6") {
-      this->ChipFamily = "ESP32-C6";
-  } else if (variantString == "esp32h2") {
-      this->ChipFamily = "ESP32-H2";
-  } else if (variantString == "esp8266") {
-      this->ChipFamily = "ESP8266";
-  } else {
-      this->ChipFamily = "ESP32";
-  }
+  // the UI is served from flash, compare the free heap with and without ElegantOTA
+  this->logf("UI assets: %u bytes in flash, free heap %u", (unsigned)elegantota_assets_size(), (unsigned)ESP.getFreeHeap());
 
  #ifdef CORS_DEBUG
   DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
@@ -36,20 +35,30 @@ void ElegantOTAClass::begin(ELEGANTOTA_WEBSERVER *server, const char * username,
  #endif
  
   _server->on("/update", HTTP_GET, [&](AsyncWebServerRequest *request){
-      if(_authenticate && !request->authenticate(_username.c_str(), _password.c_str())){
+      if(!this->isAuthorized(request)){
         return request->requestAuthentication();
       }
-      #if defined(ASYNCWEBSERVER_VERSION) && ASYNCWEBSERVER_VERSION_MAJOR > 2  // This means we are using recommended fork of AsyncWebServer
-        AsyncWebServerResponse *response = request->beginResponse(200, "text/html", include_ElegantOTA_html_gz, include_ElegantOTA_html_gz_len);
-      #else
-        AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", include_ElegantOTA_html_gz, include_ElegantOTA_html_gz_len);
-      #endif
-      response->addHeader("Content-Encoding", "gzip");
-      request->send(response);
+      // every page load holds TCP buffers until it is acked, keep their number bounded
+      if (_ui_downloads >= ELEGANTOTA_UI_MAX_DOWNLOADS) {
+        AsyncWebServerResponse *response = request->beginResponse(503, "text/html", "<meta http-equiv=\"refresh\" content=\"1\">Busy, retrying...");
+        response->addHeader("Retry-After", "1");
+        return request->send(response);
+      }
+      const ElegantOTAAsset *page = elegantota_find_asset("/update");
+      if (page == NULL) {
+        return request->send(404);
+      }
+      // the browser revalidates the cached page, a matching ETag saves the whole download
+      if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == page->etag) {
+        AsyncWebServerResponse *response = request->beginResponse(304);
+        response->addHeader("ETag", page->etag);
+        return request->send(response);
+      }
+      request->send(new ElegantOTAUiResponse(*page, _ui_downloads));
   });
   
   _server->on("/getdeviceinfo", HTTP_GET, [&](AsyncWebServerRequest *request){
-      if(_authenticate && !request->authenticate(_username.c_str(), _password.c_str())){
+      if(!this->isAuthorized(request)){
         return request->requestAuthentication();
       }
       AsyncResponseStream *response = request->beginResponseStream("application/json");
@@ -59,174 +68,185 @@ void ElegantOTAClass::begin(ELEGANTOTA_WEBSERVER *server, const char * username,
 
       JsonDocument doc;
       this->getDeviceInfo(doc);
-      String ret("");
-      ArduinoJson::serializeJson(doc, ret);
+      ArduinoJson::serializeJson(doc, *response);
 
-      response->print(ret);
       request->send(response);
 
   });
   
   _server->on("/ota/start", HTTP_GET, [&](AsyncWebServerRequest *request) {
-      if (_authenticate && !request->authenticate(_username.c_str(), _password.c_str())) {
+      if (!this->isAuthorized(request)) {
         return request->requestAuthentication();
       }
 
+      // Only one OTA session at a time, other clients have to retry later
+      if (this->isSessionBusy(request)) {
+        return this->sendSessionBusy(request);
+      }
+
+      if (!this->admitUpdate()) {
+        AsyncWebServerResponse *response = request->beginResponse(503, "text/plain", "Not enough free memory");
+        response->addHeader("Retry-After", "5");
+        return request->send(response);
+      }
+
       // Get header x-ota-mode value, if present
       OTA_Mode mode = OTA_MODE_FIRMWARE;
       // Get mode from arg
       if (request->hasParam("mode")) {
-        String argValue = request->getParam("mode")->value();
+        const String& argValue = request->getParam("mode")->value();
         if (argValue == "fs") {
           this->logf("OTA Mode: Filesystem");
           mode = OTA_MODE_FILESYSTEM;
+        } else if (argValue == "files") {
+          this->logf("OTA Mode: Filesystem file sync");
+          mode = OTA_MODE_FILES;
+        } else if (argValue == "bundle") {
+          this->logf("OTA Mode: Bundle");
+          mode = OTA_MODE_BUNDLE;
+        } else if (argValue == "multicast") {
+          this->logf("OTA Mode: Multicast");
+          mode = OTA_MODE_MULTICAST;
         } else {
           this->logf("OTA Mode: Firmware");
           mode = OTA_MODE_FIRMWARE;
         }
-        this->_currentOtaMode = mode;
       }
 
-      // Get file MD5 hash from arg
-      if (request->hasParam("hash")) {
-        String hash = request->getParam("hash")->value();
-        if (!Update.setMD5(hash.c_str())) {
-          this->logf("ERROR: MD5 hash not valid: %s", hash.c_str());
-          return request->send(400, "text/plain", "MD5 parameter invalid");
-        }
+      // File sync works on the mounted filesystem, the Update object is not involved
+      if (mode == OTA_MODE_FILES) {
+        this->_currentOtaMode = mode;
+        _update_error_str.clear();
+        _session_md5.clear();
+        if (preUpdateCallback != NULL) preUpdateCallback();
+        this->openSession(request);
+        return this->sendSessionStarted(request);
       }
 
-      #if DEBUGMODE >= 1
-        // Serial output must be active to see the callback serial prints
-        Serial.setDebugOutput(true);
-      #endif
-
-      // Pre-OTA update callback
-      if (preUpdateCallback != NULL) preUpdateCallback();
-
-      // Start update process
-      #if defined(ESP8266)
-        uint32_t update_size = mode == OTA_MODE_FILESYSTEM ? ((size_t)FS_end - (size_t)FS_start) : ((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000);
-        if (mode == OTA_MODE_FILESYSTEM) {
-          close_all_fs();
-        }
-        Update.runAsync(true);
-        if (!Update.begin(update_size, mode == OTA_MODE_FILESYSTEM ? U_FS : U_FLASH)) {
-          this->logf("Failed to start update process");
-          // Save error to string
-          StreamString str;
-          Update.printError(str);
-          _update_error_str = str.c_str();
-          _update_error_str.concat("\n");
-          this->logf(_update_error_str.c_str());
-        }
-      #elif defined(ESP32)  
-        
-        //if (!Update.begin(UPDATE_SIZE_UNKNOWN, mode == OTA_MODE_FILESYSTEM ? U_SPIFFS : U_FLASH)) {
-        if (this->FsPartitionLabel!="" && mode == OTA_MODE_FILESYSTEM) {
-          this->logf("Starting update on partition: %s", this->FsPartitionLabel.c_str());
+      // Multicast blocks are written out of order straight to the partition, without the Update object
+      if (mode == OTA_MODE_MULTICAST) {
+        if (!this->startMulticast(request)) {
+          return request->send(400, "text/plain", _update_error_str.c_str());
         }
+        this->openSession(request);
+        return this->sendSessionStarted(request);
+      }
 
-        if (!Update.begin(UPDATE_SIZE_UNKNOWN, (mode == OTA_MODE_FILESYSTEM ? U_SPIFFS : U_FLASH), -1, LOW, (this->FsPartitionLabel=="" ? NULL : this->FsPartitionLabel.c_str()))) {
-          this->logf("Failed to start update process");
-          // Save error to string
-          StreamString str;
-          Update.printError(str);
-          _update_error_str = str.c_str();
-          _update_error_str.concat("\n");
-          this->logf(_update_error_str.c_str());
-        }        
-      #endif
-
-      return request->send((Update.hasError()) ? 400 : 200, "text/plain", (Update.hasError()) ? _update_error_str.c_str() : "OK");
+      const char * hash = request->hasParam("hash") ? request->getParam("hash")->value().c_str() : NULL;
+      if (!this->startUpdate(mode, hash, request->hasParam("enc"), request->hasParam("sparse"))) {
+        return request->send(400, "text/plain", _update_error_str.c_str());
+      }
+      this->openSession(request);
+      this->sendSessionStarted(request);
   });
 
   _server->on("/ota/upload", HTTP_POST, [&](AsyncWebServerRequest *request) {
-        if(_authenticate && !request->authenticate(_username.c_str(), _password.c_str())){
+        if(!this->isAuthorized(request)){
           return request->requestAuthentication();
         }
-        
-        if (Update.hasError()) {
-          if (postUpdateCallback != NULL) postUpdateCallback(!Update.hasError());
+
+        if (this->isSessionBusy(request)) {
+          return this->sendSessionBusy(request);
         }
 
-        AsyncWebServerResponse *response = request->beginResponse((Update.hasError()) ? 400 : 200, "text/plain", (Update.hasError()) ? _update_error_str.c_str() : "OK");
+        // only the request that carried the image of a session has a result to report
+        if (request != _result_request) {
+          AsyncWebServerResponse *response = request->beginResponse(400, "text/plain", _session_active ? "No image received" : "No session started");
+          response->addHeader("Connection", "close");
+          response->addHeader("Access-Control-Allow-Origin", "*");
+          return request->send(response);
+        }
+        _result_request = NULL;
+
+        // the Update object does not know about uploads rejected by the library itself
+        bool failed = Update.hasError() || !_update_error_str.isEmpty();
+        if (failed) {
+          if (postUpdateCallback != NULL) postUpdateCallback(false);
+        }
+
+        AsyncWebServerResponse *response = request->beginResponse(failed ? 400 : 200, "text/plain", failed ? _update_error_str.c_str() : "OK");
         response->addHeader("Connection", "close");
         response->addHeader("Access-Control-Allow-Origin", "*");
         request->send(response);
 
-  }, [&](AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+  }, [&](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
         //Upload handler chunks in data
-        if(_authenticate){
-            if(!request->authenticate(_username.c_str(), _password.c_str())){
+        // authentication and the owner check parse headers and allocate, the later chunks of the request skip them
+        if (index && request != _upload_request) {
+            return;
+        }
+        if (!index) {
+            if(!this->isAuthorized(request)){
                 return request->requestAuthentication();
             }
+
+            // Chunks of clients not owning the current session are dropped, they get a 409 at the end of the request
+            if (!this->isSessionOwner(request)) {
+                return;
+            }
+            _upload_request = request;
+            _result_request = request;
         }
+        this->throttleUpload(request->client());
 
         if (!index) {
-          // Reset progress size on first frame
-          _current_progress_size = 0;
+          request->onDisconnect([&, request]() {
+            _throttled_client = NULL;
+            if (_upload_request == request) _upload_request = NULL;
+            if (_result_request == request) _result_request = NULL;
+          });
+
+          // multipart framing adds a few hundred bytes to the image size
+          if (!this->checkUpdateSize(request->contentLength(), 4096)) {
+            return request->send(400, "text/plain", _update_error_str.c_str());
+          }
         }
 
-        // Write chunked data to the free sketch space
-        if(len){
-            if (Update.write(data, len) != len) {
-                return request->send(400, "text/plain", "Failed to write chunked data to free space");
-            }
-            _current_progress_size += len;
-            // Progress update callback
-            if (progressUpdateCallback != NULL) progressUpdateCallback(_current_progress_size, request->contentLength());
+        if (!this->writeUpdate(data, len, index, request->contentLength())) {
+          return request->send(400, "text/plain", _update_error_str.c_str());
         }
-            
-        if (final) { // if the final flag is set then this is the last frame of data
-            if (postUpdateCallback != NULL) postUpdateCallback(!Update.hasError());
-            if (!Update.end(true)) { //true to set the size to the current progress
-                this->logf("Error Occurred. Error #%s: ", String(Update.getError()));
-                // Save error to string
-                StreamString str;
-                Update.printError(str);
-                _update_error_str = str.c_str();
-                _update_error_str.concat("\n");
-                this->logf(_update_error_str.c_str());
-            } else {
-              this->logf("Update of %s complete", filename.c_str());
-              // Set reboot flag now, no Restore needed
-              if (_auto_reboot) {
-                _reboot_request_millis = millis();
-                 _reboot = true;
-              }
-            }
 
-        } else {
-            return;
+        // the request handler answers with the result once the body is complete
+        if (final) { // if the final flag is set then this is the last frame of data
+          this->finishUpdate(filename.c_str());
         }
   });
-}
-void ElegantOTAClass::setFWVariant(String variant) {
-  this->FWVariant = variant;
-}
 
-void ElegantOTAClass::setFWVersion(String version) {
-  this->FWVersion = version;
+  this->beginFsSync();
+  this->beginPeer();
+  this->beginBundle();
+  this->beginSparse();
+  this->beginMulticast();
+  this->beginPrefetch();
+  this->beginHistory();
+  this->beginTrace();
+  this->beginTcp();
+
+  if (_discovery) {
+    this->advertise();
+  }
+}
+void ElegantOTAClass::setFWVariant(const char * variant) {
+  this->storeSetting(this->FWVariant, variant, "FWVariant");
 }
 
-void ElegantOTAClass::setID(String id) {
-  this->id = id;
+void ElegantOTAClass::setFWVersion(const char * version) {
+  this->storeSetting(this->FWVersion, version, "FWVersion");
 }
 
-void ElegantOTAClass::setGitEnv(String owner, String repo, String branch) {
-  this->setGitEnv(owner, repo, branch, 0);
+void ElegantOTAClass::setID(const char * id) {
+  this->storeSetting(this->id, id, "ID");
 }
 
-void ElegantOTAClass::setGitEnv(String owner, String repo, String branch, uint16_t build) {
-  this->gitOwner = owner;
-  this->gitRepo = repo;
-  this->gitBranch = branch;
+void ElegantOTAClass::setGitEnv(const char * owner, const char * repo, const char * branch, uint16_t build) {
+  this->storeSetting(this->gitOwner, owner, "Git owner");
+  this->storeSetting(this->gitRepo, repo, "Git repository");
+  this->storeSetting(this->gitBranch, branch, "Git branch");
   this->gitBuild = build;
 }
 
-void ElegantOTAClass::setTargetPartition(String FsPartitionLabel) {
-  this->FsPartitionLabel = FsPartitionLabel;
+void ElegantOTAClass::setTargetPartition(const char * FsPartitionLabel) {
+  this->storeSetting(this->FsPartitionLabel, FsPartitionLabel, "Partition label");
 }
 
 void ElegantOTAClass::logf(const char* format, ...) {
@@ -239,12 +259,420 @@ void ElegantOTAClass::logf(const char* format, ...) {
   va_end(args);
 }
 
+void ElegantOTAClass::setSessionTimeout(unsigned long timeout_ms) {
+  this->_session_timeout = timeout_ms;
+}
+
+void ElegantOTAClass::openSession(AsyncWebServerRequest *request) {
+  this->openSession((uint32_t)request->client()->remoteIP());
+}
+
+void ElegantOTAClass::openSession(uint32_t client) {
+  // admitUpdate() took the Update object over from a stale owner
+  _update_owner = this;
+  // a dry run of file sync gives way to the session
+  if (_sync_manifest_state != OTA_MANIFEST_NONE) this->resetFsManifest();
+  _profile.apply();
+  _current_progress_size = 0;
+  _session_data_millis = millis();
+  _history.start(_session_data_millis);
+  if (_quiesce_server != NULL && _quiesce_server != _server && !_quiesced) {
+    _quiesce_server->end();
+    _quiesced = true;
+  }
+
+  #if defined(ESP32)
+    uint32_t r1 = esp_random(), r2 = esp_random();
+  #else
+    uint32_t r1 = ESP.random(), r2 = ESP.random();
+  #endif
+  char token[17];
+  snprintf(token, sizeof(token), "%08lx%08lx", (unsigned long)r1, (unsigned long)r2);
+  _session_token = token;
+  _session_client = client;
+  _session_activity_millis = millis();
+  _session_active = true;
+}
+
+void ElegantOTAClass::closeSession(bool abortUpdate) {
+  if (_session_active) this->recordHistory(abortUpdate);
+  _trace.finish(!abortUpdate);
+  if (abortUpdate && Update.isRunning()) {
+    #if defined(ESP32)
+      Update.abort();
+    #else
+      Update.end(false);  // resets the updater if data is missing
+    #endif
+  }
+  if (abortUpdate && _bundle_app_done) {
+    this->revertBundle();
+  }
+  _bundle_app_done = false;
+  if (_tcp_session) {
+    // the raw TCP client learns why its session ended, a successful one is answered by handleTcpData()
+    _tcp_session = false;
+    if (abortUpdate) this->endTcp(400, _update_error_str.isEmpty() ? "Session closed" : _update_error_str.c_str());
+  }
+  if (_sync_file) _sync_file.close();
+  if (_sync_manifest_state != OTA_MANIFEST_NONE) this->resetFsManifest();
+  if (_mcast_active) this->endMulticast();
+  _writer.end();
+  _arena.end();
+  _upload_request = NULL;
+  if (_session_active) _profile.record(_current_progress_size, millis() - _session_data_millis);
+  _profile.restore();
+  _session_active = false;
+  _session_token.clear();
+  _session_client = 0;
+  if (_update_owner == this) _update_owner = NULL;
+  if (_quiesced) {
+    _quiesce_server->begin();
+    _quiesced = false;
+  }
+}
+
+bool ElegantOTAClass::isSessionStale() const {
+  return _session_active && millis() - _session_activity_millis > _session_timeout;
+}
+
+bool ElegantOTAClass::isSessionOwner(AsyncWebServerRequest *request) const {
+  if (!_session_active || _tcp_session) return false;
+
+  // an explicit token wins, otherwise the session is bound to the client address
+  const AsyncWebHeader *header = request->getHeader("X-OTA-Session");
+  if (header != NULL) return _session_token == header->value().c_str();
+  if (request->hasParam("session")) return _session_token == request->getParam("session")->value().c_str();
+  return _session_client == (uint32_t)request->client()->remoteIP();
+}
+
+bool ElegantOTAClass::isSessionBusy(AsyncWebServerRequest *request) const {
+  return this->isUpdateOwnedElsewhere() || (_session_active && !this->isSessionStale() && !this->isSessionOwner(request));
+}
+
+bool ElegantOTAClass::isUpdateOwnedElsewhere() const {
+  return _update_owner != NULL && _update_owner != this && _update_owner->_session_active && !_update_owner->isSessionStale();
+}
+
+void ElegantOTAClass::sendSessionStarted(AsyncWebServerRequest *request) {
+  AsyncWebServerResponse *response = request->beginResponse(200, "text/plain", "OK");
+  response->addHeader("X-OTA-Session", _session_token.c_str());
+  request->send(response);
+}
+
+void ElegantOTAClass::sendSessionBusy(AsyncWebServerRequest *request) {
+  const ElegantOTAClass *owner = this->isUpdateOwnedElsewhere() ? _update_owner : this;
+  unsigned long idle = millis() - owner->_session_activity_millis;
+  unsigned long retry = (idle < owner->_session_timeout ? owner->_session_timeout - idle : 0) / 1000 + 1;
+  char retry_str[21];   // 20 digits of %lu
+  snprintf(retry_str, sizeof(retry_str), "%lu", retry);
+
+  AsyncWebServerResponse *response = request->beginResponse(409, "text/plain", "Another OTA session is in progress");
+  response->addHeader("Retry-After", retry_str);
+  request->send(response);
+}
+
+void ElegantOTAClass::setEncryptionKey(const uint8_t key[32], bool required) {
+  if (_decryptor == NULL) _decryptor = new ElegantOTADecryptor();
+  _decryptor->setKey(key);
+  this->_encryption_required = required;
+}
+
+void ElegantOTAClass::enableDiscovery(uint16_t port, const char * hostname) {
+  this->_discovery = true;
+  this->_discovery_port = port;
+  this->storeSetting(this->_discovery_hostname, hostname, "mDNS hostname");
+}
+
+void ElegantOTAClass::advertise() {
+  // the application may already run its own responder, then only the service is added
+  if (!_discovery_hostname.isEmpty() && !MDNS.begin(_discovery_hostname.c_str())) {
+    this->logf("mDNS responder failed to start");
+    return;
+  }
+
+  char build[8];
+  snprintf(build, sizeof(build), "%u", gitBuild);
+  char modes[40];
+  snprintf(modes, sizeof(modes), "fr,fs,files,mcast,sparse%s%s", _decryptor != NULL ? ",enc" : "", _peer_serving && _decryptor == NULL ? ",peer" : "");
+
+  MDNS.addService("elegantota", "tcp", _discovery_port);
+  MDNS.addServiceTxt("elegantota", "tcp", "chip", this->getChipFamily());
+  MDNS.addServiceTxt("elegantota", "tcp", "version", FWVersion.c_str());
+  MDNS.addServiceTxt("elegantota", "tcp", "variant", FWVariant.c_str());
+  MDNS.addServiceTxt("elegantota", "tcp", "build", build);
+  MDNS.addServiceTxt("elegantota", "tcp", "id", id.c_str());
+  MDNS.addServiceTxt("elegantota", "tcp", "modes", modes);
+  if (_tcp_port) {
+    char tcp_port[8];
+    snprintf(tcp_port, sizeof(tcp_port), "%u", _tcp_port);
+    MDNS.addServiceTxt("elegantota", "tcp", "tcp", tcp_port);
+  }
+  this->logf("Advertising _elegantota._tcp on port %u", _discovery_port);
+}
+
+void ElegantOTAClass::setImageCheck(bool enable) {
+  this->_image_check_enabled = enable;
+}
+
+void ElegantOTAClass::setImageProject(const char * project) {
+  this->storeSetting(this->_image_project, project, "Image project");
+}
+
+void ElegantOTAClass::setRejectSameVersion(bool enable) {
+  this->_reject_same_version = enable;
+}
+
+void ElegantOTAClass::beginBundle() {
+  _bundle.onSection = [&](uint8_t type, uint32_t size, const char *md5) {
+    return this->beginBundleSection(type, size, md5);
+  };
+  _bundle.onData = [&](const uint8_t *data, size_t len) {
+    // the firmware section gets the same header check as a plain firmware upload
+    if (_bundle.type() == ElegantOTABundle::SECTION_APP && _image_check_enabled && !_image_check.complete()) {
+      if (_image_check.feed(data, len) && !this->checkImageHeader()) return false;
+    }
+    if (!_writer.write(data, len)) {
+      this->storeUpdateError();
+      return false;
+    }
+    return true;
+  };
+  _bundle.onSectionEnd = [&](uint8_t type) {
+    return this->endBundleSection(type);
+  };
+}
+
+bool ElegantOTAClass::beginBundleSection(uint8_t type, uint32_t size, const char *md5) {
+  uint8_t bit = 1 << type;
+  if (_bundle_sections & bit) {
+    _update_error_str = "Duplicate bundle section";
+    return false;
+  }
+  _bundle_sections |= bit;
+  bool fs = type == ElegantOTABundle::SECTION_FS;
+  this->logf("Bundle section: %s, %u bytes", fs ? "filesystem" : "firmware", (unsigned)size);
+
+  #if defined(ESP8266)
+    if (fs) {
+      close_all_fs();
+    }
+    Update.runAsync(true);
+    if (!Update.begin(size, fs ? U_FS : U_FLASH)) {
+      this->storeUpdateError();
+      return false;
+    }
+  #elif defined(ESP32)
+    if (!Update.begin(size, (fs ? U_SPIFFS : U_FLASH), -1, LOW, (fs && !this->FsPartitionLabel.isEmpty() ? this->FsPartitionLabel.c_str() : NULL))) {
+      this->storeUpdateError();
+      return false;
+    }
+  #endif
+
+  if (!Update.setMD5(md5)) {
+    _update_error_str = "MD5 of bundle section invalid";
+    return false;
+  }
+  _image_check.reset();
+  _writer.begin(&_arena);
+  return true;
+}
+
+bool ElegantOTAClass::endBundleSection(uint8_t type) {
+  if (type == ElegantOTABundle::SECTION_APP && _image_check_enabled && !_image_check.complete() && !this->checkImageHeader()) {
+    return false;
+  }
+  if (!_writer.flush() || !Update.end()) {
+    this->storeUpdateError();
+    return false;
+  }
+  // from here on a failure has to switch the boot partition back
+  if (type == ElegantOTABundle::SECTION_APP) _bundle_app_done = true;
+  return true;
+}
+
+void ElegantOTAClass::revertBundle() {
+  this->logf("Bundle failed, keeping the running firmware");
+  #if defined(ESP8266)
+    // the new image is only copied over the sketch by eboot at the next boot
+    eboot_command_clear();
+  #elif defined(ESP32)
+    esp_ota_set_boot_partition(esp_ota_get_running_partition());
+  #endif
+}
+
+bool ElegantOTAClass::checkImageHeader() {
+  char reason[ELEGANTOTA_ERROR_LEN];
+  if (_image_check.validate(this->getChipFamily(), _image_project.c_str(), _reject_same_version ? FWVersion.c_str() : NULL, reason, sizeof(reason))) {
+    return true;
+  }
+  _update_error_str = reason;
+  return false;
+}
+
+void ElegantOTAClass::setResourceLimits(uint32_t throttleHeap, uint32_t rejectHeap, uint32_t minBlock) {
+  _governor.setLimits(throttleHeap, rejectHeap, minBlock);
+}
+
+void ElegantOTAClass::setWriteChunk(size_t bytes) {
+  _writer.setChunk(bytes);
+}
+
+void ElegantOTAClass::setPerformanceProfile(bool enable, uint32_t cpuMhz) {
+  _profile.setEnabled(enable, cpuMhz);
+}
+
+bool ElegantOTAClass::enableTrace(size_t entries) {
+  // the ring is written by the upload handler, it is never resized under a running session
+  if (_session_active) {
+    return false;
+  }
+  if (!_trace.setCapacity(entries)) {
+    this->logf("Trace of %u entries not allocated", (unsigned)entries);
+    return false;
+  }
+  return true;
+}
+
+static const char * const history_mode_names[] = {"firmware", "fs", "files", "bundle", "multicast"};
+static const char * const history_result_names[] = {"ok", "failed", "aborted"};
+
+void ElegantOTAClass::beginHistory() {
+  _history.begin(_state_fs);
+
+  _server->on("/ota/history", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->isAuthorized(request)) {
+        return request->requestAuthentication();
+      }
+      // newest first, one record at a time so the document stays small
+      AsyncResponseStream *response = request->beginResponseStream("application/json");
+      response->addHeader("Cache-Control", "no-cache");
+      response->print("[");
+      ElegantOTAHistoryRecord record;
+      for (size_t i = 0; i < _history.count() && _history.get(i, record); i++) {
+        char md5[33] = "";
+        static const uint8_t none[16] = {0};
+        for (size_t j = 0; j < sizeof(record.md5) && memcmp(record.md5, none, sizeof(none)) != 0; j++) {
+          snprintf(md5 + 2 * j, 3, "%02x", record.md5[j]);
+        }
+        JsonDocument doc;
+        doc["seq"] = record.seq;
+        doc["time"] = record.time;
+        doc["mode"] = record.mode < 5 ? history_mode_names[record.mode] : "unknown";
+        doc["result"] = record.result < 3 ? history_result_names[record.result] : "unknown";
+        doc["size"] = record.size;
+        doc["duration"] = record.duration;
+        doc["avg_rate"] = record.avgRate;
+        doc["min_rate"] = record.minRate;
+        doc["md5"] = md5;
+        doc["client"] = record.client ? IPAddress(record.client).toString() : "pull";
+        doc["version"] = record.version;
+        doc["error"] = record.error;
+        doc["code"] = record.updateError;
+        doc["profile"] = (record.flags & ELEGANTOTA_HISTORY_PROFILE) != 0;
+        doc["tcp"] = (record.flags & ELEGANTOTA_HISTORY_TCP) != 0;
+        doc["saved"] = (record.flags & ELEGANTOTA_HISTORY_UNSAVED) == 0;
+        if (i) response->print(",");
+        ArduinoJson::serializeJson(doc, *response);
+      }
+      response->print("]");
+      request->send(response);
+  });
+}
+
+void ElegantOTAClass::beginTrace() {
+  if (ELEGANTOTA_TRACE_LEN && _trace.capacity() == 0) {
+    this->enableTrace(ELEGANTOTA_TRACE_LEN);
+  }
+
+  _server->on("/ota/trace.bin", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->isAuthorized(request)) {
+        return request->requestAuthentication();
+      }
+      if (_trace.capacity() == 0) {
+        return request->send(404, "text/plain", "Trace not enabled");
+      }
+      // the ring is written while a session runs
+      if (_session_active) {
+        return request->send(409, "text/plain", "Update in progress");
+      }
+      AsyncWebServerResponse *response = request->beginResponse("application/octet-stream", _trace.size(),
+        [&](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+          return _session_active ? 0 : _trace.read(index, buffer, maxLen);
+      });
+      response->addHeader("Content-Disposition", "attachment; filename=\"trace.bin\"");
+      response->addHeader("Cache-Control", "no-cache");
+      request->send(response);
+  });
+}
+
+void ElegantOTAClass::recordHistory(bool aborted) {
+  if (ELEGANTOTA_HISTORY_LEN == 0) return;
+  ElegantOTAHistoryRecord& record = _history_record;
+  memset(&record, 0, sizeof(record));
+  // the system time is set (NTP) once it is past 2020
+  time_t now = time(NULL);
+  record.time = now > 1600000000 ? (uint32_t)now : 0;
+  record.size = _current_progress_size;
+  record.duration = millis() - _session_data_millis;
+  record.avgRate = (uint32_t)((uint64_t)record.size * 1000 / (record.duration ? record.duration : 1));
+  record.minRate = _history.minRate();
+  record.client = _session_client;
+  if (_session_md5.length() == 32) {
+    for (size_t i = 0; i < sizeof(record.md5); i++) {
+      char byte[3] = {_session_md5.c_str()[2 * i], _session_md5.c_str()[2 * i + 1], 0};
+      record.md5[i] = (uint8_t)strtoul(byte, NULL, 16);
+    }
+  }
+  record.mode = _currentOtaMode;
+  record.result = !aborted ? ELEGANTOTA_HISTORY_OK : _update_error_str.isEmpty() ? ELEGANTOTA_HISTORY_ABORTED : ELEGANTOTA_HISTORY_FAILED;
+  // multicast and file sync do not use the Update object
+  if (_currentOtaMode == OTA_MODE_FIRMWARE || _currentOtaMode == OTA_MODE_FILESYSTEM || _currentOtaMode == OTA_MODE_BUNDLE) {
+    record.updateError = Update.getError();
+  }
+  record.flags = (_profile.applied() ? ELEGANTOTA_HISTORY_PROFILE : 0) | (_tcp_session ? ELEGANTOTA_HISTORY_TCP : 0);
+  // the filesystem holding the history may be the one just overwritten, the record and the prefetch state stay in RAM
+  bool fs_written = _currentOtaMode == OTA_MODE_FILESYSTEM || (_currentOtaMode == OTA_MODE_BUNDLE && (_bundle_sections & (1 << ElegantOTABundle::SECTION_FS)));
+  if (fs_written) {
+    record.flags |= ELEGANTOTA_HISTORY_UNSAVED;
+    _state_fs_replaced = true;
+  }
+  strlcpy(record.version, FWVersion.c_str(), sizeof(record.version));
+  strlcpy(record.error, _update_error_str.c_str(), sizeof(record.error));
+  _history_due = true;
+}
+
+void ElegantOTAClass::saveHistory() {
+  _history_due = false;
+  if (_history_record.flags & ELEGANTOTA_HISTORY_UNSAVED) {
+    _history.hold(_history_record);
+  } else if (!_history.add(_history_record)) {
+    this->logf("Update history not saved, state filesystem not mounted");
+  }
+}
+
+void ElegantOTAClass::logResources() {
+  char summary[112];
+  _governor.summary(summary, sizeof(summary));
+  this->logf("Resources: %s", summary);
+  char throughput[128];
+  _profile.summary(throughput, sizeof(throughput));
+  this->logf("Throughput: %s", throughput);
+}
+
+void ElegantOTAClass::storeUpdateError() {
+  _update_error_str.clear();
+  ElegantOTAFixedStringPrint<ELEGANTOTA_ERROR_LEN> out(_update_error_str);
+  Update.printError(out);
+  _update_error_str.append("\n");
+  this->logf("%s", _update_error_str.c_str());
+}
+
 void ElegantOTAClass::getDeviceInfo(JsonDocument& doc) {
   JsonObject jsonRoot = doc.to<JsonObject>();
       
   jsonRoot["owner"] = this->gitOwner.c_str();
   jsonRoot["repository"] = this->gitRepo.c_str();
-  jsonRoot["chipfamily"] = this->getChipFamily().c_str();
+  jsonRoot["chipfamily"] = this->getChipFamily();
   jsonRoot["branch"] = this->gitBranch.c_str();
   jsonRoot["build"] = this->gitBuild;
   jsonRoot["FWVersion"] = this->FWVersion.c_str();
@@ -254,13 +682,25 @@ void ElegantOTAClass::getDeviceInfo(JsonDocument& doc) {
 }
 
 void ElegantOTAClass::setAuth(const char * username, const char * password){
-  this->_username = username;
-  this->_password = password;
-  this->_authenticate = _username.length() && _password.length();
+  // truncated credentials never match what the client sends, and dropping them would leave
+  // the endpoints open: refuse every request until setAuth() gets credentials that fit
+  bool fits = this->_username.assign(username);
+  fits = this->_password.assign(password) && fits;
+  this->_auth_locked = !fits;
+  if (_auth_locked) {
+    this->logf("Credentials longer than %u characters (ELEGANTOTA_CREDENTIAL_LEN), OTA access is locked", (unsigned)ELEGANTOTA_CREDENTIAL_LEN);
+  }
+  this->_authenticate = _auth_locked || (_username.length() && _password.length());
 }
 
 void ElegantOTAClass::clearAuth(){
   this->_authenticate = false;
+  this->_auth_locked = false;
+}
+
+bool ElegantOTAClass::isAuthorized(AsyncWebServerRequest *request) {
+  if (!_authenticate) return true;
+  return !_auth_locked && request->authenticate(_username.c_str(), _password.c_str());
 }
 
 void ElegantOTAClass::setAutoReboot(bool enable){
@@ -268,6 +708,52 @@ void ElegantOTAClass::setAutoReboot(bool enable){
 }
 
 void ElegantOTAClass::loop() {
+  #if defined(ESP8266)
+    if (_discovery) MDNS.update();
+  #endif
+
+  if (_mcast_active) {
+    // packets arriving while the image is read back are dropped, all blocks are there
+    if (_mcast_verifying) {
+      this->verifyMulticast();
+    } else {
+      this->pollMulticast();
+    }
+  }
+
+  // Release the partition if the session owner disappeared
+  if (this->isSessionStale()) {
+    this->logf("OTA session timed out");
+    if (_pull_pending) this->cancelPull();
+    this->closeSession(true);
+    this->logResources();
+    if (postUpdateCallback != NULL) postUpdateCallback(false);
+  }
+
+  if (_pull_pending) {
+    this->runPull();
+  }
+
+  // the files of a sync manifest are hashed here, not on the network task that received it
+  if (_sync_manifest_state == OTA_MANIFEST_HASHING) {
+    this->runFsManifest();
+  }
+
+  if (_prefetch_state != OTA_PREFETCH_IDLE && _prefetch_state != OTA_PREFETCH_FAILED) {
+    this->runPrefetch();
+  }
+
+  // the history file is written here, not on the network task that closed the session
+  if (_history_due) {
+    this->saveHistory();
+  }
+
+  // resume a throttled upload once the heap recovered
+  if (_throttled_client != NULL && (!_governor.throttled() || _governor.recovered(ElegantOTAGovernor::sample()))) {
+    _throttled_client->ack((size_t)-1);
+    _throttled_client = NULL;
+  }
+
   // Check if 2 seconds have passed since _reboot_request_millis was set
   if (this->_reboot && millis() - this->_reboot_request_millis > 2000) {
     this->logf("Rebooting...");
@@ -24,7 +24,20 @@ _____ _                        _    ___ _____  _
 #include "ArduinoJson.h"
 #include <vector>
 #include "LittleFS.h"
-#include "elop.h"
+#include "ElegantOTAAssets.h"
+#include "ElegantOTAFixedString.h"
+#include "ElegantOTAImage.h"
+#include "ElegantOTACrypto.h"
+#include "ElegantOTAGovernor.h"
+#include "ElegantOTABundle.h"
+#include "ElegantOTASparse.h"
+#include "ElegantOTAArena.h"
+#include "ElegantOTAWriter.h"
+#include "ElegantOTABlocks.h"
+#include "ElegantOTARateLimiter.h"
+#include "ElegantOTAProfile.h"
+#include "ElegantOTAHistory.h"
+#include "ElegantOTATrace.h"
 
 #ifndef CORS_DEBUG
   #define CORS_DEBUG 0
@@ -34,12 +47,92 @@ _____ _                        _    ___ _____  _
   #define DEBUGMODE 0
 #endif
 
+// capacities of the inline string buffers, may be overridden by build flags;
+// longer values are logged, credentials that do not fit lock the OTA endpoints
+#ifndef ELEGANTOTA_CREDENTIAL_LEN
+  #define ELEGANTOTA_CREDENTIAL_LEN 64
+#endif
+
+#ifndef ELEGANTOTA_INFO_LEN
+  #define ELEGANTOTA_INFO_LEN 32
+#endif
+
+// git owner, repository and branch, GitHub allows up to 100 characters for a repository name
+#ifndef ELEGANTOTA_GIT_LEN
+  #define ELEGANTOTA_GIT_LEN 100
+#endif
+
+#ifndef ELEGANTOTA_ERROR_LEN
+  #define ELEGANTOTA_ERROR_LEN 96
+#endif
+
+// maximum size of the manifest posted to /ota/fs/manifest
+#ifndef ELEGANTOTA_MANIFEST_MAX
+  #define ELEGANTOTA_MANIFEST_MAX 8192
+#endif
+
+// bytes of the manifest files hashed per loop() call
+#ifndef ELEGANTOTA_SYNC_HASH_SLICE
+  #define ELEGANTOTA_SYNC_HASH_SLICE 8192
+#endif
+
+// bytes of a multicast image read back and hashed per loop() call before it is booted
+#ifndef ELEGANTOTA_MULTICAST_VERIFY_SLICE
+  #define ELEGANTOTA_MULTICAST_VERIFY_SLICE 8192
+#endif
+
+// parallel downloads of /ota/self.bin, further peers get 503 and try another device
+#ifndef ELEGANTOTA_PEER_MAX_DOWNLOADS
+  #define ELEGANTOTA_PEER_MAX_DOWNLOADS 1
+#endif
+
+// parallel downloads of the UI page, further page loads get a short retry page
+#ifndef ELEGANTOTA_UI_MAX_DOWNLOADS
+  #if defined(ESP8266)
+    #define ELEGANTOTA_UI_MAX_DOWNLOADS 2
+  #else
+    #define ELEGANTOTA_UI_MAX_DOWNLOADS 4
+  #endif
+#endif
+
+// peers found by the mDNS query of pull() that are tried before its url
+#ifndef ELEGANTOTA_PULL_PEERS
+  #define ELEGANTOTA_PULL_PEERS 8
+#endif
+
+// capacity of the url given to pull()
+#ifndef ELEGANTOTA_URL_LEN
+  #define ELEGANTOTA_URL_LEN 128
+#endif
+
+// defaults of the background prefetch, see setPrefetchLimits()
+#ifndef ELEGANTOTA_PREFETCH_RATE
+  #define ELEGANTOTA_PREFETCH_RATE 8192
+#endif
+
+#ifndef ELEGANTOTA_PREFETCH_CPU
+  #define ELEGANTOTA_PREFETCH_CPU 10
+#endif
+
+// the prefetch progress is saved after this many bytes
+#ifndef ELEGANTOTA_PREFETCH_SAVE
+  #define ELEGANTOTA_PREFETCH_SAVE 65536
+#endif
+
+#ifndef ELEGANTOTA_PREFETCH_FILE
+  #define ELEGANTOTA_PREFETCH_FILE "/ota_prefetch.json"
+#endif
+
 #if defined(ESP8266)
   #include <functional>
   #include "FS.h"
   #include "LittleFS.h"
   #include "Updater.h"
-  #include "StreamString.h"
+  #include "eboot_command.h"
+  #include "MD5Builder.h"
+  #include "ESP8266mDNS.h"
+  #include "ESP8266WiFi.h"
+  #include "WiFiUdp.h"
   #include "ESPAsyncTCP.h"
   #include "ESPAsyncWebServer.h"
   #define ELEGANTOTA_WEBSERVER AsyncWebServer
@@ -47,15 +140,46 @@ _____ _                        _    ___ _____  _
   #include <functional>
   #include "FS.h"
   #include "Update.h"
-  #include "StreamString.h"
+  #include "MD5Builder.h"
+  #include "ESPmDNS.h"
+  #include "WiFi.h"
+  #include "WiFiUdp.h"
+  #include "esp_ota_ops.h"
+  #include "esp_task_wdt.h"
   #include "AsyncTCP.h"
   #include "ESPAsyncWebServer.h"
   #define ELEGANTOTA_WEBSERVER AsyncWebServer
 #endif
 
+#include "ElegantOTAUiResponse.h"
+#include "ElegantOTAFetch.h"
+
 enum OTA_Mode {
     OTA_MODE_FIRMWARE = 0,
-    OTA_MODE_FILESYSTEM = 1
+    OTA_MODE_FILESYSTEM = 1,
+    OTA_MODE_FILES = 2,       // file level sync of the mounted filesystem
+    OTA_MODE_BUNDLE = 3,      // firmware and filesystem in one upload, see ElegantOTABundle
+    OTA_MODE_MULTICAST = 4    // firmware blocks received over UDP multicast, see ElegantOTAMulticast.cpp
+};
+
+enum OTA_PrefetchState {
+    OTA_PREFETCH_IDLE = 0,
+    OTA_PREFETCH_DOWNLOADING = 1,
+    OTA_PREFETCH_VERIFYING = 2,   // the image is read back for the MD5
+    OTA_PREFETCH_STAGED = 3,      // waits for applyStaged() or the apply window
+    OTA_PREFETCH_FAILED = 4
+};
+
+enum OTA_ManifestState {
+    OTA_MANIFEST_NONE = 0,
+    OTA_MANIFEST_HASHING = 1,     // loop() hashes the files of the manifest
+    OTA_MANIFEST_READY = 2        // the files to upload and delete are known
+};
+
+// a device found by the mDNS query of pull()
+struct ElegantOTAPeerAddress {
+    uint32_t ip;
+    uint16_t port;
 };
 
 class ElegantOTAClass{
@@ -64,9 +188,235 @@ class ElegantOTAClass{
 
     void begin(ELEGANTOTA_WEBSERVER *server, const char * username = "", const char * password = "");
 
+    /**
+     * @brief serve the OTA endpoints on a dedicated listener instead of the application's server
+     *
+     * The instance creates and starts its own server on port, the application's routes,
+     * rewrites and catch-all handlers never see OTA traffic. Several ElegantOTAClass
+     * instances can run side by side (each needs its loop() called), only one of them
+     * owns the Update object at a time, the others answer 409 meanwhile.
+     * AsyncTCP serves all servers from one task; its core and priority are set with the
+     * CONFIG_ASYNC_TCP_RUNNING_CORE and CONFIG_ASYNC_TCP_PRIORITY build flags.
+     *
+     * @param port port of the OTA listener
+     */
+    void begin(uint16_t port, const char * username = "", const char * password = "");
+
+    /**
+     * @brief stop accepting connections on the application's server while an OTA session runs
+     *
+     * Only possible with a dedicated listener, see begin(port). Requests already being served
+     * finish, new connections are refused until the session ended, so application traffic
+     * does not compete with the upload for the AsyncTCP task and heap.
+     *
+     * @param server the application's server, NULL disables
+     */
+    void setQuiesceServer(ELEGANTOTA_WEBSERVER *server);
+
     void setAuth(const char * username, const char * password);
     void clearAuth();
     void setAutoReboot(bool enable);
+
+    /**
+     * @brief set the inactivity timeout after which an unfinished OTA session is aborted
+     * @param timeout_ms timeout in milliseconds, default 30s
+     */
+    void setSessionTimeout(unsigned long timeout_ms);
+
+    /**
+     * @brief memory thresholds of the OTA resource governor
+     *
+     * Below throttleHeap free heap (or minBlock largest free block) received upload data
+     * is acknowledged late, so the sender pauses until the heap recovered. Below rejectHeap
+     * /ota/start answers 503. Watermarks are logged at the end of every update.
+     *
+     * @param throttleHeap default ELEGANTOTA_THROTTLE_HEAP, 0 disables throttling
+     * @param rejectHeap default ELEGANTOTA_REJECT_HEAP, 0 disables the check
+     * @param minBlock default ELEGANTOTA_MIN_BLOCK
+     */
+    void setResourceLimits(uint32_t throttleHeap, uint32_t rejectHeap, uint32_t minBlock = ELEGANTOTA_MIN_BLOCK);
+
+    /**
+     * @brief coalesce upload fragments to blocks of this size before Update.write()
+     *
+     * Without a call ELEGANTOTA_WRITE_CHUNK is used, 0 unless defined at build time.
+     * examples/WriteBenchmark measures the effect on a board.
+     *
+     * @param bytes block size, 0 forwards every fragment as it arrives
+     */
+    void setWriteChunk(size_t bytes);
+
+    /**
+     * @brief raise radio and CPU performance while an OTA session runs
+     *
+     * When a session opens, WiFi power save is switched off and the CPU clock raised; ESP32
+     * builds with power management (CONFIG_PM_ENABLE) also hold locks against frequency
+     * scaling and light sleep. The settings of the application are restored when the session
+     * completes, fails or times out. The resource log compares the throughput of the last
+     * sessions with and without the profile. The TCP receive window is fixed when lwIP is
+     * built (CONFIG_LWIP_TCP_WND_DEFAULT on ESP32, the "higher bandwidth" lwIP variant on
+     * ESP8266) and is shown in the same log line.
+     *
+     * @param enable default ELEGANTOTA_PERFORMANCE_PROFILE (on)
+     * @param cpuMhz CPU clock during the session, 0 for the highest clock of the chip
+     */
+    void setPerformanceProfile(bool enable, uint32_t cpuMhz = 0);
+
+    /**
+     * @brief record the fragments of the last upload for GET /ota/trace.bin
+     *
+     * Every fragment passed to the write path is stored with its arrival time, offset,
+     * length and the time the write took, 16 bytes each. An upload longer than the ring
+     * keeps its end. The file is served once the session is closed, scripts/elegantota_trace.py
+     * shows it and replays the fragment pattern and timing through the model of the write path.
+     *
+     * @param entries size of the ring, 0 frees it (default ELEGANTOTA_TRACE_LEN, off)
+     * @return false if the ring could not be allocated
+     */
+    bool enableTrace(size_t entries);
+
+    /**
+     * @brief enable encrypted uploads (/ota/start?enc=1), see scripts/encrypt_firmware.py
+     * @param key the 32 byte device key
+     * @param required refuse unencrypted uploads
+     */
+    void setEncryptionKey(const uint8_t key[32], bool required = false);
+
+    /**
+     * @brief accept uploads over a plain TCP connection on port, call before begin()
+     *
+     * The framing is a small binary header and the raw image, without HTTP parsing and
+     * multipart boundaries, for scripted flashing. Same credentials (checked with a nonce
+     * challenge, the password never travels), session rules,
+     * decryption, image check and bundles as the HTTP upload, see ElegantOTATcp.cpp and
+     * scripts/elegantota_tcp.py.
+     *
+     * @param port port of the TCP listener, 0 disables
+     */
+    void enableTcpUpload(uint16_t port);
+
+    /**
+     * @brief advertise the device as _elegantota._tcp service via mDNS, call before begin()
+     *
+     * The TXT record carries chip, version, variant, build, id and the supported
+     * upload modes, so scripts/elegantota_discover.py finds the fleet with one query.
+     * Set the git environment, FWVersion, FWVariant and ID before begin().
+     *
+     * @param port the port of the web server
+     * @param hostname start the mDNS responder with this name, NULL if the application already did
+     */
+    void enableDiscovery(uint16_t port = 80, const char * hostname = NULL);
+
+    /**
+     * @brief serve the running firmware image to other devices at /ota/self.bin, call before begin()
+     *
+     * /ota/self.bin needs no authentication, devices never send their credentials to a
+     * peer, so everyone on the network can read the image. Pulled images are checked
+     * against the MD5 given to pull(). A device with an encryption key, see setEncryptionKey(),
+     * answers 403 instead: its image contains the key, and encryption is worth nothing once
+     * anyone can download it. Encrypted fleets pull from the url only.
+     */
+    void setPeerServing(bool enable);
+
+    /**
+     * @brief download and install a firmware image over http, runs in loop()
+     *
+     * With md5 given, devices found via mDNS that serve /ota/self.bin with the same chip
+     * family, variant, version and MD5 are preferred over url, busy peers are retried for
+     * up to a minute before falling back to url. Without md5 only url is used. Query and
+     * download are driven by loop() and the network stack, loop() never waits for them.
+     * Remote trigger: GET /ota/pull?url=..&hash=..&version=..
+     *
+     * @param url plain http url of the image, used if no peer has it
+     * @param md5 expected MD5 of the image, NULL to download from url only
+     * @param version FWVersion of the image, NULL to accept any peer image
+     * @return false if another OTA session is running or md5 is not 32 hex digits
+     */
+    bool pull(const char * url, const char * md5 = NULL, const char * version = NULL);
+
+    /**
+     * @brief download a firmware image in the background and stage it, runs in loop()
+     *
+     * The image trickles into the update partition at the byte rate and CPU share of
+     * setPrefetchLimits(), survives reboots (progress in ELEGANTOTA_PREFETCH_FILE on the
+     * state filesystem, the server has to answer Range requests) and is read back for the
+     * MD5. It then waits for applyStaged() or the apply window. An OTA session writing
+     * firmware discards it. Remote trigger: GET /ota/prefetch?url=..&hash=..&rate=..
+     * The onStart, onProgress and onEnd callbacks are not called.
+     *
+     * @param url plain http url of the image
+     * @param md5 expected MD5 of the image
+     * @param bytesPerSecond rate of this download, 0 for the default of setPrefetchLimits()
+     * @return false while an OTA session is running or for invalid parameters
+     */
+    bool prefetch(const char * url, const char * md5, uint32_t bytesPerSecond = 0);
+
+    /**
+     * @brief limits of the background prefetch
+     * @param bytesPerSecond default ELEGANTOTA_PREFETCH_RATE, 0 for no limit
+     * @param cpuPercent share of loop() time the prefetch may use, default ELEGANTOTA_PREFETCH_CPU
+     */
+    void setPrefetchLimits(uint32_t bytesPerSecond, uint8_t cpuPercent = ELEGANTOTA_PREFETCH_CPU);
+
+    /**
+     * @brief apply a staged image automatically between two local hours, needs the system time (NTP)
+     * @param fromHour first hour of the window, -1 disables
+     * @param toHour hour the window ends, may be smaller than fromHour to span midnight
+     */
+    void setApplyWindow(int8_t fromHour, int8_t toHour);
+
+    /**
+     * @brief make the staged image the boot image and reboot (unless auto reboot is disabled)
+     * @return false if no image is staged or an OTA session is running
+     */
+    bool applyStaged();
+
+    /**
+     * @brief stop the prefetch and forget a staged image
+     */
+    void cancelPrefetch();
+
+    OTA_PrefetchState prefetchState() const { return _prefetch_state; }
+
+    /**
+     * @brief set the filesystem ElegantOTA keeps its state files on, mount it before begin()
+     *
+     * Besides the prefetch state it holds the update history served at /ota/history, the
+     * last ELEGANTOTA_HISTORY_LEN sessions with mode, size, MD5, duration, average and
+     * slowest throughput, result and client (ELEGANTOTA_HISTORY_FILE, one small write
+     * per session).
+     *
+     * A filesystem image replaces the default LittleFS as a whole, the state is then kept
+     * in RAM until the reboot. File sync on the same filesystem leaves the state files
+     * alone. A filesystem that neither replaces, e.g. a second LittleFS partition, keeps
+     * the state across both.
+     *
+     * @param fs default LittleFS
+     */
+    void setStateFileSystem(fs::FS& fs);
+
+    /**
+     * @brief set the filesystem used by the file sync mode (/ota/start?mode=files)
+     * @param fs the mounted filesystem, default LittleFS
+     */
+    void setSyncFileSystem(fs::FS& fs);
+
+    /**
+     * @brief validate the header of uploaded firmware images (magic, segments, chip family) before flashing
+     * @param enable default true
+     */
+    void setImageCheck(bool enable);
+
+    /**
+     * @brief only accept ESP32 firmware images whose app descriptor carries this project name
+     * @param project the project name, empty to accept any project
+     */
+    void setImageProject(const char * project);
+
+    /**
+     * @brief reject ESP32 firmware images whose app descriptor version equals FWVersion
+     */
+    void setRejectSameVersion(bool enable);
     void loop();
 
     void onStart(std::function<void()> callable);
@@ -82,42 +432,202 @@ class ElegantOTAClass{
      * @param FWVersion set the current Firmware version
      * @param FWVariant set the current Firmware variant
      */
-    void setGitEnv(String owner, String repo, String branch);
-    void setGitEnv(String owner, String repo, String branch, uint16_t build);
-    void setFWVersion(String version);
-    void setFWVariant(String variant);
-    void setID(String id);
+    void setGitEnv(const char * owner, const char * repo, const char * branch, uint16_t build = 0);
+    void setFWVersion(const char * version);
+    void setFWVariant(const char * variant);
+    void setID(const char * id);
+
+    // String overloads kept for source compatibility, values are copied into inline storage
+    void setGitEnv(const String& owner, const String& repo, const String& branch, uint16_t build = 0) { this->setGitEnv(owner.c_str(), repo.c_str(), branch.c_str(), build); }
+    void setFWVersion(const String& version) { this->setFWVersion(version.c_str()); }
+    void setFWVariant(const String& variant) { this->setFWVariant(variant.c_str()); }
+    void setID(const String& id) { this->setID(id.c_str()); }
     
     /**
      * @brief Set the target partition for filesystem OTA updates on ESP32
      * @param partition The partition label (must match partitions.csv)
      * @note IMPORTANT: Must be called BEFORE begin() on ESP32!
      */
-    void setTargetPartition(String FsPartitionLabel);
+    void setTargetPartition(const char * FsPartitionLabel);
+    void setTargetPartition(const String& FsPartitionLabel) { this->setTargetPartition(FsPartitionLabel.c_str()); }
 
   private:
     ELEGANTOTA_WEBSERVER *_server;
+    ELEGANTOTA_WEBSERVER *_own_server = NULL;       // dedicated listener, see begin(port)
+    ELEGANTOTA_WEBSERVER *_quiesce_server = NULL;
+    bool          _quiesced = false;
+
+    // the instance whose session holds the Update object
+    static ElegantOTAClass * _update_owner;
+
+    typedef ElegantOTAFixedString<ELEGANTOTA_CREDENTIAL_LEN> CredentialString;
+    typedef ElegantOTAFixedString<ELEGANTOTA_INFO_LEN>       InfoString;
+    typedef ElegantOTAFixedString<ELEGANTOTA_GIT_LEN>        GitString;
+    typedef ElegantOTAFixedString<ELEGANTOTA_ERROR_LEN>      ErrorString;
 
-    bool      _authenticate;
-    String    _username;
-    String    _password;
-    String    ChipFamily;
-    String    gitOwner;
-    String    gitRepo;
-    String    gitBranch;
-    uint16_t  gitBuild;
-    String    FWVersion;
-    String    FWVariant;
-    String    id;
-    String    FsPartitionLabel = "";  // Default partition
+    bool              _authenticate;
+    bool              _auth_locked = false;   // setAuth() got credentials that do not fit
+    CredentialString  _username;
+    CredentialString  _password;
+    const char *      ChipFamily = "";
+    GitString         gitOwner;
+    GitString         gitRepo;
+    GitString         gitBranch;
+    uint16_t          gitBuild = 0;
+    InfoString        FWVersion;
+    InfoString        FWVariant;
+    InfoString        id;
+    ElegantOTAFixedString<16> FsPartitionLabel;  // empty = default partition, labels are max. 16 chars
     OTA_Mode   _currentOtaMode = OTA_MODE_FIRMWARE;
 
     bool _auto_reboot = true;
     bool _reboot = false;
     unsigned long _reboot_request_millis = 0;
 
-    String _update_error_str = "";
+    ErrorString _update_error_str;
     unsigned long _current_progress_size;
+    size_t        _update_max_size = 0;
+
+    // mDNS service advertisement
+    bool          _discovery = false;
+    uint16_t      _discovery_port = 80;
+    InfoString    _discovery_hostname;
+
+    uint8_t       _ui_downloads = 0;
+
+    // resource governor, _throttled_client has unacknowledged data while memory is low
+    ElegantOTAGovernor _governor;
+    AsyncClient * _throttled_client = NULL;
+
+    // buffers of the session, reserved when it starts and released by closeSession()
+    ElegantOTAArena _arena;
+
+    // upload request whose first fragment passed authentication and the owner check,
+    // _result_request stays set after the session closed and gets the result
+    AsyncWebServerRequest * _upload_request = NULL;
+    AsyncWebServerRequest * _result_request = NULL;
+
+    // performance profile of the session, _session_data_millis is the time of its first byte
+    ElegantOTAProfile _profile;
+    unsigned long _session_data_millis = 0;
+
+    // update history, the record of a closed session is written by loop()
+    ElegantOTAHistory _history;
+    ElegantOTAHistoryRecord _history_record;
+    bool          _history_due = false;
+    ElegantOTAFixedString<32> _session_md5;   // expected MD5 of the session, empty if none
+
+    // fragments of the last upload, see enableTrace()
+    ElegantOTATrace _trace;
+
+    // peer distribution, /ota/self.bin and pull()
+    bool          _peer_serving = false;
+    uint8_t       _peer_downloads = 0;
+    bool          _pull_pending = false;
+    uint8_t       _pull_step = 0;
+    uint8_t       _pull_result = 0;
+    bool          _pull_from_peer = false;
+    unsigned long _pull_started_millis = 0;
+    unsigned long _pull_retry_millis = 0;
+    void *        _pull_query = NULL;          // running mDNS query
+    unsigned long _pull_query_millis = 0;
+    ElegantOTAPeerAddress _pull_peers[ELEGANTOTA_PULL_PEERS];
+    uint8_t       _pull_peer_count = 0;
+    uint8_t       _pull_peer_next = 0;
+    bool          _pull_peer_busy = false;
+    ElegantOTAFetch _pull_fetch;
+    ElegantOTAFixedString<ELEGANTOTA_URL_LEN> _pull_url;
+    ElegantOTAFixedString<32> _pull_md5;
+    InfoString    _pull_version;
+
+    // file sync mode
+    fs::FS *      _sync_fs = &LittleFS;
+    fs::File      _sync_file;
+    AsyncWebServerRequest * _sync_request = NULL;   // the authorized /ota/fs/file upload, chunks of others are dropped
+    MD5Builder    _sync_md5;
+    ElegantOTAFixedString<64> _sync_path;
+    // the manifest is checked by loop(), _sync_plan collects the files to upload and delete
+    JsonDocument  _sync_manifest;
+    JsonDocument  _sync_plan;
+    OTA_ManifestState _sync_manifest_state = OTA_MANIFEST_NONE;
+    size_t        _sync_manifest_entry = 0;
+    uint32_t      _sync_manifest_client = 0;   // address of a dry run, it has no session
+    fs::File      _sync_hash_file;
+
+    ElegantOTADecryptor *_decryptor = NULL;  // allocated by setEncryptionKey()
+    bool          _encryption_required = false;
+    bool          _encrypted_upload = false;
+
+    ElegantOTASparse _sparse;
+    bool          _sparse_upload = false;
+
+    ElegantOTAWriter _writer;
+
+    ElegantOTABundle _bundle;
+    uint8_t       _bundle_sections = 0;  // bit per section type already written
+    bool          _bundle_app_done = false;
+
+    // raw TCP upload, one connection at a time
+    uint16_t      _tcp_port = 0;
+    AsyncServer * _tcp_server = NULL;
+    AsyncClient * _tcp_client = NULL;
+    bool          _tcp_session = false;      // _tcp_client owns the OTA session
+    uint8_t       _tcp_header[28 + ElegantOTAHmac::LEN];  // header and the MAC answering the challenge
+    uint8_t       _tcp_nonce[16];
+    size_t        _tcp_header_len = 0;
+    uint32_t      _tcp_size = 0;
+    uint32_t      _tcp_received = 0;
+
+    // multicast receive, one transfer at a time
+    ElegantOTABlocks _blocks;
+    WiFiUDP       _mcast_udp;
+    bool          _mcast_active = false;
+    uint16_t      _mcast_id = 0;
+    uint8_t *     _mcast_packet = NULL;
+    ElegantOTAFixedString<32> _mcast_md5;
+    bool          _mcast_verifying = false;  // /ota/multicast/finish asked loop() to read the image back
+    bool          _mcast_committed = false;  // the image of the last multicast session passed and boots next
+
+    // background prefetch, one image at a time
+    fs::FS *      _state_fs = &LittleFS;
+    OTA_PrefetchState _prefetch_state = OTA_PREFETCH_IDLE;
+    ElegantOTAFixedString<ELEGANTOTA_URL_LEN> _prefetch_url;
+    ElegantOTAFixedString<32> _prefetch_md5;
+    ErrorString   _prefetch_error;
+    uint32_t      _prefetch_size = 0;
+    uint32_t      _prefetch_done = 0;      // bytes written, whole blocks
+    uint32_t      _prefetch_verified = 0;
+    uint32_t      _prefetch_rate = 0;
+    uint32_t      _prefetch_default_rate = ELEGANTOTA_PREFETCH_RATE;
+    uint8_t       _prefetch_cpu = ELEGANTOTA_PREFETCH_CPU;
+    size_t        _prefetch_fill = 0;      // bytes of the next block in _prefetch_buf
+    uint8_t *     _prefetch_buf = NULL;
+    unsigned long _prefetch_data_millis = 0;
+    bool          _prefetch_unsaved = false;
+    ElegantOTABlocks _prefetch_blocks;
+    ElegantOTARateLimiter _prefetch_limiter;
+    MD5Builder    _prefetch_hash;
+    ElegantOTAFetch _prefetch_fetch;
+    uint32_t      _prefetch_saved = 0;     // _prefetch_done when the state was saved last
+    unsigned long _prefetch_busy = 0;      // ms the network task spent writing since the last slice
+    const char *  _prefetch_fault = NULL;  // why the network task closed the download
+    bool          _prefetch_fatal = false; // the fault fails the prefetch instead of pausing it
+    bool          _state_fs_replaced = false;  // a filesystem image overwrote the state filesystem
+    int8_t        _apply_from = -1;
+    int8_t        _apply_to = -1;
+    unsigned long _apply_check_millis = 0;
+
+    ElegantOTAImageCheck _image_check;
+    bool          _image_check_enabled = true;
+    bool          _reject_same_version = false;
+    InfoString    _image_project;
+
+    // single-flight OTA session, owned by a token or the client address
+    bool          _session_active = false;
+    ElegantOTAFixedString<16> _session_token;
+    uint32_t      _session_client = 0;
+    unsigned long _session_activity_millis = 0;
+    unsigned long _session_timeout = 30000;
 
     std::function<void()> preUpdateCallback = NULL;
     std::function<void(size_t current, size_t final)> progressUpdateCallback = NULL;
@@ -133,8 +643,409 @@ class ElegantOTAClass{
      * @brief get the chip family of the current device
      * @return the chip family
      */
-    const String& getChipFamily() {return ChipFamily;}
-    
+    const char * getChipFamily() const {return ChipFamily;}
+
+    /**
+     * @brief start a new OTA session owned by the requesting client
+     * @param request the /ota/start request
+     */
+    void openSession(AsyncWebServerRequest *request);
+    void openSession(uint32_t client);
+
+    /**
+     * @brief end the current OTA session
+     * @param abortUpdate abort a still running update and release the partition
+     */
+    void closeSession(bool abortUpdate);
+
+    bool isSessionStale() const;
+    bool isSessionOwner(AsyncWebServerRequest *request) const;
+
+    /**
+     * @brief check if another client owns a live OTA session
+     */
+    bool isSessionBusy(AsyncWebServerRequest *request) const;
+
+    /**
+     * @brief check if another ElegantOTAClass instance owns a live OTA session
+     */
+    bool isUpdateOwnedElsewhere() const;
+
+    /**
+     * @brief answer a successful /ota/start with the session token
+     */
+    void sendSessionStarted(AsyncWebServerRequest *request);
+
+    /**
+     * @brief answer with 409 and a Retry-After header
+     */
+    void sendSessionBusy(AsyncWebServerRequest *request);
+
+    /**
+     * @brief register the _elegantota._tcp mDNS service
+     */
+    void advertise();
+
+    /**
+     * @brief register /ota/self.bin and /ota/pull
+     */
+    void beginPeer();
+
+    /**
+     * @brief advance a pending pull(): query the peers, start the next source, watch the download
+     */
+    void runPull();
+
+    /**
+     * @brief start the mDNS query for peers, with no MD5 to check their images against only the url is tried
+     */
+    void queryPeers();
+
+    /**
+     * @brief collect the answers of the mDNS query once it completed
+     * @return false while the query is still running
+     */
+    bool pollPeers();
+    void endPeerQuery();
+
+    /**
+     * @brief start the download from the next peer, the url of pull() or wait for busy peers
+     */
+    void nextPullSource();
+
+    /**
+     * @brief check the answer of a source, the update begins once it is the wanted image
+     */
+    bool beginPullImage(int status);
+
+    /**
+     * @brief commit a completed download or move on to the next source
+     */
+    void checkPullFetch();
+    void finishPull(bool success);
+
+    /**
+     * @brief stop a pull whose session ended without it
+     */
+    void cancelPull();
+
+    /**
+     * @brief register the /ota/fs/... endpoints of the file sync mode
+     */
+    void beginFsSync();
+
+    /**
+     * @brief check that a request belongs to the running file sync session, answers the request if not
+     */
+    bool checkFsSyncRequest(AsyncWebServerRequest *request);
+
+    /**
+     * @brief check a manifest request, a dry run is allowed without session
+     * @param post the manifest is posted, not polled
+     */
+    bool checkFsManifestRequest(AsyncWebServerRequest *request, bool post);
+
+    /**
+     * @brief take a manifest for runFsManifest() and answer 202
+     */
+    void handleFsManifest(AsyncWebServerRequest *request, const char *json, size_t len);
+
+    /**
+     * @brief answer the files to upload and delete, 202 while the manifest is still checked
+     */
+    void sendFsPlan(AsyncWebServerRequest *request);
+
+    /**
+     * @brief hash the next files of the manifest, called by loop()
+     */
+    void runFsManifest();
+
+    /**
+     * @brief drop the manifest, its plan and a file being hashed
+     */
+    void resetFsManifest();
+
+    /**
+     * @brief collect the paths of all files below a directory
+     */
+    void listSyncFiles(const char *dir, JsonArray& files, uint8_t depth);
+
+    /**
+     * @brief only accept absolute paths without ".." components, and none of isLibraryFile()
+     */
+    bool isSafePath(const char *path) const;
+
+    /**
+     * @brief files the library keeps on the state filesystem, ELEGANTOTA_HISTORY_FILE and
+     * ELEGANTOTA_PREFETCH_FILE, only while file sync works on the same filesystem
+     */
+    bool isLibraryFile(const char *path) const;
+
+    /**
+     * @brief connect the bundle parser to the Update object
+     */
+    void beginBundle();
+
+    /**
+     * @brief connect the sparse image parser to the writer
+     */
+    void beginSparse();
+
+    /**
+     * @brief start writing one section of a bundle to its partition
+     */
+    bool beginBundleSection(uint8_t type, uint32_t size, const char *md5);
+
+    /**
+     * @brief commit one section of a bundle
+     */
+    bool endBundleSection(uint8_t type);
+
+    /**
+     * @brief boot the running firmware again after a bundle failed behind its committed firmware section
+     */
+    void revertBundle();
+
+    /**
+     * @brief validate the collected image header, stores the reason in _update_error_str on failure
+     */
+    bool checkImageHeader();
+
+    /**
+     * @brief check the resources for a new update, take the Update object over from a stale
+     *        session of another instance and discard a previous session of this one
+     * @return false if memory is too short
+     */
+    bool admitUpdate();
+
+    /**
+     * @brief open the Update object (or the bundle parser) for mode, calls the onStart callback
+     * @param md5 expected MD5 of the image, NULL or empty for none
+     * @param encrypted the upload is an encrypted container
+     * @param sparse the (decrypted) upload is a sparse image, see ElegantOTASparse
+     * @return false on failure, the reason is in _update_error_str
+     */
+    bool startUpdate(OTA_Mode mode, const char * md5, bool encrypted, bool sparse);
+
+    /**
+     * @brief reserve the buffers of the session in one step, see ElegantOTAArena
+     * @return false if there is not enough memory, the reason is in _update_error_str
+     */
+    bool reserveSession(size_t internal, size_t external);
+
+    /**
+     * @brief fail the session if size exceeds the opened partition by more than slack
+     */
+    bool checkUpdateSize(size_t size, size_t slack);
+
+    /**
+     * @brief acknowledge the data of client late while memory is short
+     */
+    void throttleUpload(AsyncClient *client);
+
+    /**
+     * @brief pass received bytes of the upload on to the partition
+     * @param index offset of data in the upload, 0 starts over
+     * @param total size of the upload for the progress callback
+     * @return false if the session was aborted, the reason is in _update_error_str
+     */
+    bool writeUpdate(uint8_t *data, size_t len, size_t index, size_t total);
+
+    /**
+     * @brief check and write plain image data, counts it as progress
+     * @return false on failure, the reason is in _update_error_str
+     */
+    bool writeImage(const uint8_t *data, size_t len);
+
+    /**
+     * @brief write len erased bytes (0xFF), a hole of a sparse image
+     */
+    bool fillImage(uint32_t len);
+
+    /**
+     * @brief verify and commit the uploaded image, closes the session
+     * @param name shown in the log
+     * @return false on failure, the reason is in _update_error_str
+     */
+    bool finishUpdate(const char * name);
+
+    /**
+     * @brief abort the session of an upload the library refused
+     * @param reason the error reported to the client
+     */
+    void failUpdate(const char * reason);
+
+    /**
+     * @brief start the raw TCP listener if enableTcpUpload() was called
+     */
+    void beginTcp();
+
+    /**
+     * @brief parse the header and stream the payload of the raw TCP connection
+     */
+    void handleTcpData(uint8_t *data, size_t len);
+
+    /**
+     * @brief check the complete header and open the session, answers and closes the connection on failure
+     */
+    bool startTcpSession();
+
+    /**
+     * @brief answer the header of an authenticated connection with a fresh nonce
+     */
+    void sendTcpChallenge();
+
+    /**
+     * @brief check the MAC the client sent for the nonce, in constant time
+     */
+    bool checkTcpResponse();
+
+    /**
+     * @brief send one "<code> <text>" line
+     */
+    void replyTcp(AsyncClient *client, int code, const char *text);
+
+    /**
+     * @brief answer and close the raw TCP connection
+     */
+    void endTcp(int code, const char *text);
+
+    /**
+     * @brief register the /ota/multicast/... endpoints
+     */
+    void beginMulticast();
+
+    /**
+     * @brief check that a request belongs to the running multicast session, answers the request if not
+     */
+    bool checkMulticastRequest(AsyncWebServerRequest *request);
+
+    /**
+     * @brief check the parameters of /ota/start?mode=multicast and join the group
+     * @return false on failure, the reason is in _update_error_str
+     */
+    bool startMulticast(AsyncWebServerRequest *request);
+
+    /**
+     * @brief write the queued multicast packets, runs in loop()
+     */
+    void pollMulticast();
+
+    /**
+     * @brief read a slice of the received image back, check its MD5 and boot it after the last one, runs in loop()
+     */
+    void verifyMulticast();
+
+    /**
+     * @brief leave the group and free the block bookkeeping
+     */
+    void endMulticast();
+
+    /**
+     * @brief register the /ota/prefetch endpoints and resume a saved prefetch
+     */
+    void beginPrefetch();
+
+    /**
+     * @brief one slice of download or verification, runs in loop()
+     */
+    void runPrefetch();
+
+    /**
+     * @brief request the image from the current offset, the answer arrives on the network task
+     */
+    void connectPrefetch();
+    void closePrefetchConnection();
+
+    /**
+     * @brief check the status and size of the answer, runs on the network task
+     * @return false to close the connection, the reason is left in _prefetch_fault
+     */
+    bool beginPrefetchImage(int status);
+
+    /**
+     * @brief write the received bytes as whole blocks, runs on the network task
+     */
+    bool receivePrefetch(const uint8_t *data, size_t len);
+
+    /**
+     * @brief handle the end of the download, runs in loop()
+     */
+    void checkPrefetchFetch();
+
+    /**
+     * @brief allocate the block writer and take the written part of the image
+     * @return false with the reason in _prefetch_fault
+     */
+    bool openPrefetch();
+
+    /**
+     * @brief acknowledge the received bytes the rate allows, the server sends the next ones
+     */
+    void downloadPrefetch(size_t allowance);
+    void verifyPrefetch(unsigned long started);
+
+    /**
+     * @brief give up on the image, the reason is shown by /ota/prefetch/status
+     */
+    void failPrefetch(const char * reason);
+
+    /**
+     * @brief drop the connection and try again after PREFETCH_RETRY_MS
+     */
+    void retryPrefetch(const char * reason);
+
+    void savePrefetch();
+    void loadPrefetch();
+    bool inApplyWindow() const;
+
+    /**
+     * @brief register /ota/history and read the history file
+     */
+    void beginHistory();
+
+    /**
+     * @brief register /ota/trace.bin
+     */
+    void beginTrace();
+
+    /**
+     * @brief fill the history record of the session being closed
+     * @param aborted the session ends without a committed update
+     */
+    void recordHistory(bool aborted);
+
+    /**
+     * @brief write the record of the last session, runs in loop()
+     */
+    void saveHistory();
+
+    /**
+     * @brief log the resource watermarks of the finished session
+     */
+    void logResources();
+
+    /**
+     * @brief store the last error of the Update object in _update_error_str
+     */
+    void storeUpdateError();
+
+    /**
+     * @brief check the credentials of a request, refuses every request while _auth_locked
+     */
+    bool isAuthorized(AsyncWebServerRequest *request);
+
+    /**
+     * @brief copy a setting into its inline buffer, logs if it had to be truncated
+     * @param name shown in the log
+     */
+    template <size_t N>
+    void storeSetting(ElegantOTAFixedString<N>& target, const char * value, const char * name) {
+      if (!target.assign(value)) {
+        this->logf("%s is longer than %u characters and was truncated", name, (unsigned)N);
+      }
+    }
+
     /**
     * @brief Wrapper function for logging like Serial.printf
     * @param format the format string
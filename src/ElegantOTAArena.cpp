@@ -0,0 +1,54 @@
+#include "ElegantOTAArena.h"
+
+bool ElegantOTAArena::begin(size_t internal, size_t external) {
+  this->end();
+  internal = align(internal);
+  external = align(external);
+
+  #if defined(ESP32)
+    if (external >= ELEGANTOTA_ARENA_PSRAM_MIN && psramFound()) {
+      _external = (uint8_t *)heap_caps_malloc(external, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      _psram = _external != NULL;
+    }
+  #endif
+
+  // without PSRAM both regions share one block, the external one behind the internal one
+  size_t block = internal + (_external == NULL ? external : 0);
+  if (block) {
+    #if defined(ESP32)
+      _internal = (uint8_t *)heap_caps_malloc(block, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    #else
+      _internal = (uint8_t *)malloc(block);
+    #endif
+    if (_internal == NULL) {
+      this->end();
+      return false;
+    }
+  }
+  _internal_len = internal;
+  _external_len = external;
+  return true;
+}
+
+void * ElegantOTAArena::alloc(size_t len, bool external) {
+  len = align(len);
+  if (external) {
+    if (len > _external_len - _external_used) return NULL;
+    uint8_t *p = (_external != NULL ? _external : _internal + _internal_len) + _external_used;
+    _external_used += len;
+    return p;
+  }
+  if (len > _internal_len - _internal_used) return NULL;
+  uint8_t *p = _internal + _internal_used;
+  _internal_used += len;
+  return p;
+}
+
+void ElegantOTAArena::end() {
+  free(_internal);
+  free(_external);
+  _internal = _external = NULL;
+  _internal_len = _external_len = 0;
+  _internal_used = _external_used = 0;
+  _psram = false;
+}
@@ -0,0 +1,68 @@
+#ifndef ElegantOTAArena_h
+#define ElegantOTAArena_h
+
+#include "Arduino.h"
+
+#if defined(ESP32)
+  #include "esp_heap_caps.h"
+#endif
+
+// buffers of at least this size go to PSRAM on ESP32 boards that have it
+#ifndef ELEGANTOTA_ARENA_PSRAM_MIN
+  #define ELEGANTOTA_ARENA_PSRAM_MIN 1024
+#endif
+
+/**
+ * @brief buffers of one OTA session, reserved in one step when the session starts
+ *
+ * The session engine adds up the buffers of the mode (write chunk, multicast bookkeeping),
+ * reserves them with begin() at /ota/start and hands them out with alloc(), so receiving
+ * the image does not touch the heap. end() gives everything back at once.
+ *
+ * There are two regions. The internal one is always in internal RAM, for buffers that
+ * are passed to the flash API. Buffers only the CPU touches go to the external region,
+ * which is PSRAM on ESP32 boards that have it (if it is at least ELEGANTOTA_ARENA_PSRAM_MIN
+ * bytes) and part of the internal block otherwise.
+ */
+class ElegantOTAArena {
+  public:
+    ~ElegantOTAArena() { this->end(); }
+
+    /**
+     * @brief reserve the regions, releases a previous reservation first
+     * @return false if the memory could not be allocated, nothing is reserved then
+     */
+    bool begin(size_t internal, size_t external);
+
+    /**
+     * @brief take a word aligned buffer from a region
+     * @param external the buffer is never passed to the flash API
+     * @return NULL if the region is exhausted
+     */
+    void * alloc(size_t len, bool external);
+
+    /**
+     * @brief release both regions, pointers handed out before are invalid afterwards
+     */
+    void end();
+
+    /**
+     * @brief round a buffer length up to the alignment alloc() uses, to add up reservations
+     */
+    static size_t align(size_t len) { return (len + 3) & ~(size_t)3; }
+
+    size_t size() const { return _internal_len + _external_len; }
+    size_t used() const { return _internal_used + _external_used; }
+    bool psram() const { return _psram; }
+
+  private:
+    uint8_t * _internal = NULL;
+    uint8_t * _external = NULL;   // NULL if the external region is part of the internal block
+    size_t    _internal_len = 0;
+    size_t    _external_len = 0;
+    size_t    _internal_used = 0;
+    size_t    _external_used = 0;
+    bool      _psram = false;
+};
+
+#endif
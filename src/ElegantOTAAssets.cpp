@@ -0,0 +1,1031 @@
+// generated by scripts/generate_hex.py, do not edit
+// sources md5: 92439ecadd71771cdbccc7b7ccd2c2fd
+
+#include "ElegantOTAAssets.h"
+
+// include/ElegantOTA.html, 45285 bytes, gzip -9
+alignas(4) static const uint8_t asset_0[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0x3c,
+  0x69, 0x73, 0xdb, 0x46, 0xb2, 0x9f, 0x57, 0xbf, 0x62, 0x8c, 0x24, 0x32,
+  0xb1, 0x01, 0x20, 0xde, 0x92, 0xc8, 0xd0, 0x59, 0x9f, 0xb1, 0xeb, 0xf9,
+  0x48, 0xd9, 0x4e, 0x76, 0x53, 0xb6, 0x2b, 0x19, 0x02, 0x43, 0x72, 0x2c,
+  0x10, 0x40, 0x70, 0x88, 0xa2, 0xb8, 0xdc, 0xdf, 0xfe, 0xba, 0xe7, 0xc0,
+  0x45, 0x50, 0xa2, 0xbc, 0xd9, 0x57, 0xfb, 0xaa, 0xe2, 0xac, 0xbd, 0x9c,
+  0xee, 0x9e, 0xee, 0x9e, 0x99, 0x3e, 0x07, 0x04, 0xbf, 0xbb, 0x67, 0xdb,
+  0x47, 0xf3, 0x6b, 0x1e, 0x11, 0xdb, 0x25, 0x3c, 0x70, 0xfd, 0xcc, 0x63,
+  0x27, 0xcc, 0x67, 0x73, 0x1a, 0xa4, 0xbf, 0x86, 0x29, 0x75, 0x16, 0xe9,
+  0xd2, 0x27, 0x0f, 0x1a, 0x51, 0xf3, 0xeb, 0xa3, 0xa3, 0x78, 0xb9, 0x0f,
+  0x75, 0x7a, 0x4d, 0x28, 0xb1, 0x53, 0xc1, 0xbb, 0x99, 0x84, 0xec, 0x15,
+  0x78, 0x74, 0x75, 0xe5, 0x11, 0x3b, 0x20, 0x4f, 0x5f, 0x3e, 0xfd, 0xe1,
+  0xe1, 0xeb, 0xf7, 0xbf, 0xbe, 0x79, 0xff, 0xf0, 0xd7, 0xe7, 0xef, 0x5f,
+  0xbd, 0x24, 0x36, 0xdf, 0xc7, 0x2b, 0x89, 0xdd, 0x1c, 0x84, 0x2c, 0x1c,
+  0x37, 0x8a, 0x8e, 0x8e, 0x5c, 0x8f, 0xfc, 0xeb, 0xe4, 0xd5, 0xfa, 0xdd,
+  0x05, 0x4b, 0xdd, 0xc5, 0x34, 0x0c, 0x2f, 0x4e, 0x9e, 0x87, 0x4b, 0xf6,
+  0x2e, 0xa5, 0x69, 0x96, 0x3c, 0xe1, 0x49, 0xe4, 0xd3, 0xf5, 0x09, 0x39,
+  0x3e, 0x26, 0xfb, 0x76, 0x40, 0x70, 0xda, 0xb3, 0x05, 0x02, 0x07, 0x92,
+  0x61, 0xba, 0x50, 0x97, 0xef, 0xa5, 0x68, 0xe6, 0x7a, 0x74, 0x64, 0xdb,
+  0x0f, 0x8e, 0x8e, 0xbe, 0xbb, 0xe7, 0x85, 0x6e, 0xba, 0x8e, 0x18, 0x41,
+  0xf0, 0x83, 0xa3, 0xef, 0x84, 0x38, 0x9f, 0x06, 0xf3, 0x89, 0xc1, 0x02,
+  0xe3, 0xc1, 0x11, 0x21, 0xdf, 0x2d, 0x18, 0xf5, 0xf0, 0x03, 0x7c, 0x5c,
+  0xb2, 0x94, 0x12, 0x77, 0x41, 0xe3, 0x84, 0xa5, 0x13, 0xe3, 0xa7, 0xf7,
+  0xcf, 0xec, 0x33, 0x83, 0x9c, 0x94, 0x91, 0x01, 0x5d, 0xb2, 0x89, 0x71,
+  0xc9, 0xd9, 0x2a, 0x0a, 0xe3, 0xd4, 0x20, 0x6e, 0x18, 0xa4, 0x2c, 0x00,
+  0xe2, 0x15, 0xf7, 0xd2, 0xc5, 0xc4, 0x63, 0x97, 0xdc, 0x65, 0xb6, 0x18,
+  0x58, 0xa0, 0x1a, 0x4f, 0x39, 0xf5, 0xed, 0xc4, 0xa5, 0x3e, 0x9b, 0x74,
+  0x9c, 0x76, 0xc1, 0x2c, 0xe5, 0xa9, 0xcf, 0x1e, 0x3c, 0x95, 0x3a, 0xc3,
+  0x09, 0x90, 0x97, 0x3c, 0x65, 0xdf, 0x9d, 0x48, 0xb0, 0x24, 0x49, 0xdc,
+  0x98, 0x47, 0x29, 0x41, 0xed, 0x27, 0xc6, 0x32, 0xf4, 0x32, 0x9f, 0x81,
+  0xbc, 0x38, 0x4c, 0x92, 0x30, 0xe6, 0x73, 0x1e, 0x3c, 0x38, 0x6a, 0xcd,
+  0xb2, 0xc0, 0x4d, 0x79, 0x18, 0xb4, 0xcc, 0x0d, 0x28, 0x92, 0xa4, 0x64,
+  0x36, 0x81, 0xf5, 0x66, 0x4b, 0xd0, 0xc8, 0x71, 0x63, 0x46, 0x53, 0x06,
+  0x12, 0x70, 0xd4, 0x32, 0x7c, 0x1e, 0x5c, 0x18, 0xa6, 0x13, 0x33, 0xff,
+  0x25, 0x4f, 0xd2, 0x31, 0x9f, 0xb5, 0x66, 0xc7, 0xc7, 0x33, 0x27, 0xc9,
+  0x22, 0x5c, 0x48, 0x52, 0xfe, 0xdc, 0x52, 0xd2, 0x22, 0x20, 0x0e, 0xa9,
+  0x67, 0x98, 0x66, 0xcc, 0xd2, 0x2c, 0x0e, 0xc6, 0xb3, 0x30, 0x6e, 0x49,
+  0x39, 0x94, 0x84, 0x33, 0x92, 0x8b, 0xfa, 0x3d, 0x63, 0xf1, 0xfa, 0x1d,
+  0x1c, 0x80, 0x9b, 0x86, 0xf1, 0x43, 0xdf, 0x6f, 0xdd, 0x47, 0x69, 0x1f,
+  0x60, 0xfa, 0xa4, 0xc6, 0xea, 0xd3, 0x7d, 0xd3, 0xf4, 0x5a, 0xd4, 0x1c,
+  0x07, 0x6c, 0x45, 0x5e, 0x65, 0x60, 0x2a, 0xa0, 0xfd, 0x9b, 0x69, 0xc2,
+  0xe2, 0x4b, 0x16, 0xb7, 0xe8, 0xe4, 0xc1, 0xa6, 0x90, 0xe1, 0xa2, 0x0c,
+  0x6a, 0x82, 0xa6, 0xae, 0x23, 0x36, 0x61, 0x32, 0x31, 0xdc, 0x05, 0xf7,
+  0x3d, 0x5c, 0x80, 0x61, 0x16, 0x84, 0x1c, 0x09, 0x5d, 0x87, 0x7a, 0x1e,
+  0xf3, 0x5e, 0x87, 0x1e, 0x4b, 0x4c, 0xee, 0xa4, 0x74, 0xfe, 0x1a, 0x8f,
+  0x0a, 0xe6, 0xbc, 0x7c, 0xf1, 0xfa, 0x7f, 0x8c, 0xe3, 0x63, 0x8e, 0x6b,
+  0xc7, 0x71, 0x55, 0xa3, 0xe3, 0x63, 0xaf, 0xc5, 0xcd, 0xad, 0xe9, 0x84,
+  0x52, 0x8b, 0x96, 0x5e, 0x95, 0xb5, 0xc9, 0x85, 0x8d, 0xee, 0xb5, 0xad,
+  0x24, 0x9b, 0xa6, 0x31, 0x63, 0xf0, 0x71, 0x6b, 0x8e, 0xf5, 0xbe, 0x93,
+  0x04, 0xd6, 0xa2, 0xb6, 0xde, 0x9d, 0x6c, 0xb6, 0x63, 0xb9, 0x51, 0x84,
+  0x3a, 0x1c, 0xcc, 0x62, 0x1e, 0xf3, 0x74, 0x7d, 0x7c, 0x0c, 0xea, 0xe7,
+  0xa3, 0x49, 0x09, 0x63, 0x5a, 0x14, 0x54, 0x9a, 0xb1, 0x38, 0x66, 0xf1,
+  0x8f, 0xa1, 0xcf, 0x5d, 0x49, 0x5b, 0x05, 0x4d, 0xea, 0x34, 0x38, 0x4b,
+  0x18, 0xc1, 0x1b, 0x61, 0x04, 0xb8, 0xa0, 0x2c, 0x61, 0x36, 0x9c, 0xb6,
+  0x07, 0x4a, 0x83, 0xb5, 0x25, 0xc6, 0xf7, 0xae, 0x53, 0x1a, 0x4e, 0x0c,
+  0xe5, 0x21, 0xc6, 0x68, 0x67, 0x26, 0x0d, 0xc2, 0x60, 0xbd, 0x0c, 0xb3,
+  0xdd, 0x39, 0xe1, 0x92, 0xa7, 0xc6, 0xa8, 0x06, 0x4c, 0x60, 0x47, 0x6d,
+  0x69, 0x7c, 0x86, 0xe5, 0x6e, 0xf3, 0x5d, 0xc0, 0x13, 0xdd, 0xc0, 0x39,
+  0x51, 0x87, 0x45, 0xda, 0x56, 0xf0, 0xf3, 0xe4, 0x5e, 0x7b, 0xac, 0x37,
+  0x07, 0x77, 0x6a, 0x3c, 0xc3, 0x48, 0x01, 0x64, 0x0b, 0x58, 0x93, 0xe5,
+  0x9a, 0xdb, 0xad, 0xd9, 0x32, 0xc7, 0x7e, 0x08, 0xee, 0xf1, 0x0e, 0x2c,
+  0x87, 0xce, 0x99, 0x93, 0x2e, 0x98, 0x3c, 0x35, 0x8f, 0xc6, 0x17, 0xc6,
+  0x3f, 0xff, 0x79, 0xaf, 0x65, 0x08, 0x10, 0x2c, 0x82, 0x94, 0x09, 0xcd,
+  0xe3, 0xe3, 0x15, 0x0f, 0xbc, 0x70, 0xe5, 0x2c, 0x29, 0xf0, 0x7c, 0xc5,
+  0x3c, 0x4e, 0x5b, 0x46, 0x2b, 0x12, 0x9b, 0x95, 0xd8, 0x6e, 0xe8, 0x87,
+  0x31, 0xf8, 0x1d, 0x4e, 0x1d, 0x11, 0xe4, 0x65, 0x82, 0xf1, 0x0b, 0x52,
+  0x96, 0x7c, 0x9f, 0x9f, 0xb1, 0xa3, 0x3f, 0x28, 0x37, 0x71, 0x5c, 0x9f,
+  0x26, 0x09, 0x1e, 0x39, 0x5a, 0x53, 0x4b, 0x2a, 0x61, 0x5a, 0x39, 0xf9,
+  0x9c, 0x69, 0xca, 0x47, 0xeb, 0x17, 0x0a, 0xff, 0x0a, 0x2c, 0xee, 0xf1,
+  0x82, 0xb9, 0x17, 0xd3, 0xf0, 0x0a, 0x64, 0xb8, 0xf8, 0x91, 0x79, 0xb0,
+  0x74, 0x73, 0x74, 0x88, 0x9c, 0x98, 0x2d, 0x43, 0xb0, 0xba, 0x7f, 0x4b,
+  0x54, 0xc7, 0x1c, 0xdf, 0x65, 0x1e, 0x2c, 0xed, 0xe9, 0x25, 0x10, 0xa0,
+  0x7c, 0x16, 0x80, 0xdf, 0x19, 0x2e, 0x58, 0xd6, 0x85, 0x61, 0x95, 0xc2,
+  0xc9, 0x17, 0xe8, 0x71, 0xe7, 0x6d, 0x6d, 0x38, 0x78, 0x85, 0xfa, 0x92,
+  0x9d, 0x6b, 0xe2, 0xe6, 0xf3, 0xf9, 0x02, 0x42, 0x05, 0x78, 0xac, 0x34,
+  0xc3, 0xcb, 0x89, 0x0f, 0x21, 0x66, 0xdf, 0xda, 0x7c, 0xb3, 0x81, 0xfb,
+  0x82, 0x43, 0x58, 0x09, 0x80, 0x87, 0xf5, 0xe8, 0xf0, 0xc9, 0x62, 0x95,
+  0xc5, 0xcc, 0xd5, 0x8d, 0x33, 0x8d, 0x28, 0x0e, 0xe7, 0x31, 0x4b, 0x92,
+  0xf7, 0x18, 0xfc, 0x61, 0x3f, 0x79, 0x00, 0x87, 0x82, 0x19, 0x79, 0xe2,
+  0x6f, 0xad, 0xa7, 0x37, 0xcf, 0x85, 0xc8, 0x10, 0xc6, 0x8d, 0x13, 0xdf,
+  0x1f, 0x30, 0xf1, 0x2d, 0xa3, 0x49, 0x18, 0xd4, 0x67, 0x3e, 0xc1, 0x99,
+  0x0b, 0x9a, 0x2c, 0x9e, 0x71, 0x9f, 0xb5, 0x7c, 0x6b, 0x65, 0x5a, 0xaf,
+  0x27, 0x34, 0x59, 0x07, 0x2e, 0x41, 0x96, 0x8f, 0x5a, 0x46, 0x16, 0x61,
+  0xec, 0x7c, 0x1c, 0xfa, 0xd9, 0x12, 0x66, 0x5b, 0x00, 0x81, 0x84, 0x99,
+  0xf2, 0x60, 0x9e, 0xe4, 0xb0, 0xcb, 0x62, 0x5d, 0x1a, 0x36, 0xf6, 0x59,
+  0x25, 0x43, 0xd5, 0x55, 0x82, 0x62, 0x03, 0x2d, 0x0b, 0xd4, 0xb9, 0xa4,
+  0x7e, 0xc6, 0xc6, 0x69, 0xbc, 0xde, 0xe0, 0x94, 0x64, 0x42, 0x57, 0x94,
+  0xa7, 0xe4, 0x09, 0x6c, 0xf2, 0x78, 0xd5, 0x32, 0xa0, 0xc2, 0x88, 0x51,
+  0x18, 0xc1, 0xbc, 0xf9, 0x63, 0x1c, 0xba, 0x20, 0xc3, 0xd0, 0x47, 0xec,
+  0x29, 0x62, 0x19, 0x6a, 0x7e, 0x3b, 0x01, 0xa6, 0x27, 0x09, 0x4e, 0xf8,
+  0x1e, 0xe2, 0x3e, 0x9b, 0x7c, 0xbd, 0x99, 0x6d, 0x8f, 0x71, 0x6d, 0xf0,
+  0x29, 0xd9, 0xfe, 0x66, 0x62, 0x22, 0xbc, 0xe7, 0x39, 0xe1, 0x85, 0x99,
+  0x2e, 0xe2, 0x70, 0x45, 0x30, 0x2f, 0x3d, 0xc5, 0xad, 0x51, 0x62, 0x84,
+  0x8c, 0x48, 0xca, 0x20, 0x33, 0x0a, 0x1b, 0xe2, 0xe5, 0xa2, 0xa8, 0x12,
+  0xe5, 0x39, 0x29, 0xbb, 0x4a, 0x5b, 0x12, 0x1c, 0xfa, 0xcc, 0xf1, 0xc3,
+  0x79, 0x79, 0x3a, 0xec, 0x41, 0x04, 0x18, 0x36, 0x32, 0x2c, 0x6a, 0xe6,
+  0x01, 0x11, 0x25, 0x3d, 0x0b, 0xe3, 0xe5, 0x13, 0x9a, 0x52, 0xb1, 0x33,
+  0x5c, 0x80, 0xfe, 0xf1, 0xea, 0xe5, 0xf3, 0x34, 0x8d, 0xde, 0x32, 0x48,
+  0xaa, 0x98, 0xa7, 0x9d, 0x30, 0x62, 0x41, 0xcb, 0xf8, 0xf1, 0xcd, 0xbb,
+  0xf7, 0x86, 0x65, 0x88, 0xe5, 0xc8, 0xdd, 0x87, 0x3d, 0xe6, 0x8e, 0xfc,
+  0xd8, 0xe0, 0xd1, 0x7a, 0xef, 0x4b, 0x4e, 0x1d, 0x9b, 0x62, 0x37, 0xa3,
+  0xc9, 0x2b, 0x9a, 0x2e, 0x9c, 0x38, 0xcc, 0x02, 0xaf, 0x15, 0x3b, 0x38,
+  0x9f, 0x79, 0x27, 0xb1, 0x93, 0x02, 0x6b, 0xff, 0xaf, 0x9d, 0x76, 0xfb,
+  0x86, 0x60, 0xa2, 0xb9, 0x3e, 0xa2, 0x31, 0x9c, 0x52, 0x92, 0xae, 0x61,
+  0xb1, 0xb2, 0xf0, 0x89, 0xbe, 0x35, 0xbe, 0x31, 0xac, 0x5b, 0x27, 0xfe,
+  0x8c, 0x07, 0x5b, 0xb1, 0x37, 0x31, 0x71, 0x6b, 0x41, 0x0c, 0x2b, 0x96,
+  0x13, 0x06, 0x9a, 0x7e, 0x52, 0xd6, 0x1e, 0x8e, 0x0a, 0xf4, 0x65, 0xc1,
+  0x3c, 0x5d, 0x3c, 0x0e, 0x97, 0x11, 0x54, 0x0f, 0x53, 0x9f, 0xfd, 0x17,
+  0x2f, 0x6a, 0x0b, 0x2b, 0x0a, 0x03, 0x28, 0xc3, 0xbc, 0x35, 0x58, 0x60,
+  0xca, 0xa0, 0xb0, 0x0c, 0xe6, 0x6c, 0x52, 0x8a, 0xb2, 0xb0, 0x22, 0x2c,
+  0x4b, 0x80, 0x00, 0xab, 0x66, 0xc8, 0x7b, 0x7d, 0x53, 0x80, 0x12, 0x51,
+  0x43, 0x4f, 0x26, 0x5d, 0x50, 0xfc, 0x0b, 0xf4, 0x36, 0x60, 0xc1, 0x87,
+  0x28, 0x2e, 0x67, 0x16, 0x6a, 0xab, 0x79, 0x8f, 0x76, 0x5d, 0x17, 0xdd,
+  0x39, 0xc9, 0x5c, 0xb7, 0xec, 0xcd, 0xcc, 0x4f, 0x18, 0xa9, 0xa8, 0xdb,
+  0x07, 0x75, 0x37, 0xff, 0x35, 0xfa, 0x8a, 0x08, 0x97, 0x03, 0x9e, 0xb6,
+  0x8c, 0x9f, 0x84, 0x75, 0x15, 0x5e, 0x8c, 0x86, 0x13, 0x4f, 0xf0, 0x00,
+  0xa4, 0x7f, 0xbe, 0x07, 0x2f, 0x1e, 0xbf, 0x07, 0x4b, 0xdb, 0x8a, 0xa5,
+  0xfd, 0xbf, 0x59, 0x88, 0xf5, 0x1e, 0xa2, 0x8d, 0xa8, 0xa0, 0x89, 0x2c,
+  0xbe, 0x98, 0x47, 0xe4, 0x91, 0x40, 0x7b, 0xe2, 0x31, 0x62, 0x7c, 0xab,
+  0x8f, 0x08, 0x72, 0x11, 0xd4, 0xc9, 0x11, 0x44, 0x14, 0x50, 0x66, 0x06,
+  0xb3, 0x0d, 0xcb, 0xb7, 0x7c, 0x07, 0x9b, 0x1a, 0x74, 0xbf, 0x04, 0xe1,
+  0xae, 0x69, 0xad, 0xb4, 0x08, 0x0c, 0xb2, 0xc6, 0xb7, 0x8a, 0x60, 0xeb,
+  0x62, 0xf9, 0xd4, 0x4a, 0xcc, 0xcd, 0x97, 0xeb, 0x99, 0x38, 0x4b, 0x98,
+  0x84, 0xf5, 0x1b, 0x78, 0xc7, 0xcf, 0x98, 0x67, 0x7c, 0xe5, 0xd1, 0x0f,
+  0x3a, 0xc7, 0xc7, 0xf7, 0x96, 0x99, 0x9f, 0xf2, 0xc8, 0x67, 0xdf, 0xb7,
+  0xa0, 0x61, 0x8a, 0xa1, 0x6b, 0xf9, 0x25, 0xcc, 0x88, 0x4b, 0x03, 0x12,
+  0x06, 0xfe, 0x9a, 0xc8, 0xe8, 0x00, 0x9f, 0x19, 0x69, 0x39, 0x53, 0x1e,
+  0x98, 0x04, 0x97, 0x40, 0x28, 0xb6, 0x23, 0x29, 0x5f, 0x32, 0x07, 0x44,
+  0x40, 0x1c, 0x19, 0xf9, 0x1f, 0xda, 0x9f, 0x84, 0xca, 0x0e, 0xf4, 0xa0,
+  0x1c, 0xb8, 0x00, 0xc2, 0x89, 0xc2, 0xa8, 0x65, 0xde, 0x9b, 0x18, 0x30,
+  0xcf, 0xb8, 0x91, 0x7d, 0x89, 0x75, 0xa2, 0x39, 0x42, 0x1d, 0x7b, 0x49,
+  0x63, 0xf2, 0xfb, 0xfe, 0xdc, 0x25, 0x27, 0x3f, 0xca, 0xd2, 0x14, 0xf3,
+  0xa9, 0xf5, 0xf5, 0x7e, 0x4a, 0x64, 0xfc, 0x22, 0x80, 0xe8, 0x05, 0x16,
+  0xf8, 0xfb, 0x01, 0xb5, 0x98, 0x0f, 0x11, 0xce, 0x81, 0xba, 0x16, 0xa9,
+  0x9e, 0xb0, 0x19, 0x85, 0x2d, 0x6a, 0x81, 0x00, 0x47, 0xd0, 0xb5, 0xcc,
+  0x72, 0x37, 0x72, 0x8d, 0xc4, 0x98, 0xd0, 0x7e, 0x86, 0x0f, 0xaa, 0x10,
+  0xbf, 0xd7, 0x19, 0xbf, 0x6e, 0xe1, 0x8e, 0x98, 0x45, 0xbd, 0xfe, 0x03,
+  0x84, 0x1e, 0x55, 0x3d, 0x63, 0xd5, 0x84, 0x30, 0x47, 0xb6, 0x43, 0xc0,
+  0x4f, 0x21, 0xc2, 0xe0, 0x99, 0x56, 0x74, 0x72, 0x3d, 0x56, 0x40, 0x38,
+  0x71, 0x96, 0xfe, 0x0c, 0xcd, 0xef, 0xe4, 0x87, 0x31, 0x34, 0xd7, 0x27,
+  0xb2, 0x45, 0xd5, 0xfd, 0x2a, 0x3a, 0xc2, 0x83, 0xa3, 0xbf, 0x5a, 0xa3,
+  0x29, 0x83, 0xe6, 0x8c, 0x59, 0x23, 0x3a, 0x4b, 0x59, 0xbc, 0x81, 0x22,
+  0xd1, 0x4e, 0xf8, 0x35, 0xd8, 0xd2, 0x68, 0x1a, 0xc6, 0x1e, 0x8b, 0x6d,
+  0x80, 0x8c, 0xd5, 0x47, 0xe1, 0x37, 0xa3, 0xb6, 0x1e, 0x0a, 0x1e, 0x23,
+  0x48, 0xa2, 0xdc, 0xd3, 0x20, 0x51, 0xca, 0x8f, 0xbe, 0x62, 0x03, 0x76,
+  0xca, 0xa6, 0xdb, 0x1a, 0x6f, 0xdb, 0x4e, 0x57, 0xb6, 0xea, 0xc1, 0x47,
+  0xc4, 0x30, 0xb6, 0xd8, 0xdf, 0x6f, 0xa0, 0xfb, 0x64, 0xf6, 0x82, 0x61,
+  0xf1, 0x37, 0xea, 0x38, 0x83, 0xb1, 0xbd, 0x62, 0xd3, 0x0b, 0x9e, 0xda,
+  0x98, 0xa6, 0x51, 0x15, 0x66, 0x53, 0xef, 0x73, 0x06, 0x7d, 0x1d, 0xba,
+  0xdd, 0xd8, 0x5e, 0x86, 0xd7, 0x36, 0xe4, 0x12, 0x81, 0x19, 0xf5, 0xc7,
+  0x76, 0x58, 0x1e, 0x95, 0x3e, 0xce, 0x40, 0x8e, 0x3d, 0xa3, 0x4b, 0xee,
+  0xaf, 0x47, 0x19, 0xb7, 0x13, 0x1a, 0x24, 0x36, 0xf4, 0x8c, 0x7c, 0x66,
+  0x25, 0x10, 0xe0, 0xd9, 0xd2, 0xce, 0xb8, 0x65, 0x83, 0x77, 0xf9, 0xcc,
+  0x96, 0x00, 0xeb, 0x11, 0xf6, 0xc1, 0xaf, 0xa8, 0xfb, 0x4e, 0x0c, 0x9f,
+  0xc1, 0x7c, 0xeb, 0x1d, 0x9b, 0x87, 0x8c, 0xfc, 0xf4, 0xc2, 0x7a, 0x1b,
+  0x4e, 0xc3, 0x34, 0xb4, 0x9e, 0x33, 0xff, 0x92, 0xa5, 0xdc, 0xa5, 0xe4,
+  0x35, 0xcb, 0x98, 0xf5, 0x30, 0x86, 0x56, 0xcb, 0x7a, 0x0d, 0x18, 0xf2,
+  0x0e, 0xf8, 0x5b, 0x25, 0x21, 0xc6, 0x43, 0x64, 0x4d, 0x1e, 0xe3, 0x7e,
+  0x90, 0xa7, 0xcb, 0xf0, 0x33, 0x87, 0x82, 0x40, 0xb3, 0xd3, 0x80, 0x7c,
+  0xfc, 0x6e, 0xbd, 0x9c, 0x86, 0xbe, 0x65, 0x08, 0x56, 0xe5, 0x39, 0x6a,
+  0x19, 0x0c, 0xe2, 0x41, 0x0c, 0x8a, 0xaa, 0xba, 0x6d, 0x14, 0x40, 0x29,
+  0x42, 0x7d, 0x89, 0x04, 0x5b, 0xe7, 0xc2, 0x2a, 0xea, 0xe8, 0xed, 0x34,
+  0xf4, 0xd6, 0x9b, 0x25, 0x8d, 0xa1, 0x03, 0x84, 0x43, 0x2b, 0xef, 0x33,
+  0x0f, 0x16, 0xa0, 0x65, 0xba, 0x5d, 0xc4, 0x1b, 0x05, 0xc1, 0xde, 0x0f,
+  0x8f, 0x4e, 0x61, 0xf4, 0x79, 0xa6, 0x61, 0xa4, 0x4e, 0xbd, 0x13, 0x5d,
+  0x6d, 0xe9, 0x74, 0x1a, 0x8f, 0x56, 0x40, 0xc0, 0x5a, 0x1f, 0xc4, 0xe5,
+  0xc7, 0x27, 0x73, 0x53, 0x39, 0x2e, 0x8f, 0xb9, 0x50, 0xd2, 0xa3, 0x32,
+  0x23, 0xc8, 0xed, 0x2c, 0x46, 0x99, 0x10, 0x9a, 0xd3, 0x94, 0x79, 0xe3,
+  0xdb, 0x08, 0xb6, 0x8b, 0x8e, 0xb5, 0xe8, 0x5a, 0x8b, 0x9e, 0xb5, 0xe8,
+  0x5b, 0x8b, 0x81, 0xb5, 0x18, 0x6e, 0xc4, 0xfa, 0xc4, 0x79, 0x6a, 0xb5,
+  0x04, 0x64, 0x55, 0x5d, 0x04, 0xdd, 0x54, 0x55, 0xaf, 0x0b, 0xd2, 0x74,
+  0x53, 0x2b, 0x49, 0xe3, 0x30, 0x98, 0x6f, 0xca, 0x4c, 0x60, 0xdb, 0x41,
+  0x8d, 0x2d, 0x86, 0x5e, 0xeb, 0x62, 0xea, 0xc1, 0x11, 0x2e, 0x23, 0x0b,
+  0x1c, 0x78, 0x53, 0xb3, 0x9f, 0x65, 0x18, 0x84, 0x49, 0x44, 0x5d, 0x66,
+  0xbd, 0x7b, 0xf6, 0x0a, 0x3e, 0xdb, 0x6f, 0xd9, 0x3c, 0xf3, 0x69, 0x6c,
+  0xbd, 0x62, 0x81, 0x1f, 0x5a, 0x00, 0xa2, 0x6e, 0x68, 0x3d, 0x16, 0x35,
+  0x25, 0x4d, 0xac, 0x97, 0x7c, 0xca, 0xa4, 0x78, 0x82, 0xd4, 0x80, 0xc8,
+  0x62, 0x0e, 0x21, 0xff, 0x35, 0x5b, 0x59, 0x39, 0xab, 0x71, 0xb1, 0xbe,
+  0x0e, 0x5b, 0x6e, 0x13, 0x38, 0x33, 0xbf, 0xb4, 0xe6, 0xb3, 0xf6, 0x37,
+  0xdb, 0x24, 0x03, 0xad, 0xb3, 0xa8, 0x04, 0x3d, 0x1d, 0x7c, 0x53, 0x39,
+  0xca, 0xf6, 0x38, 0x0a, 0x13, 0x2e, 0x16, 0x0a, 0x51, 0x01, 0x44, 0x5e,
+  0xb2, 0x31, 0x24, 0x17, 0x34, 0x52, 0xdf, 0xa6, 0xd0, 0x53, 0x05, 0xa3,
+  0x29, 0x4d, 0x18, 0x4e, 0x41, 0x6e, 0xe0, 0xe0, 0x10, 0xf5, 0x96, 0x23,
+  0xdb, 0xe9, 0x0e, 0x50, 0x26, 0xf0, 0x86, 0x33, 0x86, 0x21, 0x8e, 0x44,
+  0x8d, 0xb6, 0x11, 0xfb, 0x07, 0x21, 0x04, 0xbd, 0xb4, 0x5d, 0x75, 0xec,
+  0x9a, 0x75, 0x00, 0xd0, 0xa7, 0x11, 0xd4, 0xca, 0xfa, 0xc3, 0x76, 0x2a,
+  0x62, 0xaa, 0xc5, 0x31, 0x12, 0x59, 0x61, 0x94, 0xce, 0xa1, 0xc8, 0x8b,
+  0xac, 0x44, 0xdc, 0x36, 0x59, 0xc8, 0x98, 0x42, 0x01, 0x55, 0xd9, 0xdb,
+  0xca, 0xc9, 0xee, 0x18, 0x7a, 0x05, 0xdb, 0x60, 0xe9, 0x15, 0xbc, 0xdc,
+  0x49, 0x8c, 0x12, 0x0d, 0x66, 0xd2, 0x64, 0xff, 0x35, 0x9b, 0xcf, 0x5d,
+  0x25, 0x82, 0x40, 0x8f, 0x11, 0xb0, 0xad, 0xd7, 0x23, 0x17, 0x20, 0x77,
+  0x26, 0x8d, 0xc1, 0xcb, 0x21, 0xac, 0x2d, 0xc1, 0xcd, 0x82, 0x7c, 0xc5,
+  0x1f, 0xc4, 0xa5, 0x97, 0x1c, 0x7c, 0x52, 0x23, 0x11, 0x80, 0xf5, 0x00,
+  0xf6, 0x7e, 0xc9, 0xd3, 0x4f, 0xb9, 0xbf, 0x60, 0x62, 0xa7, 0xc0, 0xca,
+  0x65, 0x23, 0x39, 0x6b, 0x3c, 0xa5, 0xee, 0xc5, 0x5c, 0x14, 0xc5, 0x6a,
+  0xb7, 0x85, 0xa4, 0x08, 0x76, 0x2c, 0x48, 0xcb, 0x48, 0xbe, 0x84, 0x94,
+  0x2c, 0x85, 0x8f, 0x44, 0x38, 0x9c, 0x41, 0xf6, 0x4a, 0x62, 0x50, 0x78,
+  0x13, 0x66, 0x29, 0x2e, 0x73, 0x44, 0xb3, 0x34, 0x54, 0x48, 0xb0, 0x5d,
+  0x1e, 0x40, 0x8b, 0xc6, 0x3d, 0x19, 0xdb, 0x17, 0x14, 0x72, 0x83, 0x9c,
+  0xad, 0xcb, 0x82, 0xcd, 0x3e, 0x7b, 0x19, 0x8d, 0xb4, 0xb6, 0xa2, 0xfa,
+  0xb1, 0x93, 0x88, 0x07, 0xb6, 0x5a, 0x70, 0x81, 0x03, 0xa1, 0x55, 0x9c,
+  0x8e, 0x29, 0x42, 0x0b, 0xb5, 0x7a, 0x58, 0xab, 0xbb, 0x68, 0x5c, 0x3d,
+  0x6e, 0xea, 0x8c, 0x33, 0xdf, 0x1b, 0x2b, 0xed, 0xed, 0x70, 0x36, 0x83,
+  0x8d, 0x1b, 0xd9, 0x5d, 0x08, 0x39, 0x85, 0x18, 0xc9, 0xa2, 0xe4, 0xd8,
+  0x4d, 0xcc, 0xe4, 0xae, 0xe4, 0x73, 0x30, 0x7d, 0xdb, 0x32, 0xdb, 0x6b,
+  0xdd, 0xf6, 0xef, 0x3f, 0x1a, 0x4d, 0x1e, 0x2c, 0x92, 0x6c, 0x09, 0xe6,
+  0xb0, 0xde, 0x78, 0xf2, 0x6a, 0x7c, 0xe4, 0x43, 0xca, 0xb7, 0x39, 0xe4,
+  0x85, 0xed, 0x14, 0xb2, 0xf0, 0xc5, 0xef, 0x59, 0x98, 0x32, 0xcb, 0xf3,
+  0x2d, 0xcf, 0xb3, 0x76, 0xe2, 0x96, 0xb5, 0x88, 0xad, 0x19, 0x9f, 0x83,
+  0x21, 0x5b, 0x32, 0x96, 0x68, 0xc3, 0xda, 0x8a, 0x75, 0xc2, 0xda, 0x36,
+  0x0d, 0xa6, 0xe6, 0xb3, 0x39, 0x54, 0x74, 0x9b, 0x02, 0x00, 0x09, 0x21,
+  0xf3, 0x2d, 0xa8, 0x45, 0xb2, 0x8d, 0x90, 0x2e, 0xd3, 0x2d, 0xae, 0xb0,
+  0xc9, 0x52, 0x3d, 0x48, 0x45, 0xe1, 0xbc, 0x34, 0x3d, 0xf7, 0x36, 0x38,
+  0x62, 0x74, 0x0c, 0x7d, 0xc8, 0x5b, 0xe1, 0x9c, 0x23, 0x69, 0x1d, 0xb0,
+  0x36, 0x97, 0x2d, 0x44, 0x0c, 0xcc, 0xdd, 0x73, 0x17, 0xb5, 0x09, 0x21,
+  0x5c, 0xf1, 0x74, 0x3d, 0xea, 0x28, 0x8f, 0xf9, 0xea, 0xdc, 0xa5, 0x3d,
+  0x3a, 0xd3, 0xac, 0x9a, 0xb9, 0x1c, 0xc2, 0x40, 0x7b, 0x4f, 0x0c, 0x9d,
+  0xb8, 0xf6, 0x9e, 0x8d, 0x9b, 0xc5, 0x09, 0xd0, 0x44, 0x21, 0xde, 0xbe,
+  0xc6, 0xdb, 0x11, 0x9c, 0x01, 0x06, 0x26, 0x4f, 0x23, 0x3c, 0x59, 0x58,
+  0x6d, 0xf9, 0x72, 0x6e, 0x25, 0x97, 0x73, 0xeb, 0x92, 0x7b, 0x2c, 0xb4,
+  0xa0, 0x34, 0xbc, 0x84, 0xc8, 0x4b, 0x33, 0x8f, 0x87, 0x16, 0x9f, 0xc5,
+  0x50, 0x52, 0x5a, 0x6c, 0x39, 0x65, 0x9e, 0x15, 0x4e, 0x3f, 0xa3, 0xf7,
+  0xea, 0xa3, 0x14, 0x07, 0x58, 0x8f, 0x91, 0x4b, 0xee, 0x79, 0x3e, 0x13,
+  0x2c, 0x05, 0x3b, 0x38, 0xa1, 0x2b, 0x9d, 0xf9, 0x30, 0xa2, 0x54, 0x4c,
+  0x5a, 0x5e, 0x16, 0x7d, 0xca, 0x39, 0x0a, 0xab, 0xdb, 0x29, 0xa5, 0x44,
+  0xb9, 0xa3, 0x4b, 0x25, 0x5c, 0x7f, 0x30, 0xb7, 0xaf, 0x46, 0xa4, 0x3d,
+  0x6e, 0x42, 0xac, 0x73, 0x84, 0xf0, 0x7a, 0x08, 0xe4, 0xac, 0x44, 0x5c,
+  0xc0, 0x0a, 0xba, 0x38, 0xc4, 0x2e, 0x34, 0x1f, 0x26, 0x17, 0x6c, 0x55,
+  0x9a, 0x21, 0x86, 0x05, 0xb1, 0x78, 0xa8, 0x81, 0xe8, 0x4e, 0x79, 0xbc,
+  0xce, 0xc7, 0x11, 0x0d, 0x10, 0x5b, 0x0c, 0xd6, 0xf9, 0x80, 0x07, 0xe0,
+  0x75, 0xd7, 0x21, 0xe4, 0x0c, 0xa2, 0xe7, 0xc2, 0x69, 0xf9, 0x76, 0x12,
+  0xd0, 0x08, 0x6c, 0x32, 0xe6, 0x6e, 0x1a, 0x40, 0x10, 0x19, 0xe1, 0xc5,
+  0xcb, 0x15, 0x87, 0x18, 0xb7, 0x96, 0x64, 0xf3, 0x18, 0x5a, 0x12, 0x86,
+  0x41, 0x3d, 0x0e, 0x97, 0x76, 0x9e, 0xa4, 0x48, 0x0d, 0x7b, 0xc9, 0xe9,
+  0x7e, 0x64, 0x1a, 0xee, 0xe0, 0x60, 0xdb, 0x78, 0x40, 0xfd, 0x5c, 0x19,
+  0xc8, 0xb6, 0x0b, 0xe6, 0xd9, 0xd7, 0x2c, 0x0e, 0x35, 0x2c, 0x80, 0x5a,
+  0x1e, 0xd4, 0xb2, 0xa5, 0x0f, 0xd6, 0xa1, 0x6a, 0xc7, 0x77, 0x88, 0x63,
+  0xea, 0x96, 0xe5, 0x60, 0x3c, 0x85, 0xb0, 0x87, 0x81, 0xa8, 0x0c, 0x91,
+  0xb1, 0x49, 0x59, 0x06, 0x69, 0x47, 0x57, 0xbb, 0x38, 0x69, 0xe1, 0xe4,
+  0xab, 0xd9, 0x6c, 0x56, 0x42, 0x2a, 0x68, 0x3c, 0x9f, 0xb6, 0x06, 0xe7,
+  0xa4, 0xd3, 0x6b, 0x93, 0x6e, 0x7f, 0x48, 0x4e, 0x88, 0x33, 0x30, 0x77,
+  0x59, 0xa8, 0x28, 0x4d, 0xda, 0xf0, 0xdf, 0x57, 0x6d, 0xf8, 0x53, 0x22,
+  0xd9, 0x83, 0xbb, 0x11, 0x2c, 0xa5, 0x33, 0x6f, 0x07, 0x3d, 0xf5, 0xb3,
+  0x58, 0xaf, 0x6f, 0x1a, 0xa3, 0x89, 0xcb, 0xb3, 0x1c, 0xe7, 0xb5, 0x7a,
+  0x4c, 0x93, 0xb4, 0x74, 0x2e, 0x6b, 0x61, 0x39, 0x1a, 0xb0, 0xc8, 0x58,
+  0x6e, 0x87, 0x12, 0x02, 0xb9, 0x06, 0x1c, 0x2b, 0x3f, 0x1d, 0x4c, 0xe7,
+  0x25, 0x6c, 0xc2, 0x22, 0x4e, 0xf5, 0xc0, 0x8b, 0xa1, 0xb8, 0xd4, 0x6a,
+  0x2b, 0x15, 0x20, 0xcb, 0x09, 0x70, 0x45, 0xaf, 0x1c, 0xb8, 0xa3, 0x60,
+  0x8e, 0xaa, 0x6b, 0x9a, 0x23, 0x76, 0x54, 0xce, 0x31, 0xbb, 0xba, 0xe7,
+  0xa8, 0xea, 0x22, 0x72, 0xb0, 0x0e, 0x62, 0x75, 0x78, 0x7d, 0x95, 0x05,
+  0x42, 0x2e, 0x17, 0x12, 0x92, 0x06, 0xfd, 0x19, 0x14, 0xfe, 0x0c, 0x0a,
+  0x7f, 0x06, 0x85, 0x3f, 0x83, 0x02, 0x04, 0x05, 0x27, 0x89, 0x6d, 0xbc,
+  0xca, 0xda, 0xe4, 0xc6, 0x4c, 0xa7, 0xd0, 0x3c, 0x42, 0x31, 0x3d, 0xce,
+  0x3b, 0x6e, 0x5d, 0x76, 0xe0, 0xc7, 0xbc, 0xb2, 0xd3, 0xd5, 0x9f, 0x8d,
+  0xd0, 0x10, 0x94, 0x9a, 0xf9, 0xb0, 0x59, 0xb2, 0x26, 0x19, 0xbb, 0x3e,
+  0x8f, 0xa0, 0x11, 0x74, 0xd3, 0x56, 0xdb, 0x12, 0xff, 0x99, 0xe3, 0xd5,
+  0x02, 0xea, 0x56, 0x61, 0xe1, 0x58, 0x3d, 0xae, 0x62, 0x1a, 0xd5, 0xee,
+  0x73, 0xb6, 0x8e, 0x96, 0xbc, 0xab, 0xcb, 0xd6, 0xd1, 0x5d, 0xe5, 0x66,
+  0xa7, 0xcf, 0xdc, 0x3a, 0xb2, 0x99, 0xb4, 0xdb, 0xba, 0xab, 0x04, 0x56,
+  0x3e, 0x9b, 0xa5, 0x00, 0xc0, 0xff, 0xc3, 0xa1, 0x38, 0x1d, 0x18, 0xc7,
+  0xb2, 0x59, 0xd5, 0x80, 0xae, 0x02, 0x38, 0x83, 0x18, 0x4a, 0x6a, 0x07,
+  0xaf, 0x19, 0xda, 0xa2, 0x11, 0x6d, 0xcb, 0x41, 0x57, 0x0c, 0x14, 0xf6,
+  0xda, 0x1e, 0xb4, 0x37, 0xd7, 0xa2, 0x25, 0xbd, 0x1a, 0x0d, 0x80, 0x62,
+  0x39, 0xb5, 0x3b, 0x6d, 0x55, 0x43, 0xdb, 0x4a, 0x74, 0x57, 0x11, 0x23,
+  0x6e, 0x58, 0xc3, 0xf5, 0x35, 0xa6, 0x5b, 0x43, 0x14, 0x73, 0xfa, 0x35,
+  0x4c, 0x47, 0x22, 0xfc, 0x62, 0x8a, 0x58, 0x91, 0x9e, 0x10, 0x17, 0xf0,
+  0xca, 0x42, 0x96, 0x69, 0x49, 0x33, 0x5c, 0x42, 0xb7, 0x84, 0xe8, 0x96,
+  0x11, 0xbd, 0x1c, 0xdc, 0xaf, 0x80, 0x0b, 0xfa, 0x0a, 0x79, 0x01, 0xae,
+  0x90, 0x77, 0x34, 0x74, 0x58, 0x81, 0x2a, 0x6a, 0x51, 0xe9, 0x56, 0xeb,
+  0xde, 0xad, 0xc3, 0x03, 0x6c, 0xb2, 0x72, 0xa8, 0x1c, 0x6e, 0x9d, 0x99,
+  0xcf, 0xae, 0x72, 0x20, 0x0e, 0x34, 0xa5, 0x5d, 0xc1, 0x94, 0x60, 0x5b,
+  0x47, 0xda, 0x5c, 0xb5, 0x0c, 0x76, 0x16, 0xa0, 0xb8, 0x32, 0x5b, 0xa5,
+  0x06, 0x40, 0x3e, 0x3a, 0x83, 0x1c, 0x38, 0xec, 0x6a, 0x70, 0x0e, 0xeb,
+  0x38, 0x0a, 0xb6, 0xb2, 0xcf, 0x37, 0xd2, 0x2a, 0xbb, 0x05, 0xe8, 0xe3,
+  0x87, 0xee, 0x19, 0x04, 0xd5, 0x8f, 0x9f, 0x34, 0x0a, 0x47, 0x12, 0xd1,
+  0x6b, 0x97, 0x11, 0x62, 0xa4, 0x10, 0xdd, 0x0a, 0xa2, 0xab, 0x10, 0xb3,
+  0xcc, 0xf7, 0x37, 0x45, 0x59, 0xbf, 0xfd, 0xdb, 0x05, 0x5b, 0x8b, 0x56,
+  0x21, 0x21, 0xd8, 0xc0, 0x82, 0xd5, 0x6d, 0x8a, 0xfe, 0x5e, 0x06, 0x82,
+  0x56, 0x6f, 0xd8, 0xf6, 0xd8, 0xdc, 0xdc, 0x82, 0x9b, 0x04, 0xd0, 0x7b,
+  0x0b, 0x5f, 0x02, 0x52, 0x39, 0x40, 0x7f, 0xc0, 0x21, 0xe9, 0x24, 0x04,
+  0x77, 0x86, 0xc6, 0x84, 0x07, 0x33, 0xfc, 0x2e, 0x11, 0x6c, 0x85, 0xec,
+  0x57, 0x6c, 0xd5, 0xc8, 0xd4, 0xfb, 0x1a, 0x47, 0xde, 0x2a, 0xd8, 0xb8,
+  0x6d, 0x79, 0x5b, 0x9a, 0x25, 0x98, 0xff, 0x05, 0x42, 0xb6, 0x7a, 0xb2,
+  0x89, 0xaf, 0x43, 0xeb, 0x80, 0xad, 0x53, 0xf4, 0xb3, 0x55, 0x86, 0xb5,
+  0xe6, 0x58, 0xf2, 0xab, 0x03, 0xeb, 0x1d, 0xb4, 0xb0, 0x06, 0x08, 0x84,
+  0xab, 0x8d, 0xf8, 0xe0, 0x71, 0x8c, 0x28, 0xc2, 0xf5, 0xc3, 0x95, 0x42,
+  0x42, 0xf2, 0xa8, 0x23, 0x5d, 0xf1, 0x34, 0x01, 0xec, 0x06, 0xda, 0xe4,
+  0xc4, 0x76, 0x99, 0x58, 0xb4, 0x68, 0xaf, 0x44, 0xe7, 0x9c, 0x8c, 0x24,
+  0x68, 0xeb, 0xe0, 0x75, 0x2e, 0x9f, 0xad, 0x35, 0x49, 0x3e, 0x54, 0x57,
+  0xc3, 0x75, 0xb2, 0x29, 0x4b, 0x57, 0x0c, 0xec, 0xac, 0x4e, 0x27, 0x42,
+  0x9a, 0xc6, 0x6e, 0x9d, 0x39, 0x94, 0x1e, 0x9d, 0x0d, 0xfc, 0x3b, 0xd2,
+  0xa6, 0x83, 0x90, 0xae, 0x84, 0x14, 0x80, 0x9e, 0x04, 0x9c, 0x16, 0x90,
+  0xbe, 0x80, 0x48, 0x57, 0x12, 0x57, 0x2c, 0x50, 0x3a, 0x08, 0x43, 0x51,
+  0x61, 0x12, 0x0b, 0x8f, 0x2c, 0x19, 0x9d, 0xc3, 0x1f, 0xb4, 0x22, 0x4d,
+  0xe2, 0xcf, 0x6b, 0x04, 0x4a, 0x88, 0xc6, 0x5f, 0xd5, 0x19, 0x68, 0x99,
+  0x12, 0xba, 0xa9, 0x04, 0x61, 0xbc, 0x5e, 0x55, 0x08, 0xdb, 0x13, 0xd5,
+  0xcb, 0xa6, 0x72, 0xcb, 0x2e, 0x61, 0x39, 0xc9, 0xc7, 0x0f, 0x1f, 0xbf,
+  0xea, 0x9c, 0x75, 0xce, 0x3b, 0x14, 0x6c, 0xbc, 0x5c, 0x3a, 0xe6, 0xe9,
+  0xa8, 0x53, 0xbd, 0xb9, 0xc3, 0x12, 0xa3, 0xdb, 0x27, 0xdd, 0x01, 0xe9,
+  0x62, 0x81, 0x71, 0x49, 0xe3, 0x56, 0xc3, 0x34, 0xd3, 0xac, 0x48, 0x98,
+  0xb6, 0xa7, 0xbd, 0xe9, 0xd9, 0x1d, 0x24, 0x74, 0x4e, 0x87, 0xa4, 0x73,
+  0x0a, 0x95, 0xcc, 0x59, 0xff, 0x20, 0x21, 0x98, 0x88, 0xed, 0x6e, 0xbb,
+  0x7d, 0xf8, 0x12, 0xba, 0xe7, 0xa4, 0xdb, 0xeb, 0xc0, 0xdf, 0xc1, 0x41,
+  0x02, 0x14, 0x04, 0x64, 0x34, 0x8b, 0x70, 0xba, 0x3b, 0xa4, 0xbd, 0x7d,
+  0xa4, 0xbd, 0x1d, 0xd2, 0xfe, 0x3e, 0xd2, 0x3e, 0x90, 0xce, 0xb1, 0x5e,
+  0x61, 0xf6, 0x30, 0x5f, 0xdd, 0xbc, 0xb2, 0xb2, 0xfa, 0x65, 0x1f, 0xae,
+  0xae, 0x77, 0x4a, 0xce, 0xcf, 0x77, 0xd6, 0x36, 0xaf, 0xac, 0x6b, 0x5e,
+  0xdf, 0xb4, 0xdb, 0xd9, 0xee, 0xdb, 0xb4, 0x46, 0xc6, 0x83, 0x3b, 0xf0,
+  0xed, 0x03, 0xdf, 0x01, 0xd4, 0xac, 0x83, 0xce, 0x8d, 0x7c, 0x45, 0x01,
+  0x72, 0x38, 0xd7, 0x01, 0xd8, 0xa8, 0xfa, 0xbb, 0x97, 0x2b, 0xba, 0xb1,
+  0x2e, 0x88, 0xb4, 0x5b, 0x45, 0x57, 0x98, 0x7b, 0x15, 0x54, 0xa6, 0x6b,
+  0x99, 0x7d, 0x75, 0xe9, 0xa4, 0x52, 0xb5, 0x4e, 0xc9, 0x40, 0xdf, 0xad,
+  0x92, 0x37, 0x51, 0x17, 0xc4, 0xfd, 0x2a, 0x71, 0x67, 0x97, 0xb6, 0xa3,
+  0x49, 0x07, 0x35, 0x52, 0x19, 0x90, 0xea, 0xd4, 0x3a, 0x4c, 0xc1, 0x84,
+  0x61, 0x7d, 0x42, 0x23, 0xbd, 0x22, 0x5f, 0x43, 0x98, 0xd3, 0x28, 0x51,
+  0x1b, 0x54, 0xb9, 0xeb, 0xda, 0xa6, 0x5b, 0x90, 0xb7, 0x2b, 0xf4, 0xb5,
+  0x5d, 0xa9, 0x15, 0x50, 0x40, 0xdf, 0xad, 0xb2, 0x6f, 0xe4, 0x9e, 0x13,
+  0xf7, 0xaa, 0xc4, 0xa7, 0x8d, 0xd4, 0xfa, 0x88, 0xe2, 0xd2, 0xd6, 0xd4,
+  0x76, 0x41, 0x5c, 0xae, 0xab, 0x8c, 0x20, 0x3e, 0xcb, 0x8b, 0x39, 0x9d,
+  0x0c, 0xe4, 0xe3, 0xc0, 0x65, 0xe9, 0x49, 0x88, 0x73, 0x26, 0x65, 0x55,
+  0x1f, 0x20, 0x96, 0xb9, 0x5d, 0x25, 0x65, 0xf2, 0x06, 0x6a, 0x41, 0x2a,
+  0x48, 0x96, 0x0c, 0x42, 0xf4, 0xb2, 0xf2, 0x68, 0x68, 0xd0, 0x86, 0x52,
+  0x33, 0x83, 0xcc, 0x18, 0xbb, 0x34, 0x61, 0xf5, 0xcb, 0xff, 0x1c, 0xa1,
+  0x64, 0x4d, 0x7d, 0x30, 0x66, 0x69, 0xe4, 0x62, 0x5c, 0x32, 0xf3, 0xc2,
+  0xb6, 0xdb, 0xa2, 0xd5, 0x2a, 0x59, 0x75, 0x99, 0x14, 0xed, 0x5a, 0x8c,
+  0x85, 0x1f, 0x9e, 0x6a, 0x07, 0xdf, 0xcf, 0x0d, 0x1c, 0x64, 0x38, 0x20,
+  0x67, 0x9d, 0xc3, 0x18, 0x9e, 0xdf, 0xce, 0xb0, 0x73, 0x0a, 0xfd, 0x27,
+  0xe9, 0x9d, 0x1f, 0xc0, 0x10, 0x32, 0x2e, 0x84, 0x8a, 0x5b, 0x39, 0xf6,
+  0xfa, 0xa4, 0x73, 0x0e, 0x51, 0xad, 0x7f, 0x2b, 0x4b, 0x68, 0x44, 0x0f,
+  0x61, 0xd8, 0x05, 0xed, 0x86, 0x67, 0xf8, 0xbf, 0xdb, 0x18, 0xae, 0x99,
+  0x0f, 0x7d, 0x11, 0xc4, 0xe8, 0xdb, 0x79, 0x62, 0x0c, 0x6b, 0x43, 0x72,
+  0xec, 0x1c, 0xca, 0xf4, 0x20, 0x45, 0xfb, 0x22, 0x15, 0xde, 0xae, 0x68,
+  0x3d, 0x9b, 0x54, 0x79, 0x62, 0x2e, 0xd1, 0x14, 0xc3, 0x76, 0x7e, 0x91,
+  0xee, 0x0c, 0x61, 0x36, 0x1a, 0xa3, 0x68, 0xc9, 0x64, 0xf8, 0x4c, 0x36,
+  0x25, 0x48, 0x04, 0xbd, 0x26, 0xf4, 0xab, 0xeb, 0x91, 0x40, 0x59, 0xf5,
+  0x50, 0x6b, 0x95, 0x53, 0xab, 0x55, 0x7b, 0x64, 0xaa, 0xa0, 0x33, 0xee,
+  0xfb, 0xe2, 0x99, 0xe9, 0x05, 0x7e, 0xbd, 0x2f, 0xe7, 0x9c, 0xf2, 0x25,
+  0xba, 0xaf, 0xfe, 0x82, 0xc2, 0xc8, 0xcd, 0xa6, 0xdc, 0x85, 0x32, 0xec,
+  0x9a, 0xb3, 0xb8, 0xe5, 0xf4, 0xa1, 0xe9, 0x74, 0xba, 0x56, 0xc7, 0x2c,
+  0x4f, 0xf1, 0x32, 0xf5, 0x2c, 0xd6, 0xe9, 0x0c, 0x12, 0xa8, 0x55, 0xf1,
+  0x7e, 0xfc, 0x63, 0xde, 0x63, 0xaa, 0xfb, 0x72, 0x5d, 0xd6, 0xe5, 0xbb,
+  0xa5, 0x00, 0xe6, 0xb8, 0xa1, 0x2b, 0x55, 0x2c, 0x44, 0xb7, 0x09, 0xfd,
+  0x01, 0xd6, 0xfa, 0xb7, 0xb2, 0x91, 0x29, 0x01, 0x0b, 0x2d, 0x35, 0x1b,
+  0x3b, 0xcd, 0x43, 0x27, 0x8b, 0xc0, 0x59, 0x9a, 0xbb, 0xb0, 0xfb, 0xb7,
+  0xce, 0xa9, 0x84, 0x19, 0x35, 0x6f, 0x75, 0xc0, 0x3c, 0x55, 0x12, 0x96,
+  0xa7, 0x95, 0xeb, 0xd2, 0x5b, 0xe7, 0x37, 0xd7, 0xad, 0x8a, 0x93, 0x44,
+  0x1e, 0xca, 0xa3, 0x54, 0x9d, 0x56, 0xe6, 0xcb, 0x98, 0x02, 0x0d, 0xd7,
+  0xad, 0x8c, 0x0e, 0x2e, 0xed, 0xda, 0x50, 0x4d, 0x74, 0x7a, 0xf0, 0xf7,
+  0xfc, 0xe6, 0xd2, 0x4e, 0xeb, 0xa1, 0x0a, 0x8b, 0x03, 0x15, 0xf8, 0x83,
+  0x0a, 0x0f, 0x6d, 0x39, 0x85, 0x6d, 0xd3, 0x03, 0x0e, 0xa4, 0xc9, 0x2f,
+  0x61, 0xde, 0x7f, 0xc4, 0xab, 0x94, 0x50, 0x2c, 0xe0, 0xef, 0xc3, 0x7f,
+  0x9f, 0xf6, 0x7c, 0xf9, 0x66, 0xbc, 0x57, 0x5b, 0xe8, 0xcc, 0xf1, 0x56,
+  0x29, 0x3f, 0x69, 0x1d, 0x7d, 0xce, 0xda, 0x23, 0x81, 0xd8, 0x53, 0xf3,
+  0x9e, 0x15, 0xf3, 0x8a, 0x1a, 0xb5, 0x32, 0xe3, 0x0f, 0xaa, 0x54, 0xc5,
+  0xe3, 0xee, 0x5c, 0x3b, 0x51, 0x64, 0x43, 0x3c, 0x1e, 0x09, 0xf0, 0xc1,
+  0x8d, 0x44, 0xe5, 0xba, 0xf5, 0x06, 0x63, 0x53, 0xc2, 0xf4, 0xa3, 0x69,
+  0xec, 0x8e, 0x95, 0x24, 0xfd, 0xac, 0x1d, 0x82, 0x02, 0x11, 0xdf, 0x81,
+  0x22, 0xe5, 0xe7, 0xf5, 0xb5, 0x67, 0xd9, 0x22, 0x72, 0x28, 0x5e, 0xe2,
+  0xc2, 0xb6, 0x5f, 0xd6, 0xb7, 0xe9, 0x96, 0x37, 0xd7, 0xa9, 0xb8, 0x73,
+  0x36, 0x89, 0xac, 0x1f, 0xaa, 0xa8, 0xf2, 0xe5, 0xb3, 0xd9, 0x8c, 0x13,
+  0xcb, 0x36, 0x1b, 0xae, 0x8b, 0x6f, 0x10, 0xe2, 0x52, 0xdf, 0x6d, 0xf5,
+  0x61, 0x6d, 0xdf, 0xde, 0x24, 0xaf, 0x2e, 0x50, 0x49, 0x2a, 0x7d, 0xd3,
+  0xa0, 0x71, 0xb2, 0xc4, 0x99, 0x56, 0x15, 0xb9, 0x03, 0x95, 0x00, 0xab,
+  0xb8, 0x9f, 0x36, 0xab, 0x9b, 0xd8, 0x74, 0xf6, 0x52, 0x4c, 0x71, 0xf2,
+  0xb7, 0x5f, 0xb6, 0xd7, 0x34, 0xdc, 0x39, 0x7b, 0x01, 0xce, 0x0d, 0xfa,
+  0xae, 0xa2, 0xf6, 0x98, 0xf4, 0xad, 0xb2, 0x7a, 0x5f, 0x22, 0xab, 0x39,
+  0x84, 0xd6, 0x65, 0x45, 0x0c, 0xe2, 0xbf, 0x7a, 0x0f, 0xe4, 0x5f, 0x62,
+  0x64, 0xab, 0x91, 0xf0, 0xdd, 0xff, 0x44, 0xdb, 0x7a, 0x8b, 0x48, 0x59,
+  0x4f, 0x0e, 0xef, 0xd4, 0xd3, 0x92, 0xce, 0xb0, 0x47, 0x4e, 0xfb, 0x5f,
+  0x26, 0xb3, 0x1c, 0xc6, 0xe5, 0x63, 0xb5, 0xc3, 0x32, 0xeb, 0xee, 0xc3,
+  0x38, 0xf1, 0xed, 0x80, 0xa2, 0x2d, 0xc8, 0x71, 0xad, 0xa2, 0xe8, 0x2b,
+  0xc8, 0x4b, 0xb6, 0x5d, 0x7a, 0x7a, 0x07, 0x5e, 0xa4, 0xae, 0x1a, 0x8b,
+  0x23, 0x13, 0x63, 0x40, 0xe0, 0x23, 0xbb, 0x02, 0x2c, 0x9f, 0xe7, 0x29,
+  0xf0, 0x2f, 0x35, 0x38, 0xf2, 0x11, 0x4f, 0x35, 0xfe, 0x51, 0x42, 0xc8,
+  0x47, 0x7c, 0x1a, 0xf3, 0x4b, 0x1d, 0x73, 0xe8, 0x46, 0xe9, 0x6a, 0xe0,
+  0x0e, 0x09, 0xf7, 0x80, 0x8c, 0xbf, 0x27, 0xe1, 0xee, 0x04, 0x61, 0xa1,
+  0xa0, 0x70, 0x06, 0xa5, 0x5e, 0x43, 0x54, 0xfe, 0x82, 0x78, 0xbc, 0x8f,
+  0xad, 0x0c, 0xd0, 0x7f, 0x86, 0xe6, 0xbb, 0x86, 0xe6, 0x1b, 0xf7, 0x53,
+  0x44, 0x95, 0x9e, 0xf6, 0xf0, 0x83, 0xc2, 0x59, 0xa7, 0x7f, 0x2a, 0xba,
+  0xc7, 0xee, 0xa0, 0x77, 0x6b, 0x38, 0xdb, 0x27, 0x56, 0x46, 0x96, 0x3b,
+  0xca, 0x85, 0xd6, 0x0d, 0xfb, 0xcc, 0xce, 0x69, 0xf7, 0x06, 0xb9, 0x23,
+  0x9e, 0xb4, 0x1c, 0x7c, 0x9d, 0x8d, 0x88, 0x7f, 0x73, 0x1f, 0xc1, 0x8b,
+  0xd3, 0x6e, 0xbf, 0x3b, 0xe8, 0x0e, 0x3f, 0xe2, 0xd7, 0x63, 0x0f, 0xf4,
+  0x85, 0xde, 0x90, 0x40, 0x18, 0xed, 0x9d, 0xdd, 0xe8, 0x08, 0x37, 0x89,
+  0xec, 0xd1, 0xde, 0xb4, 0xe7, 0xde, 0x45, 0xe4, 0xe0, 0x8c, 0x40, 0x1e,
+  0x1c, 0xb6, 0xbf, 0x58, 0x24, 0xeb, 0xb3, 0x21, 0x9b, 0xde, 0x45, 0x64,
+  0xb7, 0x7b, 0x06, 0x3b, 0xdb, 0xbe, 0xf5, 0xfa, 0x76, 0x9f, 0x54, 0x91,
+  0x19, 0x87, 0xf8, 0xe2, 0xca, 0xa1, 0x12, 0x4f, 0x07, 0xe4, 0x6c, 0x80,
+  0xe9, 0xe9, 0x4b, 0xc4, 0x15, 0xb7, 0xc7, 0xe6, 0xde, 0xeb, 0xe3, 0xdd,
+  0xb9, 0xf3, 0xca, 0xed, 0xbc, 0x79, 0x87, 0xeb, 0xd4, 0x86, 0xeb, 0xf9,
+  0x9b, 0x2d, 0x6e, 0xde, 0x68, 0x6d, 0x07, 0x64, 0xec, 0x26, 0x6b, 0xbb,
+  0x4d, 0x94, 0xbe, 0x96, 0x3a, 0x5c, 0x4c, 0xd3, 0x05, 0xd5, 0xad, 0x62,
+  0x4a, 0x51, 0xdb, 0xdc, 0xdc, 0xf4, 0x9d, 0xd8, 0xdd, 0xd9, 0xe2, 0x1a,
+  0xa3, 0xfc, 0xe0, 0xc2, 0xbc, 0xfd, 0xc6, 0xab, 0xf1, 0x81, 0x45, 0xed,
+  0x9e, 0x66, 0xbf, 0xa0, 0x9a, 0x0b, 0xdc, 0x70, 0x1d, 0xd4, 0x6c, 0xf9,
+  0x07, 0x09, 0x12, 0x59, 0xf7, 0x76, 0x09, 0xcd, 0xd9, 0xf4, 0x20, 0x09,
+  0xc5, 0x05, 0x53, 0xa3, 0x18, 0x67, 0xb8, 0x3b, 0xaf, 0xf4, 0xed, 0x4e,
+  0x69, 0x19, 0xf8, 0x3e, 0x59, 0xc3, 0x57, 0x47, 0xe5, 0xf7, 0x85, 0x4a,
+  0xc4, 0xcd, 0xe7, 0x30, 0x18, 0x8a, 0x7a, 0xae, 0x73, 0x5a, 0x51, 0xbe,
+  0x61, 0x5e, 0xd3, 0x1a, 0xf6, 0xe8, 0xf2, 0x7f, 0xad, 0x86, 0xde, 0xc5,
+  0x0e, 0xec, 0x62, 0x7e, 0x4f, 0xd7, 0xd9, 0xa5, 0xbb, 0xb9, 0xbd, 0x36,
+  0xf7, 0xf6, 0xd7, 0x7b, 0x19, 0xcd, 0x2b, 0x19, 0xa0, 0xca, 0xe6, 0x00,
+  0x2f, 0x6d, 0xca, 0x03, 0x37, 0x7a, 0xe9, 0x4d, 0x1d, 0xb8, 0xf9, 0x47,
+  0xb7, 0xe0, 0xfb, 0xa4, 0x8b, 0x74, 0x5c, 0x59, 0x77, 0x59, 0xfe, 0x61,
+  0x6d, 0x60, 0xc3, 0xca, 0x6f, 0xcb, 0xf2, 0xfb, 0xfb, 0x4f, 0xf3, 0x8f,
+  0x6e, 0x40, 0x4b, 0xb2, 0xcb, 0x35, 0x8e, 0xb2, 0xf9, 0xc6, 0x02, 0xeb,
+  0x2c, 0x0f, 0xcf, 0x07, 0xa9, 0x01, 0x2a, 0x0c, 0xfb, 0x75, 0x6b, 0xff,
+  0xb7, 0xb4, 0x90, 0xf5, 0xd6, 0x1d, 0xd5, 0xc0, 0x66, 0xae, 0xdd, 0x21,
+  0x83, 0x9b, 0xca, 0x2d, 0xf1, 0x06, 0x9b, 0x7c, 0x69, 0xed, 0xe8, 0x80,
+  0x5f, 0x5b, 0x21, 0x84, 0x2f, 0xf1, 0xf7, 0x51, 0xc8, 0x86, 0xbc, 0x71,
+  0xd3, 0xf0, 0x82, 0xa7, 0x64, 0x4b, 0xf0, 0x4b, 0x87, 0xc4, 0x58, 0xa4,
+  0x69, 0x94, 0x8c, 0x4e, 0x4e, 0x5c, 0x2f, 0x70, 0x92, 0x8b, 0x35, 0x48,
+  0xb8, 0x70, 0x3c, 0x76, 0x79, 0xf2, 0xb7, 0x50, 0x12, 0x9e, 0xb8, 0x61,
+  0xcc, 0x8c, 0x31, 0xb0, 0x50, 0x2f, 0xd2, 0x69, 0x06, 0x13, 0xcd, 0x6a,
+  0x5c, 0x7a, 0x9b, 0xae, 0xa6, 0x0c, 0x06, 0xce, 0x93, 0xcf, 0xf4, 0x92,
+  0x4a, 0x68, 0x4d, 0x2b, 0xc5, 0x70, 0xe7, 0x3d, 0xc2, 0xfb, 0x4f, 0xde,
+  0xbc, 0x7a, 0x2c, 0xdb, 0xa7, 0x97, 0xe2, 0x6d, 0xe8, 0xfb, 0xf2, 0xf7,
+  0x68, 0x2c, 0x32, 0xa3, 0x7e, 0xc2, 0xcc, 0xf1, 0xd1, 0x51, 0xfe, 0x3e,
+  0x20, 0xc2, 0x5b, 0x26, 0xd9, 0x80, 0x7e, 0xf2, 0xb5, 0x79, 0xe3, 0x64,
+  0xce, 0x52, 0xf9, 0x5b, 0x36, 0x3c, 0x98, 0x85, 0x86, 0xf9, 0x17, 0x40,
+  0x9d, 0x9c, 0x28, 0xa4, 0x5e, 0x6d, 0x1a, 0x4e, 0x39, 0x4d, 0x66, 0x34,
+  0x4b, 0x52, 0x67, 0xce, 0xd3, 0x45, 0x36, 0x75, 0x78, 0x78, 0x92, 0xb2,
+  0x24, 0x15, 0xff, 0x38, 0x9f, 0xc5, 0x6f, 0x0b, 0xfc, 0x45, 0xbc, 0x1d,
+  0x48, 0x08, 0xfe, 0x26, 0x43, 0xd0, 0xd2, 0xef, 0xda, 0x92, 0xc9, 0x83,
+  0xfc, 0xbd, 0x78, 0x41, 0xd8, 0x32, 0xcd, 0x0a, 0xa1, 0x47, 0x53, 0x8a,
+  0x44, 0x1b, 0x05, 0xc5, 0x3f, 0x7a, 0xf3, 0xfe, 0xfe, 0xfa, 0xe9, 0x5b,
+  0xd8, 0x3a, 0x24, 0x71, 0xc2, 0x15, 0xac, 0x76, 0xbc, 0x4b, 0xf4, 0xf6,
+  0xe9, 0x8f, 0x6f, 0xde, 0xbd, 0x78, 0xff, 0xe6, 0xed, 0x2f, 0x9a, 0x32,
+  0x66, 0xe2, 0xd2, 0x3f, 0x8c, 0xd7, 0x0d, 0xe4, 0xee, 0x82, 0x47, 0xcf,
+  0xc4, 0xeb, 0x43, 0x9a, 0x1c, 0x21, 0xf2, 0x85, 0xa2, 0x06, 0xf2, 0x67,
+  0x7f, 0xff, 0x99, 0xc5, 0x09, 0xee, 0x9d, 0xa2, 0xce, 0x01, 0x63, 0xd2,
+  0x48, 0x8d, 0xef, 0x19, 0x05, 0x69, 0x89, 0x5a, 0x02, 0x1a, 0x58, 0x3f,
+  0x5f, 0xbd, 0xf0, 0x34, 0x1d, 0x7e, 0x1e, 0x23, 0xee, 0xa8, 0x44, 0xa7,
+  0x7e, 0x63, 0xe6, 0x47, 0xb0, 0x3c, 0x0e, 0x9b, 0x47, 0x7d, 0xbf, 0xf5,
+  0xa1, 0x84, 0xc6, 0x3f, 0x27, 0x27, 0xc4, 0x87, 0x33, 0x27, 0x1e, 0x67,
+  0xa4, 0xb0, 0x9c, 0xa4, 0x46, 0xa5, 0x7e, 0x22, 0x41, 0x1f, 0xe7, 0xd7,
+  0x1b, 0xb1, 0xb1, 0xdb, 0xd2, 0x59, 0x7e, 0xbd, 0x29, 0xb6, 0x71, 0x5b,
+  0xb2, 0x41, 0x38, 0xb1, 0xdf, 0xcc, 0x1a, 0xb7, 0x1b, 0x4f, 0x58, 0xfe,
+  0x40, 0xc2, 0xbe, 0x29, 0x92, 0xa9, 0xb2, 0xd6, 0xfa, 0xa1, 0xeb, 0x3f,
+  0xf2, 0x77, 0x13, 0x24, 0xa9, 0x7a, 0xa1, 0x16, 0xb7, 0xa9, 0xf9, 0xe7,
+  0x8e, 0xee, 0x4b, 0xba, 0xfb, 0xe6, 0xb8, 0x81, 0x53, 0x85, 0x87, 0x50,
+  0x2d, 0x17, 0x4d, 0x2a, 0xaa, 0x34, 0x4d, 0xce, 0x05, 0xe2, 0xcf, 0x46,
+  0xa9, 0x77, 0xa9, 0x1f, 0xe3, 0x0f, 0x05, 0xb5, 0x2a, 0x6c, 0xd1, 0xbf,
+  0x76, 0x27, 0xab, 0x23, 0xfe, 0x01, 0x3d, 0x14, 0xb4, 0x95, 0x3f, 0x99,
+  0x84, 0x2e, 0x0b, 0x92, 0x77, 0x81, 0xe3, 0xfd, 0x1c, 0xc0, 0x3d, 0x1f,
+  0x5e, 0x52, 0xee, 0xe3, 0x4b, 0x2c, 0xca, 0x94, 0x12, 0xe0, 0xd1, 0x04,
+  0xde, 0xe5, 0xb2, 0x6d, 0x38, 0x07, 0xf9, 0x6e, 0xb7, 0x78, 0x83, 0x1b,
+  0x0f, 0x40, 0xff, 0x92, 0x85, 0x00, 0xb4, 0xee, 0x8b, 0x5f, 0xc4, 0x20,
+  0xfa, 0x8d, 0x70, 0xd8, 0x30, 0x16, 0x07, 0xd4, 0x27, 0x9f, 0x93, 0x11,
+  0x44, 0x15, 0x41, 0x63, 0x9a, 0xd6, 0xff, 0xb6, 0x77, 0xad, 0xcd, 0x6d,
+  0xdc, 0x56, 0xfb, 0xbb, 0x7e, 0x05, 0xca, 0x69, 0x4a, 0x32, 0xd6, 0xae,
+  0xb8, 0x57, 0x92, 0xa6, 0xa4, 0xd6, 0x4e, 0xda, 0xba, 0xd3, 0x38, 0xcd,
+  0xc4, 0xf1, 0xdb, 0x99, 0x6a, 0xd4, 0x86, 0x37, 0x89, 0x8c, 0x29, 0x92,
+  0x43, 0x52, 0x94, 0xed, 0x44, 0xfd, 0xed, 0xef, 0x79, 0xce, 0x01, 0xb0,
+  0xc0, 0x72, 0x29, 0x53, 0x4e, 0xd2, 0x4e, 0x33, 0xf1, 0x8c, 0x4c, 0x2c,
+  0x2e, 0x07, 0x07, 0xe7, 0x0e, 0x2c, 0x16, 0x38, 0x7a, 0x40, 0x08, 0xb7,
+  0xa2, 0x1c, 0x6b, 0x45, 0x71, 0x02, 0x49, 0xc5, 0x6c, 0xdc, 0x5f, 0x8f,
+  0x7f, 0xac, 0x38, 0x5e, 0x4d, 0x57, 0x37, 0x77, 0x14, 0xb6, 0x9f, 0x18,
+  0xe0, 0x6c, 0x47, 0x1e, 0x27, 0x97, 0xbe, 0xe5, 0xf9, 0x48, 0x7a, 0x98,
+  0xfe, 0x3d, 0x62, 0xfc, 0x44, 0x63, 0x33, 0xb4, 0x3a, 0x7c, 0x6c, 0x55,
+  0xba, 0x43, 0xae, 0xeb, 0x4a, 0xd9, 0x5a, 0xfa, 0x30, 0x00, 0x75, 0x76,
+  0x76, 0xa6, 0xd2, 0x56, 0xda, 0xdc, 0xd3, 0xc4, 0x28, 0x9d, 0x39, 0xd1,
+  0xa4, 0xfe, 0xe5, 0xc2, 0xb2, 0x4e, 0x5d, 0x21, 0xe2, 0x0b, 0xab, 0xf5,
+  0xcb, 0x33, 0x53, 0x17, 0x97, 0xd5, 0x55, 0xee, 0x8f, 0x1e, 0x68, 0x54,
+  0xe2, 0x4f, 0x15, 0x84, 0xfd, 0x42, 0x4c, 0x9e, 0x8c, 0xc8, 0x70, 0x71,
+  0xe9, 0x56, 0xb8, 0xb4, 0x30, 0xee, 0x7d, 0x37, 0xd3, 0xb8, 0xf8, 0x6e,
+  0x7d, 0x6c, 0x39, 0x78, 0x6c, 0x07, 0x78, 0xd9, 0xdc, 0xe3, 0x7c, 0xac,
+  0x24, 0x9f, 0xd9, 0x56, 0x15, 0x46, 0xdc, 0xd2, 0xe9, 0xcc, 0x42, 0x74,
+  0x6b, 0xed, 0xea, 0x7a, 0x63, 0x17, 0x05, 0xed, 0xa9, 0xad, 0xc3, 0x86,
+  0x42, 0x1d, 0xd8, 0xf0, 0x76, 0x3d, 0xfe, 0xda, 0x3e, 0x7c, 0xb5, 0xd2,
+  0xd5, 0x5f, 0x4c, 0xaf, 0x27, 0xe4, 0x97, 0x9f, 0xdf, 0x92, 0xb5, 0x6a,
+  0x7a, 0x0e, 0x05, 0x5f, 0xf5, 0x6b, 0x73, 0xe1, 0x53, 0x9b, 0x8b, 0xfe,
+  0x26, 0xe7, 0xf2, 0x94, 0x8a, 0x70, 0x2e, 0x5b, 0xe1, 0x34, 0x7f, 0xf7,
+  0x3b, 0x55, 0x3c, 0xe9, 0x23, 0x1d, 0xd4, 0xb9, 0x6a, 0x91, 0x70, 0xed,
+  0x3d, 0x48, 0xa3, 0x5e, 0xb4, 0xe0, 0x23, 0x54, 0xea, 0xcd, 0x92, 0x31,
+  0x2e, 0xca, 0x7b, 0x14, 0x6a, 0xf1, 0xa1, 0x1c, 0x07, 0x41, 0xab, 0x9b,
+  0x53, 0x39, 0xf4, 0x36, 0x62, 0x02, 0x55, 0xc7, 0x82, 0x6e, 0xbd, 0xe7,
+  0x89, 0x1d, 0x8d, 0xa0, 0xf0, 0xe3, 0x34, 0x00, 0xfb, 0x70, 0x28, 0xfe,
+  0xb6, 0x41, 0x35, 0xfa, 0x4e, 0x4c, 0xf0, 0x61, 0xec, 0x6d, 0xe5, 0xc3,
+  0x91, 0xe7, 0x48, 0x81, 0xf0, 0xc6, 0xef, 0xa1, 0x28, 0xa3, 0x6e, 0x35,
+  0xb6, 0x12, 0x6b, 0x7c, 0x18, 0x51, 0xd4, 0x7b, 0x14, 0x81, 0x75, 0xe8,
+  0x23, 0x04, 0x96, 0x87, 0x47, 0x10, 0x58, 0x1a, 0xec, 0x25, 0xb0, 0x0e,
+  0xa3, 0x0e, 0x23, 0xb0, 0x54, 0x3e, 0x00, 0xf9, 0xc2, 0x48, 0xfc, 0x48,
+  0x3f, 0xd0, 0x3b, 0xba, 0x57, 0x4e, 0xa0, 0xed, 0x2a, 0x13, 0x3e, 0xc0,
+  0x15, 0xd3, 0x2b, 0x91, 0x8d, 0xac, 0x40, 0xb9, 0x21, 0x4d, 0x79, 0x04,
+  0xfa, 0x7c, 0x2c, 0x31, 0xba, 0x52, 0xbd, 0x38, 0x43, 0x06, 0xa3, 0xa8,
+  0xb3, 0x8d, 0xf8, 0x6c, 0x86, 0x2d, 0xe3, 0xe3, 0xb7, 0x04, 0x1f, 0x58,
+  0xa1, 0x9f, 0x23, 0xdb, 0xcb, 0x68, 0x7c, 0xf5, 0x40, 0xd4, 0xb4, 0x58,
+  0x6e, 0x58, 0x02, 0xd1, 0x01, 0xd5, 0x94, 0x73, 0xb8, 0x04, 0xb2, 0xce,
+  0x01, 0x03, 0x90, 0x21, 0x16, 0x85, 0x8f, 0xb7, 0x62, 0x9c, 0x4c, 0xb9,
+  0xf9, 0xb0, 0x96, 0xea, 0x6c, 0x56, 0xb7, 0x63, 0x93, 0x2d, 0xfb, 0xca,
+  0xbd, 0x6c, 0x3d, 0x00, 0x37, 0x82, 0xa2, 0x9a, 0x12, 0x37, 0xc1, 0x5b,
+  0x01, 0xef, 0x70, 0xd2, 0x5f, 0x37, 0xea, 0x7c, 0x14, 0x0b, 0x9f, 0xa0,
+  0x51, 0x6f, 0x1a, 0x67, 0x25, 0xa3, 0x59, 0x1c, 0x38, 0x16, 0xa5, 0x16,
+  0xc5, 0x58, 0xae, 0xd6, 0x75, 0x93, 0x67, 0x46, 0xf3, 0xa7, 0xa2, 0x07,
+  0x29, 0xaa, 0x40, 0x6e, 0xc1, 0x90, 0xee, 0xab, 0xd0, 0x13, 0x5f, 0xfd,
+  0xd3, 0x20, 0xb7, 0xaa, 0x40, 0x4e, 0xc3, 0xff, 0x20, 0x6a, 0xf7, 0x8e,
+  0xa8, 0xf9, 0x96, 0x5b, 0x8b, 0xe6, 0x97, 0xb7, 0x37, 0x83, 0xf1, 0x0a,
+  0x2a, 0x67, 0x05, 0x02, 0xc4, 0xfd, 0x86, 0xe6, 0x99, 0x70, 0x55, 0x38,
+  0x7f, 0xec, 0xd5, 0x18, 0x27, 0x99, 0x1d, 0xf1, 0x7c, 0x4f, 0xf1, 0x3b,
+  0x3b, 0x1c, 0xb0, 0x43, 0x63, 0xa4, 0xba, 0xe4, 0x31, 0x8b, 0x08, 0xe0,
+  0x6e, 0x32, 0x1d, 0x4e, 0x20, 0x00, 0x01, 0x77, 0xa1, 0x08, 0x2d, 0xd5,
+  0x37, 0xc1, 0x27, 0xc5, 0x07, 0x2b, 0xae, 0x6e, 0x19, 0xaf, 0x31, 0x50,
+  0x7d, 0x0a, 0x00, 0x0b, 0x4b, 0x8d, 0x19, 0x27, 0xd5, 0xd4, 0x07, 0x79,
+  0x6a, 0xd8, 0x38, 0xce, 0xd3, 0x74, 0x63, 0x48, 0x2a, 0xf1, 0x0b, 0xe7,
+  0x85, 0x03, 0x38, 0x30, 0x8a, 0x5e, 0x54, 0x79, 0x54, 0x47, 0xc6, 0x69,
+  0x39, 0xf5, 0xd6, 0x21, 0x75, 0xf0, 0xc7, 0x3e, 0x29, 0xb1, 0x6e, 0xe6,
+  0x7a, 0x75, 0x40, 0xe5, 0x6c, 0x6f, 0xfe, 0xe7, 0x3a, 0x1e, 0x3f, 0x38,
+  0x92, 0xba, 0xc4, 0x81, 0x4d, 0x01, 0x16, 0x4f, 0xbb, 0x71, 0x97, 0x25,
+  0x2b, 0x9f, 0x05, 0x88, 0x3a, 0x21, 0xb2, 0x30, 0xa3, 0xf7, 0xbc, 0xe8,
+  0xbd, 0xf3, 0x54, 0x58, 0x1f, 0xc9, 0xbb, 0x37, 0xf2, 0xe6, 0x90, 0xc8,
+  0x90, 0x91, 0x48, 0x64, 0xcc, 0x8d, 0x4b, 0x22, 0x9d, 0xf7, 0x41, 0x12,
+  0x79, 0xf5, 0x7e, 0x09, 0x24, 0x02, 0x9a, 0xbf, 0xf1, 0x06, 0xab, 0x7e,
+  0xf8, 0xc1, 0xe9, 0x02, 0xfb, 0x75, 0x81, 0x76, 0xcb, 0x60, 0xeb, 0xf7,
+  0xee, 0x28, 0x71, 0xaf, 0xba, 0xb8, 0x30, 0x41, 0xa2, 0x6b, 0x4a, 0x71,
+  0xaf, 0xbe, 0x66, 0xc1, 0xc9, 0x95, 0xfa, 0x3c, 0x57, 0x51, 0x73, 0xbf,
+  0x49, 0x9f, 0x4c, 0xe7, 0x9b, 0x97, 0xfa, 0xd0, 0x2b, 0x56, 0xa3, 0x2a,
+  0xe7, 0x84, 0x6f, 0x62, 0x58, 0xf9, 0x1f, 0x3c, 0x96, 0xec, 0x30, 0x58,
+  0xe2, 0xe8, 0x78, 0x88, 0xf4, 0x9f, 0x6b, 0x22, 0x2c, 0xde, 0x70, 0x5a,
+  0x18, 0x9e, 0x6f, 0x4a, 0x6c, 0x7c, 0x58, 0x21, 0x51, 0x5a, 0x34, 0x1f,
+  0x9e, 0x87, 0x56, 0x06, 0xaa, 0x1e, 0xb0, 0x63, 0x57, 0xa8, 0xd8, 0x95,
+  0x99, 0xe3, 0x74, 0x61, 0x95, 0xf8, 0x34, 0x60, 0x6b, 0x5f, 0x4c, 0x67,
+  0x47, 0x8f, 0xf0, 0x9f, 0xa6, 0xcd, 0x47, 0x3a, 0x50, 0x2a, 0x79, 0x36,
+  0x1a, 0x11, 0x32, 0xfa, 0xb0, 0x08, 0x25, 0x46, 0x1c, 0xa2, 0x37, 0x5f,
+  0x14, 0xa3, 0xf7, 0xec, 0xa0, 0x96, 0x4c, 0x53, 0xb8, 0x2b, 0x86, 0xb6,
+  0x84, 0xc5, 0x4c, 0x43, 0xd6, 0x32, 0xa6, 0x8c, 0x90, 0x95, 0x01, 0xb0,
+  0x4c, 0xb9, 0xae, 0xe6, 0x70, 0xaf, 0x5e, 0xe5, 0xd7, 0x2b, 0x3d, 0xbb,
+  0x09, 0x96, 0x8a, 0x0a, 0x15, 0xae, 0x7d, 0xaf, 0x73, 0x7f, 0xc0, 0xbd,
+  0x6b, 0x85, 0xb5, 0x23, 0x32, 0x46, 0x62, 0x6b, 0x96, 0xc8, 0xce, 0x7f,
+  0xb4, 0x17, 0xdd, 0xba, 0x8b, 0x6b, 0xd6, 0x91, 0xda, 0xdc, 0x23, 0xbd,
+  0x3a, 0xf1, 0x8c, 0x71, 0x13, 0xaf, 0x46, 0x11, 0xdc, 0x42, 0xc9, 0x69,
+  0x21, 0xec, 0xa2, 0x88, 0x7b, 0xe3, 0x99, 0xda, 0x2c, 0xb8, 0x14, 0xdb,
+  0x50, 0xfa, 0x53, 0x92, 0x93, 0x0f, 0x38, 0x60, 0xd6, 0x9c, 0xa3, 0x93,
+  0x4f, 0x3f, 0x3d, 0x52, 0x9f, 0xaa, 0x62, 0x75, 0x75, 0x8d, 0xed, 0x15,
+  0x20, 0xdc, 0x1d, 0xcd, 0x38, 0xcd, 0x31, 0x73, 0xba, 0xaf, 0xbb, 0xfe,
+  0x5a, 0x2d, 0x71, 0x62, 0x0e, 0x15, 0x53, 0x6f, 0xba, 0xb0, 0xbf, 0xe3,
+  0x37, 0x8f, 0x3e, 0x3d, 0x29, 0x14, 0x92, 0x26, 0x1c, 0x92, 0x2b, 0xbc,
+  0xd2, 0x4b, 0xb7, 0x72, 0x26, 0xc9, 0x83, 0x0a, 0xa0, 0x35, 0x50, 0x28,
+  0xb6, 0x2d, 0xd6, 0x24, 0x3f, 0xac, 0x31, 0x9a, 0xb6, 0x64, 0x53, 0xb1,
+  0x69, 0xf8, 0x8a, 0x88, 0x31, 0x42, 0x97, 0x9b, 0x3e, 0x4e, 0x55, 0x3d,
+  0x28, 0x68, 0xad, 0x80, 0xd0, 0x33, 0xda, 0x6b, 0x0f, 0x4d, 0x35, 0xf1,
+  0xe4, 0x53, 0x55, 0x53, 0x4f, 0x0c, 0x78, 0xc6, 0xd6, 0xab, 0xa6, 0x85,
+  0x53, 0x6a, 0x69, 0x24, 0x4d, 0xe4, 0xd8, 0x10, 0x3a, 0x18, 0x61, 0x38,
+  0x53, 0xb5, 0x9a, 0x0e, 0x78, 0x94, 0x92, 0x63, 0xff, 0xea, 0x5f, 0x49,
+  0x98, 0x21, 0x34, 0x26, 0x62, 0x1b, 0x6f, 0x68, 0x24, 0x49, 0x1f, 0x61,
+  0xed, 0xfa, 0x16, 0x78, 0x25, 0x32, 0x40, 0x76, 0xc0, 0x04, 0xb7, 0x6e,
+  0xc7, 0x51, 0x37, 0xda, 0x58, 0x0d, 0x7f, 0x6e, 0xc3, 0xe4, 0x03, 0x7a,
+  0xb0, 0x5c, 0x79, 0x4c, 0x0f, 0xa6, 0x55, 0x25, 0x7c, 0xa5, 0x4a, 0xe4,
+  0xfb, 0xb6, 0x2c, 0x5c, 0x4f, 0xd5, 0x6f, 0xbf, 0x77, 0xa9, 0x76, 0xaf,
+  0x8e, 0x0d, 0x44, 0x14, 0xe9, 0xe4, 0xfd, 0xb1, 0x2a, 0xd8, 0x43, 0x0d,
+  0x84, 0x14, 0x38, 0x43, 0x57, 0xeb, 0xb3, 0x62, 0xaf, 0x4f, 0xc2, 0x80,
+  0x35, 0x1f, 0x31, 0x98, 0xb3, 0xc5, 0xe2, 0x0d, 0x6c, 0xe8, 0xde, 0x70,
+  0x70, 0x3a, 0xf7, 0xa2, 0xca, 0x1f, 0x17, 0x0f, 0x7a, 0x9c, 0x27, 0x57,
+  0x6c, 0x2a, 0x14, 0x34, 0xb5, 0xc2, 0xf2, 0x1f, 0x08, 0x16, 0x0d, 0x35,
+  0x9c, 0x88, 0xe8, 0x80, 0x40, 0x86, 0x88, 0xc6, 0x0e, 0x65, 0x23, 0x4b,
+  0x6c, 0x20, 0x50, 0xe1, 0x2e, 0x41, 0x4e, 0x43, 0x32, 0xa3, 0xcc, 0x5a,
+  0x7c, 0x24, 0xe2, 0xd2, 0xf3, 0x6a, 0x2f, 0xd0, 0x39, 0x28, 0x78, 0xdc,
+  0x13, 0x3e, 0x96, 0x29, 0x6a, 0x2a, 0x3c, 0x44, 0xd1, 0xc7, 0x44, 0x97,
+  0x8f, 0xa7, 0xea, 0x07, 0xe8, 0xea, 0x2e, 0x2c, 0x16, 0x81, 0xe3, 0x7d,
+  0x15, 0x8d, 0x99, 0xbe, 0xc7, 0x3c, 0x7b, 0x67, 0x82, 0x0e, 0xa6, 0xf3,
+  0xfe, 0xea, 0x1d, 0xc7, 0x6f, 0x55, 0x34, 0x3d, 0x2f, 0x48, 0xca, 0x47,
+  0x7d, 0x72, 0x6d, 0x3e, 0x21, 0x9b, 0xab, 0x69, 0x97, 0x2d, 0xab, 0x10,
+  0x47, 0xee, 0xda, 0xa9, 0x5e, 0x2b, 0xf8, 0x72, 0xc1, 0xea, 0xc3, 0x53,
+  0x4d, 0xcd, 0x5b, 0xb0, 0xa6, 0x72, 0x82, 0xe4, 0xab, 0x33, 0xe1, 0x8c,
+  0x55, 0x84, 0xb2, 0x5f, 0x71, 0x9d, 0x4a, 0x5f, 0x0d, 0x6f, 0xd7, 0x9b,
+  0xc5, 0x8d, 0x3b, 0x08, 0x38, 0x1e, 0x03, 0x9d, 0x1a, 0x7a, 0xfe, 0x03,
+  0x58, 0xf8, 0xce, 0xe3, 0xd1, 0x96, 0x1c, 0x98, 0xd9, 0xb3, 0x4c, 0x1f,
+  0x6a, 0x67, 0x2b, 0xc9, 0x68, 0x9c, 0x83, 0x45, 0x1b, 0xb6, 0x88, 0x23,
+  0xff, 0xb5, 0xe7, 0x3f, 0x2d, 0x5f, 0xf8, 0xa3, 0x3e, 0x3d, 0x30, 0x1e,
+  0x17, 0x4a, 0xff, 0x40, 0x44, 0xef, 0xdf, 0xa8, 0xef, 0x9f, 0xad, 0x56,
+  0xfd, 0x77, 0xf7, 0x4e, 0x3d, 0x91, 0x8e, 0xf5, 0x58, 0x8f, 0xf4, 0xca,
+  0x21, 0xb0, 0x96, 0x59, 0x7f, 0x06, 0xaa, 0x98, 0x34, 0x72, 0xba, 0xb9,
+  0x25, 0x50, 0x89, 0xc1, 0x82, 0x9c, 0x13, 0xea, 0x9a, 0x58, 0xf9, 0x31,
+  0x8e, 0x8f, 0x0d, 0x3a, 0x4d, 0xef, 0xd5, 0xef, 0x55, 0x31, 0xdb, 0x50,
+  0x4f, 0x95, 0x3b, 0xb7, 0xe8, 0xb9, 0xd1, 0x2c, 0x88, 0x2a, 0xa7, 0xd0,
+  0x92, 0x0b, 0x18, 0xd9, 0x49, 0x94, 0x37, 0x51, 0x62, 0xa8, 0x06, 0x9b,
+  0xc2, 0x10, 0x23, 0xa7, 0x67, 0x05, 0x7d, 0x25, 0x67, 0x89, 0x13, 0x09,
+  0x8c, 0x58, 0x90, 0x4b, 0xea, 0x53, 0xc8, 0xb1, 0x91, 0xd7, 0xd7, 0x7d,
+  0x63, 0x61, 0x1c, 0xb1, 0x0f, 0xb9, 0xfc, 0x5f, 0xfd, 0xe5, 0xf4, 0xf5,
+  0x6a, 0xe6, 0xce, 0x99, 0x08, 0x29, 0x7e, 0x01, 0xfc, 0xf4, 0xe4, 0xe4,
+  0xee, 0xee, 0x8e, 0x82, 0x42, 0x0a, 0x59, 0xc7, 0x24, 0x7b, 0x34, 0xcb,
+  0x18, 0xe3, 0xb4, 0x84, 0x4e, 0xeb, 0x04, 0x4e, 0x79, 0x07, 0x46, 0xef,
+  0xa8, 0xfc, 0x3e, 0xe1, 0x5b, 0x06, 0x67, 0xad, 0x9c, 0xbc, 0x0a, 0x31,
+  0xa8, 0xc0, 0xc3, 0x30, 0x8c, 0x65, 0x7f, 0x33, 0x61, 0x1f, 0xb3, 0xd3,
+  0xfc, 0x96, 0x34, 0x4d, 0x8f, 0x82, 0x87, 0x45, 0x64, 0x1b, 0xf7, 0x47,
+  0xb6, 0xa1, 0xdb, 0xb9, 0x06, 0x50, 0xa9, 0x9e, 0xfb, 0x51, 0x59, 0xae,
+  0x16, 0x1c, 0x51, 0x5d, 0xf1, 0x36, 0x9d, 0x6a, 0x8c, 0x34, 0x49, 0x6c,
+  0x81, 0x75, 0xe9, 0xf2, 0xc6, 0x07, 0xc5, 0xc7, 0xba, 0xc3, 0x9b, 0xf1,
+  0x66, 0xb2, 0x20, 0xfc, 0xea, 0x7f, 0xfe, 0xe3, 0x37, 0x75, 0x79, 0x41,
+  0x84, 0x77, 0x88, 0xa4, 0xf6, 0x4f, 0xad, 0x85, 0xab, 0x3f, 0x1b, 0x0e,
+  0xc7, 0xcb, 0x4d, 0x9d, 0x6a, 0xe1, 0x20, 0xd9, 0xa9, 0x1c, 0xce, 0x7b,
+  0xb2, 0x20, 0x01, 0xc6, 0x69, 0x7d, 0x14, 0xfe, 0xde, 0xd4, 0x0b, 0x5b,
+  0x86, 0x55, 0xca, 0x07, 0x5e, 0x6e, 0xf5, 0xa1, 0x1b, 0xcf, 0x6f, 0xaf,
+  0xae, 0xc6, 0x2b, 0x79, 0xc7, 0x25, 0x75, 0x07, 0x9c, 0xe3, 0xda, 0x61,
+  0x11, 0xb9, 0xc1, 0x6c, 0x31, 0xd0, 0x8b, 0x40, 0xcf, 0x29, 0xd9, 0xb8,
+  0x90, 0x8a, 0x97, 0x84, 0x3f, 0xef, 0x44, 0x78, 0x08, 0x27, 0xc7, 0xd6,
+  0x16, 0x1a, 0xa2, 0x81, 0xb1, 0x0a, 0x5d, 0x00, 0x3a, 0x81, 0xb2, 0x84,
+  0xd2, 0x67, 0x33, 0xd7, 0x4f, 0xea, 0xfa, 0x6c, 0xe6, 0x47, 0x76, 0xe3,
+  0x9a, 0x91, 0x0b, 0xf4, 0x76, 0xa9, 0x63, 0xf0, 0xa3, 0x47, 0xae, 0xda,
+  0x9a, 0x20, 0x83, 0xe5, 0xc5, 0x5b, 0xba, 0xa5, 0xc0, 0xa9, 0x30, 0x47,
+  0xd3, 0x39, 0x4d, 0x3e, 0xa0, 0xdd, 0xfd, 0x99, 0x7a, 0xf9, 0x79, 0x76,
+  0x4c, 0x0c, 0x86, 0x19, 0xb9, 0x9d, 0xbf, 0x51, 0x83, 0x77, 0x3a, 0xb1,
+  0x5e, 0x90, 0x2e, 0xf1, 0xc8, 0xe7, 0x63, 0x9c, 0xc6, 0x3d, 0xa1, 0xe0,
+  0x9e, 0x82, 0xfa, 0x01, 0x84, 0x93, 0xd8, 0x7f, 0xb3, 0x20, 0xcb, 0xdc,
+  0xa7, 0x29, 0xcd, 0x7c, 0x38, 0x06, 0xc8, 0xc6, 0x7a, 0x71, 0xbb, 0x1a,
+  0x8a, 0x42, 0xce, 0xa8, 0xad, 0x9c, 0x5a, 0x4f, 0x75, 0xf5, 0xb4, 0x03,
+  0xd7, 0x14, 0x00, 0xc3, 0xbb, 0xc5, 0xea, 0x0d, 0x66, 0xc7, 0x6f, 0xc6,
+  0xe3, 0xa5, 0x9a, 0x6e, 0x60, 0xd1, 0xae, 0x02, 0x33, 0x27, 0xc1, 0x9b,
+  0x1c, 0xd7, 0xb6, 0xbf, 0x1c, 0x65, 0xaf, 0x98, 0x58, 0xda, 0xb0, 0xc3,
+  0x1c, 0xbc, 0x42, 0x4c, 0xd6, 0x3e, 0x56, 0x51, 0x4c, 0x7f, 0xf4, 0x1b,
+  0xd3, 0x2f, 0x8d, 0xa0, 0x4b, 0x4f, 0x29, 0x3d, 0xb5, 0x8e, 0x15, 0xfd,
+  0x44, 0x11, 0xfd, 0xe5, 0xf4, 0x98, 0x1c, 0x2b, 0xfa, 0x89, 0x28, 0x37,
+  0xa2, 0x4a, 0x71, 0x74, 0xa9, 0x27, 0x0b, 0xea, 0xaf, 0x9a, 0xa1, 0x7f,
+  0x99, 0x6f, 0x92, 0x98, 0x0d, 0x6f, 0x23, 0x4f, 0x99, 0x4e, 0x1c, 0x63,
+  0xa0, 0xca, 0x1b, 0xaa, 0xd2, 0xea, 0xd1, 0xcf, 0xa9, 0xca, 0x53, 0xfa,
+  0x7d, 0xf2, 0xa4, 0xa9, 0xfe, 0x7a, 0xf1, 0xe6, 0x92, 0xb2, 0xf9, 0x80,
+  0xfe, 0x2b, 0x8a, 0x60, 0x56, 0x0d, 0x4e, 0xf6, 0x07, 0x6b, 0x49, 0xac,
+  0xa7, 0xf3, 0xc6, 0x1b, 0x32, 0x19, 0x51, 0xb3, 0x49, 0x44, 0x49, 0xe3,
+  0x6e, 0xda, 0xcd, 0xdb, 0x71, 0x37, 0x37, 0x93, 0x14, 0x3e, 0xcb, 0x7c,
+  0xbc, 0xdb, 0xf7, 0x45, 0xd4, 0x4e, 0xe2, 0xac, 0x93, 0x46, 0x5d, 0xc2,
+  0x38, 0x88, 0xdb, 0xf4, 0x98, 0x74, 0xda, 0x34, 0xa8, 0xc0, 0x16, 0x60,
+  0x74, 0x3a, 0xbf, 0x73, 0x69, 0xe1, 0xbd, 0xdd, 0x85, 0x15, 0x15, 0xbd,
+  0x11, 0x55, 0x67, 0xba, 0xc2, 0x6b, 0x62, 0x45, 0xc7, 0x0e, 0xf4, 0x98,
+  0x8b, 0xbe, 0x18, 0x63, 0xcf, 0x07, 0x11, 0xc7, 0x84, 0x5a, 0x34, 0x5e,
+  0xd6, 0x77, 0xc3, 0x00, 0x3e, 0x13, 0xa7, 0x31, 0x38, 0x56, 0x0b, 0x2f,
+  0x02, 0x03, 0xe8, 0xef, 0x84, 0x3a, 0xdf, 0x11, 0x75, 0xa2, 0x9c, 0x7e,
+  0x9f, 0x3c, 0xa1, 0x5a, 0xea, 0xc9, 0x99, 0x4a, 0x9b, 0xea, 0xed, 0xc5,
+  0x77, 0xa0, 0xd2, 0xe0, 0x62, 0x71, 0xa9, 0x7e, 0xc0, 0x0f, 0x28, 0x72,
+  0xa9, 0x4e, 0x4f, 0x55, 0xc7, 0x3e, 0xc7, 0xfc, 0x1c, 0xe5, 0x36, 0x23,
+  0xe1, 0x8c, 0x38, 0xed, 0x99, 0xb5, 0x04, 0x92, 0xbf, 0x33, 0xa1, 0xd7,
+  0x45, 0x8b, 0xb4, 0x6d, 0x30, 0xb0, 0x8f, 0x11, 0x3d, 0x0e, 0xed, 0x53,
+  0x4c, 0x4f, 0x23, 0xfb, 0x94, 0xe8, 0x77, 0xb4, 0x16, 0xd1, 0xa9, 0x20,
+  0x3a, 0xd5, 0x6c, 0x9c, 0x82, 0x8d, 0x76, 0xe9, 0x90, 0xca, 0x49, 0xab,
+  0xa8, 0xf0, 0xfc, 0x1c, 0x72, 0x73, 0x75, 0xac, 0xae, 0x7b, 0x4e, 0x0c,
+  0xb9, 0x62, 0x9f, 0xc4, 0xef, 0x75, 0xb0, 0x28, 0xd1, 0x20, 0x1c, 0x7e,
+  0xa7, 0x86, 0x4d, 0xc2, 0xb9, 0xf1, 0x6f, 0x4e, 0x8f, 0x9a, 0x3d, 0x75,
+  0x0d, 0x00, 0xc5, 0xfb, 0x16, 0x7d, 0x95, 0x80, 0x69, 0x1c, 0xd9, 0xc6,
+  0x23, 0xaa, 0x3f, 0x18, 0x48, 0xe3, 0x11, 0xc3, 0x91, 0xb6, 0x8d, 0x0c,
+  0x2a, 0xc9, 0x42, 0x43, 0xb9, 0x51, 0xb6, 0x17, 0x54, 0x6c, 0x40, 0x51,
+  0xd7, 0xff, 0x24, 0x02, 0xfc, 0x53, 0x8d, 0x34, 0x84, 0x44, 0x43, 0xc8,
+  0x2a, 0x21, 0x48, 0x23, 0xd4, 0xc7, 0x00, 0x7e, 0x50, 0xff, 0x36, 0x58,
+  0x37, 0xda, 0x68, 0x57, 0x6e, 0xc3, 0x62, 0x4a, 0xa5, 0xaf, 0x2e, 0xa8,
+  0x5f, 0xb0, 0x84, 0x51, 0x9e, 0x52, 0xad, 0xa4, 0x49, 0xa4, 0x5e, 0xdf,
+  0xde, 0xa0, 0x69, 0x9f, 0xba, 0xbb, 0xa2, 0xbf, 0xbf, 0x5e, 0x4c, 0x2f,
+  0xe9, 0xe7, 0xed, 0xc5, 0xf5, 0x25, 0xea, 0xb5, 0x0c, 0xf9, 0xc0, 0x3c,
+  0x42, 0x0f, 0x8c, 0x19, 0xf6, 0x98, 0x5b, 0x83, 0x81, 0x29, 0x63, 0x56,
+  0x02, 0x97, 0x27, 0xaa, 0xd1, 0x00, 0x3c, 0xea, 0x65, 0xcd, 0xbd, 0xe0,
+  0xe1, 0x9c, 0x78, 0xd1, 0x48, 0x62, 0x15, 0x50, 0x1e, 0xfd, 0x2b, 0x80,
+  0x0a, 0x82, 0x46, 0x22, 0x20, 0x6b, 0xfd, 0x9e, 0x95, 0x08, 0x3c, 0x52,
+  0x0f, 0x56, 0x26, 0xf0, 0x3c, 0xec, 0x59, 0xa1, 0xc0, 0xe3, 0xc8, 0x3a,
+  0xb4, 0xcd, 0x64, 0xba, 0x0e, 0x6f, 0x97, 0x23, 0xd1, 0x45, 0x2b, 0xee,
+  0xbc, 0x51, 0xcb, 0x59, 0xcd, 0x12, 0xd9, 0x39, 0x56, 0x76, 0x67, 0x94,
+  0xe8, 0x89, 0x60, 0xa3, 0x75, 0x86, 0xe0, 0xce, 0x7b, 0x76, 0x1a, 0xa7,
+  0xb5, 0xaa, 0x90, 0xb0, 0xbb, 0x09, 0x4c, 0xa8, 0xc9, 0x67, 0x19, 0xc4,
+  0xdc, 0x03, 0xd2, 0x48, 0xb5, 0x90, 0x7d, 0xa1, 0xcb, 0x9e, 0x3c, 0xb9,
+  0xd4, 0xdd, 0x5c, 0x90, 0x8c, 0x5e, 0xba, 0x62, 0xe8, 0xb6, 0x6e, 0x3a,
+  0xf3, 0x61, 0xa6, 0x25, 0xab, 0x28, 0x6a, 0x1c, 0x93, 0xa0, 0x9a, 0x5c,
+  0x47, 0xbb, 0x5d, 0xda, 0xb1, 0x52, 0xf4, 0x58, 0x54, 0x08, 0x8f, 0x53,
+  0xa0, 0x8e, 0x87, 0x33, 0x86, 0x2b, 0x90, 0x80, 0xc0, 0x31, 0x09, 0x85,
+  0x34, 0xd3, 0xe8, 0x1f, 0x86, 0xee, 0x7d, 0xcf, 0xd2, 0x76, 0x32, 0x7e,
+  0xeb, 0x11, 0xd6, 0x25, 0xea, 0x60, 0xca, 0x53, 0x1e, 0x4d, 0xbf, 0x4f,
+  0x55, 0x47, 0xba, 0xda, 0x05, 0xde, 0x7a, 0xdb, 0x69, 0xed, 0x90, 0x96,
+  0xe6, 0x2e, 0x59, 0x5e, 0xd0, 0x17, 0xb9, 0x88, 0x20, 0x67, 0x8d, 0x96,
+  0xb5, 0x69, 0xcd, 0x8f, 0xa2, 0x4d, 0x15, 0xa4, 0x63, 0xf4, 0xb5, 0xdf,
+  0x9e, 0x74, 0xb4, 0x39, 0x61, 0xd4, 0xb3, 0x9c, 0xa8, 0x3a, 0x2d, 0x79,
+  0x07, 0x1e, 0xeb, 0x89, 0xe4, 0x2c, 0x17, 0x77, 0x0d, 0x72, 0x56, 0x1d,
+  0xd6, 0x39, 0x28, 0x5d, 0x9c, 0x65, 0x02, 0xbb, 0x0a, 0x4f, 0x74, 0xb5,
+  0xe0, 0xc9, 0x88, 0x59, 0xd8, 0xb4, 0x18, 0xdc, 0x09, 0x06, 0x77, 0x84,
+  0x01, 0x19, 0xb4, 0x3b, 0xd7, 0xa0, 0xd9, 0x3a, 0x83, 0x77, 0x2c, 0xda,
+  0x54, 0x8d, 0x53, 0x5c, 0x13, 0x29, 0x54, 0x06, 0x58, 0xe2, 0x39, 0xa9,
+  0x1e, 0x2b, 0xc7, 0xdd, 0xa5, 0xa8, 0x1c, 0x10, 0x43, 0x15, 0x83, 0x5b,
+  0x33, 0xdc, 0x2c, 0xc8, 0xfd, 0x92, 0xd7, 0x86, 0x4b, 0xa1, 0x40, 0x67,
+  0xc4, 0xd7, 0x00, 0x61, 0x0c, 0xf5, 0x56, 0xbd, 0xe9, 0xd2, 0x4e, 0xaf,
+  0x6d, 0x13, 0x60, 0x2d, 0x07, 0x45, 0xac, 0x81, 0x53, 0xf6, 0x31, 0x75,
+  0xd9, 0x0d, 0x02, 0x9e, 0x2a, 0xdc, 0x16, 0xb3, 0xe6, 0x92, 0xe5, 0xa2,
+  0x88, 0xe9, 0xd7, 0x14, 0x2f, 0x8d, 0x11, 0x88, 0x70, 0xc2, 0x8f, 0x08,
+  0x6e, 0x46, 0xd9, 0xdf, 0xb9, 0xf1, 0x4b, 0x8a, 0x17, 0xb4, 0x54, 0x21,
+  0x84, 0x08, 0x17, 0x73, 0x7d, 0x19, 0x87, 0x27, 0x76, 0x63, 0x57, 0xee,
+  0x74, 0x18, 0x47, 0xc1, 0x3d, 0x54, 0x59, 0xa2, 0x59, 0x89, 0x75, 0x6c,
+  0x26, 0x3f, 0x1e, 0xa3, 0x17, 0xed, 0x35, 0x9d, 0x08, 0xe4, 0x98, 0xd1,
+  0x45, 0xb0, 0x69, 0x23, 0xc1, 0xaf, 0x39, 0xe3, 0x15, 0x4d, 0xb7, 0x1a,
+  0x65, 0x29, 0x91, 0xcf, 0xc5, 0x84, 0x03, 0x3a, 0x7d, 0xca, 0x18, 0xf0,
+  0xaa, 0xb7, 0xcd, 0x83, 0x91, 0x42, 0x9f, 0x05, 0x07, 0xa9, 0x6f, 0x6d,
+  0x99, 0x1a, 0x25, 0xb7, 0x2d, 0xdd, 0xf3, 0x15, 0x3b, 0xcf, 0xd6, 0xcf,
+  0x9c, 0x78, 0x58, 0xc0, 0x82, 0x58, 0x0d, 0x01, 0x7b, 0x6c, 0xc1, 0x6b,
+  0xe8, 0xcd, 0xa6, 0x95, 0x7e, 0xa6, 0x16, 0xc8, 0xfd, 0x52, 0xe8, 0xd5,
+  0xc0, 0x36, 0x83, 0x39, 0x45, 0xaa, 0x2c, 0xa3, 0x37, 0x44, 0x55, 0xbf,
+  0xed, 0x71, 0x81, 0x75, 0xd3, 0x5b, 0xe1, 0x79, 0x00, 0x94, 0x6d, 0xc1,
+  0xa4, 0x7c, 0xca, 0x63, 0x22, 0x8b, 0xd0, 0x30, 0x00, 0x44, 0x40, 0x24,
+  0xb8, 0x7e, 0xf1, 0xec, 0xd5, 0x8b, 0x7f, 0x7d, 0xf6, 0xe2, 0xf5, 0x97,
+  0x88, 0xc8, 0xa2, 0x56, 0x9c, 0x92, 0xcc, 0xe0, 0xa7, 0x67, 0x25, 0x88,
+  0x22, 0x54, 0x7e, 0x5f, 0xa2, 0x34, 0xcb, 0xf8, 0xba, 0x24, 0x8e, 0x2d,
+  0x29, 0xef, 0xef, 0xe3, 0x81, 0x12, 0x89, 0x50, 0x8d, 0x85, 0x2c, 0x26,
+  0xdd, 0xf4, 0x79, 0x55, 0x09, 0x74, 0x42, 0x1d, 0x26, 0xcc, 0x1a, 0x26,
+  0x44, 0xc4, 0x4e, 0xde, 0x6a, 0xdc, 0xce, 0xed, 0x7b, 0x8d, 0xa6, 0x3b,
+  0x07, 0x07, 0x5b, 0xef, 0x45, 0x54, 0xbc, 0x35, 0x3e, 0x3e, 0x55, 0xde,
+  0xab, 0xa8, 0x85, 0x8c, 0xe6, 0xeb, 0xb8, 0xea, 0x41, 0xad, 0x27, 0x8b,
+  0xbb, 0x35, 0x16, 0xbb, 0x65, 0x3f, 0x1a, 0xdf, 0xdc, 0xd0, 0x1f, 0x2c,
+  0xb6, 0x02, 0xc7, 0x9c, 0x25, 0xaf, 0x06, 0xfd, 0x15, 0x43, 0x11, 0x8d,
+  0x59, 0xab, 0xef, 0xf5, 0xd6, 0xd7, 0xd3, 0x35, 0x6b, 0xda, 0xb9, 0x4c,
+  0xff, 0x61, 0x3e, 0x47, 0xd3, 0x6b, 0x9a, 0xe8, 0xfa, 0xe2, 0x6f, 0x2f,
+  0x32, 0x13, 0x52, 0x70, 0xcf, 0xee, 0x5c, 0x9e, 0x2f, 0x07, 0xe3, 0x97,
+  0x17, 0xcb, 0xf1, 0x0a, 0x1f, 0xdc, 0xe2, 0xcc, 0xba, 0x70, 0x4e, 0x86,
+  0xa7, 0x59, 0x4c, 0xc7, 0xb1, 0x77, 0x98, 0x27, 0xe4, 0x0d, 0x70, 0xab,
+  0x59, 0x7e, 0x49, 0xb1, 0x1c, 0x9a, 0xc9, 0xba, 0xbc, 0xa0, 0xf9, 0xbd,
+  0x72, 0xae, 0xa3, 0x42, 0x0b, 0xb2, 0x67, 0x45, 0x29, 0x98, 0x45, 0xf1,
+  0x11, 0x7f, 0xe8, 0xdb, 0x73, 0xa0, 0xac, 0xc7, 0xf4, 0x3b, 0x5a, 0x1b,
+  0x6b, 0x78, 0xd3, 0x7f, 0xdb, 0x68, 0xec, 0xe0, 0x04, 0x17, 0x2f, 0x18,
+  0x37, 0x09, 0x28, 0x41, 0x20, 0xcb, 0xdb, 0x0a, 0x5b, 0xad, 0x48, 0x8b,
+  0x19, 0x8f, 0xaf, 0xf1, 0xed, 0x0b, 0x6d, 0x36, 0x7e, 0xfb, 0x3d, 0xf7,
+  0x8b, 0xdb, 0x70, 0xee, 0x79, 0x06, 0x3b, 0xdc, 0xdc, 0x7f, 0xa2, 0x1a,
+  0xbf, 0xfd, 0xde, 0xa0, 0x15, 0xb5, 0xd2, 0x4e, 0xd6, 0xc6, 0x37, 0x03,
+  0xba, 0x7b, 0x98, 0xb0, 0x3f, 0x4d, 0xdf, 0x8e, 0x47, 0x8d, 0xa8, 0x79,
+  0xaf, 0x5e, 0x3e, 0x3f, 0x59, 0x37, 0xcd, 0x64, 0x77, 0xef, 0x5a, 0x87,
+  0x73, 0xaf, 0x51, 0xdd, 0xbb, 0x11, 0x09, 0x54, 0x1d, 0x42, 0x2f, 0xea,
+  0x9f, 0xd4, 0x0f, 0x84, 0x61, 0xb6, 0xfa, 0xb8, 0x2f, 0xe6, 0x3c, 0x18,
+  0xf7, 0xbd, 0xe2, 0xa5, 0xdf, 0x62, 0x0e, 0xa3, 0xf6, 0x8d, 0x08, 0x2e,
+  0xc5, 0x36, 0xbc, 0x8c, 0xd3, 0xd8, 0xe1, 0x4f, 0xa5, 0x71, 0x72, 0xac,
+  0xcf, 0x8c, 0x5f, 0x2f, 0x1e, 0x6a, 0x7d, 0x0a, 0xf5, 0x3b, 0xc4, 0x04,
+  0xe9, 0xeb, 0xe8, 0x1e, 0xb0, 0x37, 0x0e, 0xbc, 0xd2, 0x9c, 0xdd, 0x5a,
+  0x20, 0x91, 0xbf, 0xc6, 0xae, 0xbd, 0x29, 0xda, 0xba, 0x46, 0xa7, 0xca,
+  0xd1, 0x58, 0x83, 0x52, 0xd0, 0x50, 0x97, 0x00, 0x61, 0xad, 0x52, 0x0d,
+  0xac, 0x24, 0x2c, 0x66, 0xdb, 0x31, 0x2c, 0x37, 0x16, 0x3f, 0x1c, 0x52,
+  0x82, 0x48, 0x62, 0x0e, 0x40, 0xcb, 0xdb, 0x99, 0x5e, 0xd2, 0xd9, 0xd0,
+  0xa4, 0xd6, 0x5f, 0x48, 0xb8, 0x5d, 0x61, 0x02, 0xf5, 0xfa, 0xeb, 0x2f,
+  0xf4, 0xfb, 0xba, 0xbf, 0xf1, 0x22, 0x32, 0x3d, 0x37, 0x8a, 0xb5, 0x05,
+  0xcb, 0x87, 0xc2, 0x61, 0x92, 0xb7, 0xa8, 0xf7, 0x1a, 0xf5, 0x63, 0xdf,
+  0x61, 0xf9, 0xe5, 0xb8, 0x2f, 0xb4, 0xee, 0xae, 0x48, 0x94, 0x3e, 0x8e,
+  0xc0, 0x0a, 0x81, 0x25, 0x5a, 0x81, 0x2c, 0x75, 0x2b, 0x10, 0x1b, 0x84,
+  0x9b, 0x2d, 0x07, 0x86, 0xab, 0xf1, 0x76, 0xf1, 0xc6, 0xc1, 0xb0, 0x28,
+  0xbf, 0x57, 0xbc, 0x8a, 0xe0, 0x38, 0xc4, 0xd2, 0x76, 0xd8, 0x17, 0x9e,
+  0x67, 0xe6, 0x25, 0x7b, 0x6b, 0x1f, 0x8f, 0xad, 0xdf, 0xd6, 0x06, 0x76,
+  0x89, 0x0b, 0x36, 0xb0, 0xb8, 0xe0, 0xb1, 0x86, 0x77, 0x2d, 0x48, 0xfb,
+  0xa2, 0x13, 0x57, 0xa6, 0x1b, 0x4d, 0xbb, 0xbe, 0xe3, 0x71, 0xa5, 0x90,
+  0x8b, 0x22, 0xae, 0x15, 0x90, 0x02, 0xcd, 0xf3, 0xed, 0x8d, 0xb1, 0xb7,
+  0x99, 0x55, 0xcb, 0x92, 0x76, 0xdf, 0x6c, 0xcf, 0xdc, 0xc0, 0x59, 0xe7,
+  0x13, 0x13, 0xdc, 0x85, 0x77, 0x0d, 0x76, 0x33, 0x5e, 0x91, 0xf8, 0x41,
+  0xca, 0x9d, 0x4d, 0x19, 0xde, 0x4a, 0x9a, 0xf6, 0x3c, 0x65, 0xbb, 0x53,
+  0x40, 0xbd, 0x87, 0x83, 0x21, 0xfb, 0x73, 0x88, 0x69, 0x2b, 0x6c, 0x51,
+  0x4c, 0xb6, 0x68, 0xfd, 0xad, 0xd3, 0xa9, 0xa6, 0x88, 0x8b, 0x6e, 0x69,
+  0xb5, 0xbf, 0xe7, 0xd3, 0x43, 0xaf, 0x06, 0x95, 0xa9, 0x31, 0xde, 0xb9,
+  0x5b, 0xcb, 0x17, 0x9f, 0xaa, 0x21, 0x3f, 0x24, 0x06, 0x72, 0xd9, 0xd9,
+  0x7e, 0xfe, 0xdb, 0x0b, 0xd0, 0x7a, 0x8f, 0x66, 0xb7, 0x3f, 0x22, 0x3f,
+  0x88, 0x00, 0xb5, 0x9f, 0x2a, 0x27, 0x40, 0x7b, 0xea, 0x46, 0x09, 0xf7,
+  0xee, 0xfb, 0x69, 0xf7, 0x43, 0xa3, 0x13, 0x73, 0xf9, 0xf5, 0x29, 0xc7,
+  0x9c, 0x7c, 0x83, 0xa9, 0x5c, 0xc2, 0x8a, 0x4f, 0x00, 0x2f, 0xf4, 0x27,
+  0xc7, 0x97, 0xca, 0x9c, 0x8c, 0xc4, 0x57, 0xe9, 0xca, 0x07, 0x9e, 0x17,
+  0xfa, 0x4b, 0xd5, 0x4b, 0x85, 0xc3, 0x06, 0x6b, 0xe7, 0x66, 0x4f, 0x09,
+  0xc1, 0x1a, 0x4d, 0xb7, 0x06, 0x14, 0xf6, 0xae, 0x28, 0x73, 0xba, 0xab,
+  0x72, 0x8f, 0x71, 0x55, 0x7c, 0x7e, 0xb1, 0xe2, 0xc3, 0x95, 0x75, 0x6b,
+  0x6a, 0xfa, 0x9b, 0x20, 0x50, 0x5f, 0x2c, 0xae, 0x17, 0x0a, 0xd7, 0x77,
+  0xeb, 0xbc, 0xf5, 0xd6, 0xee, 0xad, 0x3c, 0xab, 0x45, 0x61, 0x5c, 0x53,
+  0x6f, 0x6f, 0x66, 0x73, 0x02, 0xee, 0xac, 0x43, 0xdf, 0x25, 0xe1, 0x62,
+  0x75, 0x7d, 0x12, 0x93, 0xd0, 0x9c, 0x50, 0xfd, 0x9a, 0xc2, 0x15, 0xdd,
+  0xcf, 0x17, 0x6f, 0xcf, 0x6a, 0x38, 0x4e, 0xa0, 0x93, 0xb6, 0xf0, 0xd9,
+  0x7f, 0x4d, 0xe9, 0x6b, 0xfa, 0xe2, 0xb8, 0x55, 0x53, 0x72, 0x94, 0xd6,
+  0x59, 0x2d, 0xa7, 0xb4, 0x3b, 0x70, 0x7f, 0x74, 0x16, 0x35, 0x42, 0x04,
+  0xeb, 0x96, 0xa0, 0xf1, 0x2c, 0x58, 0xdd, 0xce, 0xc6, 0x67, 0x35, 0xc8,
+  0xcd, 0x62, 0x34, 0xaa, 0x71, 0xde, 0x59, 0x6d, 0x78, 0xbb, 0xc2, 0xce,
+  0x00, 0xbe, 0x6c, 0xab, 0xa6, 0x46, 0x67, 0xb5, 0x9b, 0xa8, 0x15, 0x26,
+  0x2a, 0x8b, 0xc2, 0xee, 0x2c, 0x40, 0x32, 0xc8, 0xc2, 0xee, 0xb6, 0x9d,
+  0x0f, 0x09, 0x99, 0xb0, 0x4d, 0x5e, 0xbb, 0xab, 0x92, 0x30, 0x55, 0x31,
+  0xfd, 0xa5, 0x61, 0x3c, 0x6b, 0xd3, 0x73, 0x1a, 0xe6, 0xef, 0x6f, 0xa2,
+  0x6e, 0x98, 0xa9, 0x28, 0xa2, 0x36, 0x71, 0x18, 0x07, 0x39, 0xda, 0x74,
+  0x67, 0x48, 0xab, 0xb6, 0x2d, 0x0c, 0xfd, 0x62, 0x7a, 0x94, 0x0a, 0x61,
+  0xb4, 0x5b, 0xa5, 0x8d, 0x0a, 0xa9, 0x85, 0x90, 0x87, 0x51, 0xd0, 0x49,
+  0xc3, 0x74, 0x18, 0x44, 0x61, 0x16, 0x10, 0x16, 0x41, 0x42, 0xa8, 0xe1,
+  0x37, 0x0d, 0x3b, 0xaa, 0x35, 0x0b, 0x72, 0x7c, 0xc7, 0x4d, 0x08, 0x72,
+  0x03, 0x82, 0xaf, 0xf2, 0x2e, 0x2a, 0x75, 0x43, 0x6a, 0x1c, 0x64, 0xc8,
+  0x4c, 0x29, 0x63, 0x16, 0x61, 0x00, 0x39, 0xaa, 0x74, 0xc3, 0x0e, 0x8a,
+  0x73, 0x0c, 0xb2, 0x4b, 0x18, 0x25, 0x84, 0x43, 0x87, 0x46, 0x45, 0x8f,
+  0xa9, 0x57, 0x2d, 0x47, 0xb5, 0x0c, 0xd5, 0x3a, 0x7e, 0xb5, 0x6c, 0x16,
+  0x25, 0x84, 0x7c, 0x8a, 0x4a, 0x19, 0x2a, 0xa5, 0x41, 0x94, 0x04, 0xed,
+  0x30, 0xa3, 0x2a, 0x39, 0x61, 0x15, 0x25, 0x61, 0x47, 0x46, 0x91, 0xe7,
+  0x54, 0x46, 0xe8, 0x25, 0x43, 0x8d, 0x3d, 0xe8, 0x17, 0xc4, 0x34, 0x62,
+  0xfc, 0x12, 0x1d, 0xb7, 0x41, 0x3b, 0x7f, 0x5f, 0x3b, 0xa9, 0x62, 0x5b,
+  0x15, 0x8b, 0xe2, 0x8c, 0x68, 0x86, 0x2f, 0x27, 0xb7, 0x41, 0x44, 0xa9,
+  0x49, 0x90, 0x10, 0x35, 0x28, 0x9d, 0x85, 0xd9, 0x24, 0x69, 0x85, 0x11,
+  0x27, 0xbb, 0x94, 0x6d, 0xd2, 0xc9, 0x84, 0x6a, 0xc4, 0xa8, 0x3d, 0x09,
+  0x88, 0xb5, 0xf1, 0xb6, 0x43, 0xa3, 0x79, 0x7f, 0x93, 0x44, 0xc4, 0x6a,
+  0x02, 0xd2, 0x21, 0x54, 0x26, 0x00, 0x95, 0x6c, 0x91, 0x7c, 0x7f, 0x13,
+  0x77, 0x80, 0x70, 0x16, 0x46, 0x43, 0x48, 0x40, 0x0a, 0xea, 0x05, 0x44,
+  0x09, 0x30, 0x28, 0xe1, 0x44, 0x87, 0xb2, 0x5a, 0xcc, 0x2f, 0x45, 0xd0,
+  0x91, 0x48, 0x55, 0x17, 0x72, 0x10, 0x27, 0x34, 0xba, 0x28, 0x0d, 0xdb,
+  0xe0, 0x54, 0x4e, 0xb2, 0x91, 0x92, 0x00, 0x45, 0x20, 0x53, 0xc0, 0x95,
+  0x90, 0xc8, 0x21, 0x48, 0x60, 0x73, 0x46, 0xa0, 0x73, 0x24, 0xba, 0xcc,
+  0x85, 0x09, 0x08, 0x4d, 0x3d, 0x46, 0x44, 0xa2, 0x54, 0xa1, 0xe7, 0x44,
+  0x89, 0x04, 0xa6, 0xa8, 0x4f, 0x7d, 0x0a, 0x17, 0x62, 0x12, 0x9d, 0x80,
+  0x51, 0xe4, 0x14, 0x7a, 0xa3, 0xf2, 0x18, 0x38, 0x51, 0x1f, 0x6d, 0x49,
+  0x51, 0x51, 0x17, 0x28, 0xe2, 0x0b, 0x53, 0x08, 0x6d, 0x4b, 0xf2, 0x32,
+  0x49, 0x51, 0x1b, 0x82, 0xad, 0x08, 0xdb, 0x34, 0xe0, 0xda, 0x10, 0xb0,
+  0x88, 0x48, 0x12, 0xc7, 0x04, 0x8c, 0xb2, 0xf3, 0x21, 0xd0, 0xa7, 0xee,
+  0x22, 0xc0, 0x24, 0x86, 0x71, 0x7b, 0xae, 0xca, 0x29, 0xa6, 0x1c, 0x60,
+  0xa5, 0xe8, 0x3f, 0x96, 0x14, 0xfd, 0x97, 0x6d, 0x03, 0x12, 0xb4, 0x9c,
+  0xa8, 0x99, 0x87, 0xf9, 0x96, 0xa0, 0x32, 0x1d, 0x82, 0x84, 0x06, 0x9d,
+  0x91, 0x6c, 0x44, 0xe0, 0x46, 0xdb, 0x24, 0x32, 0xa0, 0x9d, 0x83, 0x7e,
+  0x31, 0x86, 0x85, 0x54, 0xdc, 0xc6, 0x60, 0x14, 0x15, 0x76, 0x98, 0xda,
+  0xc8, 0xc8, 0x95, 0x29, 0xb2, 0x84, 0x4f, 0x08, 0x40, 0x82, 0x86, 0x19,
+  0xab, 0x53, 0xba, 0x8d, 0x43, 0x56, 0x51, 0x43, 0x2e, 0xc2, 0x29, 0x03,
+  0x62, 0x91, 0xa4, 0x72, 0xa1, 0x60, 0x14, 0xa4, 0xa0, 0x76, 0x44, 0x2c,
+  0x4c, 0x69, 0xa8, 0x10, 0x5b, 0x1a, 0x0d, 0xb1, 0x4a, 0xf3, 0x23, 0x86,
+  0x36, 0x49, 0x02, 0xdc, 0xa1, 0xcc, 0x36, 0xa1, 0x01, 0x84, 0xf9, 0xb1,
+  0x28, 0xc8, 0x51, 0x88, 0xe7, 0x48, 0xa5, 0xa2, 0x74, 0x91, 0x92, 0x16,
+  0xc4, 0xe0, 0x36, 0x73, 0x9c, 0xd9, 0x6b, 0x0b, 0x48, 0xd6, 0x58, 0x7e,
+  0xc2, 0x2e, 0x61, 0xd9, 0xa5, 0x4a, 0xc4, 0x02, 0xfe, 0xaf, 0x8b, 0xe6,
+  0x6d, 0xb6, 0x02, 0x0c, 0x92, 0x78, 0x8e, 0x6c, 0x12, 0xdf, 0xa0, 0x03,
+  0x02, 0x83, 0x89, 0x54, 0x92, 0xf1, 0x6f, 0x4e, 0x1d, 0xa7, 0x13, 0x2a,
+  0xcc, 0x87, 0x81, 0x88, 0x49, 0x4e, 0x7f, 0xed, 0x00, 0x52, 0x86, 0xdf,
+  0x0e, 0x29, 0x5c, 0x00, 0x0a, 0x0e, 0x31, 0x58, 0x2a, 0xcc, 0x21, 0x0d,
+  0xd4, 0x69, 0x10, 0x67, 0x10, 0x19, 0xa4, 0xc0, 0x17, 0x90, 0x9d, 0x69,
+  0x83, 0x46, 0x31, 0x2c, 0x08, 0x09, 0x57, 0x67, 0x16, 0x91, 0x70, 0xb0,
+  0xc8, 0xb3, 0x4e, 0x52, 0x1a, 0x10, 0x13, 0x92, 0x6b, 0xf9, 0x65, 0x7e,
+  0x29, 0xa4, 0x88, 0x5b, 0xfc, 0x4b, 0xec, 0x85, 0x10, 0x05, 0x11, 0x6c,
+  0x62, 0x00, 0x88, 0x09, 0x9b, 0xcd, 0x84, 0xeb, 0x10, 0xeb, 0xbb, 0x60,
+  0x11, 0xb1, 0x84, 0xed, 0x41, 0x5b, 0x7e, 0x22, 0xb6, 0x77, 0xac, 0x27,
+  0x29, 0x06, 0xc2, 0x06, 0x4c, 0x30, 0x65, 0x0b, 0x03, 0xf2, 0x21, 0x07,
+  0x46, 0x16, 0xe9, 0x36, 0x75, 0x03, 0xf1, 0x49, 0x66, 0x8c, 0x2e, 0x09,
+  0x38, 0x31, 0x9b, 0xd4, 0x84, 0x30, 0xe8, 0x50, 0x71, 0x2c, 0x4a, 0xc9,
+  0x56, 0x1b, 0xa9, 0xf7, 0x37, 0x59, 0x57, 0xc6, 0x4a, 0x75, 0xb8, 0x39,
+  0xc6, 0x01, 0x65, 0x80, 0x81, 0xea, 0xb2, 0x5d, 0x83, 0xe8, 0x76, 0xa1,
+  0xd4, 0xf4, 0xd7, 0xe5, 0xbf, 0xce, 0x36, 0x21, 0x09, 0x9a, 0x10, 0x6e,
+  0xe9, 0x16, 0x8a, 0x9f, 0x0f, 0x59, 0x20, 0xa0, 0xab, 0xa4, 0x65, 0x54,
+  0xc4, 0x82, 0x22, 0x29, 0x41, 0x0f, 0x22, 0xcb, 0x18, 0xb2, 0xa8, 0x12,
+  0xdd, 0x73, 0xb6, 0x21, 0x34, 0xc2, 0x6d, 0x46, 0x83, 0x00, 0x28, 0xc2,
+  0xa5, 0x0d, 0xdc, 0x52, 0x6a, 0x3a, 0x61, 0x79, 0xdf, 0x52, 0x26, 0x61,
+  0x0e, 0xa1, 0x8d, 0x19, 0xa3, 0x18, 0x3c, 0xc3, 0xef, 0x04, 0xa3, 0xdf,
+  0x42, 0x9c, 0x27, 0x51, 0x6b, 0x4b, 0x3c, 0x89, 0x87, 0x2d, 0x51, 0x00,
+  0x16, 0x13, 0x50, 0x9b, 0xfe, 0xeb, 0x4a, 0xca, 0x72, 0x22, 0x40, 0x85,
+  0x2e, 0x34, 0x6c, 0x0b, 0x69, 0x87, 0x7b, 0x60, 0x8b, 0x11, 0xb3, 0xab,
+  0xca, 0x89, 0xb6, 0x19, 0xff, 0x26, 0x9a, 0xc6, 0xdc, 0x80, 0x7f, 0xe1,
+  0xd5, 0x40, 0x24, 0xea, 0x4e, 0x4c, 0x24, 0x61, 0x10, 0x11, 0x5f, 0x92,
+  0x8e, 0x22, 0x4a, 0xb0, 0x00, 0x31, 0xb3, 0x62, 0xc8, 0x47, 0x06, 0x8b,
+  0x90, 0x48, 0x8a, 0x70, 0x8a, 0xc5, 0x72, 0x00, 0xb5, 0xb6, 0x24, 0xb8,
+  0x84, 0xf0, 0xcd, 0x21, 0x60, 0x90, 0xf9, 0x18, 0x22, 0x69, 0x8a, 0xd8,
+  0xf4, 0x25, 0x10, 0x3a, 0x40, 0x69, 0x43, 0xeb, 0x34, 0x38, 0xd2, 0x42,
+  0xd8, 0x35, 0x20, 0x4b, 0x72, 0xa7, 0x48, 0x4a, 0x73, 0xa8, 0x04, 0x71,
+  0x86, 0x55, 0x4b, 0xff, 0xb2, 0x4d, 0x6a, 0x51, 0x1a, 0x38, 0x65, 0xf8,
+  0xe5, 0xec, 0x16, 0xa4, 0x9a, 0xcc, 0x67, 0x17, 0x24, 0x86, 0x56, 0xeb,
+  0x02, 0x70, 0x89, 0x05, 0x08, 0x67, 0x83, 0xc1, 0xc6, 0x0a, 0x18, 0xf2,
+  0x4a, 0x19, 0x46, 0x1e, 0x6b, 0x4f, 0x80, 0x11, 0xe7, 0xe4, 0xbf, 0xb7,
+  0x9c, 0x24, 0x64, 0xba, 0xdb, 0x3c, 0x81, 0x0c, 0x80, 0x97, 0x09, 0x6c,
+  0x79, 0x86, 0xf1, 0x49, 0x1e, 0x29, 0xef, 0x8c, 0xdd, 0x49, 0x00, 0xcf,
+  0x31, 0x81, 0x34, 0x74, 0x39, 0x23, 0x55, 0x9c, 0x01, 0xde, 0xcc, 0x32,
+  0x18, 0x0f, 0x68, 0x68, 0xc2, 0x72, 0xc8, 0xe4, 0x0d, 0x72, 0x2a, 0x9e,
+  0x41, 0xf7, 0x49, 0x2f, 0xc9, 0x25, 0x45, 0xec, 0x25, 0x02, 0xb6, 0x65,
+  0x51, 0x0c, 0x69, 0x81, 0x6e, 0xb1, 0xe0, 0x10, 0x43, 0x12, 0x96, 0x14,
+  0x22, 0xc8, 0x36, 0xe9, 0x12, 0xbe, 0x09, 0xa8, 0xca, 0x1a, 0x9d, 0x20,
+  0x97, 0xac, 0x1c, 0x0b, 0x55, 0x00, 0x01, 0x27, 0x21, 0x6d, 0x83, 0x64,
+  0x60, 0x01, 0x8b, 0x72, 0xd7, 0xfe, 0x69, 0x72, 0x41, 0xed, 0xa5, 0x24,
+  0x40, 0x6e, 0x0b, 0x52, 0x11, 0x88, 0x91, 0xeb, 0xda, 0x3f, 0xae, 0x1b,
+  0x48, 0x2b, 0x2e, 0x41, 0x7d, 0x52, 0x4f, 0xb6, 0x98, 0x34, 0x14, 0xb0,
+  0x6b, 0x9b, 0xb0, 0xbe, 0xb1, 0x41, 0x23, 0x3e, 0xa6, 0xec, 0xb7, 0x00,
+  0x18, 0x02, 0x4f, 0x58, 0x01, 0x3d, 0x90, 0x0f, 0xce, 0x87, 0xa5, 0x3b,
+  0xe5, 0x18, 0x49, 0x24, 0x3b, 0xe2, 0xdf, 0x18, 0x46, 0x47, 0xc1, 0x4a,
+  0x89, 0x4f, 0x6c, 0x85, 0xac, 0x31, 0x5d, 0xd8, 0x31, 0x88, 0x68, 0x04,
+  0x40, 0x5a, 0x74, 0x63, 0xfe, 0x8d, 0x18, 0xe5, 0x44, 0x5b, 0x39, 0xfc,
+  0xc6, 0xa0, 0x10, 0xe9, 0x79, 0x3c, 0xc9, 0xa0, 0xa5, 0x4c, 0x94, 0x0c,
+  0x22, 0x04, 0x55, 0x63, 0xc5, 0x20, 0xd3, 0x45, 0xf2, 0x0a, 0x2b, 0x0b,
+  0xc7, 0x0a, 0x44, 0xf8, 0x97, 0x00, 0x33, 0x52, 0x31, 0xe7, 0x65, 0x3a,
+  0x60, 0x83, 0x7f, 0x6b, 0xc3, 0x48, 0xb5, 0x18, 0xbf, 0x98, 0xe3, 0x91,
+  0x84, 0xf5, 0x5b, 0x7e, 0x13, 0x96, 0xd9, 0x9c, 0x7b, 0x86, 0x93, 0x89,
+  0x03, 0x04, 0x12, 0x51, 0x57, 0x7b, 0x68, 0x68, 0x5a, 0xac, 0xd1, 0x46,
+  0x63, 0x58, 0x55, 0x31, 0x49, 0x84, 0x3c, 0x42, 0x21, 0xd8, 0x86, 0x14,
+  0xae, 0x0e, 0xd6, 0x82, 0x9e, 0x14, 0x4b, 0x2b, 0x12, 0x50, 0x55, 0x6d,
+  0x82, 0x72, 0x79, 0xcc, 0xc5, 0x23, 0x73, 0x2a, 0x17, 0xc7, 0xcd, 0x96,
+  0x03, 0xce, 0x23, 0x87, 0x40, 0x38, 0xd1, 0xd1, 0x29, 0x82, 0x65, 0x2f,
+  0xf8, 0xd6, 0x77, 0x36, 0xcb, 0x35, 0xce, 0x6e, 0x14, 0x8e, 0xa0, 0x7e,
+  0x4a, 0x11, 0x93, 0x6c, 0x51, 0xd5, 0xd7, 0x3c, 0x57, 0x87, 0xf9, 0xfe,
+  0x65, 0x0c, 0x45, 0xa0, 0x9f, 0xba, 0xc1, 0x34, 0x3a, 0xfb, 0x8c, 0xd7,
+  0x07, 0x54, 0xdf, 0xec, 0x86, 0x2d, 0xba, 0xa3, 0x0a, 0x7c, 0x75, 0xa8,
+  0xfb, 0xbc, 0x3a, 0x3f, 0xdd, 0x8c, 0x9c, 0x0c, 0x67, 0x9a, 0x51, 0x04,
+  0xee, 0x32, 0x4d, 0xf1, 0x0e, 0xbd, 0x56, 0x38, 0x52, 0x5c, 0xe1, 0x82,
+  0x15, 0xe5, 0xe3, 0xc9, 0x77, 0x37, 0x94, 0xb0, 0xad, 0x9d, 0xeb, 0x9d,
+  0x54, 0x66, 0x8f, 0x8e, 0xb3, 0xb5, 0xec, 0x14, 0xf3, 0xd5, 0x73, 0x6f,
+  0x33, 0xda, 0xa9, 0xc6, 0xbc, 0xa0, 0x8c, 0xbe, 0x03, 0x7a, 0x1f, 0x66,
+  0xc5, 0xa1, 0xf8, 0x4a, 0xce, 0x25, 0xd1, 0x3f, 0x34, 0xe3, 0x90, 0x23,
+  0x86, 0x2e, 0xd5, 0xce, 0x95, 0x00, 0x8a, 0x8f, 0x5f, 0x71, 0x0f, 0x41,
+  0x2d, 0x0d, 0x90, 0x8f, 0xcb, 0xf0, 0xce, 0xae, 0xd3, 0x59, 0x72, 0xee,
+  0x9c, 0xfb, 0x60, 0x21, 0xb8, 0xc7, 0xff, 0x62, 0x0a, 0x97, 0x55, 0x92,
+  0x69, 0xb5, 0xb8, 0xd3, 0x64, 0xf2, 0xe6, 0x6e, 0xc5, 0x0c, 0x51, 0x4e,
+  0x8a, 0xba, 0x94, 0x1c, 0x8b, 0xe7, 0x85, 0x3e, 0x42, 0x45, 0xe7, 0x3b,
+  0xfd, 0x97, 0x4a, 0xec, 0xe0, 0x75, 0x6e, 0xed, 0x7c, 0xe7, 0xb3, 0x5e,
+  0x9e, 0xff, 0x1d, 0x30, 0xe3, 0x33, 0x73, 0x3b, 0x67, 0x6a, 0x87, 0xb4,
+  0x37, 0x11, 0xc4, 0x81, 0x58, 0xa9, 0x99, 0xaf, 0x81, 0x4e, 0x35, 0x25,
+  0xa7, 0x51, 0x97, 0xa7, 0x06, 0x92, 0x1b, 0x98, 0x6b, 0xdd, 0xc3, 0xcc,
+  0x66, 0x81, 0xc4, 0xc3, 0xfe, 0xf2, 0xac, 0xc6, 0x04, 0xf4, 0xb2, 0xbf,
+  0x5b, 0x4c, 0xe7, 0x36, 0x5f, 0xf3, 0x7f, 0x76, 0x3b, 0x9c, 0x8e, 0xc6,
+  0x4a, 0x7e, 0xcc, 0xed, 0xa1, 0xb5, 0x73, 0x99, 0x94, 0x90, 0xd0, 0xbc,
+  0x8c, 0xd8, 0x27, 0xbe, 0xc8, 0xfb, 0x14, 0x09, 0xcb, 0x69, 0x7c, 0xc4,
+  0x80, 0x78, 0x1b, 0x39, 0x19, 0xf4, 0x4b, 0xbe, 0x35, 0x76, 0x33, 0x82,
+  0xf8, 0xff, 0xc8, 0x9a, 0x7e, 0x21, 0x8d, 0xa1, 0xd0, 0xa7, 0xcb, 0xc5,
+  0xec, 0x1d, 0xaf, 0xa0, 0xf3, 0x65, 0x30, 0xd4, 0x73, 0x44, 0x63, 0x25,
+  0x2b, 0xa0, 0xc8, 0x22, 0x91, 0x83, 0xe7, 0x2a, 0xb6, 0x4f, 0x2a, 0x88,
+  0xb7, 0xb9, 0x9b, 0x47, 0x1e, 0x8d, 0x42, 0x45, 0x0a, 0xae, 0x31, 0x53,
+  0x48, 0x50, 0xe2, 0x9a, 0x06, 0x97, 0x1b, 0xcb, 0xfe, 0x7c, 0x37, 0x5b,
+  0x7f, 0x35, 0xf0, 0x27, 0xd9, 0x3c, 0x59, 0x6a, 0x72, 0xb2, 0xdb, 0xe6,
+  0xf4, 0x44, 0x14, 0xa7, 0x94, 0xcb, 0xb7, 0x7f, 0xea, 0x73, 0x4f, 0xf8,
+  0x7e, 0x7a, 0x56, 0xac, 0xe2, 0xca, 0x74, 0x43, 0x55, 0xb9, 0x26, 0xa8,
+  0xa6, 0xfa, 0xbc, 0x5d, 0xea, 0xac, 0x86, 0x3b, 0xdb, 0x8f, 0xf1, 0x5f,
+  0x78, 0xfd, 0xbe, 0x86, 0x0d, 0x36, 0x93, 0xfe, 0xfc, 0x9a, 0x60, 0xf8,
+  0x3b, 0x1d, 0x3d, 0xe1, 0x3a, 0x3d, 0xf1, 0xb5, 0xf9, 0xf4, 0x84, 0xec,
+  0xc9, 0xb9, 0x52, 0x4e, 0x06, 0x59, 0x1b, 0xcf, 0xe2, 0xfc, 0x7c, 0x36,
+  0x67, 0xb9, 0x1a, 0xe3, 0x1d, 0x0d, 0x96, 0x8e, 0xaa, 0x0c, 0x8f, 0xb5,
+  0x86, 0x3b, 0x46, 0x50, 0x58, 0x22, 0xc4, 0x07, 0xa9, 0xcc, 0xbe, 0xde,
+  0x9a, 0xda, 0x61, 0xc3, 0xaf, 0x06, 0xe9, 0xa3, 0x0c, 0xd2, 0x2e, 0x21,
+  0x0b, 0xf1, 0xf2, 0xbf, 0x8c, 0xe2, 0xb7, 0xf8, 0xbc, 0xd9, 0xb3, 0xd9,
+  0xf3, 0x3f, 0xbf, 0x74, 0x4a, 0x6a, 0x65, 0x3d, 0x10, 0xe6, 0x95, 0x73,
+  0x77, 0x45, 0xef, 0x21, 0x5f, 0x43, 0x18, 0xcd, 0xa6, 0xc3, 0x37, 0x90,
+  0xf7, 0xd2, 0x97, 0x21, 0xbf, 0xfa, 0xa1, 0x9f, 0xc8, 0x0f, 0xfd, 0xe2,
+  0xbc, 0xd0, 0x68, 0x71, 0x37, 0xff, 0x9f, 0xf4, 0x43, 0x55, 0xae, 0x43,
+  0x14, 0xe6, 0x04, 0xd6, 0xf1, 0xa4, 0x14, 0x37, 0x1a, 0xcb, 0x7e, 0x74,
+  0x40, 0x5d, 0x3f, 0x3a, 0xc5, 0x07, 0x95, 0x78, 0x25, 0x72, 0xa3, 0x3f,
+  0xaa, 0x74, 0x3e, 0x76, 0xe6, 0x8f, 0x03, 0xd7, 0x7e, 0xbc, 0x6a, 0x02,
+  0xe4, 0x9d, 0xef, 0x30, 0xc1, 0x9d, 0x77, 0x58, 0x2f, 0x36, 0xb7, 0xda,
+  0x29, 0xbe, 0x21, 0xed, 0xa0, 0xe0, 0xd9, 0x77, 0x59, 0xf0, 0xa3, 0xa6,
+  0x95, 0x73, 0xb9, 0x8d, 0xd2, 0x57, 0xd3, 0x78, 0xab, 0xf3, 0x5a, 0x8b,
+  0x4b, 0x82, 0xac, 0x3f, 0x1c, 0xba, 0xc2, 0x75, 0xa6, 0xd6, 0xd3, 0xa8,
+  0x67, 0x5f, 0x7e, 0xae, 0x8a, 0x6d, 0xe8, 0x6a, 0xb3, 0xb8, 0x1e, 0x6f,
+  0x26, 0xe3, 0xd5, 0x6f, 0x8e, 0xf6, 0x3b, 0x71, 0x8f, 0xa8, 0x3e, 0xdd,
+  0x76, 0xc2, 0x64, 0x4b, 0x1a, 0xdc, 0x56, 0xf9, 0x9e, 0xe5, 0x5d, 0x0f,
+  0x82, 0x2f, 0x58, 0x52, 0x7c, 0x9f, 0x90, 0x31, 0x43, 0xc5, 0x5d, 0x67,
+  0xca, 0xbb, 0xbc, 0xcc, 0xd3, 0xd3, 0xe2, 0x18, 0x55, 0xb5, 0x9b, 0xe3,
+  0x9a, 0x80, 0xf2, 0x81, 0x88, 0x6a, 0x5f, 0xbe, 0xbe, 0x0c, 0xa8, 0x64,
+  0x0d, 0xcc, 0x2b, 0x0e, 0x9b, 0x61, 0x5e, 0x88, 0xec, 0x5c, 0x94, 0xa2,
+  0xfc, 0x9b, 0xf9, 0x94, 0xcb, 0x9e, 0xbb, 0x40, 0x2e, 0x0f, 0x2c, 0x33,
+  0xe3, 0x74, 0x79, 0xfe, 0xf9, 0xaa, 0x7f, 0xcd, 0x5f, 0x24, 0x80, 0x34,
+  0x64, 0x31, 0x88, 0x19, 0xa7, 0x83, 0x15, 0x49, 0xbd, 0xcb, 0xea, 0x0a,
+  0xb6, 0x3a, 0xac, 0x2e, 0x4e, 0xda, 0x54, 0xc5, 0xb5, 0x41, 0xaa, 0x74,
+  0x0f, 0x4c, 0xed, 0x7c, 0xb1, 0x12, 0xc8, 0x8a, 0x5d, 0x05, 0xf6, 0x25,
+  0xeb, 0xb0, 0xa1, 0x81, 0xb8, 0xa9, 0xc9, 0xfc, 0x3f, 0x3d, 0x59, 0xfe,
+  0x47, 0x02, 0xb2, 0xe2, 0xeb, 0x8f, 0x75, 0x39, 0x28, 0x2b, 0xa9, 0x2a,
+  0x8b, 0x92, 0x3b, 0x0d, 0xad, 0x10, 0x3b, 0x16, 0xba, 0xaf, 0xcc, 0x6e,
+  0x91, 0xfd, 0x33, 0x57, 0xb3, 0xc3, 0xe0, 0xb1, 0x73, 0xd7, 0x94, 0x5f,
+  0x52, 0x91, 0xe8, 0xc8, 0x18, 0xdd, 0x37, 0x0b, 0x1e, 0xdc, 0x6f, 0xb0,
+  0xf5, 0xa2, 0x56, 0xa5, 0x9f, 0xb8, 0x27, 0xd4, 0x97, 0xb0, 0xb2, 0x92,
+  0x7a, 0x94, 0xaf, 0x7e, 0x81, 0x06, 0x17, 0xe8, 0x39, 0x3f, 0xbe, 0x68,
+  0x10, 0xc2, 0xc5, 0xb7, 0x57, 0xfa, 0xc2, 0xe5, 0x82, 0x90, 0x3b, 0x2a,
+  0xd5, 0x60, 0x9f, 0xd3, 0x9d, 0xf0, 0x72, 0xc5, 0x8e, 0x2b, 0x2d, 0x0b,
+  0x6b, 0x99, 0x8c, 0xcf, 0xfb, 0x2b, 0x3b, 0x58, 0xe7, 0x8c, 0x7f, 0x0d,
+  0xce, 0xed, 0xc1, 0x1a, 0x40, 0x73, 0x9d, 0xf1, 0x27, 0x18, 0xb0, 0xc7,
+  0xe9, 0x1d, 0xd6, 0xef, 0x50, 0x97, 0xf7, 0x85, 0xf8, 0xd4, 0x5d, 0xdf,
+  0x94, 0x70, 0x6c, 0x7d, 0xe2, 0x01, 0x5c, 0xee, 0x31, 0x57, 0xfe, 0x03,
+  0xa4, 0xe7, 0xd5, 0x2d, 0xc9, 0xed, 0x83, 0xc2, 0xb3, 0x96, 0x1a, 0x0f,
+  0xca, 0x4e, 0x05, 0x77, 0x64, 0xed, 0x63, 0x57, 0x72, 0x1e, 0x17, 0x4d,
+  0xa4, 0x71, 0x11, 0x4d, 0x20, 0xfd, 0x53, 0x44, 0x13, 0xf1, 0xc7, 0xc6,
+  0x12, 0xfe, 0x75, 0x5d, 0x6e, 0x08, 0x91, 0x84, 0x9d, 0x4c, 0x75, 0xc2,
+  0x3c, 0xee, 0xa7, 0xbc, 0x50, 0xd6, 0x52, 0xfc, 0x4e, 0xa3, 0x13, 0xd0,
+  0x7f, 0x6d, 0x55, 0xe4, 0xe5, 0x61, 0x1b, 0x49, 0xbf, 0x92, 0xfe, 0xcf,
+  0xe6, 0xb5, 0xa4, 0x9a, 0xcd, 0xd0, 0x40, 0xbc, 0x4a, 0x58, 0xe2, 0xcf,
+  0x5c, 0x48, 0x41, 0x55, 0x77, 0xfc, 0x46, 0x20, 0xff, 0x87, 0x17, 0x65,
+  0x74, 0x29, 0xf0, 0x40, 0x38, 0xa3, 0xd2, 0x20, 0xdd, 0x0d, 0x32, 0x4e,
+  0x3d, 0x33, 0xf8, 0x5a, 0x36, 0x3d, 0x6b, 0x19, 0x21, 0x81, 0x3e, 0xaa,
+  0x16, 0x31, 0x1d, 0x9e, 0xdb, 0x60, 0x7c, 0xb3, 0x58, 0x86, 0xb3, 0x85,
+  0x7c, 0xc7, 0x12, 0x4e, 0x56, 0xe3, 0xab, 0xb3, 0xfa, 0x49, 0x9d, 0xdc,
+  0xbe, 0x58, 0xd3, 0xc1, 0x7f, 0x61, 0x9d, 0xc8, 0xc4, 0x09, 0x8f, 0x8d,
+  0xd3, 0x13, 0x8e, 0xed, 0xed, 0x9d, 0x76, 0x3b, 0x31, 0x7b, 0x0a, 0x17,
+  0x1e, 0x4b, 0xcc, 0x8e, 0x6b, 0x86, 0x2b, 0x02, 0xf7, 0xf8, 0xbf, 0x11,
+  0xb8, 0x3f, 0x52, 0xcd, 0xa2, 0xb4, 0x50, 0x33, 0xa4, 0xff, 0xab, 0x6a,
+  0xe6, 0x87, 0xec, 0xfd, 0x15, 0x11, 0x92, 0x6f, 0x72, 0xac, 0xb9, 0xb1,
+  0x32, 0xde, 0xfa, 0x05, 0xed, 0xa0, 0xad, 0xe8, 0xcf, 0x8f, 0xac, 0x21,
+  0xe0, 0x2f, 0xb2, 0xaa, 0xf8, 0xf9, 0xcf, 0x0b, 0xf5, 0x9c, 0x22, 0x84,
+  0xa3, 0x7d, 0xf1, 0xb4, 0xb6, 0x8e, 0xae, 0x79, 0x94, 0x2f, 0xa6, 0xf6,
+  0x1b, 0x47, 0xde, 0x5b, 0xf3, 0x38, 0xd3, 0x18, 0xff, 0x62, 0x4d, 0xa3,
+  0xbe, 0x76, 0xd0, 0xe5, 0x53, 0x1c, 0x85, 0x6d, 0xbc, 0x56, 0x08, 0x3a,
+  0x14, 0x4d, 0x38, 0x13, 0xac, 0x24, 0x4c, 0x79, 0xc7, 0x45, 0x87, 0xe6,
+  0x47, 0xcf, 0x8a, 0x59, 0x15, 0xee, 0x0d, 0x9c, 0x78, 0x13, 0x2f, 0xb4,
+  0x0f, 0x92, 0x7f, 0x94, 0x27, 0x4f, 0xdd, 0x6d, 0xba, 0x33, 0x9f, 0x6a,
+  0x4f, 0xc2, 0x56, 0x54, 0x65, 0xd2, 0x0a, 0x4e, 0xf9, 0x81, 0x0a, 0x14,
+  0xd6, 0xd3, 0x9a, 0xd7, 0xf3, 0xf1, 0xdb, 0xa5, 0x6c, 0xe1, 0x65, 0xc6,
+  0xef, 0x31, 0x77, 0x0e, 0xc0, 0xaf, 0x69, 0x52, 0xe1, 0xd8, 0xb2, 0x43,
+  0xa7, 0x23, 0x7a, 0x32, 0x82, 0x1d, 0x84, 0xfd, 0xeb, 0xfe, 0x74, 0x7e,
+  0xa0, 0x5d, 0x95, 0x55, 0x17, 0xe2, 0x33, 0x96, 0x37, 0x7e, 0xf1, 0xc6,
+  0x34, 0xfd, 0xd5, 0x98, 0xfe, 0xb2, 0x8c, 0xe9, 0xab, 0xf1, 0x06, 0xe7,
+  0x0a, 0x3d, 0x18, 0x6c, 0xea, 0x2a, 0x8f, 0x9d, 0xa9, 0xb4, 0x6a, 0x87,
+  0x4c, 0x22, 0x4a, 0x0d, 0x77, 0x4c, 0x73, 0xa4, 0xec, 0x4d, 0xb4, 0x56,
+  0xc8, 0x9d, 0x8b, 0xe5, 0x6b, 0xa5, 0x20, 0xfd, 0x81, 0x49, 0xea, 0xce,
+  0x2c, 0xb9, 0x14, 0xaf, 0x1b, 0x52, 0x1c, 0x14, 0xb5, 0x57, 0xd2, 0x87,
+  0x8f, 0x82, 0xdc, 0x43, 0x20, 0x1b, 0x81, 0xe7, 0x3c, 0x03, 0x6f, 0x3d,
+  0x38, 0x49, 0xaa, 0x26, 0x91, 0xbe, 0x09, 0xbe, 0x22, 0xb2, 0xdf, 0x9d,
+  0xca, 0x97, 0x16, 0x0c, 0xcd, 0x59, 0x29, 0xa5, 0x85, 0xdd, 0xe5, 0xfe,
+  0xb5, 0x7b, 0x7d, 0x62, 0x40, 0x31, 0xa9, 0xc2, 0x27, 0x4e, 0x0a, 0xe7,
+  0x0c, 0xf5, 0x57, 0xd8, 0x25, 0x2b, 0xb6, 0x05, 0x8b, 0x25, 0x30, 0x13,
+  0xc5, 0x84, 0xd2, 0xbb, 0x90, 0xb7, 0x64, 0xe0, 0x76, 0x66, 0x7c, 0xb3,
+  0x6b, 0xd7, 0x1a, 0x3a, 0xa6, 0xc0, 0xdc, 0x3c, 0xa0, 0xf3, 0x4a, 0x37,
+  0x31, 0xec, 0xb3, 0x31, 0xd6, 0x62, 0x78, 0xb9, 0x55, 0xb7, 0x67, 0xa8,
+  0xb2, 0x51, 0x2e, 0xdb, 0x22, 0xbf, 0xab, 0x4a, 0x2c, 0x0e, 0x58, 0x3c,
+  0xf7, 0x15, 0xee, 0x67, 0xe7, 0xb2, 0x5e, 0xfc, 0x3f, 0x9c, 0xc9, 0xe6,
+  0x48, 0xa5, 0x5f, 0xb9, 0xfc, 0x3f, 0xc4, 0xe5, 0xcf, 0x71, 0x57, 0xc5,
+  0xeb, 0xbf, 0x7c, 0x80, 0xcb, 0x72, 0x66, 0x98, 0xc6, 0x61, 0x35, 0x9e,
+  0xd1, 0xc4, 0x6f, 0x8b, 0x4f, 0xff, 0x39, 0x2e, 0x60, 0x9c, 0xbc, 0xae,
+  0xfd, 0x05, 0xc3, 0xdd, 0x17, 0x0e, 0xee, 0xd2, 0x1b, 0x1f, 0xc4, 0x39,
+  0x58, 0xbc, 0x95, 0xe5, 0x37, 0x90, 0x0e, 0x96, 0xe2, 0x33, 0x9b, 0xcb,
+  0xef, 0x96, 0xce, 0x6a, 0x56, 0xa8, 0xd6, 0x14, 0xc9, 0xcc, 0x67, 0xef,
+  0x14, 0x2e, 0xd3, 0xd8, 0x85, 0xec, 0xad, 0x0d, 0x75, 0xd5, 0x24, 0xc8,
+  0xbc, 0xc5, 0xa1, 0xe2, 0x06, 0x0e, 0x3f, 0xaa, 0x71, 0xf2, 0x75, 0x68,
+  0x53, 0xce, 0x31, 0x37, 0xb2, 0x69, 0xf9, 0xa8, 0x2a, 0xed, 0xec, 0xbc,
+  0xf2, 0x19, 0x3b, 0x11, 0x4c, 0xf1, 0xfa, 0xd4, 0xb9, 0x32, 0x50, 0x6e,
+  0x07, 0xdc, 0xb9, 0x59, 0xb1, 0xaa, 0x8e, 0x7b, 0xa9, 0xa0, 0x92, 0x2c,
+  0x73, 0x79, 0xed, 0x45, 0xbd, 0x7e, 0xa9, 0xb3, 0xcc, 0x9d, 0xcf, 0xfa,
+  0x11, 0x77, 0x36, 0xe3, 0xca, 0x66, 0x53, 0xcc, 0x37, 0x40, 0xbb, 0x19,
+  0x76, 0xf7, 0xbb, 0xd7, 0x89, 0x0d, 0xe6, 0xdc, 0x5c, 0xfd, 0xe0, 0x8d,
+  0x50, 0xb2, 0x26, 0x44, 0x2f, 0x49, 0xdd, 0xd9, 0x94, 0x7f, 0xe7, 0xaf,
+  0xa7, 0x6b, 0xe6, 0x5e, 0x32, 0x7f, 0x94, 0xce, 0x3a, 0x5b, 0xc5, 0x12,
+  0x1a, 0x84, 0x92, 0x85, 0xf0, 0x81, 0x75, 0xb5, 0xaa, 0x65, 0xf9, 0xe2,
+  0x34, 0x9c, 0xda, 0xcf, 0xa6, 0x42, 0x7f, 0x7c, 0xf5, 0x95, 0xfa, 0xcc,
+  0x3d, 0xf7, 0xf5, 0x21, 0x4d, 0x5a, 0xee, 0xbe, 0x7d, 0xc3, 0x72, 0xb8,
+  0x8f, 0xab, 0x2c, 0x08, 0x9e, 0x57, 0xef, 0x2e, 0x58, 0xee, 0x92, 0x40,
+  0x1d, 0x55, 0x8d, 0xdd, 0x9e, 0xbb, 0xfd, 0xf3, 0x0d, 0xdd, 0x76, 0xf1,
+  0xf1, 0xa3, 0xf6, 0x4f, 0x1a, 0x7f, 0xc4, 0xa0, 0xf7, 0x8d, 0x59, 0xbc,
+  0xd0, 0xcf, 0x3a, 0xe6, 0x83, 0x3c, 0xe3, 0xc3, 0x63, 0x76, 0x0e, 0xff,
+  0xfe, 0xb1, 0x63, 0xc6, 0xb1, 0xe5, 0x3f, 0xdf, 0x70, 0x5f, 0xf4, 0x57,
+  0x23, 0x7e, 0x93, 0xf6, 0x97, 0xcf, 0x3f, 0x7e, 0xc0, 0xf6, 0x6c, 0xf6,
+  0x47, 0x09, 0x75, 0x91, 0x53, 0xc4, 0xc9, 0x93, 0x95, 0x17, 0x95, 0x17,
+  0xb7, 0x88, 0xa9, 0xe2, 0x65, 0x91, 0xfb, 0x89, 0x84, 0xb7, 0xeb, 0xa5,
+  0x7a, 0xa1, 0xdc, 0x26, 0x69, 0x86, 0xb3, 0x18, 0xbd, 0x3b, 0xc7, 0xb7,
+  0x43, 0x9b, 0x1b, 0xb2, 0x34, 0xff, 0x0f, 0x80, 0xae, 0xec, 0x9a, 0xe5,
+  0xb0, 0x00, 0x00
+};
+
+const ElegantOTAAsset elegantota_assets[] = {
+  { "/update", "text/html", asset_0, 12195, "\"5a28bd93e1d2c83b1021970ae7667e05\"" },
+};
+
+const size_t elegantota_assets_count = sizeof(elegantota_assets) / sizeof(elegantota_assets[0]);
@@ -0,0 +1,42 @@
+#ifndef ElegantOTAAssets_h
+#define ElegantOTAAssets_h
+
+#include "Arduino.h"
+
+/**
+ * @brief a gzipped file of the UI, generated into src/ElegantOTAAssets.cpp by scripts/generate_hex.py
+ *
+ * data is a 4 byte aligned PROGMEM array, on ESP8266 it stays in flash and has to be
+ * read with memcpy_P/pgm_read_*. etag is the quoted md5 of the gzipped bytes.
+ */
+struct ElegantOTAAsset {
+  const char *    path;
+  const char *    contentType;
+  const uint8_t * data;
+  uint32_t        len;
+  const char *    etag;
+};
+
+extern const ElegantOTAAsset elegantota_assets[];
+extern const size_t elegantota_assets_count;
+
+/**
+ * @brief the asset served at path, NULL if there is none
+ */
+inline const ElegantOTAAsset * elegantota_find_asset(const char *path) {
+  for (size_t i = 0; i < elegantota_assets_count; i++) {
+    if (strcmp(elegantota_assets[i].path, path) == 0) return &elegantota_assets[i];
+  }
+  return NULL;
+}
+
+/**
+ * @brief bytes of all assets together, all of them in flash
+ */
+inline size_t elegantota_assets_size() {
+  size_t total = 0;
+  for (size_t i = 0; i < elegantota_assets_count; i++) total += elegantota_assets[i].len;
+  return total;
+}
+
+#endif
@@ -0,0 +1,322 @@
+#include "ElegantOTABlocks.h"
+
+#if defined(ESP8266)
+  #include "Updater.h"
+  #include "eboot_command.h"
+#elif defined(ESP32)
+  #include "esp_ota_ops.h"
+#endif
+
+static size_t bitmapLen(uint32_t bits) {
+  return (bits + 7) / 8;
+}
+
+static bool validBlockLen(uint16_t blockLen) {
+  return blockLen >= 256 && blockLen <= ELEGANTOTA_MULTICAST_BLOCK && blockLen % 16 == 0 && ElegantOTABlocks::SECTOR_SIZE % blockLen == 0;
+}
+
+size_t ElegantOTABlocks::arenaSize(uint32_t size, uint16_t blockLen, uint8_t groupLen, bool external) {
+  // begin() refuses the block size before it takes anything
+  if (!validBlockLen(blockLen)) {
+    return 0;
+  }
+  if (!external) {
+    // the flash API reads and writes these
+    return 2 * ElegantOTAArena::align(blockLen);
+  }
+  uint32_t sectors = (size + SECTOR_SIZE - 1) / SECTOR_SIZE;
+  size_t len = ElegantOTAArena::align(bitmapLen((size + blockLen - 1) / blockLen)) + ElegantOTAArena::align(bitmapLen(sectors));
+  if (groupLen) len += ElegantOTAArena::align((size_t)blockLen * ELEGANTOTA_MULTICAST_FEC_SLOTS);
+  return len;
+}
+
+bool ElegantOTABlocks::begin(uint32_t size, uint16_t blockLen, uint8_t groupLen, ElegantOTAArena *arena) {
+  this->end();
+  if (size == 0 || !validBlockLen(blockLen)) {
+    _error = "Invalid block size";
+    return false;
+  }
+
+  uint32_t rounded = (size + SECTOR_SIZE - 1) & ~(SECTOR_SIZE - 1);
+  #if defined(ESP32)
+    _partition = esp_ota_get_next_update_partition(NULL);
+    if (_partition == NULL) {
+      _error = "No update partition";
+      return false;
+    }
+    if (rounded > _partition->size) {
+      _error = "Not enough space";
+      return false;
+    }
+  #elif defined(ESP8266)
+    // the space Updater::begin() would use, right below the filesystem
+    uint32_t sketch = (ESP.getSketchSize() + SECTOR_SIZE - 1) & ~(SECTOR_SIZE - 1);
+    uint32_t end = (uint32_t)FS_start - 0x40200000;
+    _address = end > rounded ? end - rounded : 0;
+    if (_address < sketch) {
+      _error = "Not enough space";
+      return false;
+    }
+  #endif
+
+  _size = size;
+  _block_len = blockLen;
+  _group_len = groupLen;
+  _blocks = (size + blockLen - 1) / blockLen;
+  _missing = _blocks;
+  _owned = arena == NULL;
+  if (_owned) {
+    _have = (uint8_t *)malloc(bitmapLen(_blocks));
+    _erased = (uint8_t *)malloc(bitmapLen(rounded / SECTOR_SIZE));
+    _buf = (uint8_t *)malloc(blockLen);
+    _tmp = (uint8_t *)malloc(blockLen);
+    _parity = groupLen ? (uint8_t *)malloc((size_t)blockLen * ELEGANTOTA_MULTICAST_FEC_SLOTS) : NULL;
+  } else {
+    _have = (uint8_t *)arena->alloc(bitmapLen(_blocks), true);
+    _erased = (uint8_t *)arena->alloc(bitmapLen(rounded / SECTOR_SIZE), true);
+    _buf = (uint8_t *)arena->alloc(blockLen, false);
+    _tmp = (uint8_t *)arena->alloc(blockLen, false);
+    _parity = groupLen ? (uint8_t *)arena->alloc((size_t)blockLen * ELEGANTOTA_MULTICAST_FEC_SLOTS, true) : NULL;
+  }
+  if (_have == NULL || _erased == NULL || _buf == NULL || _tmp == NULL || (groupLen && _parity == NULL)) {
+    this->end();
+    _error = "Not enough memory";
+    return false;
+  }
+  memset(_have, 0, bitmapLen(_blocks));
+  memset(_erased, 0, bitmapLen(rounded / SECTOR_SIZE));
+  return true;
+}
+
+void ElegantOTABlocks::end() {
+  // arena buffers are released with the arena
+  if (_owned) {
+    free(_have);
+    free(_erased);
+    free(_buf);
+    free(_tmp);
+    free(_parity);
+  }
+  _owned = false;
+  _have = _erased = _buf = _tmp = _parity = NULL;
+  for (size_t i = 0; i < ELEGANTOTA_MULTICAST_FEC_SLOTS; i++) _parity_group[i] = NO_GROUP;
+  _size = _blocks = _missing = _recovered = 0;
+  _error = NULL;
+  #if defined(ESP32)
+    _partition = NULL;
+  #elif defined(ESP8266)
+    _address = 0;
+  #endif
+}
+
+bool ElegantOTABlocks::resume(uint32_t bytes) {
+  if (_have == NULL || _missing != _blocks || bytes > _size || (bytes % SECTOR_SIZE && bytes != _size)) {
+    _error = "Invalid resume offset";
+    return false;
+  }
+  // the sector holding bytes is erased again when its first block arrives
+  uint32_t count = bytes / _block_len;
+  if (bytes == _size) count = _blocks;
+  for (uint32_t i = 0; i < count; i++) _have[i >> 3] |= 1 << (i & 7);
+  for (uint32_t i = 0; i < (bytes + SECTOR_SIZE - 1) / SECTOR_SIZE; i++) _erased[i >> 3] |= 1 << (i & 7);
+  _missing -= count;
+  return true;
+}
+
+size_t ElegantOTABlocks::blockLen(uint32_t index) const {
+  return index + 1 < _blocks ? _block_len : _size - index * _block_len;
+}
+
+bool ElegantOTABlocks::data(uint32_t index, const uint8_t *payload, size_t len) {
+  if (_have == NULL || index >= _blocks || len != this->blockLen(index) || this->has(index)) {
+    return true;
+  }
+  if (!this->writeBlock(index, payload, len)) {
+    return false;
+  }
+  return _group_len == 0 || this->recover(index / _group_len);
+}
+
+bool ElegantOTABlocks::repair(uint32_t group, const uint8_t *payload, size_t len) {
+  if (_parity == NULL || len != _block_len || (uint64_t)group * _group_len >= _blocks) {
+    return true;
+  }
+  size_t slot = group % ELEGANTOTA_MULTICAST_FEC_SLOTS;
+  if (_parity_group[slot] == group) {
+    return true;
+  }
+  // a newer group takes the slot over, the older one waits for the repair round
+  memcpy(_parity + slot * _block_len, payload, len);
+  _parity_group[slot] = group;
+  return this->recover(group);
+}
+
+bool ElegantOTABlocks::recover(uint32_t group) {
+  size_t slot = group % ELEGANTOTA_MULTICAST_FEC_SLOTS;
+  if (_parity_group[slot] != group) {
+    return true;
+  }
+  uint32_t first = group * _group_len;
+  uint32_t last = first + _group_len < _blocks ? first + _group_len : _blocks;
+  uint32_t lost = _blocks;
+  for (uint32_t i = first; i < last; i++) {
+    if (this->has(i)) continue;
+    if (lost != _blocks) return true;  // more than one block missing
+    lost = i;
+  }
+  _parity_group[slot] = NO_GROUP;
+  if (lost == _blocks) {
+    return true;
+  }
+
+  // the lost block is the parity XOR all other blocks of the group
+  memcpy(_buf, _parity + slot * _block_len, _block_len);
+  for (uint32_t i = first; i < last; i++) {
+    if (i == lost) continue;
+    size_t len = this->blockLen(i);
+    if (!this->readBlock(i, _tmp)) return false;
+    for (size_t j = 0; j < len; j++) _buf[j] ^= _tmp[j];
+  }
+  _recovered++;
+  return this->writeBlock(lost, _buf, this->blockLen(lost));
+}
+
+bool ElegantOTABlocks::writeBlock(uint32_t index, const uint8_t *payload, size_t len) {
+  if (onBlock != NULL && !onBlock(index, payload, len)) {
+    _error = NULL;
+    return false;
+  }
+  // writes are padded to 16 bytes for encrypted flash, the padding lies behind the image
+  if (payload != _buf) memcpy(_buf, payload, len);
+  size_t padded = (len + 15) & ~15;
+  memset(_buf + len, 0xFF, padded - len);
+
+  // blockLen divides the sector size, a block never spans two sectors
+  uint32_t offset = index * _block_len;
+  uint32_t sector = offset / SECTOR_SIZE;
+  if (!(_erased[sector >> 3] & (1 << (sector & 7)))) {
+    if (!this->flashErase(sector)) {
+      _error = "Flash erase failed";
+      return false;
+    }
+    _erased[sector >> 3] |= 1 << (sector & 7);
+  }
+  if (!this->flashWrite(offset, _buf, padded)) {
+    _error = "Flash write failed";
+    return false;
+  }
+  _have[index >> 3] |= 1 << (index & 7);
+  _missing--;
+  return true;
+}
+
+bool ElegantOTABlocks::readBlock(uint32_t index, uint8_t *data) {
+  // ESP8266 reads whole words, the block buffers are multiples of 16 bytes
+  if (!this->flashRead(index * _block_len, data, (this->blockLen(index) + 3) & ~3)) {
+    _error = "Flash read failed";
+    return false;
+  }
+  return true;
+}
+
+uint32_t ElegantOTABlocks::nextMissing(uint32_t from) const {
+  for (uint32_t i = from; i < _blocks; i++) {
+    if ((i & 7) == 0 && _have[i >> 3] == 0xFF) {
+      i += 7;
+      continue;
+    }
+    if (!this->has(i)) return i;
+  }
+  return _blocks;
+}
+
+uint32_t ElegantOTABlocks::nextPresent(uint32_t from) const {
+  for (uint32_t i = from; i < _blocks; i++) {
+    if ((i & 7) == 0 && _have[i >> 3] == 0) {
+      i += 7;
+      continue;
+    }
+    if (this->has(i)) return i;
+  }
+  return _blocks;
+}
+
+bool ElegantOTABlocks::beginCommit() {
+  if (!this->complete()) {
+    _error = "Image incomplete";
+    return false;
+  }
+  _verified = 0;
+  _md5.begin();
+  return true;
+}
+
+ElegantOTABlocks::Commit ElegantOTABlocks::commitStep(const char *md5, uint32_t count) {
+  // read back what the flash holds, a corrupted or injected block fails here
+  for (; count && _verified < _blocks; count--, _verified++) {
+    if (!this->readBlock(_verified, _tmp)) return COMMIT_FAILED;
+    _md5.add(_tmp, this->blockLen(_verified));
+  }
+  if (_verified < _blocks) return COMMIT_RUNNING;
+  _md5.calculate();
+  char digest[33];
+  _md5.getChars(digest);
+  if (md5 == NULL || strcasecmp(digest, md5) != 0) {
+    _error = "MD5 Check Failed";
+    return COMMIT_FAILED;
+  }
+  return this->activate() ? COMMIT_DONE : COMMIT_FAILED;
+}
+
+bool ElegantOTABlocks::activate() {
+  if (!this->complete()) {
+    _error = "Image incomplete";
+    return false;
+  }
+  #if defined(ESP32)
+    // verifies the image before it becomes the boot partition
+    if (esp_ota_set_boot_partition(_partition) != ESP_OK) {
+      _error = "Image is not bootable";
+      return false;
+    }
+  #elif defined(ESP8266)
+    // eboot copies the image over the sketch at the next boot, as after Update.end()
+    eboot_command ebcmd;
+    ebcmd.action = ACTION_COPY_RAW;
+    ebcmd.args[0] = _address;
+    ebcmd.args[1] = 0x00000;
+    ebcmd.args[2] = _size;
+    eboot_command_write(&ebcmd);
+  #endif
+  return true;
+}
+
+bool ElegantOTABlocks::flashErase(uint32_t sector) {
+  #if defined(ESP32)
+    return esp_partition_erase_range(_partition, sector * SECTOR_SIZE, SECTOR_SIZE) == ESP_OK;
+  #elif defined(ESP8266)
+    return ESP.flashEraseSector(_address / SECTOR_SIZE + sector);
+  #else
+    return false;
+  #endif
+}
+
+bool ElegantOTABlocks::flashWrite(uint32_t offset, const uint8_t *data, size_t len) {
+  #if defined(ESP32)
+    return esp_partition_write(_partition, offset, data, len) == ESP_OK;
+  #elif defined(ESP8266)
+    return ESP.flashWrite(_address + offset, (const uint32_t *)data, len);
+  #else
+    return false;
+  #endif
+}
+
+bool ElegantOTABlocks::flashRead(uint32_t offset, uint8_t *data, size_t len) {
+  #if defined(ESP32)
+    return esp_partition_read(_partition, offset, data, len) == ESP_OK;
+  #elif defined(ESP8266)
+    return ESP.flashRead(_address + offset, (uint32_t *)data, len);
+  #else
+    return false;
+  #endif
+}
@@ -0,0 +1,167 @@
+#ifndef ElegantOTABlocks_h
+#define ElegantOTABlocks_h
+
+#include "Arduino.h"
+#include <functional>
+#include "ElegantOTAArena.h"
+#include "MD5Builder.h"
+
+#if defined(ESP32)
+  #include "esp_partition.h"
+#endif
+
+// largest block of a multicast transfer, the receive buffers are sized for it
+#ifndef ELEGANTOTA_MULTICAST_BLOCK
+  #define ELEGANTOTA_MULTICAST_BLOCK 1024
+#endif
+
+// parity blocks kept for groups that still miss more than one block
+#ifndef ELEGANTOTA_MULTICAST_FEC_SLOTS
+  #define ELEGANTOTA_MULTICAST_FEC_SLOTS 2
+#endif
+
+/**
+ * @brief writes a firmware image that arrives as numbered blocks in any order
+ *
+ * The Update object only appends, so the blocks go straight to the update partition:
+ * on ESP32 through the partition API, on ESP8266 to the free space below the
+ * filesystem that Updater would use, with the eboot copy command written at activate().
+ * A sector is erased when the first block inside it arrives.
+ *
+ * Blocks are grouped, groupLen consecutive blocks share one parity block (their XOR,
+ * the last block zero padded). A group missing a single block gets it back from the
+ * parity and the other blocks, which are read back from flash, so only the parity
+ * blocks need RAM. Groups missing more are left for a repair round of the sender,
+ * nextMissing() lists them.
+ */
+class ElegantOTABlocks {
+  public:
+    static const uint32_t SECTOR_SIZE = 4096;
+    static const uint32_t NO_GROUP = 0xFFFFFFFF;
+
+    /**
+     * @brief called with every block before it is written, also with recovered ones
+     * @return false refuses the image
+     */
+    std::function<bool(uint32_t index, const uint8_t *data, size_t len)> onBlock = NULL;
+
+    /**
+     * @brief allocate the bookkeeping and select the update partition
+     * @param size image size in bytes
+     * @param blockLen block size, a multiple of 16 that divides SECTOR_SIZE, at most ELEGANTOTA_MULTICAST_BLOCK
+     * @param groupLen blocks per parity block, 0 without parity
+     * @param arena buffers are taken from it, reserved with arenaSize(), the heap is used without
+     */
+    bool begin(uint32_t size, uint16_t blockLen, uint8_t groupLen, ElegantOTAArena *arena = NULL);
+    void end();
+
+    /**
+     * @brief bytes begin() takes from the internal or the external region of an arena
+     */
+    static size_t arenaSize(uint32_t size, uint16_t blockLen, uint8_t groupLen, bool external);
+
+    /**
+     * @brief take the first bytes as written, right after begin(), e.g. after a reboot
+     * @param bytes a multiple of SECTOR_SIZE or the image size
+     */
+    bool resume(uint32_t bytes);
+
+    /**
+     * @brief write a data block, duplicates and blocks of a wrong size are ignored
+     * @return false on a flash error or a block refused by onBlock
+     */
+    bool data(uint32_t index, const uint8_t *payload, size_t len);
+
+    /**
+     * @brief take the parity block of a group
+     * @return false if recovering a block failed
+     */
+    bool repair(uint32_t group, const uint8_t *payload, size_t len);
+
+    bool active() const { return _have != NULL; }
+    bool complete() const { return _have != NULL && _missing == 0; }
+    uint32_t blocks() const { return _blocks; }
+    uint16_t blockSize() const { return _block_len; }
+    uint32_t missing() const { return _missing; }
+    uint32_t recovered() const { return _recovered; }
+    uint32_t size() const { return _size; }
+
+    /**
+     * @brief length of a block, only the last one is shorter than blockSize()
+     */
+    size_t blockLen(uint32_t index) const;
+
+    /**
+     * @brief read a written block back from flash
+     * @param data buffer of blockSize() bytes
+     */
+    bool readBlock(uint32_t index, uint8_t *data);
+
+    /**
+     * @brief index of the first missing block at or after from, blocks() if there is none
+     */
+    uint32_t nextMissing(uint32_t from) const;
+
+    /**
+     * @brief index of the first block at or after from that is present, blocks() if there is none
+     */
+    uint32_t nextPresent(uint32_t from) const;
+
+    enum Commit : uint8_t { COMMIT_RUNNING, COMMIT_DONE, COMMIT_FAILED };
+
+    /**
+     * @brief start reading the written image back for commitStep()
+     * @return false if blocks are missing
+     */
+    bool beginCommit();
+
+    /**
+     * @brief read the next count blocks back, after the last one check the MD5 and make it the boot image
+     * @param md5 expected MD5 as 32 hex digits
+     */
+    Commit commitStep(const char *md5, uint32_t count);
+
+    /**
+     * @brief make the complete image the boot image without reading it back
+     */
+    bool activate();
+
+    /**
+     * @brief the reason of the last failure, NULL if onBlock refused a block
+     */
+    const char * error() const { return _error; }
+
+  private:
+    uint32_t  _size = 0;
+    uint32_t  _blocks = 0;
+    uint32_t  _missing = 0;
+    uint32_t  _recovered = 0;
+    uint16_t  _block_len = 0;
+    uint8_t   _group_len = 0;
+    uint32_t  _verified = 0;      // blocks read back by commitStep()
+    uint8_t * _have = NULL;       // bit per block
+    uint8_t * _erased = NULL;     // bit per sector
+    uint8_t * _buf = NULL;        // padded copy of the block being written, recovered blocks
+    uint8_t * _tmp = NULL;        // blocks read back from flash
+    uint8_t * _parity = NULL;     // ELEGANTOTA_MULTICAST_FEC_SLOTS parity blocks
+    uint32_t  _parity_group[ELEGANTOTA_MULTICAST_FEC_SLOTS];
+    bool      _owned = false;     // the buffers are on the heap, not in an arena
+    const char * _error = NULL;
+    MD5Builder _md5;
+
+    #if defined(ESP32)
+      const esp_partition_t * _partition = NULL;
+    #elif defined(ESP8266)
+      uint32_t  _address = 0;
+    #endif
+
+    bool has(uint32_t index) const { return _have[index >> 3] & (1 << (index & 7)); }
+    bool writeBlock(uint32_t index, const uint8_t *payload, size_t len);
+    bool recover(uint32_t group);
+
+    bool flashErase(uint32_t sector);
+    bool flashWrite(uint32_t offset, const uint8_t *data, size_t len);
+    bool flashRead(uint32_t offset, uint8_t *data, size_t len);
+};
+
+#endif
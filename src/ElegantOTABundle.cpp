@@ -0,0 +1,89 @@
+#include "ElegantOTABundle.h"
+
+#define BUNDLE_MAGIC   "EOTB"
+#define BUNDLE_VERSION 1
+
+void ElegantOTABundle::begin() {
+  _header_len = 0;
+  _section_header_len = 0;
+  _count = 0;
+  _section = 0;
+  _type = 0;
+  _remaining = 0;
+  _in_section = false;
+  _error = NULL;
+}
+
+bool ElegantOTABundle::startSection() {
+  _type = _header[0];
+  _remaining = (uint32_t)_header[4] | ((uint32_t)_header[5] << 8) | ((uint32_t)_header[6] << 16) | ((uint32_t)_header[7] << 24);
+  if (_type != SECTION_APP && _type != SECTION_FS) {
+    _error = "Unknown bundle section";
+    return false;
+  }
+  if (_section == 0 && _type != SECTION_APP) {
+    _error = "Bundle must start with the firmware";
+    return false;
+  }
+
+  char md5[33];
+  for (size_t i = 0; i < 16; i++) {
+    snprintf(md5 + i * 2, 3, "%02x", _header[8 + i]);
+  }
+  _in_section = true;
+  return onSection == NULL || onSection(_type, _remaining, md5);
+}
+
+bool ElegantOTABundle::feed(const uint8_t *data, size_t len) {
+  if (_error != NULL) return false;
+
+  while (len) {
+    if (_header_len < HEADER_LEN) {
+      size_t n = HEADER_LEN - _header_len < len ? HEADER_LEN - _header_len : len;
+      memcpy(_header + _header_len, data, n);
+      _header_len += n;
+      data += n;
+      len -= n;
+      if (_header_len < HEADER_LEN) return true;
+      if (memcmp(_header, BUNDLE_MAGIC, 4) != 0 || _header[4] != BUNDLE_VERSION) {
+        _error = "Not an update bundle";
+        return false;
+      }
+      _count = _header[5];
+      if (_count == 0) {
+        _error = "Empty bundle";
+        return false;
+      }
+      continue;
+    }
+
+    if (_section == _count) {
+      _error = "Unexpected data after bundle";
+      return false;
+    }
+
+    if (!_in_section) {
+      size_t n = SECTION_HEADER_LEN - _section_header_len < len ? SECTION_HEADER_LEN - _section_header_len : len;
+      memcpy(_header + _section_header_len, data, n);
+      _section_header_len += n;
+      data += n;
+      len -= n;
+      if (_section_header_len < SECTION_HEADER_LEN) return true;
+      _section_header_len = 0;
+      if (!this->startSection()) return false;
+    }
+
+    size_t n = _remaining < len ? _remaining : len;
+    if (n && onData != NULL && !onData(data, n)) return false;
+    _remaining -= n;
+    data += n;
+    len -= n;
+
+    if (_remaining == 0) {
+      _in_section = false;
+      _section++;
+      if (onSectionEnd != NULL && !onSectionEnd(_type)) return false;
+    }
+  }
+  return true;
+}
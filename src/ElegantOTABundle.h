@@ -0,0 +1,75 @@
+#ifndef ElegantOTABundle_h
+#define ElegantOTABundle_h
+
+#include "Arduino.h"
+#include <functional>
+
+/**
+ * @brief streaming parser of update bundles, firmware and filesystem in one upload
+ *
+ * Layout, all numbers little endian (see scripts/bundle_firmware.py):
+ *   0   "EOTB"
+ *   4   format version (1)
+ *   5   number of sections
+ *   6   2 reserved bytes
+ *   8   sections, each a 24 byte header followed by the image:
+ *         0   type (1 = firmware, 2 = filesystem)
+ *         1   3 reserved bytes
+ *         4   image size
+ *         8   MD5 of the image
+ *
+ * The firmware section has to come first, a bundle starting with any other section is
+ * rejected before a byte of it is written: a failing filesystem section can only be
+ * undone by keeping the running firmware, which needs the firmware written already.
+ * The parser hands every section to the callbacks as the bytes arrive, nothing
+ * larger than a section header is buffered.
+ */
+class ElegantOTABundle {
+  public:
+    static const uint8_t SECTION_APP = 1;
+    static const uint8_t SECTION_FS = 2;
+    static const size_t HEADER_LEN = 8;
+    static const size_t SECTION_HEADER_LEN = 24;
+
+    std::function<bool(uint8_t type, uint32_t size, const char *md5)> onSection = NULL;
+    std::function<bool(const uint8_t *data, size_t len)> onData = NULL;
+    std::function<bool(uint8_t type)> onSectionEnd = NULL;
+
+    void begin();
+
+    /**
+     * @brief parse the next bytes of the upload
+     * @return false if the bundle is invalid or a callback failed
+     */
+    bool feed(const uint8_t *data, size_t len);
+
+    /**
+     * @brief check that all announced sections were received completely
+     */
+    bool complete() const { return _header_len == HEADER_LEN && _section == _count && _remaining == 0 && _error == NULL; }
+
+    /**
+     * @brief type of the section being parsed or the one parsed last
+     */
+    uint8_t type() const { return _type; }
+
+    /**
+     * @brief the reason of the last failure of the parser itself, NULL if a callback failed
+     */
+    const char * error() const { return _error; }
+
+  private:
+    uint8_t  _header[SECTION_HEADER_LEN];
+    size_t   _header_len = 0;
+    size_t   _section_header_len = 0;
+    uint8_t  _count = 0;
+    uint8_t  _section = 0;
+    uint8_t  _type = 0;
+    uint32_t _remaining = 0;
+    bool     _in_section = false;
+    const char * _error = NULL;
+
+    bool startSection();
+};
+
+#endif
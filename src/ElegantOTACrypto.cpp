@@ -0,0 +1,208 @@
+#include "ElegantOTACrypto.h"
+
+#define CRYPTO_MAGIC     "EOTA"
+#define CRYPTO_VERSION   1
+#define CRYPTO_ALG_CTR_HMAC 1
+
+void ElegantOTAHmac::sha256(const uint8_t *key, size_t keyLen, const uint8_t * const *parts, const size_t *lens, size_t count, uint8_t out[LEN]) {
+  #if defined(ESP8266)
+    br_hmac_key_context key_ctx;
+    br_hmac_context ctx;
+    br_hmac_key_init(&key_ctx, &br_sha256_vtable, key, keyLen);
+    br_hmac_init(&ctx, &key_ctx, 0);
+    for (size_t i = 0; i < count; i++) br_hmac_update(&ctx, parts[i], lens[i]);
+    br_hmac_out(&ctx, out);
+  #elif defined(ESP32)
+    mbedtls_md_context_t ctx;
+    mbedtls_md_init(&ctx);
+    mbedtls_md_setup(&ctx, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 1);
+    mbedtls_md_hmac_starts(&ctx, key, keyLen);
+    for (size_t i = 0; i < count; i++) mbedtls_md_hmac_update(&ctx, parts[i], lens[i]);
+    mbedtls_md_hmac_finish(&ctx, out);
+    mbedtls_md_free(&ctx);
+  #endif
+}
+
+bool ElegantOTAHmac::equal(const uint8_t *a, const uint8_t *b, size_t len) {
+  volatile uint8_t diff = 0;
+  for (size_t i = 0; i < len; i++) diff |= a[i] ^ b[i];
+  return diff == 0;
+}
+
+ElegantOTADecryptor::ElegantOTADecryptor() {
+  #if defined(ESP32)
+    mbedtls_aes_init(&_aes);
+    mbedtls_md_init(&_hmac);
+  #endif
+}
+
+ElegantOTADecryptor::~ElegantOTADecryptor() {
+  #if defined(ESP32)
+    mbedtls_aes_free(&_aes);
+    mbedtls_md_free(&_hmac);
+  #endif
+  memset(_enc_key, 0, sizeof(_enc_key));
+  memset(_mac_key, 0, sizeof(_mac_key));
+}
+
+void ElegantOTADecryptor::deriveKey(const uint8_t key[KEY_LEN], uint8_t label, uint8_t out[KEY_LEN]) {
+  uint8_t buf[KEY_LEN + 1];
+  memcpy(buf, key, KEY_LEN);
+  buf[KEY_LEN] = label;
+  #if defined(ESP8266)
+    br_sha256_context ctx;
+    br_sha256_init(&ctx);
+    br_sha256_update(&ctx, buf, sizeof(buf));
+    br_sha256_out(&ctx, out);
+  #elif defined(ESP32)
+    mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), buf, sizeof(buf), out);
+  #endif
+  memset(buf, 0, sizeof(buf));
+}
+
+void ElegantOTADecryptor::setKey(const uint8_t key[KEY_LEN]) {
+  deriveKey(key, 0x01, _enc_key);
+  deriveKey(key, 0x02, _mac_key);
+
+  #if defined(ESP8266)
+    br_aes_ct_ctr_init(&_aes, _enc_key, KEY_LEN);
+    br_hmac_key_init(&_hmac_key, &br_sha256_vtable, _mac_key, KEY_LEN);
+  #elif defined(ESP32)
+    // uses the AES peripheral where the core provides the hardware implementation
+    mbedtls_aes_setkey_enc(&_aes, _enc_key, KEY_LEN * 8);
+    if (!_has_key) mbedtls_md_setup(&_hmac, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 1);
+  #endif
+  _has_key = true;
+}
+
+void ElegantOTADecryptor::begin() {
+  _header_len = 0;
+  _plain_size = 0;
+  _plain_done = 0;
+  _mac_len = 0;
+  _stream_off = 0;
+  _error = NULL;
+}
+
+bool ElegantOTADecryptor::startStream() {
+  if (memcmp(_header, CRYPTO_MAGIC, 4) != 0) {
+    _error = "Not an encrypted image";
+    return false;
+  }
+  if (_header[4] != CRYPTO_VERSION || _header[5] != CRYPTO_ALG_CTR_HMAC) {
+    _error = "Unsupported encrypted image format";
+    return false;
+  }
+
+  _plain_size = (uint32_t)_header[8] | ((uint32_t)_header[9] << 8) | ((uint32_t)_header[10] << 16) | ((uint32_t)_header[11] << 24);
+  memcpy(_nonce, _header + 16, 12);
+  memset(_nonce + 12, 0, 4);
+  _stream_off = 0;
+
+  #if defined(ESP8266)
+    _counter = 0;
+    br_hmac_init(&_hmac, &_hmac_key, 0);
+  #elif defined(ESP32)
+    mbedtls_md_hmac_starts(&_hmac, _mac_key, KEY_LEN);
+  #endif
+  this->macUpdate(_header, HEADER_LEN);
+  return true;
+}
+
+void ElegantOTADecryptor::crypt(uint8_t *data, size_t len) {
+  #if defined(ESP8266)
+    while (len) {
+      if (_stream_off == 0 && len >= 16) {
+        // whole blocks are decrypted directly by BearSSL
+        size_t blocks = len & ~(size_t)15;
+        _counter = br_aes_ct_ctr_run(&_aes, _nonce, _counter, data, blocks);
+        data += blocks;
+        len -= blocks;
+        continue;
+      }
+      if (_stream_off == 0) {
+        memset(_stream, 0, sizeof(_stream));
+        _counter = br_aes_ct_ctr_run(&_aes, _nonce, _counter, _stream, sizeof(_stream));
+      }
+      *data++ ^= _stream[_stream_off];
+      _stream_off = (_stream_off + 1) & 15;
+      len--;
+    }
+  #elif defined(ESP32)
+    mbedtls_aes_crypt_ctr(&_aes, len, &_stream_off, _nonce, _stream, data, data);
+  #endif
+}
+
+void ElegantOTADecryptor::macUpdate(const uint8_t *data, size_t len) {
+  #if defined(ESP8266)
+    br_hmac_update(&_hmac, data, len);
+  #elif defined(ESP32)
+    mbedtls_md_hmac_update(&_hmac, data, len);
+  #endif
+}
+
+void ElegantOTADecryptor::macFinish(uint8_t out[MAC_LEN]) {
+  #if defined(ESP8266)
+    br_hmac_out(&_hmac, out);
+  #elif defined(ESP32)
+    mbedtls_md_hmac_finish(&_hmac, out);
+  #endif
+}
+
+bool ElegantOTADecryptor::update(uint8_t *data, size_t len, size_t& offset, size_t& plainLen) {
+  size_t pos = 0;
+  offset = 0;
+  plainLen = 0;
+  if (_error != NULL) return false;
+
+  if (_header_len < HEADER_LEN) {
+    size_t n = HEADER_LEN - _header_len;
+    if (len < n) n = len;
+    memcpy(_header + _header_len, data, n);
+    _header_len += n;
+    pos += n;
+    if (_header_len < HEADER_LEN) return true;
+    if (!this->startStream()) return false;
+  }
+
+  // ciphertext is authenticated as received, then decrypted in place
+  size_t n = _plain_size - _plain_done;
+  if (len - pos < n) n = len - pos;
+  if (n) {
+    this->macUpdate(data + pos, n);
+    this->crypt(data + pos, n);
+    offset = pos;
+    plainLen = n;
+    _plain_done += n;
+    pos += n;
+  }
+
+  n = MAC_LEN - _mac_len;
+  if (len - pos < n) n = len - pos;
+  memcpy(_mac + _mac_len, data + pos, n);
+  _mac_len += n;
+  pos += n;
+
+  if (pos < len) {
+    _error = "Unexpected data after encrypted image";
+    return false;
+  }
+  return true;
+}
+
+bool ElegantOTADecryptor::finish() {
+  if (_error != NULL) return false;
+  if (_header_len < HEADER_LEN || _plain_done < _plain_size || _mac_len < MAC_LEN) {
+    _error = "Encrypted image incomplete";
+    return false;
+  }
+
+  uint8_t mac[MAC_LEN];
+  this->macFinish(mac);
+
+  if (!ElegantOTAHmac::equal(mac, _mac, MAC_LEN)) {
+    _error = "Encrypted image authentication failed";
+    return false;
+  }
+  return true;
+}
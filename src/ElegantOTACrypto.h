@@ -0,0 +1,121 @@
+#ifndef ElegantOTACrypto_h
+#define ElegantOTACrypto_h
+
+#include "Arduino.h"
+
+#if defined(ESP8266)
+  #include <bearssl/bearssl.h>
+#elif defined(ESP32)
+  #include "mbedtls/aes.h"
+  #include "mbedtls/md.h"
+#endif
+
+/**
+ * @brief HMAC-SHA256 over a few buffers and a compare that does not leak the position of a difference
+ */
+class ElegantOTAHmac {
+  public:
+    static const size_t LEN = 32;
+
+    /**
+     * @param parts buffers authenticated one after the other, lens their lengths
+     */
+    static void sha256(const uint8_t *key, size_t keyLen, const uint8_t * const *parts, const size_t *lens, size_t count, uint8_t out[LEN]);
+
+    /**
+     * @brief compare in constant time, every byte is looked at
+     */
+    static bool equal(const uint8_t *a, const uint8_t *b, size_t len);
+};
+
+/**
+ * @brief streaming decryption of encrypted firmware uploads
+ *
+ * Container written by scripts/encrypt_firmware.py:
+ *   0   magic "EOTA"
+ *   4   format version (1)
+ *   5   algorithm (1 = AES-256-CTR + HMAC-SHA256)
+ *   6   reserved (2)
+ *   8   plaintext size, little endian (4)
+ *   12  reserved (4)
+ *   16  nonce (12), the CTR counter block is nonce || 32 bit big endian block counter
+ *   28  reserved (4)
+ *   32  ciphertext
+ *   ..  HMAC-SHA256 over header and ciphertext (32)
+ *
+ * Encryption and MAC keys are derived from the 32 byte device key as
+ * SHA256(key || 0x01) and SHA256(key || 0x02). Chunks are decrypted in place,
+ * so no image data is buffered. The MAC is checked by finish(), before the
+ * update is committed.
+ */
+class ElegantOTADecryptor {
+  public:
+    static const size_t KEY_LEN    = 32;
+    static const size_t HEADER_LEN = 32;
+    static const size_t MAC_LEN    = 32;
+
+    ElegantOTADecryptor();
+    ~ElegantOTADecryptor();
+
+    void setKey(const uint8_t key[KEY_LEN]);
+    bool hasKey() const { return _has_key; }
+
+    /**
+     * @brief prepare for a new encrypted upload
+     */
+    void begin();
+
+    /**
+     * @brief decrypt the next chunk of the upload in place
+     * @param data the received chunk, overwritten with plaintext
+     * @param len length of the chunk
+     * @param offset returns the start of the plaintext inside data
+     * @param plainLen returns the number of plaintext bytes
+     * @return false if the container is invalid, see error()
+     */
+    bool update(uint8_t *data, size_t len, size_t& offset, size_t& plainLen);
+
+    /**
+     * @brief check the MAC after the last chunk
+     * @return true if the whole container was received and is authentic
+     */
+    bool finish();
+
+    const char * error() const { return _error; }
+
+  private:
+    bool     _has_key = false;
+    uint8_t  _enc_key[KEY_LEN];
+    uint8_t  _mac_key[KEY_LEN];
+
+    uint8_t  _header[HEADER_LEN];
+    size_t   _header_len = 0;
+    uint32_t _plain_size = 0;
+    uint32_t _plain_done = 0;
+    uint8_t  _mac[MAC_LEN];
+    size_t   _mac_len = 0;
+    const char * _error = NULL;
+
+    // CTR state, keystream bytes of a partially used block are kept for the next chunk
+    uint8_t  _nonce[16];
+    uint8_t  _stream[16];
+    size_t   _stream_off = 0;
+
+    #if defined(ESP8266)
+      br_aes_ct_ctr_keys _aes;
+      uint32_t           _counter = 0;
+      br_hmac_key_context _hmac_key;
+      br_hmac_context    _hmac;
+    #elif defined(ESP32)
+      mbedtls_aes_context _aes;
+      mbedtls_md_context_t _hmac;
+    #endif
+
+    bool startStream();
+    void crypt(uint8_t *data, size_t len);
+    void macUpdate(const uint8_t *data, size_t len);
+    void macFinish(uint8_t out[MAC_LEN]);
+    static void deriveKey(const uint8_t key[KEY_LEN], uint8_t label, uint8_t out[KEY_LEN]);
+};
+
+#endif
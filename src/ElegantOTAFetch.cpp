@@ -0,0 +1,159 @@
+#include "ElegantOTAFetch.h"
+
+bool ElegantOTAFetch::begin(const char *url, const char * const *headers, uint8_t count, uint32_t rangeFrom) {
+  this->end();
+  _status = 0;
+  _length = -1;
+  _received = 0;
+  _line_len = 0;
+  _error = NULL;
+  _names = headers;
+  _count = count < MAX_HEADERS ? count : MAX_HEADERS;
+  for (uint8_t i = 0; i < MAX_HEADERS; i++) _values[i].clear();
+  _activity = millis();
+
+  // http://host[:port][/path]
+  if (url == NULL || strncmp(url, "http://", 7) != 0) {
+    this->fail("Only http urls are supported");
+    return false;
+  }
+  const char *host = url + 7;
+  const char *path = strchr(host, '/');
+  if (path == NULL) path = host + strlen(host);
+  const char *colon = (const char *)memchr(host, ':', path - host);
+  size_t host_len = (colon != NULL ? colon : path) - host;
+  unsigned long port = colon != NULL ? strtoul(colon + 1, NULL, 10) : 80;
+  if (host_len == 0 || host_len >= sizeof(_host) || port == 0 || port > 65535) {
+    this->fail("Invalid url");
+    return false;
+  }
+  memcpy(_host, host, host_len);
+  _host[host_len] = 0;
+  _port = (uint16_t)port;
+
+  int n = snprintf(_request, sizeof(_request), "GET %s HTTP/1.0\r\nHost: %s\r\nConnection: close\r\n", path[0] ? path : "/", _host);
+  if (n > 0 && rangeFrom && (size_t)n < sizeof(_request)) {
+    n += snprintf(_request + n, sizeof(_request) - n, "Range: bytes=%lu-\r\n", (unsigned long)rangeFrom);
+  }
+  if (n < 0 || (size_t)n + 2 >= sizeof(_request)) {
+    this->fail("Invalid url");
+    return false;
+  }
+  memcpy(_request + n, "\r\n", 3);
+  _request_len = n + 2;
+
+  // the callbacks of a client that end() already gave up are ignored
+  _client = new AsyncClient();
+  _client->onConnect([&](void *, AsyncClient *c) { if (c == _client) this->connected(); });
+  _client->onData([&](void *, AsyncClient *c, void *data, size_t len) { if (c == _client) this->receive((const uint8_t *)data, len); });
+  _client->onError([&](void *, AsyncClient *c, int8_t) { if (c == _client && this->running()) this->fail("Connection failed"); });
+  _client->onDisconnect([&](void *, AsyncClient *c) { if (c == _client) this->disconnected(); });
+  _state = CONNECTING;
+  if (!_client->connect(_host, _port)) {
+    this->fail("Connection failed");
+    this->end();
+    return false;
+  }
+  return true;
+}
+
+void ElegantOTAFetch::end() {
+  AsyncClient *client = _client;
+  _client = NULL;
+  if (client != NULL) {
+    client->close(true);
+    delete client;
+  }
+  if (this->running()) _state = IDLE;
+}
+
+void ElegantOTAFetch::connected() {
+  _activity = millis();
+  _state = HEAD;
+  _client->write(_request, _request_len);
+}
+
+void ElegantOTAFetch::receive(const uint8_t *data, size_t len) {
+  _activity = millis();
+  while (len && _state == HEAD) {
+    char c = (char)*data++;
+    len--;
+    if (c == '\n') {
+      if (!this->headLine()) return;
+    } else if (c != '\r' && _line_len < sizeof(_line) - 1) {
+      // longer lines are cut, none of the headers kept is that long
+      _line[_line_len++] = c;
+    }
+  }
+  if (len && _state == BODY) this->body(data, len);
+}
+
+bool ElegantOTAFetch::headLine() {
+  _line[_line_len] = 0;
+  _line_len = 0;
+
+  if (_status == 0) {
+    const char *code = strchr(_line, ' ');
+    if (strncmp(_line, "HTTP/", 5) != 0 || code == NULL || (_status = atoi(code + 1)) <= 0) {
+      this->fail("Invalid response");
+      return false;
+    }
+    return true;
+  }
+
+  if (_line[0]) {
+    char *colon = strchr(_line, ':');
+    if (colon == NULL) return true;
+    *colon = 0;
+    const char *value = colon + 1;
+    while (*value == ' ') value++;
+    if (strcasecmp(_line, "Content-Length") == 0) _length = strtol(value, NULL, 10);
+    for (uint8_t i = 0; i < _count; i++) {
+      if (strcasecmp(_line, _names[i]) == 0) _values[i] = value;
+    }
+    return true;
+  }
+
+  // the empty line ends the head
+  _state = BODY;
+  if (onHead != NULL && !onHead(_status)) {
+    this->fail(NULL);
+    return false;
+  }
+  if (_length == 0) {
+    _state = DONE;
+    _client->close();
+    return false;
+  }
+  return true;
+}
+
+void ElegantOTAFetch::body(const uint8_t *data, size_t len) {
+  if (_length >= 0 && len > (uint32_t)_length - _received) len = _length - _received;
+  if (onBody != NULL && !onBody(data, len)) {
+    this->fail(NULL);
+    return;
+  }
+  _received += len;
+  if (_length >= 0 && _received == (uint32_t)_length) {
+    _state = DONE;
+    _client->close();
+  }
+}
+
+void ElegantOTAFetch::disconnected() {
+  _activity = millis();
+  // without a Content-Length the end of the connection is the end of the body
+  if (_state == BODY && _length < 0) {
+    _state = DONE;
+  } else if (this->running()) {
+    _error = "Connection closed";
+    _state = FAILED;
+  }
+}
+
+void ElegantOTAFetch::fail(const char *reason) {
+  _error = reason;
+  _state = FAILED;
+  if (_client != NULL) _client->close();
+}
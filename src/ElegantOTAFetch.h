@@ -0,0 +1,111 @@
+#ifndef ElegantOTAFetch_h
+#define ElegantOTAFetch_h
+
+#include "Arduino.h"
+#include <functional>
+#include "ElegantOTAFixedString.h"
+
+#if defined(ESP8266)
+  #include "ESPAsyncTCP.h"
+#elif defined(ESP32)
+  #include "AsyncTCP.h"
+#endif
+
+/**
+ * @brief HTTP GET on an AsyncClient, driven by the network stack instead of loop()
+ *
+ * Connecting, sending the request and parsing the answer happen in the callbacks of the
+ * connection, the owner starts it and looks at state() from loop(). The body is handed
+ * to onBody() as it arrives, on the network task like the data of an upload; bytes left
+ * unacknowledged with client()->ackLater() hold the server back. Plain http only, the
+ * request is HTTP/1.0 so the body is never chunked.
+ */
+class ElegantOTAFetch {
+  public:
+    static const uint8_t MAX_HEADERS = 4;
+    static const size_t HOST_LEN = 64;
+    static const size_t REQUEST_LEN = 256;
+    static const size_t LINE_LEN = 96;
+
+    enum State : uint8_t { IDLE, CONNECTING, HEAD, BODY, DONE, FAILED };
+
+    /**
+     * @brief called once the status line and the headers are parsed
+     * @return false to close the connection, the fetch fails
+     */
+    std::function<bool(int status)> onHead = NULL;
+
+    /**
+     * @brief called with the next bytes of the body, false closes the connection
+     */
+    std::function<bool(const uint8_t *data, size_t len)> onBody = NULL;
+
+    ~ElegantOTAFetch() { this->end(); }
+
+    /**
+     * @brief connect and send GET url, the answer arrives in the callbacks
+     * @param headers names of the response headers kept for header(), at most MAX_HEADERS
+     * @param rangeFrom request the body from this offset on, 0 for all of it
+     * @return false if the url is invalid or the connection could not be started
+     */
+    bool begin(const char *url, const char * const *headers = NULL, uint8_t count = 0, uint32_t rangeFrom = 0);
+
+    /**
+     * @brief close the connection, no callback runs afterwards
+     */
+    void end();
+
+    State state() const { return _state; }
+    bool running() const { return _state == CONNECTING || _state == HEAD || _state == BODY; }
+    int status() const { return _status; }
+
+    /**
+     * @brief Content-Length of the answer, -1 if the server sent none
+     */
+    int32_t length() const { return _length; }
+    uint32_t received() const { return _received; }
+
+    /**
+     * @brief value of the i-th header passed to begin(), empty if the answer had none
+     */
+    const char * header(uint8_t i) const { return i < _count ? _values[i].c_str() : ""; }
+
+    /**
+     * @brief millis() of the last event of the connection, for the timeouts of the owner
+     */
+    unsigned long activity() const { return _activity; }
+
+    /**
+     * @brief the reason of a failure of the connection, NULL if a callback ended it
+     */
+    const char * error() const { return _error; }
+
+    AsyncClient * client() const { return _client; }
+
+  private:
+    AsyncClient * _client = NULL;
+    volatile State _state = IDLE;
+    int           _status = 0;
+    int32_t       _length = -1;
+    uint32_t      _received = 0;
+    unsigned long _activity = 0;
+    const char *  _error = NULL;
+    char          _host[HOST_LEN];
+    uint16_t      _port = 80;
+    char          _request[REQUEST_LEN];
+    size_t        _request_len = 0;
+    char          _line[LINE_LEN];
+    size_t        _line_len = 0;
+    const char * const * _names = NULL;
+    uint8_t       _count = 0;
+    ElegantOTAFixedString<48> _values[MAX_HEADERS];
+
+    void connected();
+    void receive(const uint8_t *data, size_t len);
+    bool headLine();
+    void body(const uint8_t *data, size_t len);
+    void disconnected();
+    void fail(const char *reason);
+};
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef ElegantOTAFixedString_h
+#define ElegantOTAFixedString_h
+
+#include "Arduino.h"
+
+/**
+ * @brief string with inline storage of a compile time capacity
+ *
+ * Used for all configuration and error strings of ElegantOTAClass so they
+ * never touch the heap. Input longer than the capacity is truncated, assign()
+ * and append() report that by returning false.
+ *
+ * @tparam N maximum number of characters (without terminating zero)
+ */
+template <size_t N>
+class ElegantOTAFixedString {
+  public:
+    ElegantOTAFixedString() { this->clear(); }
+    ElegantOTAFixedString(const char * str) {
+      this->clear();
+      this->assign(str);
+    }
+
+    ElegantOTAFixedString& operator=(const char * str) {
+      this->assign(str);
+      return *this;
+    }
+
+    /**
+     * @return false if str was truncated
+     */
+    bool assign(const char * str) {
+      if (str == NULL) {
+        this->clear();
+        return true;
+      }
+      return this->assign(str, strlen(str));
+    }
+
+    /**
+     * @brief str may point into this string (self-assignment, substrings)
+     * @return false if str was truncated
+     */
+    bool assign(const char * str, size_t len) {
+      bool complete = len <= N;
+      if (!complete) len = N;
+      memmove(_buf, str, len);
+      _len = len;
+      _buf[_len] = '\0';
+      return complete;
+    }
+
+    /**
+     * @return false if str was truncated
+     */
+    bool append(const char * str) {
+      return str == NULL || this->append(str, strlen(str));
+    }
+
+    bool append(const char * str, size_t len) {
+      bool complete = len <= N - _len;
+      if (!complete) len = N - _len;
+      memmove(_buf + _len, str, len);
+      _len += len;
+      _buf[_len] = '\0';
+      return complete;
+    }
+
+    bool append(char c) {
+      if (_len >= N) return false;
+      _buf[_len++] = c;
+      _buf[_len] = '\0';
+      return true;
+    }
+
+    void clear() {
+      _len = 0;
+      _buf[0] = '\0';
+    }
+
+    const char * c_str() const { return _buf; }
+    size_t length() const { return _len; }
+    bool isEmpty() const { return _len == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    bool operator==(const char * str) const { return str != NULL && strcmp(_buf, str) == 0; }
+    bool operator!=(const char * str) const { return !(*this == str); }
+
+  private:
+    char   _buf[N + 1];
+    size_t _len;
+};
+
+/**
+ * @brief Print adapter appending into an ElegantOTAFixedString
+ *
+ * Replaces StreamString for capturing output of e.g. Update.printError()
+ * without heap allocation.
+ */
+template <size_t N>
+class ElegantOTAFixedStringPrint : public Print {
+  public:
+    explicit ElegantOTAFixedStringPrint(ElegantOTAFixedString<N>& target) : _target(target) {}
+
+    size_t write(uint8_t c) override {
+      return _target.append((char)c) ? 1 : 0;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+      size_t before = _target.length();
+      _target.append((const char *)buffer, size);
+      return _target.length() - before;
+    }
+
+  private:
+    ElegantOTAFixedString<N>& _target;
+};
+
+#endif
@@ -0,0 +1,334 @@
+#include "ElegantOTA.h"
+
+/*
+ * File level filesystem sync, an alternative to replacing the whole filesystem image:
+ *
+ *   GET  /ota/start?mode=files            open the session
+ *   POST /ota/fs/manifest                 {"files":[{"path":"/index.html","md5":"..."}]}, answers
+ *                                         202, the files are hashed by loop() and not here
+ *   POST /ota/fs/manifest?dry=1           the same without a session, for a dry run
+ *   GET  /ota/fs/manifest                 202 while hashing, then {"upload":[paths],"delete":[paths]}
+ *   POST /ota/fs/file?path=..&hash=..     multipart upload of one file, written to <path>.tmp
+ *                                         and renamed over the old file after the MD5 matched
+ *   POST /ota/fs/delete?path=..           remove a file, sent after all uploads
+ *   GET  /ota/fs/commit                   close the session, no reboot required
+ *
+ * The files the library keeps on the filesystem itself (update history, prefetch state)
+ * are neither listed for deletion nor written or deleted by a sync.
+ *
+ * See scripts/fs_sync.py for the client side.
+ */
+
+#define SYNC_PATH_LEN 64
+#define SYNC_MAX_DEPTH 8
+#define SYNC_READ_LEN 512
+
+void ElegantOTAClass::setSyncFileSystem(fs::FS& fs) {
+  this->_sync_fs = &fs;
+}
+
+bool ElegantOTAClass::isSafePath(const char *path) const {
+  return path != NULL && path[0] == '/' && strlen(path) < SYNC_PATH_LEN - 4 && strstr(path, "..") == NULL && !this->isLibraryFile(path);
+}
+
+bool ElegantOTAClass::isLibraryFile(const char *path) const {
+  // on another filesystem these names are files of the application
+  if (_sync_fs != _state_fs) return false;
+  return strcmp(path, ELEGANTOTA_HISTORY_FILE) == 0 || strcmp(path, ELEGANTOTA_PREFETCH_FILE) == 0;
+}
+
+bool ElegantOTAClass::checkFsSyncRequest(AsyncWebServerRequest *request) {
+  if (!this->isAuthorized(request)) {
+    request->requestAuthentication();
+    return false;
+  }
+  if (this->isSessionBusy(request)) {
+    this->sendSessionBusy(request);
+    return false;
+  }
+  if (!this->isSessionOwner(request) || _currentOtaMode != OTA_MODE_FILES) {
+    request->send(400, "text/plain", "No file sync session started");
+    return false;
+  }
+  _session_activity_millis = millis();
+  return true;
+}
+
+void ElegantOTAClass::listSyncFiles(const char *dir, JsonArray& files, uint8_t depth) {
+  if (depth > SYNC_MAX_DEPTH) return;
+  char path[SYNC_PATH_LEN];
+
+  #if defined(ESP8266)
+    fs::Dir entries = _sync_fs->openDir(dir);
+    while (entries.next()) {
+      snprintf(path, sizeof(path), "%s%s%s", dir, dir[strlen(dir) - 1] == '/' ? "" : "/", entries.fileName().c_str());
+      if (entries.isDirectory()) {
+        this->listSyncFiles(path, files, depth + 1);
+      } else {
+        files.add(path);
+      }
+    }
+  #elif defined(ESP32)
+    fs::File root = _sync_fs->open(dir);
+    if (!root || !root.isDirectory()) return;
+    fs::File entry = root.openNextFile();
+    while (entry) {
+      strncpy(path, entry.path(), sizeof(path) - 1);
+      path[sizeof(path) - 1] = '\0';
+      bool is_dir = entry.isDirectory();
+      entry.close();
+      if (is_dir) {
+        this->listSyncFiles(path, files, depth + 1);
+      } else {
+        files.add(path);
+      }
+      entry = root.openNextFile();
+    }
+  #endif
+}
+
+void ElegantOTAClass::handleFsManifest(AsyncWebServerRequest *request, const char *json, size_t len) {
+  this->resetFsManifest();
+  DeserializationError err = deserializeJson(_sync_manifest, json, len);
+  if (err || !_sync_manifest["files"].is<JsonArray>()) {
+    _sync_manifest.clear();
+    return request->send(400, "text/plain", "Invalid manifest");
+  }
+  _sync_plan["upload"].to<JsonArray>();
+  _sync_plan["delete"].to<JsonArray>();
+  _sync_manifest_client = (uint32_t)request->client()->remoteIP();
+  _sync_manifest_state = OTA_MANIFEST_HASHING;
+  request->send(202, "application/json", "{\"status\":\"hashing\"}");
+}
+
+void ElegantOTAClass::sendFsPlan(AsyncWebServerRequest *request) {
+  if (_sync_manifest_state == OTA_MANIFEST_NONE) {
+    return request->send(400, "text/plain", "No manifest posted");
+  }
+  if (_sync_manifest_state == OTA_MANIFEST_HASHING) {
+    AsyncWebServerResponse *response = request->beginResponse(202, "application/json", "{\"status\":\"hashing\"}");
+    response->addHeader("Retry-After", "1");
+    return request->send(response);
+  }
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  ArduinoJson::serializeJson(_sync_plan, *response);
+  request->send(response);
+  // the plan of a dry run is answered once, a session keeps it until it closes
+  if (!_session_active) this->resetFsManifest();
+}
+
+void ElegantOTAClass::resetFsManifest() {
+  if (_sync_hash_file) _sync_hash_file.close();
+  _sync_manifest.clear();
+  _sync_plan.clear();
+  _sync_manifest_entry = 0;
+  _sync_manifest_client = 0;
+  _sync_manifest_state = OTA_MANIFEST_NONE;
+}
+
+void ElegantOTAClass::runFsManifest() {
+  JsonArray wanted = _sync_manifest["files"].as<JsonArray>();
+  JsonArray upload = _sync_plan["upload"].as<JsonArray>();
+  uint8_t buf[SYNC_READ_LEN];
+  size_t budget = ELEGANTOTA_SYNC_HASH_SLICE;
+
+  // a slice of the files per call, loop() stays responsive on large filesystems
+  while (budget && _sync_manifest_entry < wanted.size()) {
+    JsonObject file = wanted[_sync_manifest_entry].as<JsonObject>();
+    const char *path = file["path"];
+    const char *hash = file["md5"];
+    if (!_sync_hash_file) {
+      if (!this->isSafePath(path)) {
+        _sync_manifest_entry++;
+        continue;
+      }
+      if (hash != NULL) _sync_hash_file = _sync_fs->open(path, "r");
+      if (!_sync_hash_file || _sync_hash_file.isDirectory()) {
+        if (_sync_hash_file) _sync_hash_file.close();
+        upload.add(path);
+        _sync_manifest_entry++;
+        continue;
+      }
+      _sync_md5.begin();
+    }
+
+    size_t n = _sync_hash_file.read(buf, budget < sizeof(buf) ? budget : sizeof(buf));
+    if (n > 0) {
+      _sync_md5.add(buf, n);
+      budget -= n;
+      continue;
+    }
+    _sync_hash_file.close();
+    char md5[33];
+    _sync_md5.calculate();
+    _sync_md5.getChars(md5);
+    if (strcasecmp(md5, hash) != 0) upload.add(path);
+    _sync_manifest_entry++;
+  }
+  if (_sync_manifest_entry < wanted.size()) return;
+
+  // everything on the device that is not part of the manifest goes away
+  JsonDocument existing;
+  JsonArray present = existing.to<JsonArray>();
+  this->listSyncFiles("/", present, 0);
+  JsonArray remove = _sync_plan["delete"].as<JsonArray>();
+  for (JsonVariant entry : present) {
+    const char *path = entry.as<const char *>();
+    if (this->isLibraryFile(path)) continue;
+    bool keep = false;
+    for (JsonObject file : wanted) {
+      const char *wanted_path = file["path"];
+      if (wanted_path != NULL && strcmp(wanted_path, path) == 0) {
+        keep = true;
+        break;
+      }
+    }
+    if (!keep) remove.add(path);
+  }
+
+  this->logf("File sync: %u to upload, %u to delete", (unsigned)upload.size(), (unsigned)remove.size());
+  _sync_manifest.clear();
+  _sync_manifest_state = OTA_MANIFEST_READY;
+}
+
+bool ElegantOTAClass::checkFsManifestRequest(AsyncWebServerRequest *request, bool post) {
+  // a dry run needs no session, but must not disturb the one of another client
+  if (!_session_active && (post ? request->hasParam("dry") : _sync_manifest_client == (uint32_t)request->client()->remoteIP())) {
+    if (!this->isAuthorized(request)) {
+      request->requestAuthentication();
+      return false;
+    }
+    if (this->isSessionBusy(request)) {
+      this->sendSessionBusy(request);
+      return false;
+    }
+    return true;
+  }
+  return this->checkFsSyncRequest(request);
+}
+
+void ElegantOTAClass::beginFsSync() {
+  _server->on("/ota/fs/manifest", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->checkFsManifestRequest(request, false)) return;
+      this->sendFsPlan(request);
+  });
+
+  _server->on("/ota/fs/manifest", HTTP_POST, [&](AsyncWebServerRequest *request) {
+      if (!this->checkFsManifestRequest(request, true)) return;
+      if (request->_tempObject == NULL) {
+        return request->send(400, "text/plain", "Manifest missing or too large");
+      }
+      this->handleFsManifest(request, (const char *)request->_tempObject, request->contentLength());
+  }, NULL, [&](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+      // the body is collected in _tempObject, which AsyncWebServer frees with the request,
+      // nothing is allocated for unauthorized clients, the request handler answers them with 401
+      if (!index && total <= ELEGANTOTA_MANIFEST_MAX && this->isAuthorized(request)) {
+        request->_tempObject = malloc(total);
+      }
+      if (request->_tempObject != NULL) {
+        memcpy((uint8_t *)request->_tempObject + index, data, len);
+      }
+  });
+
+  _server->on("/ota/fs/file", HTTP_POST, [&](AsyncWebServerRequest *request) {
+      if (!this->checkFsSyncRequest(request)) return;
+      if (!_update_error_str.isEmpty()) {
+        return request->send(400, "text/plain", _update_error_str.c_str());
+      }
+      request->send(200, "text/plain", "OK");
+  }, [&](AsyncWebServerRequest *request, const String& /* filename */, size_t index, uint8_t *data, size_t len, bool final) {
+      // authorization is checked once per request, chunks of other requests are dropped
+      if (index && request != _sync_request) return;
+      if (!index) {
+        if (!this->isAuthorized(request) || !this->isSessionOwner(request) || _currentOtaMode != OTA_MODE_FILES) return;
+        _sync_request = request;
+        request->onDisconnect([&, request]() {
+          if (_sync_request == request) _sync_request = NULL;
+        });
+      }
+      _session_activity_millis = millis();
+
+      char tmp[SYNC_PATH_LEN + 5];   // the path and ".tmp"
+      if (!index) {
+        _update_error_str.clear();
+        if (_sync_manifest_state == OTA_MANIFEST_HASHING) {
+          _update_error_str = "Manifest check in progress";
+          return;
+        }
+        const char *path = request->hasParam("path") ? request->getParam("path")->value().c_str() : NULL;
+        if (!this->isSafePath(path)) {
+          _update_error_str = "Invalid path";
+          return;
+        }
+        _sync_path = path;
+        snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+        #if defined(ESP32)
+          _sync_file = _sync_fs->open(tmp, FILE_WRITE, true);
+        #else
+          _sync_file = _sync_fs->open(tmp, "w");
+        #endif
+        if (!_sync_file) {
+          _update_error_str = "Failed to create file";
+          return;
+        }
+        _sync_md5.begin();
+      }
+      if (!_update_error_str.isEmpty() || !_sync_file) return;
+
+      snprintf(tmp, sizeof(tmp), "%s.tmp", _sync_path.c_str());
+      if (len) {
+        if (_sync_file.write(data, len) != len) {
+          _sync_file.close();
+          _sync_fs->remove(tmp);
+          _update_error_str = "Failed to write file, filesystem full?";
+          return;
+        }
+        _sync_md5.add(data, len);
+        _current_progress_size += len;
+        _history.progress(_current_progress_size, millis());
+      }
+
+      if (final) {
+        _sync_file.close();
+        char md5[33];
+        _sync_md5.calculate();
+        _sync_md5.getChars(md5);
+        if (request->hasParam("hash") && strcasecmp(md5, request->getParam("hash")->value().c_str()) != 0) {
+          _sync_fs->remove(tmp);
+          _update_error_str = "MD5 Check Failed";
+          return;
+        }
+        // LittleFS renames atomically, fall back to remove + rename where the target must not exist
+        if (!_sync_fs->rename(tmp, _sync_path.c_str())) {
+          _sync_fs->remove(_sync_path.c_str());
+          if (!_sync_fs->rename(tmp, _sync_path.c_str())) {
+            _sync_fs->remove(tmp);
+            _update_error_str = "Failed to replace file";
+            return;
+          }
+        }
+        this->logf("File sync: updated %s", _sync_path.c_str());
+      }
+  });
+
+  _server->on("/ota/fs/delete", HTTP_POST, [&](AsyncWebServerRequest *request) {
+      if (!this->checkFsSyncRequest(request)) return;
+      const char *path = request->hasParam("path") ? request->getParam("path")->value().c_str() : NULL;
+      if (!this->isSafePath(path)) {
+        return request->send(400, "text/plain", "Invalid path");
+      }
+      if (_sync_fs->exists(path) && !_sync_fs->remove(path)) {
+        return request->send(400, "text/plain", "Failed to delete file");
+      }
+      this->logf("File sync: deleted %s", path);
+      request->send(200, "text/plain", "OK");
+  });
+
+  _server->on("/ota/fs/commit", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->checkFsSyncRequest(request)) return;
+      this->closeSession(false);
+      this->logf("File sync complete");
+      if (postUpdateCallback != NULL) postUpdateCallback(true);
+      request->send(200, "text/plain", "OK");
+  });
+}
@@ -0,0 +1,62 @@
+#include "ElegantOTAGovernor.h"
+
+void ElegantOTAGovernor::setLimits(uint32_t throttleHeap, uint32_t rejectHeap, uint32_t minBlock) {
+  _throttle_heap = throttleHeap;
+  _reject_heap = rejectHeap;
+  _min_block = minBlock;
+}
+
+ElegantOTAResources ElegantOTAGovernor::sample() {
+  ElegantOTAResources now;
+  #if defined(ESP8266)
+    now.freeHeap = ESP.getFreeHeap();
+    now.maxBlock = ESP.getMaxFreeBlockSize();
+    // getFreeContStack() describes loop(), not the sys stack the network callbacks run on
+    now.stackFree = can_yield() ? ESP.getFreeContStack() : ELEGANTOTA_STACK_UNKNOWN;
+  #elif defined(ESP32)
+    now.freeHeap = ESP.getFreeHeap();
+    now.maxBlock = ESP.getMaxAllocHeap();
+    now.stackFree = uxTaskGetStackHighWaterMark(NULL);
+  #endif
+  return now;
+}
+
+bool ElegantOTAGovernor::admit(const ElegantOTAResources& now) const {
+  return _reject_heap == 0 || (now.freeHeap >= _reject_heap && now.maxBlock >= _min_block);
+}
+
+void ElegantOTAGovernor::begin(const ElegantOTAResources& now) {
+  _low = now;
+  _throttled = false;
+  _throttle_count = 0;
+}
+
+bool ElegantOTAGovernor::update(const ElegantOTAResources& now) {
+  if (now.freeHeap < _low.freeHeap) _low.freeHeap = now.freeHeap;
+  if (now.maxBlock < _low.maxBlock) _low.maxBlock = now.maxBlock;
+  if (now.stackFree < _low.stackFree) _low.stackFree = now.stackFree;
+
+  if (!_throttled && _throttle_heap && (now.freeHeap < _throttle_heap || now.maxBlock < _min_block)) {
+    _throttled = true;
+    _throttle_count++;
+  } else if (_throttled) {
+    this->recovered(now);
+  }
+  return _throttled;
+}
+
+bool ElegantOTAGovernor::recovered(const ElegantOTAResources& now) {
+  if (_throttled && now.freeHeap >= _throttle_heap + _throttle_heap / 4 && now.maxBlock >= _min_block) {
+    _throttled = false;
+    return true;
+  }
+  return false;
+}
+
+size_t ElegantOTAGovernor::summary(char *buf, size_t len) const {
+  char stack[12] = "n/a";
+  if (_low.stackFree != ELEGANTOTA_STACK_UNKNOWN) snprintf(stack, sizeof(stack), "%u", (unsigned)_low.stackFree);
+  int n = snprintf(buf, len, "min free heap %u, min largest block %u, min free stack %s, throttled %u times",
+                   (unsigned)_low.freeHeap, (unsigned)_low.maxBlock, stack, (unsigned)_throttle_count);
+  return n < 0 ? 0 : (size_t)n;
+}
@@ -0,0 +1,103 @@
+#ifndef ElegantOTAGovernor_h
+#define ElegantOTAGovernor_h
+
+#include "Arduino.h"
+#if defined(ESP8266)
+  #include <coredecls.h>
+#endif
+
+// defaults of the resource governor, see ElegantOTAClass::setResourceLimits()
+#if defined(ESP8266)
+  #ifndef ELEGANTOTA_THROTTLE_HEAP
+    #define ELEGANTOTA_THROTTLE_HEAP 8192
+  #endif
+  #ifndef ELEGANTOTA_REJECT_HEAP
+    #define ELEGANTOTA_REJECT_HEAP 6144
+  #endif
+#else
+  #ifndef ELEGANTOTA_THROTTLE_HEAP
+    #define ELEGANTOTA_THROTTLE_HEAP 16384
+  #endif
+  #ifndef ELEGANTOTA_REJECT_HEAP
+    #define ELEGANTOTA_REJECT_HEAP 12288
+  #endif
+#endif
+
+// the Update object allocates one flash sector as write buffer
+#ifndef ELEGANTOTA_MIN_BLOCK
+  #define ELEGANTOTA_MIN_BLOCK 4096
+#endif
+
+// stackFree of a sample taken where the stack cannot be measured
+#define ELEGANTOTA_STACK_UNKNOWN 0xFFFFFFFF
+
+/**
+ * @brief one sample of the memory situation
+ */
+struct ElegantOTAResources {
+  uint32_t freeHeap;
+  uint32_t maxBlock;   // largest allocatable block
+  uint32_t stackFree;  // stack high-water mark of the sampling task, bytes, or ELEGANTOTA_STACK_UNKNOWN
+};
+
+/**
+ * @brief watches heap and stack during an OTA session and decides when to back off
+ *
+ * The decisions only depend on the samples passed in, sample() reads the platform
+ * values. Throttling has a hysteresis of a quarter of the threshold, so the receive
+ * path does not flap between pausing and resuming on every packet.
+ */
+class ElegantOTAGovernor {
+  public:
+    void setLimits(uint32_t throttleHeap, uint32_t rejectHeap, uint32_t minBlock);
+
+    /**
+     * @brief read free heap, largest free block and the stack high-water mark of the calling task
+     *
+     * On ESP8266 only the cont stack of loop() has a watermark. Uploads arrive in the sys
+     * context of lwIP, samples taken there report ELEGANTOTA_STACK_UNKNOWN.
+     */
+    static ElegantOTAResources sample();
+
+    /**
+     * @brief check whether a new session may start
+     */
+    bool admit(const ElegantOTAResources& now) const;
+
+    /**
+     * @brief reset watermarks and throttling for a new session
+     */
+    void begin(const ElegantOTAResources& now);
+
+    /**
+     * @brief record a sample taken on the receive path
+     * @return true while the receive path should pause
+     */
+    bool update(const ElegantOTAResources& now);
+
+    /**
+     * @brief check a sample taken outside the receive path, ends throttling once memory recovered
+     * @return true if throttling ended
+     */
+    bool recovered(const ElegantOTAResources& now);
+
+    bool throttled() const { return _throttled; }
+    uint32_t throttleCount() const { return _throttle_count; }
+    const ElegantOTAResources& low() const { return _low; }
+
+    /**
+     * @brief print the watermarks of the session
+     */
+    size_t summary(char *buf, size_t len) const;
+
+  private:
+    uint32_t _throttle_heap = ELEGANTOTA_THROTTLE_HEAP;
+    uint32_t _reject_heap = ELEGANTOTA_REJECT_HEAP;
+    uint32_t _min_block = ELEGANTOTA_MIN_BLOCK;
+
+    ElegantOTAResources _low = {0, 0, 0};
+    bool     _throttled = false;
+    uint32_t _throttle_count = 0;
+};
+
+#endif
@@ -0,0 +1,118 @@
+#include "ElegantOTAHistory.h"
+
+#define HISTORY_WINDOW_MS 1000
+
+void ElegantOTAHistory::begin(fs::FS *fs) {
+  _fs = fs;
+  _count = 0;
+  _next = 0;
+  _seq = 0;
+  if (ELEGANTOTA_HISTORY_LEN == 0 || !_fs->exists(ELEGANTOTA_HISTORY_FILE)) {
+    return;
+  }
+  fs::File file = _fs->open(ELEGANTOTA_HISTORY_FILE, "r");
+  if (!file) {
+    return;
+  }
+  // slots are filled in order, the one after the newest record is overwritten next
+  ElegantOTAHistoryRecord record;
+  for (size_t slot = 0; slot < ELEGANTOTA_HISTORY_LEN; slot++) {
+    if (file.read((uint8_t *)&record, sizeof(record)) != sizeof(record) || record.magic != ELEGANTOTA_HISTORY_MAGIC) {
+      break;
+    }
+    _count++;
+    if (slot == 0 || record.seq >= _seq) {
+      _seq = record.seq + 1;
+      _next = (slot + 1) % ELEGANTOTA_HISTORY_LEN;
+    }
+  }
+  file.close();
+}
+
+bool ElegantOTAHistory::add(ElegantOTAHistoryRecord& record) {
+  if (ELEGANTOTA_HISTORY_LEN == 0 || _fs == NULL) {
+    return false;
+  }
+  // a record held in RAM goes first, it is the older one
+  if (_held) {
+    _held = false;
+    ElegantOTAHistoryRecord held = _held_record;
+    if (!this->write(held)) {
+      this->hold(record);
+      return false;
+    }
+  }
+  if (!this->write(record)) {
+    this->hold(record);
+    return false;
+  }
+  return true;
+}
+
+bool ElegantOTAHistory::write(ElegantOTAHistoryRecord& record) {
+  record.magic = ELEGANTOTA_HISTORY_MAGIC;
+  record.seq = _seq;
+  record.flags &= ~ELEGANTOTA_HISTORY_UNSAVED;
+
+  // "r+" keeps the other slots, a missing file is created
+  fs::File file = _fs->exists(ELEGANTOTA_HISTORY_FILE) ? _fs->open(ELEGANTOTA_HISTORY_FILE, "r+") : _fs->open(ELEGANTOTA_HISTORY_FILE, "w");
+  if (!file) {
+    return false;
+  }
+  bool ok = file.seek(_next * sizeof(record)) && file.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+  file.close();
+  if (!ok) {
+    return false;
+  }
+  _seq++;
+  _next = (_next + 1) % ELEGANTOTA_HISTORY_LEN;
+  if (_count < ELEGANTOTA_HISTORY_LEN) _count++;
+  return true;
+}
+
+void ElegantOTAHistory::hold(const ElegantOTAHistoryRecord& record) {
+  _held_record = record;
+  _held_record.magic = ELEGANTOTA_HISTORY_MAGIC;
+  _held_record.seq = _seq;
+  _held_record.flags |= ELEGANTOTA_HISTORY_UNSAVED;
+  _held = true;
+}
+
+bool ElegantOTAHistory::get(size_t index, ElegantOTAHistoryRecord& record) {
+  if (_held) {
+    if (index == 0) {
+      record = _held_record;
+      return true;
+    }
+    index--;
+  }
+  if (index >= _count) {
+    return false;
+  }
+  size_t slot = (_next + ELEGANTOTA_HISTORY_LEN - 1 - index) % ELEGANTOTA_HISTORY_LEN;
+  fs::File file = _fs->open(ELEGANTOTA_HISTORY_FILE, "r");
+  if (!file) {
+    return false;
+  }
+  bool ok = file.seek(slot * sizeof(record)) && file.read((uint8_t *)&record, sizeof(record)) == sizeof(record);
+  file.close();
+  return ok && record.magic == ELEGANTOTA_HISTORY_MAGIC;
+}
+
+void ElegantOTAHistory::start(uint32_t now) {
+  _window_start = now;
+  _window_bytes = 0;
+  _min_rate = UINT32_MAX;
+}
+
+void ElegantOTAHistory::progress(uint32_t bytes, uint32_t now) {
+  uint32_t elapsed = now - _window_start;
+  if (elapsed < HISTORY_WINDOW_MS) {
+    return;
+  }
+  // a pause longer than a window counts as one slow window
+  uint32_t rate = (uint32_t)((uint64_t)(bytes - _window_bytes) * 1000 / elapsed);
+  if (rate < _min_rate) _min_rate = rate;
+  _window_start = now;
+  _window_bytes = bytes;
+}
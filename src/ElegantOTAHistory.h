@@ -0,0 +1,103 @@
+#ifndef ElegantOTAHistory_h
+#define ElegantOTAHistory_h
+
+#include "Arduino.h"
+#include "FS.h"
+
+// records kept in the history file, the oldest one is overwritten, 0 disables the history
+#ifndef ELEGANTOTA_HISTORY_LEN
+  #define ELEGANTOTA_HISTORY_LEN 16
+#endif
+
+#ifndef ELEGANTOTA_HISTORY_FILE
+  #define ELEGANTOTA_HISTORY_FILE "/ota_history.bin"
+#endif
+
+#define ELEGANTOTA_HISTORY_MAGIC   0x31484F45  // "EOH1", a slot written with this layout
+#define ELEGANTOTA_HISTORY_OK      0
+#define ELEGANTOTA_HISTORY_FAILED  1
+#define ELEGANTOTA_HISTORY_ABORTED 2           // timed out or replaced by another session
+
+// flags of a record
+#define ELEGANTOTA_HISTORY_PROFILE 0x01        // the performance profile was applied
+#define ELEGANTOTA_HISTORY_TCP     0x02        // uploaded over the raw TCP listener
+#define ELEGANTOTA_HISTORY_UNSAVED 0x80        // only in RAM, see ElegantOTAHistory::hold()
+
+/**
+ * @brief one OTA session, stored as is in a slot of the history file
+ */
+struct ElegantOTAHistoryRecord {
+  uint32_t magic;
+  uint32_t seq;          // increases with every record
+  uint32_t time;         // unix time at the end, 0 without system time
+  uint32_t size;         // bytes written
+  uint32_t duration;     // ms from the first byte to the end
+  uint32_t avgRate;      // bytes/s over duration
+  uint32_t minRate;      // bytes/s of the slowest full second, 0 if shorter
+  uint32_t client;       // IPv4 address of the client, 0 for pull()
+  uint8_t  md5[16];      // expected MD5 of the image, zero if none was given
+  uint8_t  mode;         // OTA_Mode
+  uint8_t  result;       // ELEGANTOTA_HISTORY_OK, _FAILED or _ABORTED
+  uint8_t  updateError;  // Update.getError()
+  uint8_t  flags;
+  char     version[16];  // FWVersion running during the update
+  char     error[32];
+};
+
+/**
+ * @brief ring of the last ELEGANTOTA_HISTORY_LEN sessions in a file of fixed size slots
+ *
+ * add() writes exactly one slot per session, the one of the oldest record, so the file
+ * never grows past ELEGANTOTA_HISTORY_LEN records and a session costs one small write.
+ * LittleFS commits the write atomically, a power loss leaves either the old or the new
+ * record. The slots are scanned once in begin() for the newest sequence number.
+ *
+ * The class also measures the session: start() at the first byte, progress() with the
+ * bytes written so far, the slowest full second ends up in minRate().
+ */
+class ElegantOTAHistory {
+  public:
+    void begin(fs::FS *fs);
+
+    /**
+     * @brief append a record (after the one held in RAM), assigns magic and sequence number
+     * @return false if the file could not be written, the record is held in RAM then
+     */
+    bool add(ElegantOTAHistoryRecord& record);
+
+    /**
+     * @brief keep a record in RAM only, it is listed first by get() and written by the next add()
+     */
+    void hold(const ElegantOTAHistoryRecord& record);
+
+    /**
+     * @brief number of records, the one in RAM included
+     */
+    size_t count() const { return _count + (_held ? 1 : 0); }
+
+    /**
+     * @brief read a record, 0 is the newest
+     */
+    bool get(size_t index, ElegantOTAHistoryRecord& record);
+
+    void start(uint32_t now);
+    void progress(uint32_t bytes, uint32_t now);
+    uint32_t minRate() const { return _min_rate == UINT32_MAX ? 0 : _min_rate; }
+
+  private:
+    bool write(ElegantOTAHistoryRecord& record);
+
+    fs::FS * _fs = NULL;
+    size_t   _count = 0;   // valid slots in the file
+    size_t   _next = 0;    // slot the next record goes to
+    uint32_t _seq = 0;     // sequence number of the next record
+
+    bool     _held = false;
+    ElegantOTAHistoryRecord _held_record;
+
+    uint32_t _window_start = 0;
+    uint32_t _window_bytes = 0;
+    uint32_t _min_rate = UINT32_MAX;
+};
+
+#endif
@@ -0,0 +1,143 @@
+#include "ElegantOTAImage.h"
+
+#define IMAGE_MAGIC           0xE9
+#define IMAGE_GZIP_MAGIC      0x8B1F
+#define IMAGE_MAX_SEGMENTS    16
+#define IMAGE_CHIP_ID_OFFSET  12
+#define IMAGE_APP_DESC_OFFSET 32
+#define IMAGE_APP_DESC_MAGIC  0xABCD5432
+#define IMAGE_VERSION_OFFSET  48
+#define IMAGE_PROJECT_OFFSET  80
+#define IMAGE_FIELD_LEN       32
+
+static const struct {
+  uint16_t     id;
+  const char * family;
+} chipIds[] = {
+  { 0x0000, "ESP32" },
+  { 0x0002, "ESP32-S2" },
+  { 0x0005, "ESP32-C3" },
+  { 0x0009, "ESP32-S3" },
+  { 0x000C, "ESP32-C2" },
+  { 0x000D, "ESP32-C6" },
+  { 0x0010, "ESP32-H2" },
+  { 0x0012, "ESP32-P4" },
+  { 0x0014, "ESP32-C61" },
+  { 0x0017, "ESP32-C5" },
+};
+
+bool ElegantOTAImageCheck::feed(const uint8_t *data, size_t len) {
+  if (this->complete()) return false;
+
+  size_t n = HEADER_LEN - _len;
+  if (len < n) n = len;
+  memcpy(_buf + _len, data, n);
+  _len += n;
+
+  return this->complete();
+}
+
+uint32_t ElegantOTAImageCheck::readU32(size_t offset) const {
+  return (uint32_t)_buf[offset] | ((uint32_t)_buf[offset + 1] << 8) | ((uint32_t)_buf[offset + 2] << 16) | ((uint32_t)_buf[offset + 3] << 24);
+}
+
+const char * ElegantOTAImageCheck::deviceChipFamily() {
+  #if defined(ESP8266)
+    return "ESP8266";
+  #else
+    // the id the build writes into its own images, board variants like lolin_s3 or XIAO_ESP32S3 do not name the chip
+    #if defined(CONFIG_IDF_FIRMWARE_CHIP_ID)
+      const char * family = chipFamilyName(CONFIG_IDF_FIRMWARE_CHIP_ID);
+      if (family != NULL) return family;
+    #endif
+    #if defined(CONFIG_IDF_TARGET_ESP32S2)
+      return "ESP32-S2";
+    #elif defined(CONFIG_IDF_TARGET_ESP32S3)
+      return "ESP32-S3";
+    #elif defined(CONFIG_IDF_TARGET_ESP32C2)
+      return "ESP32-C2";
+    #elif defined(CONFIG_IDF_TARGET_ESP32C3)
+      return "ESP32-C3";
+    #elif defined(CONFIG_IDF_TARGET_ESP32C5)
+      return "ESP32-C5";
+    #elif defined(CONFIG_IDF_TARGET_ESP32C61)
+      return "ESP32-C61";
+    #elif defined(CONFIG_IDF_TARGET_ESP32C6)
+      return "ESP32-C6";
+    #elif defined(CONFIG_IDF_TARGET_ESP32H2)
+      return "ESP32-H2";
+    #elif defined(CONFIG_IDF_TARGET_ESP32P4)
+      return "ESP32-P4";
+    #else
+      return "ESP32";
+    #endif
+  #endif
+}
+
+const char * ElegantOTAImageCheck::chipFamilyName(uint16_t chipId) {
+  for (size_t i = 0; i < sizeof(chipIds) / sizeof(chipIds[0]); i++) {
+    if (chipIds[i].id == chipId) return chipIds[i].family;
+  }
+  return NULL;
+}
+
+bool ElegantOTAImageCheck::validate(const char *chipFamily, const char *project, const char *runningVersion, char *error, size_t errorLen) const {
+  if (_len < 16) {
+    snprintf(error, errorLen, "Image too small");
+    return false;
+  }
+  bool esp8266 = strcmp(chipFamily, "ESP8266") == 0;
+  // the ESP8266 updater takes gzip compressed images as well, eboot inflates them at boot
+  if (esp8266 && (_buf[0] | (_buf[1] << 8)) == IMAGE_GZIP_MAGIC) {
+    return true;
+  }
+  if (_buf[0] != IMAGE_MAGIC) {
+    snprintf(error, errorLen, "Invalid image magic 0x%02X", _buf[0]);
+    return false;
+  }
+  if (_buf[1] == 0 || _buf[1] > IMAGE_MAX_SEGMENTS) {
+    snprintf(error, errorLen, "Invalid image segment count %u", _buf[1]);
+    return false;
+  }
+
+  if (esp8266) {
+    // no chip id here, but an ESP32 extended header never looks like a valid ESP8266 load address
+    uint32_t load_addr = this->readU32(8);
+    if (load_addr < 0x3FFE8000 || load_addr >= 0x40300000) {
+      snprintf(error, errorLen, "Image is not built for ESP8266");
+      return false;
+    }
+    return true;
+  }
+
+  if (_len < IMAGE_APP_DESC_OFFSET) {
+    snprintf(error, errorLen, "Image too small");
+    return false;
+  }
+
+  uint16_t chip_id = _buf[IMAGE_CHIP_ID_OFFSET] | (_buf[IMAGE_CHIP_ID_OFFSET + 1] << 8);
+  const char * image_family = chipFamilyName(chip_id);
+  if (image_family == NULL || strcmp(image_family, chipFamily) != 0) {
+    snprintf(error, errorLen, "Image built for %s, device is %s", image_family ? image_family : "unknown chip", chipFamily);
+    return false;
+  }
+
+  // the app descriptor is optional, only check it if the image carries one
+  if (!this->complete() || this->readU32(IMAGE_APP_DESC_OFFSET) != IMAGE_APP_DESC_MAGIC) {
+    return true;
+  }
+
+  const char * image_version = (const char *)_buf + IMAGE_VERSION_OFFSET;
+  const char * image_project = (const char *)_buf + IMAGE_PROJECT_OFFSET;
+
+  if (project != NULL && project[0] != '\0' && strncmp(image_project, project, IMAGE_FIELD_LEN) != 0) {
+    snprintf(error, errorLen, "Image project %.32s does not match %s", image_project, project);
+    return false;
+  }
+  if (runningVersion != NULL && runningVersion[0] != '\0' && strncmp(image_version, runningVersion, IMAGE_FIELD_LEN) == 0) {
+    snprintf(error, errorLen, "Image version %.32s is already running", image_version);
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,64 @@
+#ifndef ElegantOTAImage_h
+#define ElegantOTAImage_h
+
+#include "Arduino.h"
+
+/**
+ * @brief collects the first bytes of a firmware upload and validates the image header
+ *
+ * The Update object buffers a whole flash sector before it writes anything, so the
+ * header can be checked while the first chunks pass through, long before the
+ * transfer is finished and without touching the flash.
+ *
+ * Layout of an ESP32 image (esp_image_format.h):
+ *   0   image header (magic 0xE9, segment count, flash mode/size, entry address)
+ *   8   extended header (chip id at offset 12)
+ *   24  first segment header (load address, length)
+ *   32  esp_app_desc_t (magic 0xABCD5432, version at 48, project name at 80)
+ * ESP8266 images have no extended header, the first segment header follows at 8, or
+ * are gzip compressed (magic 0x1F 0x8B).
+ */
+class ElegantOTAImageCheck {
+  public:
+    static const size_t HEADER_LEN = 112;
+
+    void reset() { _len = 0; }
+
+    /**
+     * @brief copy bytes of the upload into the header buffer
+     * @return true if the header just got complete with this chunk
+     */
+    bool feed(const uint8_t *data, size_t len);
+
+    bool complete() const { return _len >= HEADER_LEN; }
+
+    /**
+     * @brief validate the collected header against the running device
+     * @param chipFamily the chip family of the device, see ElegantOTAClass::getChipFamily()
+     * @param project required project name of the app descriptor, NULL or empty to skip
+     * @param runningVersion reject images with this version, NULL or empty to skip
+     * @param error buffer receiving the reason of a rejection
+     * @param errorLen size of the error buffer
+     * @return true if the image is acceptable
+     */
+    bool validate(const char *chipFamily, const char *project, const char *runningVersion, char *error, size_t errorLen) const;
+
+    /**
+     * @brief translate the chip id of the extended header to a chip family name
+     * @return the family name or NULL if unknown
+     */
+    static const char * chipFamilyName(uint16_t chipId);
+
+    /**
+     * @brief chip family of the running build, taken from the IDF target and not the board variant
+     */
+    static const char * deviceChipFamily();
+
+  private:
+    uint8_t _buf[HEADER_LEN];
+    size_t  _len = 0;
+
+    uint32_t readU32(size_t offset) const;
+};
+
+#endif
@@ -0,0 +1,244 @@
+#include "ElegantOTA.h"
+
+/*
+ * Multicast firmware distribution, one transmission for a whole fleet:
+ *
+ *   GET /ota/start?mode=multicast&size=..&hash=..&group=..&port=..&id=..&block=..&k=..
+ *                                         join the group, size and MD5 of the image are
+ *                                         required, block (default ELEGANTOTA_MULTICAST_BLOCK)
+ *                                         and k (blocks per parity block, default 8, 0 for none)
+ *                                         must match the sender
+ *   GET /ota/multicast/status             {"blocks":..,"missing":..,"recovered":..,
+ *                                         "ranges":[[first,last],..],"truncated":false}
+ *                                         the missing blocks, polled by the sender after each round
+ *   GET /ota/multicast/finish             202 + Retry-After, loop() reads the image back from flash
+ *                                         and checks its MD5, polled until 200 once the image boots
+ *                                         next or 400 with the reason; 400 while blocks are missing
+ *
+ * UDP packets to group:port, all numbers little endian:
+ *   0   "EOTM"
+ *   4   type, 0 data block, 1 parity block of a group
+ *   5   reserved
+ *   6   id of the transfer, packets of other transfers are ignored
+ *   8   block index or group index
+ *   12  payload, block bytes (the last block shorter), parity blocks are always full size
+ *
+ * The packets are not authenticated, the MD5 given to the authenticated /ota/start is
+ * checked before the image is booted, so a forged packet can only make the update fail.
+ * Devices in WiFi modem sleep receive multicast only at DTIM beacons, WiFi.setSleep(false)
+ * keeps up with the sender. See scripts/elegantota_multicast.py for the sender.
+ */
+
+#define MULTICAST_MAGIC       "EOTM"
+#define MULTICAST_HEADER_LEN  12
+#define MULTICAST_DATA        0
+#define MULTICAST_PARITY      1
+#define MULTICAST_GROUP       "239.255.51.51"
+#define MULTICAST_PORT        3233
+#define MULTICAST_FEC_GROUP   8
+#define MULTICAST_BURST       16   // packets written per loop()
+#define MULTICAST_MAX_RANGES  64   // ranges per status answer, the sender asks again after the next round
+
+bool ElegantOTAClass::checkMulticastRequest(AsyncWebServerRequest *request) {
+  if (!this->isAuthorized(request)) {
+    request->requestAuthentication();
+    return false;
+  }
+  if (this->isSessionBusy(request)) {
+    this->sendSessionBusy(request);
+    return false;
+  }
+  if (!this->isSessionOwner(request) || !_mcast_active) {
+    // a session the device ended itself tells the sender why
+    bool failed = _currentOtaMode == OTA_MODE_MULTICAST && !_update_error_str.isEmpty();
+    request->send(400, "text/plain", failed ? _update_error_str.c_str() : "No multicast session started");
+    return false;
+  }
+  _session_activity_millis = millis();
+  return true;
+}
+
+bool ElegantOTAClass::startMulticast(AsyncWebServerRequest *request) {
+  this->_currentOtaMode = OTA_MODE_MULTICAST;
+  _update_error_str.clear();
+  _mcast_committed = false;
+
+  // blocks arrive out of order, a streaming decryptor cannot follow
+  if (_encryption_required) {
+    _update_error_str = "Encrypted image required";
+    return false;
+  }
+  uint32_t size = request->hasParam("size") ? strtoul(request->getParam("size")->value().c_str(), NULL, 10) : 0;
+  const char *hash = request->hasParam("hash") ? request->getParam("hash")->value().c_str() : "";
+  if (size == 0) {
+    _update_error_str = "Image size missing";
+    return false;
+  }
+  if (strlen(hash) != 32) {
+    _update_error_str = "MD5 parameter invalid";
+    return false;
+  }
+  const char *group_str = request->hasParam("group") ? request->getParam("group")->value().c_str() : MULTICAST_GROUP;
+  IPAddress group;
+  int first_octet = atoi(group_str);
+  if (!group.fromString(group_str) || first_octet < 224 || first_octet > 239) {
+    _update_error_str = "Invalid multicast group";
+    return false;
+  }
+  uint16_t port = request->hasParam("port") ? atoi(request->getParam("port")->value().c_str()) : MULTICAST_PORT;
+  uint16_t block = request->hasParam("block") ? atoi(request->getParam("block")->value().c_str()) : ELEGANTOTA_MULTICAST_BLOCK;
+  int k = request->hasParam("k") ? atoi(request->getParam("k")->value().c_str()) : MULTICAST_FEC_GROUP;
+  if (k < 0 || k > 64) {
+    _update_error_str = "Invalid parity group";
+    return false;
+  }
+
+  if (preUpdateCallback != NULL) preUpdateCallback();
+
+  _current_progress_size = 0;
+  _image_check.reset();
+  // bookkeeping, block buffers and the packet buffer come from one reservation, the packets are received into it
+  if (!this->reserveSession(ElegantOTABlocks::arenaSize(size, block, k, false) + ElegantOTAArena::align(MULTICAST_HEADER_LEN + block),
+                            ElegantOTABlocks::arenaSize(size, block, k, true))) {
+    if (postUpdateCallback != NULL) postUpdateCallback(false);
+    return false;
+  }
+  if (!_blocks.begin(size, block, k, &_arena)) {
+    _update_error_str = _blocks.error();
+    _arena.end();
+    if (postUpdateCallback != NULL) postUpdateCallback(false);
+    return false;
+  }
+  _mcast_packet = (uint8_t *)_arena.alloc(MULTICAST_HEADER_LEN + block, false);
+  #if defined(ESP8266)
+    bool joined = _mcast_udp.beginMulticast(WiFi.localIP(), group, port);
+  #else
+    bool joined = _mcast_udp.beginMulticast(group, port);
+  #endif
+  if (!joined) {
+    this->endMulticast();
+    _arena.end();
+    _update_error_str = "Failed to join the multicast group";
+    if (postUpdateCallback != NULL) postUpdateCallback(false);
+    return false;
+  }
+  _mcast_md5 = hash;
+  _session_md5 = hash;
+  _mcast_id = request->hasParam("id") ? atoi(request->getParam("id")->value().c_str()) : 0;
+  _mcast_active = true;
+  this->logf("Multicast receive: %u bytes in %u blocks from %s:%u", (unsigned)size, (unsigned)_blocks.blocks(), group_str, port);
+  return true;
+}
+
+void ElegantOTAClass::endMulticast() {
+  _mcast_udp.stop();
+  _blocks.end();
+  // the buffers are released with the session arena
+  _mcast_packet = NULL;
+  _mcast_active = false;
+  _mcast_verifying = false;
+}
+
+void ElegantOTAClass::pollMulticast() {
+  size_t capacity = MULTICAST_HEADER_LEN + _blocks.blockSize();
+  for (int i = 0; i < MULTICAST_BURST && _mcast_active; i++) {
+    if (_mcast_udp.parsePacket() <= 0) return;
+    int len = _mcast_udp.read(_mcast_packet, capacity);
+    const uint8_t *p = _mcast_packet;
+    if (len < MULTICAST_HEADER_LEN || memcmp(p, MULTICAST_MAGIC, 4) != 0 || (uint16_t)(p[6] | p[7] << 8) != _mcast_id) {
+      continue;
+    }
+    _session_activity_millis = millis();
+    uint32_t index = (uint32_t)p[8] | (uint32_t)p[9] << 8 | (uint32_t)p[10] << 16 | (uint32_t)p[11] << 24;
+    bool ok = true;
+    if (p[4] == MULTICAST_DATA) {
+      ok = _blocks.data(index, p + MULTICAST_HEADER_LEN, len - MULTICAST_HEADER_LEN);
+    } else if (p[4] == MULTICAST_PARITY) {
+      ok = _blocks.repair(index, p + MULTICAST_HEADER_LEN, len - MULTICAST_HEADER_LEN);
+    }
+    if (!ok) {
+      this->failUpdate(_blocks.error() != NULL ? _blocks.error() : _update_error_str.c_str());
+      if (postUpdateCallback != NULL) postUpdateCallback(false);
+      return;
+    }
+  }
+}
+
+void ElegantOTAClass::verifyMulticast() {
+  uint32_t count = ELEGANTOTA_MULTICAST_VERIFY_SLICE / _blocks.blockSize();
+  ElegantOTABlocks::Commit state = _blocks.commitStep(_mcast_md5.c_str(), count ? count : 1);
+  if (state == ElegantOTABlocks::COMMIT_RUNNING) return;
+  if (state == ElegantOTABlocks::COMMIT_FAILED) {
+    // the sender reads the reason from its next poll of /ota/multicast/finish
+    this->failUpdate(_blocks.error());
+    if (postUpdateCallback != NULL) postUpdateCallback(false);
+    return;
+  }
+  this->logf("Multicast update complete, %u of %u blocks recovered from parity", (unsigned)_blocks.recovered(), (unsigned)_blocks.blocks());
+  _mcast_committed = true;
+  if (postUpdateCallback != NULL) postUpdateCallback(true);
+  this->closeSession(false);
+  this->logResources();
+  if (_auto_reboot) {
+    _reboot_request_millis = millis();
+    _reboot = true;
+  }
+}
+
+void ElegantOTAClass::beginMulticast() {
+  _blocks.onBlock = [&](uint32_t index, const uint8_t *data, size_t len) {
+    // the header is checked whenever the first block arrives, before it is written
+    if (index == 0 && _image_check_enabled) {
+      _image_check.feed(data, len);
+      if (!this->checkImageHeader()) return false;
+    }
+    _current_progress_size += len;
+    _history.progress(_current_progress_size, millis());
+    if (progressUpdateCallback != NULL) progressUpdateCallback(_current_progress_size, _blocks.size());
+    return true;
+  };
+
+  _server->on("/ota/multicast/status", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->checkMulticastRequest(request)) return;
+      JsonDocument doc;
+      doc["blocks"] = _blocks.blocks();
+      doc["missing"] = _blocks.missing();
+      doc["recovered"] = _blocks.recovered();
+      JsonArray ranges = doc["ranges"].to<JsonArray>();
+      uint32_t first = _blocks.nextMissing(0);
+      for (size_t n = 0; first < _blocks.blocks() && n < MULTICAST_MAX_RANGES; n++) {
+        uint32_t end = _blocks.nextPresent(first);
+        JsonArray range = ranges.add<JsonArray>();
+        range.add(first);
+        range.add(end - 1);
+        first = _blocks.nextMissing(end);
+      }
+      doc["truncated"] = first < _blocks.blocks();
+      AsyncResponseStream *response = request->beginResponseStream("application/json");
+      ArduinoJson::serializeJson(doc, *response);
+      request->send(response);
+  });
+
+  _server->on("/ota/multicast/finish", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      // loop() verified the image and closed the session, a later poll learns it boots next
+      if (_mcast_committed && _currentOtaMode == OTA_MODE_MULTICAST && !_session_active && this->isAuthorized(request)) {
+        AsyncWebServerResponse *response = request->beginResponse(200, "text/plain", "OK");
+        response->addHeader("Connection", "close");
+        return request->send(response);
+      }
+      if (!this->checkMulticastRequest(request)) return;
+      if (!_mcast_verifying) {
+        if (!_blocks.beginCommit()) {
+          // the session stays open for another repair round
+          char reason[40];
+          snprintf(reason, sizeof(reason), "%u blocks missing", (unsigned)_blocks.missing());
+          return request->send(400, "text/plain", reason);
+        }
+        // reading the image back takes seconds on a large image, too long for the network task
+        _mcast_verifying = true;
+      }
+      AsyncWebServerResponse *response = request->beginResponse(202, "text/plain", "Verifying");
+      response->addHeader("Retry-After", "1");
+      request->send(response);
+  });
+}
@@ -0,0 +1,387 @@
+#include "ElegantOTA.h"
+#if defined(ESP32)
+  #include "mdns.h"
+  #include "esp_idf_version.h"
+#endif
+
+/*
+ * Peer distribution: an updated device hands its running image to the next ones, so a
+ * rollout fans out over the LAN instead of pulling every copy through the site uplink.
+ *
+ *   GET /ota/self.bin                     the running firmware image, read from flash straight
+ *                                         into the response buffers; X-Image-MD5, X-Chip-Family,
+ *                                         X-FW-Variant and X-FW-Version describe it. No
+ *                                         authentication, pulling devices send no credentials.
+ *                                         503 + Retry-After while ELEGANTOTA_PEER_MAX_DOWNLOADS
+ *                                         downloads are running. 403 once setEncryptionKey()
+ *                                         was called: the running image holds the key, serving it
+ *                                         to anyone would let them forge encrypted images
+ *   GET /ota/pull?url=..&hash=..&version=..
+ *                                         start pull(), 202 once queued
+ *
+ * A pull is a state machine advanced by loop(): the mDNS query runs asynchronously, the
+ * download is an ElegantOTAFetch whose body is written on the network task like an
+ * upload. Peers are only asked when the MD5 of the image is known, their image has to
+ * carry it and Update checks it again, the url of the pull is the only source trusted
+ * without one.
+ *
+ * See scripts/elegantota_p2p.py for the fleet side and a simulation.
+ */
+
+// steps of a pull, _pull_step
+#define PULL_IDLE      0
+#define PULL_QUERY     1   // the mDNS query for peers runs
+#define PULL_NEXT      2   // start the next source
+#define PULL_FETCH     3   // a download runs
+#define PULL_WAIT      4   // every peer with the image was busy, query again
+
+// outcome of a source, _pull_result
+#define PULL_FAILED    0
+#define PULL_BUSY      1
+#define PULL_MISMATCH  2
+
+#define PULL_RETRY_MS      1000
+#define PULL_PEER_WAIT_MS  60000
+#define PULL_QUERY_MS      1000
+#define PULL_READ_TIMEOUT  10000
+
+static const char * const pull_headers[] = {"X-Image-MD5", "X-Chip-Family", "X-FW-Variant", "X-FW-Version"};
+
+void ElegantOTAClass::setPeerServing(bool enable) {
+  this->_peer_serving = enable;
+}
+
+bool ElegantOTAClass::pull(const char * url, const char * md5, const char * version) {
+  if (url == NULL || (md5 != NULL && md5[0] && strlen(md5) != 32)) {
+    return false;
+  }
+  if (this->isUpdateOwnedElsewhere() || (_session_active && !this->isSessionStale())) {
+    return false;
+  }
+  if (_pull_pending) this->cancelPull();
+  if (!this->admitUpdate()) {
+    return false;
+  }
+
+  _pull_url = url;
+  _pull_md5 = md5;
+  _session_md5 = md5;
+  _pull_version = version;
+  _pull_started_millis = millis();
+  _pull_pending = true;
+  _currentOtaMode = OTA_MODE_FIRMWARE;
+  _update_error_str.clear();
+  _pull_fetch.onHead = [&](int status) { return this->beginPullImage(status); };
+  _pull_fetch.onBody = [&](const uint8_t *data, size_t len) {
+    // the body arrives on the network task, written like the data of an upload
+    _session_activity_millis = millis();
+    this->throttleUpload(_pull_fetch.client());
+    if (!this->writeImage(data, len)) return false;
+    _history.progress(_current_progress_size, millis());
+    if (progressUpdateCallback != NULL) progressUpdateCallback(_current_progress_size, _pull_fetch.length() > 0 ? _pull_fetch.length() : 0);
+    return true;
+  };
+
+  // uploads get 409 until the pull is done, nobody owns the session from outside
+  this->openSession((uint32_t)0);
+  if (preUpdateCallback != NULL) preUpdateCallback();
+  this->logf("Pull of %s queued", url);
+  this->queryPeers();
+  return true;
+}
+
+void ElegantOTAClass::beginPeer() {
+  if (_peer_serving) {
+    // open to every device, a pulling device never sends its credentials to a peer
+    _server->on("/ota/self.bin", HTTP_GET, [&](AsyncWebServerRequest *request) {
+        // the key may be set after begin(), checked for every request
+        if (_decryptor != NULL) {
+          return request->send(403, "text/plain", "Peer serving is disabled with an encryption key");
+        }
+        if (_peer_downloads >= ELEGANTOTA_PEER_MAX_DOWNLOADS) {
+          AsyncWebServerResponse *response = request->beginResponse(503, "text/plain", "Busy");
+          response->addHeader("Retry-After", "2");
+          return request->send(response);
+        }
+
+        // both cores cache the size and MD5 of the running sketch after the first call
+        size_t size = ESP.getSketchSize();
+        #if defined(ESP32)
+          const esp_partition_t *running = esp_ota_get_running_partition();
+          if (running == NULL) {
+            return request->send(500, "text/plain", "Running partition not found");
+          }
+        #endif
+
+        AsyncWebServerResponse *response = request->beginResponse("application/octet-stream", size,
+          [=](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            size_t n = size - index < maxLen ? size - index : maxLen;
+            #if defined(ESP32)
+              if (esp_partition_read(running, index, buffer, n) != ESP_OK) return 0;
+            #elif defined(ESP8266)
+              // the running sketch starts at flash offset 0
+              if (!ESP.flashRead(index, buffer, n)) return 0;
+            #endif
+            return n;
+        });
+        response->addHeader("X-Image-MD5", ESP.getSketchMD5());
+        response->addHeader("X-Chip-Family", this->getChipFamily());
+        response->addHeader("X-FW-Variant", FWVariant.c_str());
+        response->addHeader("X-FW-Version", FWVersion.c_str());
+
+        _peer_downloads++;
+        request->onDisconnect([&]() { if (_peer_downloads) _peer_downloads--; });
+        request->send(response);
+    });
+  }
+
+  _server->on("/ota/pull", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->isAuthorized(request)) {
+        return request->requestAuthentication();
+      }
+      if (!request->hasParam("url")) {
+        return request->send(400, "text/plain", "url parameter missing");
+      }
+      if (this->isSessionBusy(request)) {
+        return this->sendSessionBusy(request);
+      }
+      const char * md5 = request->hasParam("hash") ? request->getParam("hash")->value().c_str() : NULL;
+      if (md5 != NULL && md5[0] && strlen(md5) != 32) {
+        return request->send(400, "text/plain", "MD5 parameter invalid");
+      }
+      const char * version = request->hasParam("version") ? request->getParam("version")->value().c_str() : NULL;
+      if (!this->pull(request->getParam("url")->value().c_str(), md5, version)) {
+        return this->sendSessionBusy(request);
+      }
+      request->send(202, "text/plain", "OK");
+  });
+}
+
+
+void ElegantOTAClass::runPull() {
+  // the session stays with the pull while it waits for peers, the downloads have their own timeout
+  _session_activity_millis = millis();
+  switch (_pull_step) {
+    case PULL_QUERY:
+      if (this->pollPeers()) this->nextPullSource();
+      break;
+    case PULL_NEXT:
+      this->nextPullSource();
+      break;
+    case PULL_WAIT:
+      if (millis() - _pull_retry_millis >= PULL_RETRY_MS) this->queryPeers();
+      break;
+    case PULL_FETCH:
+      this->checkPullFetch();
+      break;
+  }
+}
+
+void ElegantOTAClass::queryPeers() {
+  _pull_peer_count = 0;
+  _pull_peer_next = 0;
+  _pull_peer_busy = false;
+  _pull_step = PULL_NEXT;
+  if (_pull_md5.isEmpty()) {
+    return;
+  }
+  _pull_query_millis = millis();
+  #if defined(ESP32)
+    #if ESP_IDF_VERSION_MAJOR >= 5
+      _pull_query = mdns_query_async_new(NULL, "_elegantota", "_tcp", MDNS_TYPE_PTR, PULL_QUERY_MS, ELEGANTOTA_PULL_PEERS, NULL);
+    #else
+      _pull_query = mdns_query_async_new(NULL, "_elegantota", "_tcp", MDNS_TYPE_PTR, PULL_QUERY_MS, ELEGANTOTA_PULL_PEERS);
+    #endif
+  #elif defined(ESP8266)
+    // the answers are collected by MDNS.update(), pollPeers() reads them after PULL_QUERY_MS
+    _pull_query = (void *)MDNS.installServiceQuery("elegantota", "tcp",
+      [](const MDNSResponder::MDNSServiceInfo&, MDNSResponder::AnswerType, bool) {});
+  #endif
+  if (_pull_query != NULL) _pull_step = PULL_QUERY;
+}
+
+#if defined(ESP32)
+static const char * peerTxt(const mdns_result_t *result, const char *key) {
+  for (size_t i = 0; i < result->txt_count; i++) {
+    if (strcmp(result->txt[i].key, key) == 0) return result->txt[i].value != NULL ? result->txt[i].value : "";
+  }
+  return "";
+}
+#endif
+
+bool ElegantOTAClass::pollPeers() {
+  uint32_t self = (uint32_t)WiFi.localIP();
+  #if defined(ESP32)
+    mdns_search_once_t *search = (mdns_search_once_t *)_pull_query;
+    mdns_result_t *results = NULL;
+    #if ESP_IDF_VERSION_MAJOR >= 5
+      uint8_t count = 0;
+      if (!mdns_query_async_get_results(search, 0, &results, &count)) return false;
+    #else
+      if (!mdns_query_async_get_results(search, 0, &results)) return false;
+    #endif
+    for (mdns_result_t *r = results; r != NULL && _pull_peer_count < ELEGANTOTA_PULL_PEERS; r = r->next) {
+      // skip devices whose advertisement already shows they cannot help
+      if (strcmp(peerTxt(r, "chip"), this->getChipFamily()) != 0 || FWVariant != peerTxt(r, "variant")) continue;
+      if (!_pull_version.isEmpty() && _pull_version != peerTxt(r, "version")) continue;
+      for (mdns_ip_addr_t *a = r->addr; a != NULL; a = a->next) {
+        if (a->addr.type != ESP_IPADDR_TYPE_V4 || a->addr.u_addr.ip4.addr == self) continue;
+        _pull_peers[_pull_peer_count].ip = a->addr.u_addr.ip4.addr;
+        _pull_peers[_pull_peer_count].port = r->port;
+        _pull_peer_count++;
+        break;
+      }
+    }
+    mdns_query_results_free(results);
+  #elif defined(ESP8266)
+    if (millis() - _pull_query_millis < PULL_QUERY_MS) return false;
+    MDNSResponder::hMDNSServiceQuery query = (MDNSResponder::hMDNSServiceQuery)_pull_query;
+    uint32_t answers = MDNS.answerCount(query);
+    for (uint32_t i = 0; i < answers && _pull_peer_count < ELEGANTOTA_PULL_PEERS; i++) {
+      if (!MDNS.hasAnswerIP4Address(query, i) || !MDNS.hasAnswerPort(query, i)) continue;
+      uint32_t ip = (uint32_t)MDNS.answerIP4Address(query, i, 0);
+      if (ip == self) continue;
+      _pull_peers[_pull_peer_count].ip = ip;
+      _pull_peers[_pull_peer_count].port = MDNS.answerPort(query, i);
+      _pull_peer_count++;
+    }
+  #endif
+  this->endPeerQuery();
+  this->logf("%u peers found", (unsigned)_pull_peer_count);
+  return true;
+}
+
+void ElegantOTAClass::endPeerQuery() {
+  if (_pull_query == NULL) return;
+  #if defined(ESP32)
+    mdns_query_async_delete((mdns_search_once_t *)_pull_query);
+  #elif defined(ESP8266)
+    MDNS.removeServiceQuery((MDNSResponder::hMDNSServiceQuery)_pull_query);
+  #endif
+  _pull_query = NULL;
+}
+
+void ElegantOTAClass::nextPullSource() {
+  _pull_result = PULL_FAILED;
+  _update_error_str.clear();
+  if (_pull_peer_next < _pull_peer_count) {
+    const ElegantOTAPeerAddress& peer = _pull_peers[_pull_peer_next++];
+    char url[48];   // http://255.255.255.255:65535/ota/self.bin
+    snprintf(url, sizeof(url), "http://%s:%u/ota/self.bin", IPAddress(peer.ip).toString().c_str(), peer.port);
+    _pull_from_peer = true;
+    _pull_step = PULL_FETCH;
+    if (!_pull_fetch.begin(url, pull_headers, 4)) this->checkPullFetch();
+    return;
+  }
+  // a peer with the image exists but is serving someone else, wait for it or the next one
+  if (_pull_peer_busy && millis() - _pull_started_millis < PULL_PEER_WAIT_MS) {
+    _pull_step = PULL_WAIT;
+    _pull_retry_millis = millis();
+    return;
+  }
+  this->logf("Downloading %s", _pull_url.c_str());
+  _pull_from_peer = false;
+  _pull_step = PULL_FETCH;
+  if (!_pull_fetch.begin(_pull_url.c_str(), pull_headers, 4)) this->checkPullFetch();
+}
+
+bool ElegantOTAClass::beginPullImage(int status) {
+  if (status == 503 && _pull_from_peer) {
+    _pull_result = PULL_BUSY;
+    return false;
+  }
+  if (status != 200) {
+    char reason[32];
+    snprintf(reason, sizeof(reason), "Download failed with %d", status);
+    _update_error_str = reason;
+    return false;
+  }
+  // the advertisement may be outdated, the answer of the peer has to match as well
+  if (_pull_from_peer && (strcmp(_pull_fetch.header(1), this->getChipFamily()) != 0 || FWVariant != _pull_fetch.header(2)
+              || (!_pull_version.isEmpty() && _pull_version != _pull_fetch.header(3)) || strcasecmp(_pull_fetch.header(0), _pull_md5.c_str()) != 0)) {
+    _pull_result = PULL_MISMATCH;
+    return false;
+  }
+
+  int32_t size = _pull_fetch.length();
+  this->logf("Downloading %ld bytes", (long)size);
+  if (!this->reserveSession(0, _writer.chunk())) {
+    return false;
+  }
+  // the body is written on the network task, like an upload
+  #if defined(ESP8266)
+    Update.runAsync(true);
+    bool started = Update.begin(size > 0 ? size : ((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000), U_FLASH);
+  #elif defined(ESP32)
+    bool started = Update.begin(size > 0 ? size : UPDATE_SIZE_UNKNOWN, U_FLASH);
+  #endif
+  // begin() clears the expected MD5, it is only kept when set afterwards
+  if (!started || (!_pull_md5.isEmpty() && !Update.setMD5(_pull_md5.c_str()))) {
+    this->storeUpdateError();
+    return false;
+  }
+  _update_max_size = Update.size();
+  _current_progress_size = 0;
+  _session_data_millis = millis();
+  _history.start(_session_data_millis);
+  _image_check.reset();
+  _writer.begin(&_arena);
+  return true;
+}
+
+void ElegantOTAClass::checkPullFetch() {
+  if (_pull_fetch.running()) {
+    if (millis() - _pull_fetch.activity() < PULL_READ_TIMEOUT) return;
+    _update_error_str = "Download timed out";
+  }
+  bool ok = _pull_fetch.state() == ElegantOTAFetch::DONE;
+  if (!ok && _update_error_str.isEmpty()) {
+    _update_error_str = _pull_fetch.error() != NULL ? _pull_fetch.error() : "Download failed";
+  }
+  _pull_fetch.end();
+
+  if (ok && _image_check_enabled && !_image_check.complete() && !this->checkImageHeader()) ok = false;
+  if (ok && (!_writer.flush() || !Update.end(true))) {
+    this->storeUpdateError();
+    ok = false;
+  }
+  if (ok || !_pull_from_peer) {
+    return this->finishPull(ok);
+  }
+
+  if (_pull_result == PULL_BUSY) {
+    _pull_peer_busy = true;
+  } else if (_pull_result == PULL_FAILED) {
+    this->logf("Peer failed: %s", _update_error_str.c_str());
+  }
+  if (Update.isRunning()) {
+    // release the partition, the device stays reserved for the next source
+    this->closeSession(true);
+    this->openSession((uint32_t)0);
+  }
+  this->nextPullSource();
+}
+
+void ElegantOTAClass::cancelPull() {
+  this->endPeerQuery();
+  _pull_fetch.end();
+  _pull_pending = false;
+  _pull_step = PULL_IDLE;
+}
+
+void ElegantOTAClass::finishPull(bool success) {
+  _pull_pending = false;
+  _pull_step = PULL_IDLE;
+  this->closeSession(!success);
+  if (postUpdateCallback != NULL) postUpdateCallback(success);
+  this->logResources();
+  if (success) {
+    this->logf("Pull complete");
+    if (_auto_reboot) {
+      _reboot_request_millis = millis();
+      _reboot = true;
+    }
+  } else {
+    this->logf("Pull failed: %s", _update_error_str.c_str());
+  }
+}
@@ -0,0 +1,481 @@
+#include "ElegantOTA.h"
+#include <time.h>
+
+/*
+ * Background prefetch: the image trickles into the update partition while the
+ * application keeps running and stays staged until applyStaged() or the apply window,
+ * then only the boot partition switch and the reboot are left.
+ *
+ *   GET /ota/prefetch?url=..&hash=..&rate=..
+ *                                         start prefetch(), 202 once queued
+ *   GET /ota/prefetch/status              {"state":"downloading","size":..,"done":..,"rate":..,"error":""}
+ *   GET /ota/prefetch/apply               applyStaged(), 400 unless an image is staged
+ *
+ * The download runs on an ElegantOTAFetch, loop() never waits for the network. Received
+ * bytes are written on the network task but acknowledged late: every loop() acknowledges
+ * the bytes the rate limiter allows, so the TCP window and with it the server follow the
+ * rate. The write time counts for the CPU share, the limiter rests after each slice. The
+ * progress is saved every ELEGANTOTA_PREFETCH_SAVE bytes, after a reboot the download
+ * continues with a Range request from the last saved sector. The image is read back for
+ * the MD5 in slices of PREFETCH_SLICE_MS before it counts as staged.
+ */
+
+#define PREFETCH_BLOCK         ELEGANTOTA_MULTICAST_BLOCK
+#define PREFETCH_SLICE_MS      5
+#define PREFETCH_RETRY_MS      30000
+#define PREFETCH_TIMEOUT       5000    // connecting and the head of the answer
+#define PREFETCH_STALL_MS      30000
+#define PREFETCH_WINDOW_CHECK  10000
+#define PREFETCH_TIME_VALID    1600000000  // the system time is set once it is past 2020
+
+static const char * const prefetch_state_names[] = {"idle", "downloading", "verifying", "staged", "failed"};
+static const char * const prefetch_headers[] = {"Content-Range"};
+
+void ElegantOTAClass::setStateFileSystem(fs::FS& fs) {
+  this->_state_fs = &fs;
+}
+
+void ElegantOTAClass::setPrefetchLimits(uint32_t bytesPerSecond, uint8_t cpuPercent) {
+  this->_prefetch_default_rate = bytesPerSecond;
+  this->_prefetch_cpu = cpuPercent;
+}
+
+void ElegantOTAClass::setApplyWindow(int8_t fromHour, int8_t toHour) {
+  this->_apply_from = fromHour;
+  this->_apply_to = toHour;
+}
+
+bool ElegantOTAClass::prefetch(const char * url, const char * md5, uint32_t bytesPerSecond) {
+  if (url == NULL || md5 == NULL || strlen(md5) != 32 || strncmp(url, "http://", 7) != 0 || strlen(url) >= ELEGANTOTA_URL_LEN || _update_owner != NULL) {
+    return false;
+  }
+  uint32_t rate = bytesPerSecond ? bytesPerSecond : _prefetch_default_rate;
+
+  // the same image again keeps its progress, a fleet tool may repeat the request
+  bool running = _prefetch_state != OTA_PREFETCH_IDLE && _prefetch_state != OTA_PREFETCH_FAILED;
+  if (running && _prefetch_url == url && strcasecmp(_prefetch_md5.c_str(), md5) == 0) {
+    _prefetch_rate = rate;
+    _prefetch_limiter.begin(rate, _prefetch_cpu, millis());
+    this->savePrefetch();
+    return true;
+  }
+
+  this->cancelPrefetch();
+  _prefetch_url = url;
+  _prefetch_md5 = md5;
+  _prefetch_rate = rate;
+  _prefetch_size = 0;
+  _prefetch_done = 0;
+  _prefetch_error.clear();
+  _prefetch_state = OTA_PREFETCH_DOWNLOADING;
+  _prefetch_limiter.begin(rate, _prefetch_cpu, millis());
+  this->savePrefetch();
+  this->logf("Prefetch of %s at %u bytes/s queued", url, (unsigned)rate);
+  return true;
+}
+
+void ElegantOTAClass::cancelPrefetch() {
+  this->closePrefetchConnection();
+  _prefetch_blocks.end();
+  free(_prefetch_buf);
+  _prefetch_buf = NULL;
+  if (_prefetch_state != OTA_PREFETCH_IDLE && !_state_fs_replaced) {
+    _state_fs->remove(ELEGANTOTA_PREFETCH_FILE);
+  }
+  _prefetch_state = OTA_PREFETCH_IDLE;
+}
+
+bool ElegantOTAClass::applyStaged() {
+  if (_prefetch_state != OTA_PREFETCH_STAGED || _update_owner != NULL) {
+    return false;
+  }
+  // removed first, a power loss right after the switch must not apply the state again from the new firmware
+  if (!_state_fs_replaced) _state_fs->remove(ELEGANTOTA_PREFETCH_FILE);
+  if (!_prefetch_blocks.begin(_prefetch_size, PREFETCH_BLOCK, 0) || !_prefetch_blocks.resume(_prefetch_size) || !_prefetch_blocks.activate()) {
+    this->failPrefetch(_prefetch_blocks.error());
+    return false;
+  }
+  _prefetch_blocks.end();
+  _prefetch_state = OTA_PREFETCH_IDLE;
+  this->logf("Staged image applied");
+  if (_auto_reboot) {
+    _reboot_request_millis = millis();
+    _reboot = true;
+  }
+  return true;
+}
+
+void ElegantOTAClass::beginPrefetch() {
+  _prefetch_fetch.onHead = [&](int status) { return this->beginPrefetchImage(status); };
+  _prefetch_fetch.onBody = [&](const uint8_t *data, size_t len) { return this->receivePrefetch(data, len); };
+  this->loadPrefetch();
+
+  // registered before /ota/prefetch, which would match these urls as well
+  _server->on("/ota/prefetch/status", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->isAuthorized(request)) {
+        return request->requestAuthentication();
+      }
+      JsonDocument doc;
+      doc["state"] = prefetch_state_names[_prefetch_state];
+      doc["size"] = _prefetch_size;
+      doc["done"] = _prefetch_state == OTA_PREFETCH_VERIFYING ? _prefetch_verified : _prefetch_done;
+      doc["rate"] = _prefetch_rate;
+      doc["error"] = _prefetch_error.c_str();
+      AsyncResponseStream *response = request->beginResponseStream("application/json");
+      ArduinoJson::serializeJson(doc, *response);
+      request->send(response);
+  });
+
+  _server->on("/ota/prefetch/apply", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->isAuthorized(request)) {
+        return request->requestAuthentication();
+      }
+      if (this->isSessionBusy(request)) {
+        return this->sendSessionBusy(request);
+      }
+      if (!this->applyStaged()) {
+        return request->send(400, "text/plain", _prefetch_error.isEmpty() ? "No image staged" : _prefetch_error.c_str());
+      }
+      AsyncWebServerResponse *response = request->beginResponse(200, "text/plain", "OK");
+      response->addHeader("Connection", "close");
+      request->send(response);
+  });
+
+  _server->on("/ota/prefetch", HTTP_GET, [&](AsyncWebServerRequest *request) {
+      if (!this->isAuthorized(request)) {
+        return request->requestAuthentication();
+      }
+      if (!request->hasParam("url") || !request->hasParam("hash")) {
+        return request->send(400, "text/plain", "url and hash parameters required");
+      }
+      if (this->isSessionBusy(request) || _update_owner != NULL) {
+        return this->sendSessionBusy(request);
+      }
+      uint32_t rate = request->hasParam("rate") ? strtoul(request->getParam("rate")->value().c_str(), NULL, 10) : 0;
+      if (!this->prefetch(request->getParam("url")->value().c_str(), request->getParam("hash")->value().c_str(), rate)) {
+        return request->send(400, "text/plain", "Invalid url or hash");
+      }
+      request->send(202, "text/plain", "OK");
+  });
+}
+
+void ElegantOTAClass::runPrefetch() {
+  // a session writing firmware overwrites the partition, other sessions only pause the prefetch
+  if (_update_owner != NULL) {
+    OTA_Mode mode = _update_owner->_currentOtaMode;
+    if (mode != OTA_MODE_FILESYSTEM && mode != OTA_MODE_FILES) {
+      this->logf("Prefetch discarded, an OTA session writes the update partition");
+      this->cancelPrefetch();
+    }
+    return;
+  }
+
+  if (_prefetch_state == OTA_PREFETCH_STAGED) {
+    if (_apply_from >= 0 && millis() - _apply_check_millis > PREFETCH_WINDOW_CHECK) {
+      _apply_check_millis = millis();
+      if (this->inApplyWindow()) {
+        this->logf("Apply window reached");
+        this->applyStaged();
+      }
+    }
+    return;
+  }
+  if (_prefetch_state != OTA_PREFETCH_DOWNLOADING && _prefetch_state != OTA_PREFETCH_VERIFYING) {
+    return;
+  }
+
+  unsigned long started = millis();
+  size_t allowance = _prefetch_limiter.allowance(started);
+  if (allowance == 0) {
+    return;
+  }
+  if (_prefetch_state == OTA_PREFETCH_VERIFYING) {
+    if (_prefetch_blocks.active() || this->openPrefetch()) {
+      this->verifyPrefetch(started);
+    } else if (_prefetch_fatal) {
+      this->failPrefetch(_prefetch_fault);
+    } else {
+      this->retryPrefetch(_prefetch_fault);
+    }
+  } else {
+    this->downloadPrefetch(allowance);
+  }
+  // the blocks written on the network task since the last slice belong to this one
+  unsigned long busy = _prefetch_busy;
+  _prefetch_busy = 0;
+  _prefetch_limiter.slice(started - busy, millis());
+}
+
+bool ElegantOTAClass::openPrefetch() {
+  _prefetch_fatal = true;
+  if (!_prefetch_blocks.begin(_prefetch_size, PREFETCH_BLOCK, 0) || !_prefetch_blocks.resume(_prefetch_done)) {
+    _prefetch_fault = _prefetch_blocks.error();
+    return false;
+  }
+  if (_prefetch_buf == NULL) _prefetch_buf = (uint8_t *)malloc(PREFETCH_BLOCK);
+  if (_prefetch_buf == NULL) {
+    _prefetch_blocks.end();
+    _prefetch_fault = "Not enough memory";
+    _prefetch_fatal = false;
+    return false;
+  }
+  // only the header check of the first block, progress is reported by /ota/prefetch/status
+  _prefetch_blocks.onBlock = [&](uint32_t index, const uint8_t *data, size_t len) {
+    if (index != 0 || !_image_check_enabled) return true;
+    _image_check.reset();
+    _image_check.feed(data, len);
+    return this->checkImageHeader();
+  };
+  return true;
+}
+
+void ElegantOTAClass::connectPrefetch() {
+  // a partly received block is fetched again
+  _prefetch_fill = 0;
+  _prefetch_fault = NULL;
+  _prefetch_fatal = false;
+  _prefetch_data_millis = millis();
+  if (!_prefetch_fetch.begin(_prefetch_url.c_str(), prefetch_headers, 1, _prefetch_done)) {
+    this->retryPrefetch(_prefetch_fetch.error());
+  }
+}
+
+void ElegantOTAClass::closePrefetchConnection() {
+  _prefetch_fetch.end();
+}
+
+bool ElegantOTAClass::beginPrefetchImage(int status) {
+  uint32_t total = 0;
+  if (status == 206 && _prefetch_done) {
+    const char *slash = strrchr(_prefetch_fetch.header(0), '/');
+    total = slash != NULL ? strtoul(slash + 1, NULL, 10) : 0;
+  } else if (status == 200) {
+    if (_prefetch_done) {
+      this->logf("Server ignores Range, prefetch starts over");
+      _prefetch_done = 0;
+      _prefetch_blocks.end();
+    }
+    total = _prefetch_fetch.length() > 0 ? _prefetch_fetch.length() : 0;
+  } else {
+    // loop() pauses with the status
+    return false;
+  }
+
+  _prefetch_fatal = true;
+  if (total == 0) {
+    _prefetch_fault = "Image size unknown";
+    return false;
+  }
+  if (_prefetch_size && total != _prefetch_size) {
+    _prefetch_fault = "Image on the server changed";
+    return false;
+  }
+  _prefetch_size = total;
+  if (!_prefetch_blocks.active() && !this->openPrefetch()) {
+    return false;
+  }
+  this->logf("Prefetch from byte %u of %u", (unsigned)_prefetch_done, (unsigned)_prefetch_size);
+  return true;
+}
+
+bool ElegantOTAClass::receivePrefetch(const uint8_t *data, size_t len) {
+  unsigned long started = millis();
+  // loop() acknowledges the bytes at the rate of the prefetch
+  _prefetch_fetch.client()->ackLater();
+  while (len && _prefetch_done < _prefetch_size) {
+    uint32_t index = _prefetch_done / PREFETCH_BLOCK;
+    size_t block = _prefetch_blocks.blockLen(index);
+    size_t n = block - _prefetch_fill;
+    if (n > len) n = len;
+    memcpy(_prefetch_buf + _prefetch_fill, data, n);
+    _prefetch_fill += n;
+    data += n;
+    len -= n;
+    if (_prefetch_fill < block) break;
+
+    if (!_prefetch_blocks.data(index, _prefetch_buf, block)) {
+      _prefetch_fault = _prefetch_blocks.error() != NULL ? _prefetch_blocks.error() : _update_error_str.c_str();
+      _prefetch_fatal = true;
+      return false;
+    }
+    _prefetch_fill = 0;
+    _prefetch_done += block;
+  }
+  _prefetch_busy += millis() - started;
+  return true;
+}
+
+void ElegantOTAClass::checkPrefetchFetch() {
+  if (_prefetch_fetch.state() == ElegantOTAFetch::DONE && _prefetch_done == _prefetch_size) {
+    this->closePrefetchConnection();
+    _prefetch_state = OTA_PREFETCH_VERIFYING;
+    _prefetch_verified = 0;
+    _prefetch_hash.begin();
+    this->savePrefetch();
+    this->logf("Prefetch downloaded, verifying");
+    return;
+  }
+  if (_prefetch_fault != NULL && _prefetch_fatal) {
+    this->failPrefetch(_prefetch_fault);
+  } else if (_prefetch_fault != NULL) {
+    this->retryPrefetch(_prefetch_fault);
+  } else if (_prefetch_fetch.state() == ElegantOTAFetch::FAILED && _prefetch_fetch.error() == NULL) {
+    char reason[32];
+    snprintf(reason, sizeof(reason), "Download failed with %d", _prefetch_fetch.status());
+    this->retryPrefetch(reason);
+  } else {
+    this->retryPrefetch(_prefetch_fetch.error() != NULL ? _prefetch_fetch.error() : "Connection closed");
+  }
+}
+
+void ElegantOTAClass::downloadPrefetch(size_t allowance) {
+  if (_prefetch_fetch.client() == NULL) {
+    this->connectPrefetch();
+    return;
+  }
+  if (!_prefetch_fetch.running()) {
+    this->checkPrefetchFetch();
+    return;
+  }
+  if (_prefetch_fetch.state() != ElegantOTAFetch::BODY) {
+    if (millis() - _prefetch_fetch.activity() > PREFETCH_TIMEOUT) this->retryPrefetch("Connection timed out");
+    return;
+  }
+
+  size_t acked = _prefetch_fetch.client()->ack(allowance);
+  _prefetch_limiter.consume(acked);
+  if (acked) {
+    _prefetch_data_millis = millis();
+  } else if (millis() - _prefetch_data_millis > PREFETCH_STALL_MS && millis() - _prefetch_fetch.activity() > PREFETCH_STALL_MS) {
+    this->retryPrefetch("Download stalled");
+    return;
+  }
+  // a server ignoring Range started over, the state follows
+  if (_prefetch_done < _prefetch_saved || _prefetch_done - _prefetch_saved >= ELEGANTOTA_PREFETCH_SAVE) {
+    this->savePrefetch();
+  }
+}
+
+void ElegantOTAClass::verifyPrefetch(unsigned long started) {
+  while (millis() - started < PREFETCH_SLICE_MS) {
+    uint32_t index = _prefetch_verified / PREFETCH_BLOCK;
+    if (!_prefetch_blocks.readBlock(index, _prefetch_buf)) {
+      this->failPrefetch(_prefetch_blocks.error());
+      return;
+    }
+    size_t len = _prefetch_blocks.blockLen(index);
+    _prefetch_hash.add(_prefetch_buf, len);
+    _prefetch_verified += len;
+    if (_prefetch_verified < _prefetch_size) continue;
+
+    _prefetch_hash.calculate();
+    char digest[33];
+    _prefetch_hash.getChars(digest);
+    if (strcasecmp(digest, _prefetch_md5.c_str()) != 0) {
+      this->failPrefetch("MD5 Check Failed");
+      return;
+    }
+    // the partition stays as it is, applyStaged() only switches the boot image
+    _prefetch_blocks.end();
+    free(_prefetch_buf);
+    _prefetch_buf = NULL;
+    _prefetch_state = OTA_PREFETCH_STAGED;
+    this->savePrefetch();
+    this->logf("Prefetched image of %u bytes staged", (unsigned)_prefetch_size);
+    return;
+  }
+}
+
+void ElegantOTAClass::failPrefetch(const char * reason) {
+  _prefetch_error = reason != NULL ? reason : "Prefetch failed";
+  this->cancelPrefetch();
+  _prefetch_state = OTA_PREFETCH_FAILED;
+  this->logf("Prefetch failed: %s", _prefetch_error.c_str());
+}
+
+void ElegantOTAClass::retryPrefetch(const char * reason) {
+  _prefetch_error = reason;
+  this->closePrefetchConnection();
+  this->savePrefetch();
+  _prefetch_limiter.pause(millis(), PREFETCH_RETRY_MS);
+  this->logf("Prefetch paused: %s", reason);
+}
+
+void ElegantOTAClass::savePrefetch() {
+  // a reboot continues at the last sector boundary, the sector after it is erased again
+  uint32_t done = _prefetch_done == _prefetch_size ? _prefetch_done : _prefetch_done & ~(ElegantOTABlocks::SECTOR_SIZE - 1);
+  _prefetch_saved = _prefetch_done;
+  if (_state_fs_replaced) {
+    // the mounted filesystem no longer matches the flash, the state is lost with the reboot
+    if (!_prefetch_unsaved) this->logf("Prefetch progress not saved, state filesystem replaced");
+    _prefetch_unsaved = true;
+    return;
+  }
+  fs::File file = _state_fs->open(ELEGANTOTA_PREFETCH_FILE, "w");
+  if (!file) {
+    if (!_prefetch_unsaved) this->logf("Prefetch progress not saved, state filesystem not mounted");
+    _prefetch_unsaved = true;
+    return;
+  }
+  JsonDocument doc;
+  doc["url"] = _prefetch_url.c_str();
+  doc["hash"] = _prefetch_md5.c_str();
+  doc["size"] = _prefetch_size;
+  doc["done"] = done;
+  doc["rate"] = _prefetch_rate;
+  doc["staged"] = _prefetch_state == OTA_PREFETCH_STAGED;
+  // the image was written next to this firmware, another one has another update partition
+  doc["running"] = ESP.getSketchMD5().c_str();
+  ArduinoJson::serializeJson(doc, file);
+  file.close();
+}
+
+void ElegantOTAClass::loadPrefetch() {
+  if (!_state_fs->exists(ELEGANTOTA_PREFETCH_FILE)) {
+    return;
+  }
+  fs::File file = _state_fs->open(ELEGANTOTA_PREFETCH_FILE, "r");
+  JsonDocument doc;
+  bool valid = file && !ArduinoJson::deserializeJson(doc, file);
+  file.close();
+  const char * url = doc["url"] | "";
+  const char * md5 = doc["hash"] | "";
+  if (!valid || strncmp(url, "http://", 7) != 0 || strlen(md5) != 32 || ESP.getSketchMD5() != (doc["running"] | "")) {
+    this->logf("Discarding saved prefetch");
+    _state_fs->remove(ELEGANTOTA_PREFETCH_FILE);
+    return;
+  }
+
+  _prefetch_url = url;
+  _prefetch_md5 = md5;
+  _prefetch_size = doc["size"] | 0;
+  _prefetch_done = doc["done"] | 0;
+  _prefetch_saved = _prefetch_done;
+  _prefetch_rate = doc["rate"] | _prefetch_default_rate;
+  _prefetch_error.clear();
+  if (doc["staged"] | false) {
+    _prefetch_state = OTA_PREFETCH_STAGED;
+  } else if (_prefetch_size && _prefetch_done == _prefetch_size) {
+    _prefetch_state = OTA_PREFETCH_VERIFYING;
+    _prefetch_verified = 0;
+    _prefetch_hash.begin();
+  } else {
+    _prefetch_state = OTA_PREFETCH_DOWNLOADING;
+  }
+  _prefetch_limiter.begin(_prefetch_rate, _prefetch_cpu, millis());
+  this->logf("Prefetch resumed: %s, %u of %u bytes", prefetch_state_names[_prefetch_state], (unsigned)_prefetch_done, (unsigned)_prefetch_size);
+}
+
+bool ElegantOTAClass::inApplyWindow() const {
+  time_t now = time(NULL);
+  if (now < PREFETCH_TIME_VALID || _apply_from < 0) {
+    return false;
+  }
+  struct tm local;
+  localtime_r(&now, &local);
+  if (_apply_from <= _apply_to) {
+    return local.tm_hour >= _apply_from && local.tm_hour < _apply_to;
+  }
+  // the window spans midnight
+  return local.tm_hour >= _apply_from || local.tm_hour < _apply_to;
+}
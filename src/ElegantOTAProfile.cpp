@@ -0,0 +1,94 @@
+#include "ElegantOTAProfile.h"
+#include "lwip/opt.h"
+
+void ElegantOTAProfile::setEnabled(bool enable, uint32_t cpuMhz) {
+  _enabled = enable;
+  _target_mhz = cpuMhz;
+}
+
+uint32_t ElegantOTAProfile::maxCpuMhz() {
+  #if defined(ESP8266)
+    return 160;
+  #elif CONFIG_IDF_TARGET_ESP32C2 || CONFIG_IDF_TARGET_ESP32C3 || CONFIG_IDF_TARGET_ESP32C6
+    return 160;
+  #elif CONFIG_IDF_TARGET_ESP32H2
+    return 96;
+  #else
+    return 240;
+  #endif
+}
+
+void ElegantOTAProfile::apply() {
+  if (!_enabled || _applied) return;
+  _applied = true;
+  uint32_t target = _target_mhz ? _target_mhz : maxCpuMhz();
+
+  #if defined(ESP8266)
+    // modem sleep wakes the radio only at beacons, every received segment waits for one
+    _saved_sleep = WiFi.getSleepMode();
+    _sleep_changed = _saved_sleep != WIFI_NONE_SLEEP;
+    if (_sleep_changed) WiFi.setSleepMode(WIFI_NONE_SLEEP);
+
+    _saved_mhz = ESP.getCpuFreqMHz();
+    if (target > _saved_mhz) {
+      system_update_cpu_freq(target);
+    } else {
+      _saved_mhz = 0;
+    }
+  #elif defined(ESP32)
+    _sleep_changed = esp_wifi_get_ps(&_saved_ps) == ESP_OK && _saved_ps != WIFI_PS_NONE;
+    if (_sleep_changed) esp_wifi_set_ps(WIFI_PS_NONE);
+
+    #if CONFIG_PM_ENABLE
+      // with dynamic frequency scaling configured the locks keep the clock up, setCpuFrequencyMhz() would be overridden
+      if (_cpu_lock == NULL) esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "ota", &_cpu_lock);
+      if (_sleep_lock == NULL) esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "ota", &_sleep_lock);
+      if (_cpu_lock != NULL) esp_pm_lock_acquire(_cpu_lock);
+      if (_sleep_lock != NULL) esp_pm_lock_acquire(_sleep_lock);
+    #endif
+
+    _saved_mhz = getCpuFrequencyMhz();
+    if (target > _saved_mhz) {
+      setCpuFrequencyMhz(target);
+    } else {
+      _saved_mhz = 0;
+    }
+  #endif
+}
+
+void ElegantOTAProfile::restore() {
+  if (!_applied) return;
+  _applied = false;
+
+  #if defined(ESP8266)
+    if (_saved_mhz) system_update_cpu_freq(_saved_mhz);
+    if (_sleep_changed) WiFi.setSleepMode(_saved_sleep);
+  #elif defined(ESP32)
+    if (_saved_mhz) setCpuFrequencyMhz(_saved_mhz);
+    #if CONFIG_PM_ENABLE
+      if (_cpu_lock != NULL) esp_pm_lock_release(_cpu_lock);
+      if (_sleep_lock != NULL) esp_pm_lock_release(_sleep_lock);
+    #endif
+    if (_sleep_changed) esp_wifi_set_ps(_saved_ps);
+  #endif
+  _saved_mhz = 0;
+  _sleep_changed = false;
+}
+
+void ElegantOTAProfile::record(uint32_t bytes, uint32_t ms) {
+  if (bytes == 0) return;
+  _last_rate = (uint32_t)((uint64_t)bytes * 1000 / (ms ? ms : 1));
+  _last_profiled = _applied;
+  if (_applied) {
+    _rate_with = _last_rate;
+  } else {
+    _rate_without = _last_rate;
+  }
+}
+
+size_t ElegantOTAProfile::summary(char *buf, size_t len) const {
+  // the receive window is fixed when lwIP is built, it bounds the throughput of a single connection
+  int n = snprintf(buf, len, "last session %u B/s %s profile, last with profile %u B/s, without %u B/s, TCP window %u",
+                   (unsigned)_last_rate, _last_profiled ? "with" : "without", (unsigned)_rate_with, (unsigned)_rate_without, (unsigned)TCP_WND);
+  return n < 0 ? 0 : (size_t)n;
+}
@@ -0,0 +1,91 @@
+#ifndef ElegantOTAProfile_h
+#define ElegantOTAProfile_h
+
+#include "Arduino.h"
+
+#if defined(ESP8266)
+  #include "ESP8266WiFi.h"
+#elif defined(ESP32)
+  #include "esp_wifi.h"
+  #if CONFIG_PM_ENABLE
+    #include "esp_pm.h"
+  #endif
+#endif
+
+// switch the performance profile on for every OTA session, see ElegantOTAClass::setPerformanceProfile()
+#ifndef ELEGANTOTA_PERFORMANCE_PROFILE
+  #define ELEGANTOTA_PERFORMANCE_PROFILE 1
+#endif
+
+/**
+ * @brief raises radio and CPU performance for the duration of an OTA session
+ *
+ * apply() remembers the settings of the application and switches WiFi power save off,
+ * raises the CPU clock and, on ESP32 builds with power management, holds locks against
+ * frequency scaling and light sleep. restore() puts back exactly what apply() changed.
+ * The throughput of the last sessions with and without the profile is kept for the
+ * resource log.
+ */
+class ElegantOTAProfile {
+  public:
+    /**
+     * @param enable apply the profile in apply()
+     * @param cpuMhz CPU clock during the session, 0 for the highest clock of the chip
+     */
+    void setEnabled(bool enable, uint32_t cpuMhz = 0);
+    bool enabled() const { return _enabled; }
+
+    /**
+     * @brief switch to the performance settings, does nothing if disabled or already applied
+     */
+    void apply();
+
+    /**
+     * @brief put back the settings of the application
+     */
+    void restore();
+
+    bool applied() const { return _applied; }
+
+    /**
+     * @brief record the throughput of a session, call before restore()
+     * @param bytes bytes written in the session
+     * @param ms time from the first byte to the end of the session
+     */
+    void record(uint32_t bytes, uint32_t ms);
+
+    /**
+     * @brief highest CPU clock of the chip in MHz
+     */
+    static uint32_t maxCpuMhz();
+
+    /**
+     * @brief print the throughput of the last sessions with and without the profile
+     */
+    size_t summary(char *buf, size_t len) const;
+
+  private:
+    bool     _enabled = ELEGANTOTA_PERFORMANCE_PROFILE;
+    uint32_t _target_mhz = 0;
+    bool     _applied = false;
+
+    // what apply() changed, restore() only touches these
+    uint32_t _saved_mhz = 0;
+    bool     _sleep_changed = false;
+    #if defined(ESP8266)
+      WiFiSleepType_t _saved_sleep = WIFI_NONE_SLEEP;
+    #elif defined(ESP32)
+      wifi_ps_type_t _saved_ps = WIFI_PS_NONE;
+      #if CONFIG_PM_ENABLE
+        esp_pm_lock_handle_t _cpu_lock = NULL;
+        esp_pm_lock_handle_t _sleep_lock = NULL;
+      #endif
+    #endif
+
+    uint32_t _last_rate = 0;       // bytes/s of the last session
+    bool     _last_profiled = false;
+    uint32_t _rate_with = 0;       // last session with the profile
+    uint32_t _rate_without = 0;    // last session without
+};
+
+#endif
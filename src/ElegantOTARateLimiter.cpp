@@ -0,0 +1,51 @@
+#include "ElegantOTARateLimiter.h"
+
+// smallest bucket, one block of the writer fits even at very low rates
+#define RATE_MIN_BURST  1024
+// fewer bytes are not worth a slice
+#define RATE_MIN_CHUNK  256
+
+void ElegantOTARateLimiter::begin(uint32_t bytesPerSecond, uint8_t cpuPercent, unsigned long now) {
+  _rate = bytesPerSecond;
+  _cpu = cpuPercent == 0 ? 1 : (cpuPercent > 100 ? 100 : cpuPercent);
+  _credit = this->capacity();
+  _refill_millis = now;
+  _resting = false;
+}
+
+uint64_t ElegantOTARateLimiter::capacity() const {
+  uint32_t burst = _rate / 4 > RATE_MIN_BURST ? _rate / 4 : RATE_MIN_BURST;
+  return (uint64_t)burst * 1000;
+}
+
+size_t ElegantOTARateLimiter::allowance(unsigned long now) {
+  if (_resting) {
+    if ((long)(now - _rest_until) < 0) return 0;
+    _resting = false;
+  }
+  if (_rate == 0) return (size_t)-1;
+
+  // the credit grows by rate bytes per second, elapsed ms * rate are byte milliseconds
+  _credit += (uint64_t)(now - _refill_millis) * _rate;
+  _refill_millis = now;
+  if (_credit > this->capacity()) _credit = this->capacity();
+  return _credit < (uint64_t)RATE_MIN_CHUNK * 1000 ? 0 : (size_t)(_credit / 1000);
+}
+
+void ElegantOTARateLimiter::consume(size_t bytes) {
+  if (_rate == 0) return;
+  uint64_t used = (uint64_t)bytes * 1000;
+  _credit = used < _credit ? _credit - used : 0;
+}
+
+void ElegantOTARateLimiter::slice(unsigned long started, unsigned long now) {
+  if (_cpu >= 100) return;
+  unsigned long busy = now - started;
+  this->pause(now, busy * (100 - _cpu) / _cpu);
+}
+
+void ElegantOTARateLimiter::pause(unsigned long now, unsigned long ms) {
+  if (ms == 0) return;
+  _rest_until = now + ms;
+  _resting = true;
+}
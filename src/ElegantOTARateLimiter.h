@@ -0,0 +1,56 @@
+#ifndef ElegantOTARateLimiter_h
+#define ElegantOTARateLimiter_h
+
+#include "Arduino.h"
+
+/**
+ * @brief paces background work by a byte rate and a share of the CPU
+ *
+ * The bytes follow a token bucket that holds at most a quarter second of the rate, so
+ * a long pause does not turn into a burst. The CPU share works on whole slices: after a
+ * slice that was busy for t ms the limiter rests t * (100 - percent) / percent ms.
+ * All decisions depend on the times passed in, there is no platform code.
+ */
+class ElegantOTARateLimiter {
+  public:
+    /**
+     * @param bytesPerSecond 0 for no byte limit
+     * @param cpuPercent share of the time spent in slices, 1..100
+     */
+    void begin(uint32_t bytesPerSecond, uint8_t cpuPercent, unsigned long now);
+
+    /**
+     * @brief bytes the next slice may handle, 0 while resting or the bucket is empty
+     */
+    size_t allowance(unsigned long now);
+
+    /**
+     * @brief take bytes out of the bucket
+     */
+    void consume(size_t bytes);
+
+    /**
+     * @brief record the busy time of a slice, the limiter rests accordingly
+     */
+    void slice(unsigned long started, unsigned long now);
+
+    /**
+     * @brief rest until now + ms, e.g. before retrying a failed connection
+     */
+    void pause(unsigned long now, unsigned long ms);
+
+    uint32_t rate() const { return _rate; }
+    uint8_t cpu() const { return _cpu; }
+
+  private:
+    uint32_t      _rate = 0;
+    uint8_t       _cpu = 100;
+    uint64_t      _credit = 0;       // byte milliseconds, bytes * 1000
+    unsigned long _refill_millis = 0;
+    unsigned long _rest_until = 0;
+    bool          _resting = false;
+
+    uint64_t capacity() const;
+};
+
+#endif
@@ -0,0 +1,350 @@
+#include "ElegantOTA.h"
+
+/*
+ * Transport independent part of an upload session: opening the update for a mode,
+ * passing received bytes through decryption, sparse expansion, image check and bundle
+ * parser to the writer, and committing the result. The HTTP endpoints (/ota/start,
+ * /ota/upload) and the raw TCP listener (ElegantOTATcp.cpp) only parse their framing,
+ * check session ownership and turn the results into their answers; the error of a
+ * failed step is left in _update_error_str.
+ */
+
+bool ElegantOTAClass::admitUpdate() {
+  // an update started on a short heap would most likely fail halfway
+  ElegantOTAResources resources = ElegantOTAGovernor::sample();
+  if (!_governor.admit(resources)) {
+    this->logf("Not enough memory for OTA: %u bytes free, largest block %u", (unsigned)resources.freeHeap, (unsigned)resources.maxBlock);
+    return false;
+  }
+  _governor.begin(resources);
+
+  // the session of another instance went stale, it releases the Update object before startUpdate() begins it
+  if (_update_owner != NULL && _update_owner != this) {
+    ElegantOTAClass *stale = _update_owner;
+    this->logf("Taking over the stale OTA session of another instance");
+    stale->closeSession(true);
+    if (stale->postUpdateCallback != NULL) stale->postUpdateCallback(false);
+  }
+  if (_session_active) {
+    // the owner restarts or the previous session went stale
+    this->logf("Discarding previous OTA session");
+    this->closeSession(true);
+  }
+  return true;
+}
+
+bool ElegantOTAClass::startUpdate(OTA_Mode mode, const char * md5, bool encrypted, bool sparse) {
+  this->_currentOtaMode = mode;
+  _update_error_str.clear();
+  _session_md5 = md5;
+
+  // Sparse image, expanded while streaming, the bundle format carries plain images
+  _sparse_upload = sparse;
+  if (_sparse_upload && mode != OTA_MODE_FIRMWARE && mode != OTA_MODE_FILESYSTEM) {
+    _update_error_str = "Sparse images are firmware or filesystem images";
+    return false;
+  }
+  if (_sparse_upload) {
+    _sparse.begin();
+  }
+
+  // Encrypted container, decrypted while streaming
+  _encrypted_upload = encrypted;
+  if (_encrypted_upload && _decryptor == NULL) {
+    _update_error_str = "Encryption not configured";
+    return false;
+  }
+  if (!_encrypted_upload && _encryption_required) {
+    _update_error_str = "Encrypted image required";
+    return false;
+  }
+  if (_encrypted_upload) {
+    _decryptor->begin();
+  }
+
+  // The write chunk is the only buffer of an upload, receiving the image does not allocate
+  if (!this->reserveSession(0, _writer.chunk())) {
+    return false;
+  }
+
+  // A bundle carries the sizes and hashes of its sections, the partitions are opened while it streams in
+  if (mode == OTA_MODE_BUNDLE) {
+    _bundle.begin();
+    _bundle_sections = 0;
+    _bundle_app_done = false;
+    _update_max_size = 0;
+    if (preUpdateCallback != NULL) preUpdateCallback();
+    return true;
+  }
+
+  // MD5 of the plaintext image for encrypted uploads, handed to the Update object once it began
+  bool has_md5 = md5 != NULL && md5[0];
+  if (has_md5 && strlen(md5) != 32) {
+    this->logf("ERROR: MD5 hash not valid: %s", md5);
+    _update_error_str = "MD5 parameter invalid";
+    _arena.end();
+    return false;
+  }
+
+  #if DEBUGMODE >= 1
+    // Serial output must be active to see the callback serial prints
+    Serial.setDebugOutput(true);
+  #endif
+
+  // Pre-OTA update callback
+  if (preUpdateCallback != NULL) preUpdateCallback();
+
+  // Start update process
+  #if defined(ESP8266)
+    uint32_t update_size = mode == OTA_MODE_FILESYSTEM ? ((size_t)FS_end - (size_t)FS_start) : ((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000);
+    if (mode == OTA_MODE_FILESYSTEM) {
+      close_all_fs();
+    }
+    Update.runAsync(true);
+    if (!Update.begin(update_size, mode == OTA_MODE_FILESYSTEM ? U_FS : U_FLASH)) {
+      this->logf("Failed to start update process");
+      this->storeUpdateError();
+    }
+  #elif defined(ESP32)
+    if (!this->FsPartitionLabel.isEmpty() && mode == OTA_MODE_FILESYSTEM) {
+      this->logf("Starting update on partition: %s", this->FsPartitionLabel.c_str());
+    }
+
+    if (!Update.begin(UPDATE_SIZE_UNKNOWN, (mode == OTA_MODE_FILESYSTEM ? U_SPIFFS : U_FLASH), -1, LOW, (this->FsPartitionLabel.isEmpty() ? NULL : this->FsPartitionLabel.c_str()))) {
+      this->logf("Failed to start update process");
+      this->storeUpdateError();
+    }
+  #endif
+
+  if (Update.hasError()) {
+    _arena.end();
+    if (postUpdateCallback != NULL) postUpdateCallback(false);
+    return false;
+  }
+
+  // begin() clears the expected MD5, it is only kept when set afterwards
+  if (has_md5) {
+    Update.setMD5(md5);
+  }
+
+  _update_max_size = Update.size();
+  _writer.begin(&_arena);
+  return true;
+}
+
+bool ElegantOTAClass::reserveSession(size_t internal, size_t external) {
+  // buffers of a previous session point into the old reservation
+  _writer.end();
+  if (!_arena.begin(internal, external)) {
+    this->logf("Not enough memory for %u bytes of session buffers", (unsigned)(internal + external));
+    _update_error_str = "Not enough memory for the session buffers";
+    return false;
+  }
+  if (_arena.size()) {
+    this->logf("Session buffers: %u bytes%s", (unsigned)_arena.size(), _arena.psram() ? ", large ones in PSRAM" : "");
+  }
+  return true;
+}
+
+bool ElegantOTAClass::checkUpdateSize(size_t size, size_t slack) {
+  if (!_update_max_size || size <= _update_max_size + slack) {
+    return true;
+  }
+  char reason[64];
+  snprintf(reason, sizeof(reason), "Image of %u bytes exceeds partition size %u", (unsigned)size, (unsigned)_update_max_size);
+  this->failUpdate(reason);
+  return false;
+}
+
+void ElegantOTAClass::throttleUpload(AsyncClient *client) {
+  // while memory is short the data is acknowledged late, the sender pauses when the TCP window is full
+  if (_governor.update(ElegantOTAGovernor::sample())) {
+    client->ackLater();
+    _throttled_client = client;
+  } else if (_throttled_client != NULL) {
+    _throttled_client->ack((size_t)-1);
+    _throttled_client = NULL;
+  }
+}
+
+bool ElegantOTAClass::writeUpdate(uint8_t *data, size_t len, size_t index, size_t total) {
+  // the fragment goes to the trace on every return below, a fragment at index 0 starts a new trace
+  ElegantOTATrace::Scope trace(_trace, index, len, (_governor.throttled() ? ELEGANTOTA_TRACE_THROTTLED : 0) | (_tcp_session ? ELEGANTOTA_TRACE_TCP : 0));
+  _session_activity_millis = millis();
+  if (!index) {
+    // Reset progress size on first frame
+    _current_progress_size = 0;
+    _session_data_millis = millis();
+    _history.start(_session_data_millis);
+    _image_check.reset();
+    if (_trace.capacity()) {
+      ElegantOTATraceHeader& header = _trace.header();
+      header.mode = _currentOtaMode;
+      strlcpy(header.chip, ChipFamily, sizeof(header.chip));
+      header.cpuMhz = ESP.getCpuFreqMHz();
+      header.writeChunk = _writer.chunk();
+      header.total = total;
+    }
+  }
+
+  // Decrypt in place, header and MAC of the container are consumed by the decryptor
+  if (_encrypted_upload && len) {
+    size_t offset, plain_len;
+    if (!_decryptor->update(data, len, offset, plain_len)) {
+      this->failUpdate(_decryptor->error());
+      return false;
+    }
+    data += offset;
+    len = plain_len;
+  }
+
+  if (!len) {
+    return true;
+  }
+
+  // Sparse images are expanded by the parser callbacks, progress counts the expanded image
+  if (_sparse_upload) {
+    if (!_sparse.feed(data, len)) {
+      this->failUpdate(_sparse.error() != NULL ? _sparse.error() : _update_error_str.c_str());
+      return false;
+    }
+    total = _sparse.size();
+  } else if (!this->writeImage(data, len)) {
+    this->failUpdate(_update_error_str.c_str());
+    return false;
+  }
+  _history.progress(_current_progress_size, millis());
+  // Progress update callback
+  if (progressUpdateCallback != NULL) progressUpdateCallback(_current_progress_size, total);
+  return true;
+}
+
+bool ElegantOTAClass::writeImage(const uint8_t *data, size_t len) {
+  // Validate the image header before the first flash sector is written
+  if (_image_check_enabled && _currentOtaMode == OTA_MODE_FIRMWARE && !_image_check.complete()) {
+    if (_image_check.feed(data, len) && !this->checkImageHeader()) {
+      return false;
+    }
+  }
+
+  // Bundles are split into their sections, which are written by the parser callbacks
+  if (_currentOtaMode == OTA_MODE_BUNDLE) {
+    if (!_bundle.feed(data, len)) {
+      if (_bundle.error() != NULL) _update_error_str = _bundle.error();
+      return false;
+    }
+  } else if (!_writer.write(data, len)) {
+    _update_error_str = "Failed to write chunked data to free space";
+    return false;
+  }
+  _current_progress_size += len;
+  return true;
+}
+
+bool ElegantOTAClass::fillImage(uint32_t len) {
+  // the hole goes through the writer like data, Update hashes it and ESP32 cores skip
+  // programming sectors that stay erased
+  static uint8_t erased[256];
+  if (erased[0] != 0xFF) memset(erased, 0xFF, sizeof(erased));
+  while (len) {
+    size_t n = len < sizeof(erased) ? len : sizeof(erased);
+    if (!this->writeImage(erased, n)) return false;
+    len -= n;
+    // a long hole erases many sectors within one call of the upload handler
+    if ((_current_progress_size & (ElegantOTABlocks::SECTOR_SIZE - 1)) == 0) {
+      #if defined(ESP8266)
+        ESP.wdtFeed();
+      #elif defined(ESP32)
+        if (esp_task_wdt_status(NULL) == ESP_OK) esp_task_wdt_reset();
+      #endif
+    }
+  }
+  return true;
+}
+
+void ElegantOTAClass::beginSparse() {
+  _sparse.onImage = [&](uint32_t size, const char *md5) {
+    if (_update_max_size && size > _update_max_size) {
+      char reason[64];
+      snprintf(reason, sizeof(reason), "Image of %u bytes exceeds partition size %u", (unsigned)size, (unsigned)_update_max_size);
+      _update_error_str = reason;
+      return false;
+    }
+    // with a hash given to /ota/start the one of the sparse header has to agree, otherwise it is taken
+    if (!_session_md5.isEmpty() && md5[0] && strcasecmp(_session_md5.c_str(), md5) != 0) {
+      this->logf("Sparse image MD5 %s does not match %s", md5, _session_md5.c_str());
+      _update_error_str = "MD5 of sparse image does not match";
+      return false;
+    }
+    if (_session_md5.isEmpty() && md5[0]) {
+      if (!Update.setMD5(md5)) {
+        _update_error_str = "MD5 of sparse image invalid";
+        return false;
+      }
+      _session_md5 = md5;
+    }
+    return true;
+  };
+  _sparse.onData = [&](const uint8_t *data, size_t len) {
+    return this->writeImage(data, len);
+  };
+  _sparse.onFill = [&](uint32_t len) {
+    return this->fillImage(len);
+  };
+}
+
+bool ElegantOTAClass::finishUpdate(const char * name) {
+  // images shorter than the header never passed the check in writeUpdate()
+  if (_image_check_enabled && _currentOtaMode == OTA_MODE_FIRMWARE && !_image_check.complete() && !this->checkImageHeader()) {
+    this->failUpdate(_update_error_str.c_str());
+    return false;
+  }
+  // never commit an image that failed authentication
+  if (_encrypted_upload && !_decryptor->finish()) {
+    this->failUpdate(_decryptor->error());
+    return false;
+  }
+  // the holes behind the last extent are written when it completes, a truncated image is not
+  if (_sparse_upload && !_sparse.complete()) {
+    this->failUpdate("Sparse image incomplete");
+    return false;
+  }
+  // every section of a bundle is committed by the parser, a truncated bundle is rolled back
+  bool bundle = _currentOtaMode == OTA_MODE_BUNDLE;
+  if (bundle && !_bundle.complete()) {
+    this->failUpdate("Bundle incomplete");
+    return false;
+  }
+  if (!bundle && !_writer.flush()) {
+    this->storeUpdateError();
+    this->failUpdate(_update_error_str.c_str());
+    return false;
+  }
+  // the session is closed with the result of Update.end(), the history records it
+  bool ended = bundle || Update.end(true); //true to set the size to the current progress
+  if (!ended) {
+    this->logf("Error Occurred. Error #%u: ", Update.getError());
+    this->storeUpdateError();
+  }
+  this->closeSession(!ended);
+  if (!ended) {
+    this->logResources();
+    return false;
+  }
+  this->logf("Update of %s complete", name);
+  this->logResources();
+  // only Update.end() knows if the MD5 matched, failures are reported by the transport
+  if (postUpdateCallback != NULL) postUpdateCallback(true);
+  // Set reboot flag now, no Restore needed
+  if (_auto_reboot) {
+    _reboot_request_millis = millis();
+    _reboot = true;
+  }
+  return true;
+}
+
+void ElegantOTAClass::failUpdate(const char * reason) {
+  if (reason != _update_error_str.c_str()) _update_error_str = reason;
+  this->logf("Upload rejected: %s", _update_error_str.c_str());
+  this->closeSession(true);
+}
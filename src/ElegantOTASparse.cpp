@@ -0,0 +1,103 @@
+#include "ElegantOTASparse.h"
+
+#define SPARSE_MAGIC   "EOTS"
+#define SPARSE_VERSION 1
+
+static uint32_t read32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void ElegantOTASparse::begin() {
+  _header_len = 0;
+  _extent_header_len = 0;
+  _size = 0;
+  _count = 0;
+  _extent = 0;
+  _position = 0;
+  _remaining = 0;
+  _error = NULL;
+}
+
+bool ElegantOTASparse::startImage() {
+  if (memcmp(_header, SPARSE_MAGIC, 4) != 0 || _header[4] != SPARSE_VERSION) {
+    _error = "Not a sparse image";
+    return false;
+  }
+  _size = read32(_header + 8);
+  _count = read32(_header + 12);
+  if (_size == 0) {
+    _error = "Empty image";
+    return false;
+  }
+
+  char md5[33] = "";
+  static const uint8_t none[16] = {0};
+  for (size_t i = 0; i < 16 && memcmp(_header + 16, none, sizeof(none)) != 0; i++) {
+    snprintf(md5 + i * 2, 3, "%02x", _header[16 + i]);
+  }
+  if (onImage != NULL && !onImage(_size, md5)) return false;
+  // an image without extents is erased completely
+  return _count != 0 || this->fill(_size);
+}
+
+bool ElegantOTASparse::startExtent() {
+  uint32_t offset = read32(_header);
+  _remaining = read32(_header + 4);
+  if (offset < _position || offset > _size || _remaining > _size - offset) {
+    _error = "Invalid sparse extent";
+    return false;
+  }
+  _extent++;
+  return this->fill(offset);
+}
+
+bool ElegantOTASparse::fill(uint32_t end) {
+  uint32_t n = end - _position;
+  if (n == 0) return true;
+  _position = end;
+  return onFill == NULL || onFill(n);
+}
+
+bool ElegantOTASparse::feed(const uint8_t *data, size_t len) {
+  if (_error != NULL) return false;
+
+  while (len) {
+    if (_header_len < HEADER_LEN) {
+      size_t n = HEADER_LEN - _header_len < len ? HEADER_LEN - _header_len : len;
+      memcpy(_header + _header_len, data, n);
+      _header_len += n;
+      data += n;
+      len -= n;
+      if (_header_len == HEADER_LEN && !this->startImage()) return false;
+      continue;
+    }
+
+    if (_remaining == 0) {
+      if (_extent == _count) {
+        _error = "Unexpected data after sparse image";
+        return false;
+      }
+      size_t n = EXTENT_HEADER_LEN - _extent_header_len < len ? EXTENT_HEADER_LEN - _extent_header_len : len;
+      memcpy(_header + _extent_header_len, data, n);
+      _extent_header_len += n;
+      data += n;
+      len -= n;
+      if (_extent_header_len < EXTENT_HEADER_LEN) return true;
+      _extent_header_len = 0;
+      if (!this->startExtent()) return false;
+      // the hole behind the last extent follows an empty last extent right away
+      if (_remaining == 0 && _extent == _count && !this->fill(_size)) return false;
+      continue;
+    }
+
+    size_t n = _remaining < len ? _remaining : len;
+    if (onData != NULL && !onData(data, n)) return false;
+    _remaining -= n;
+    _position += n;
+    data += n;
+    len -= n;
+
+    if (_remaining == 0 && _extent == _count && !this->fill(_size)) return false;
+  }
+  return true;
+}
@@ -0,0 +1,82 @@
+#ifndef ElegantOTASparse_h
+#define ElegantOTASparse_h
+
+#include "Arduino.h"
+#include <functional>
+
+/**
+ * @brief streaming parser of sparse images, a firmware or filesystem image without its erased pages
+ *
+ * Layout, all numbers little endian (see scripts/sparse_image.py):
+ *   0   "EOTS"
+ *   4   format version (1)
+ *   5   3 reserved bytes
+ *   8   size of the expanded image
+ *   12  number of extents
+ *   16  MD5 of the expanded image, all zero for none
+ *   32  extents, each an 8 byte header followed by its data:
+ *         0   offset in the image, at or behind the end of the previous extent
+ *         4   length
+ *
+ * Every byte outside the extents is 0xFF. The parser hands the image on in order:
+ * a hole to onFill() before the extent that follows it, the data of the extent to
+ * onData() as it arrives, and the hole behind the last extent once that is complete.
+ * Nothing larger than the image header is buffered.
+ */
+class ElegantOTASparse {
+  public:
+    static const size_t HEADER_LEN = 32;
+    static const size_t EXTENT_HEADER_LEN = 8;
+
+    /**
+     * @brief called once the header is complete
+     * @param md5 MD5 of the expanded image as 32 hex digits, empty if the header has none
+     */
+    std::function<bool(uint32_t size, const char *md5)> onImage = NULL;
+    std::function<bool(const uint8_t *data, size_t len)> onData = NULL;
+
+    /**
+     * @brief called with the length of a run of erased bytes
+     */
+    std::function<bool(uint32_t len)> onFill = NULL;
+
+    void begin();
+
+    /**
+     * @brief parse the next bytes of the upload
+     * @return false if the image is invalid or a callback failed
+     */
+    bool feed(const uint8_t *data, size_t len);
+
+    /**
+     * @brief check that all extents were received and the image is expanded to its full size
+     */
+    bool complete() const { return _header_len == HEADER_LEN && _extent == _count && _remaining == 0 && _position == _size && _error == NULL; }
+
+    /**
+     * @brief size of the expanded image, 0 until the header is complete
+     */
+    uint32_t size() const { return _size; }
+
+    /**
+     * @brief the reason of the last failure of the parser itself, NULL if a callback failed
+     */
+    const char * error() const { return _error; }
+
+  private:
+    uint8_t  _header[HEADER_LEN];
+    size_t   _header_len = 0;
+    size_t   _extent_header_len = 0;
+    uint32_t _size = 0;
+    uint32_t _count = 0;
+    uint32_t _extent = 0;      // extents started
+    uint32_t _position = 0;    // bytes of the expanded image handed on
+    uint32_t _remaining = 0;   // data bytes left in the current extent
+    const char * _error = NULL;
+
+    bool startImage();
+    bool startExtent();
+    bool fill(uint32_t end);
+};
+
+#endif
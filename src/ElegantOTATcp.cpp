@@ -0,0 +1,235 @@
+#include "ElegantOTA.h"
+
+/*
+ * Raw TCP upload, for flashing from scripts without HTTP and multipart framing.
+ *
+ * The client connects to the port given to enableTcpUpload() and sends a header,
+ * all numbers little endian:
+ *
+ *   0   "EOTU"
+ *   4   version (2)
+ *   5   mode, OTA_MODE_FIRMWARE, OTA_MODE_FILESYSTEM or OTA_MODE_BUNDLE
+ *   6   flags, bit 0: encrypted container (see scripts/encrypt_firmware.py)
+ *              bit 1: sparse image (see scripts/sparse_image.py)
+ *   7   reserved
+ *   8   size of the payload (uint32)
+ *   12  MD5 of the image (16 bytes, all zero for none)
+ *
+ * With authentication the credentials never travel. The device answers the header
+ * with a challenge, a fresh random nonce for every connection:
+ *   101 <nonce as 32 hex digits>
+ * and the client sends HMAC-SHA256(password, nonce || header || username), 32 bytes.
+ * The MAC also covers the header, so mode, size and hash cannot be swapped later.
+ *
+ * The device answers each further step with one line "<code> <text>\n":
+ *   100 Ready                  after the header (and MAC), the client streams size bytes of payload
+ *   200 OK                     after the payload, the image is committed
+ *   400/401 <reason>           the connection is closed
+ *   409 <seconds> <reason>     another session is running, retry after <seconds>
+ *   503 <reason>               not enough memory
+ * Only one connection is served at a time, the session rules are the same as for HTTP
+ * uploads. scripts/elegantota_tcp.py is the host side.
+ */
+
+#define TCP_MAGIC       "EOTU"
+#define TCP_VERSION     2
+#define TCP_HEADER_LEN  28
+#define TCP_NONCE_LEN   16
+#define TCP_FLAG_ENC    0x01
+#define TCP_FLAG_SPARSE 0x02
+
+void ElegantOTAClass::enableTcpUpload(uint16_t port) {
+  this->_tcp_port = port;
+}
+
+void ElegantOTAClass::beginTcp() {
+  if (!_tcp_port || _tcp_server != NULL) return;
+  _tcp_server = new AsyncServer(_tcp_port);
+  _tcp_server->setNoDelay(true);
+  _tcp_server->onClient([&](void *, AsyncClient *client) {
+    client->onDisconnect([&](void *, AsyncClient *c) {
+      if (_throttled_client == c) _throttled_client = NULL;
+      if (_tcp_client == c) {
+        _tcp_client = NULL;
+        if (_tcp_session) {
+          this->failUpdate("Connection closed");
+          if (postUpdateCallback != NULL) postUpdateCallback(false);
+        }
+      }
+      delete c;
+    });
+    if (_tcp_client != NULL) {
+      this->replyTcp(client, 409, "Another OTA connection is open");
+      client->close();
+      return;
+    }
+    _tcp_client = client;
+    _tcp_session = false;
+    _tcp_header_len = 0;
+    _tcp_received = 0;
+    _tcp_size = 0;
+    // a client that stops sending is dropped, the session timeout covers the rest
+    client->setRxTimeout(_session_timeout / 1000 + 1);
+    client->onData([&](void *, AsyncClient *c, void *data, size_t len) {
+      if (c == _tcp_client) this->handleTcpData((uint8_t *)data, len);
+    });
+  }, NULL);
+  _tcp_server->begin();
+  this->logf("Raw TCP upload on port %u", _tcp_port);
+}
+
+void ElegantOTAClass::replyTcp(AsyncClient *client, int code, const char *text) {
+  char line[ELEGANTOTA_ERROR_LEN + 24];
+  int n = snprintf(line, sizeof(line), "%d %s", code, text);
+  if (n < 0) return;
+  if ((size_t)n > sizeof(line) - 2) n = sizeof(line) - 2;
+  // Update errors end with a line break already
+  while (n && (line[n - 1] == '\n' || line[n - 1] == '\r')) n--;
+  line[n++] = '\n';
+  client->write(line, n);
+}
+
+void ElegantOTAClass::endTcp(int code, const char *text) {
+  AsyncClient *client = _tcp_client;
+  if (client == NULL) return;
+  _tcp_client = NULL;
+  this->replyTcp(client, code, text);
+  client->close();
+}
+
+void ElegantOTAClass::handleTcpData(uint8_t *data, size_t len) {
+  // the header, with authentication followed by the MAC answering the challenge
+  size_t need = TCP_HEADER_LEN + (_authenticate ? ElegantOTAHmac::LEN : 0);
+  if (_tcp_header_len < need) {
+    // collect the header, it may arrive split or together with the first payload bytes
+    while (len && _tcp_header_len < need) {
+      _tcp_header[_tcp_header_len++] = *data++;
+      len--;
+      if (_tcp_header_len == TCP_HEADER_LEN) {
+        if (memcmp(_tcp_header, TCP_MAGIC, 4) != 0 || _tcp_header[4] != TCP_VERSION) {
+          return this->endTcp(400, "Bad header");
+        }
+        if (_authenticate) {
+          // the client cannot know the MAC before it has the nonce
+          if (len) return this->endTcp(400, "Data before the challenge was answered");
+          return this->sendTcpChallenge();
+        }
+      }
+    }
+    if (_tcp_header_len < need) return;
+    if (!this->startTcpSession()) return;
+  }
+
+  if (!len) return;
+  if (!_session_active || !_tcp_session) {
+    return this->endTcp(400, "No session");
+  }
+  if (len > _tcp_size - _tcp_received) {
+    return this->endTcp(400, "More data than announced");
+  }
+
+  this->throttleUpload(_tcp_client);
+  size_t index = _tcp_received;
+  _tcp_received += len;
+  if (!this->writeUpdate(data, len, index, _tcp_size)) {
+    // failUpdate() already answered and closed the connection
+    if (postUpdateCallback != NULL) postUpdateCallback(false);
+    return;
+  }
+  if (_tcp_received == _tcp_size) {
+    if (this->finishUpdate("tcp upload")) {
+      this->endTcp(200, "OK");
+    } else {
+      this->endTcp(400, _update_error_str.c_str());
+      if (postUpdateCallback != NULL) postUpdateCallback(false);
+    }
+  }
+}
+
+void ElegantOTAClass::sendTcpChallenge() {
+  for (size_t i = 0; i < TCP_NONCE_LEN; i += 4) {
+    #if defined(ESP32)
+      uint32_t r = esp_random();
+    #else
+      uint32_t r = ESP.random();
+    #endif
+    memcpy(_tcp_nonce + i, &r, 4);
+  }
+  char challenge[2 * TCP_NONCE_LEN + 1];
+  for (size_t i = 0; i < TCP_NONCE_LEN; i++) {
+    snprintf(challenge + 2 * i, 3, "%02x", _tcp_nonce[i]);
+  }
+  this->replyTcp(_tcp_client, 101, challenge);
+}
+
+bool ElegantOTAClass::checkTcpResponse() {
+  if (_auth_locked) return false;
+  const uint8_t * const parts[] = {_tcp_nonce, _tcp_header, (const uint8_t *)_username.c_str()};
+  const size_t lens[] = {TCP_NONCE_LEN, TCP_HEADER_LEN, _username.length()};
+  uint8_t mac[ElegantOTAHmac::LEN];
+  ElegantOTAHmac::sha256((const uint8_t *)_password.c_str(), _password.length(), parts, lens, 3, mac);
+  bool ok = ElegantOTAHmac::equal(mac, _tcp_header + TCP_HEADER_LEN, sizeof(mac));
+  // one answer per nonce
+  memset(_tcp_nonce, 0, sizeof(_tcp_nonce));
+  memset(mac, 0, sizeof(mac));
+  return ok;
+}
+
+bool ElegantOTAClass::startTcpSession() {
+  const uint8_t *h = _tcp_header;
+  uint8_t mode = h[5];
+  bool encrypted = h[6] & TCP_FLAG_ENC;
+  bool sparse = h[6] & TCP_FLAG_SPARSE;
+  _tcp_size = (uint32_t)h[8] | (uint32_t)h[9] << 8 | (uint32_t)h[10] << 16 | (uint32_t)h[11] << 24;
+
+  if (_authenticate && !this->checkTcpResponse()) {
+    this->endTcp(401, "Unauthorized");
+    return false;
+  }
+
+  if (mode != OTA_MODE_FIRMWARE && mode != OTA_MODE_FILESYSTEM && mode != OTA_MODE_BUNDLE) {
+    this->endTcp(400, "Mode not supported");
+    return false;
+  }
+  if (_tcp_size == 0) {
+    this->endTcp(400, "Empty image");
+    return false;
+  }
+
+  // the same single-flight rules as /ota/start, a stale session is taken over
+  if (this->isUpdateOwnedElsewhere() || (_session_active && !this->isSessionStale())) {
+    const ElegantOTAClass *owner = this->isUpdateOwnedElsewhere() ? _update_owner : this;
+    unsigned long idle = millis() - owner->_session_activity_millis;
+    char busy[60];   // 20 digits of %lu and the message
+    snprintf(busy, sizeof(busy), "%lu Another OTA session is in progress", (idle < owner->_session_timeout ? owner->_session_timeout - idle : 0) / 1000 + 1);
+    this->endTcp(409, busy);
+    return false;
+  }
+  if (!this->admitUpdate()) {
+    this->endTcp(503, "Not enough free memory");
+    return false;
+  }
+
+  char md5[33] = "";
+  bool has_md5 = false;
+  for (int i = 0; i < 16; i++) {
+    has_md5 = has_md5 || h[12 + i];
+    snprintf(md5 + 2 * i, 3, "%02x", h[12 + i]);
+  }
+  this->logf("Raw TCP upload: mode %u, %u bytes", mode, (unsigned)_tcp_size);
+  if (!this->startUpdate((OTA_Mode)mode, has_md5 ? md5 : NULL, encrypted, sparse)) {
+    this->endTcp(400, _update_error_str.c_str());
+    return false;
+  }
+  // the size of a sparse image is checked once its header arrived
+  if (!sparse && !this->checkUpdateSize(_tcp_size, encrypted ? ElegantOTADecryptor::HEADER_LEN + ElegantOTADecryptor::MAC_LEN : 0)) {
+    // failUpdate() released the partition, the session was not open yet
+    this->endTcp(400, _update_error_str.c_str());
+    return false;
+  }
+
+  this->openSession((uint32_t)_tcp_client->remoteIP());
+  _tcp_session = true;
+  this->replyTcp(_tcp_client, 100, "Ready");
+  return true;
+}
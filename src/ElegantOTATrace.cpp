@@ -0,0 +1,87 @@
+#include "ElegantOTATrace.h"
+
+bool ElegantOTATrace::setCapacity(size_t entries) {
+  free(_ring);
+  _ring = NULL;
+  _capacity = 0;
+  _header = {};
+  if (entries == 0) {
+    return true;
+  }
+  _ring = (ElegantOTATraceEntry *)malloc(entries * sizeof(ElegantOTATraceEntry));
+  if (_ring == NULL) {
+    return false;
+  }
+  _capacity = entries;
+  return true;
+}
+
+void ElegantOTATrace::begin(uint32_t now) {
+  _header = {};
+  memcpy(_header.magic, "EOTR", sizeof(_header.magic));
+  _header.version = ELEGANTOTA_TRACE_VERSION;
+  _header.result = ELEGANTOTA_TRACE_RUNNING;
+  _next = 0;
+  _start = now;
+}
+
+void ElegantOTATrace::add(uint32_t index, size_t len, uint32_t started, uint32_t latency, uint16_t flags) {
+  if (_capacity == 0 || _header.version == 0) {
+    return;
+  }
+  ElegantOTATraceEntry& entry = _ring[_next];
+  entry.time = started - _start;
+  entry.index = index;
+  entry.len = len > 0xFFFF ? 0xFFFF : (uint16_t)len;
+  entry.flags = flags;
+  entry.latency = latency;
+  _next = (_next + 1) % _capacity;
+  if (_header.count < _capacity) {
+    _header.count++;
+  } else {
+    _header.dropped++;
+  }
+}
+
+void ElegantOTATrace::finish(bool ok) {
+  if (_header.version != 0 && _header.result == ELEGANTOTA_TRACE_RUNNING) {
+    _header.result = ok ? ELEGANTOTA_TRACE_OK : ELEGANTOTA_TRACE_FAILED;
+  }
+}
+
+size_t ElegantOTATrace::read(size_t offset, uint8_t *buf, size_t len) const {
+  size_t copied = 0;
+  if (offset < sizeof(_header)) {
+    copied = sizeof(_header) - offset < len ? sizeof(_header) - offset : len;
+    memcpy(buf, (const uint8_t *)&_header + offset, copied);
+    offset += copied;
+  }
+  // entries oldest first, the oldest one is at _next once the ring is full
+  size_t first = _header.count < _capacity ? 0 : _next;
+  while (copied < len && offset < this->size()) {
+    size_t n = (offset - sizeof(_header)) / sizeof(ElegantOTATraceEntry);
+    size_t skip = (offset - sizeof(_header)) % sizeof(ElegantOTATraceEntry);
+    size_t chunk = sizeof(ElegantOTATraceEntry) - skip < len - copied ? sizeof(ElegantOTATraceEntry) - skip : len - copied;
+    memcpy(buf + copied, (const uint8_t *)&_ring[(first + n) % _capacity] + skip, chunk);
+    copied += chunk;
+    offset += chunk;
+  }
+  return copied;
+}
+
+ElegantOTATrace::Scope::Scope(ElegantOTATrace& trace, size_t index, size_t len, uint16_t flags)
+  : _trace(trace), _index(index), _len(len), _flags(flags), _started(0) {
+  if (_trace._capacity == 0) {
+    return;
+  }
+  _started = micros();
+  if (index == 0) {
+    _trace.begin(_started);
+  }
+}
+
+ElegantOTATrace::Scope::~Scope() {
+  if (_trace._capacity != 0) {
+    _trace.add(_index, _len, _started, micros() - _started, _flags);
+  }
+}
@@ -0,0 +1,117 @@
+#ifndef ElegantOTATrace_h
+#define ElegantOTATrace_h
+
+#include "Arduino.h"
+
+// entries of the trace ring allocated by begin(), 0 leaves the recorder off, see ElegantOTAClass::enableTrace()
+#ifndef ELEGANTOTA_TRACE_LEN
+  #define ELEGANTOTA_TRACE_LEN 0
+#endif
+
+#define ELEGANTOTA_TRACE_VERSION   1
+
+// result in the header
+#define ELEGANTOTA_TRACE_RUNNING   0
+#define ELEGANTOTA_TRACE_OK        1
+#define ELEGANTOTA_TRACE_FAILED    2
+
+// flags of an entry
+#define ELEGANTOTA_TRACE_THROTTLED 0x0001      // the governor acknowledged the fragment late
+#define ELEGANTOTA_TRACE_TCP       0x0002      // received by the raw TCP listener
+
+/**
+ * @brief one fragment as passed to the write path, 16 bytes little endian in the file
+ */
+struct ElegantOTATraceEntry {
+  uint32_t time;         // µs from the first fragment of the upload to this one
+  uint32_t index;        // offset of the fragment in the upload
+  uint16_t len;          // bytes received, before decryption
+  uint16_t flags;
+  uint32_t latency;      // µs spent in the write path for the fragment
+};
+
+/**
+ * @brief head of the file served at /ota/trace.bin, the entries follow oldest first
+ */
+struct ElegantOTATraceHeader {
+  char     magic[4];     // "EOTR"
+  uint8_t  version;      // ELEGANTOTA_TRACE_VERSION
+  uint8_t  mode;         // OTA_Mode
+  uint8_t  result;       // ELEGANTOTA_TRACE_RUNNING, _OK or _FAILED
+  uint8_t  reserved;
+  char     chip[12];     // ChipFamily
+  uint32_t cpuMhz;
+  uint32_t writeChunk;   // ElegantOTAWriter chunk, 0 forwards every fragment
+  uint32_t total;        // size of the upload announced by the client
+  uint32_t count;        // entries in the file
+  uint32_t dropped;      // older entries overwritten by the ring
+};
+
+/**
+ * @brief fixed ring of the fragments of the last upload and the time each one took
+ *
+ * The ring is allocated once by setCapacity(), recording costs two micros() calls and a
+ * 16 byte store per fragment. When the upload is longer than the ring, its end is kept.
+ * read() serializes header and entries for a response callback, scripts/elegantota_trace.py
+ * decodes the file and replays the fragment pattern through the model of the write path.
+ */
+class ElegantOTATrace {
+  public:
+    ~ElegantOTATrace() { this->setCapacity(0); }
+
+    /**
+     * @brief allocate a ring of entries, 0 frees it and stops recording
+     * @return false if the ring could not be allocated
+     */
+    bool setCapacity(size_t entries);
+    size_t capacity() const { return _capacity; }
+
+    /**
+     * @brief start a new trace, the first fragment arrives at now (µs)
+     */
+    void begin(uint32_t now);
+
+    void add(uint32_t index, size_t len, uint32_t started, uint32_t latency, uint16_t flags);
+
+    /**
+     * @brief mark the recorded upload as complete, does nothing once finished
+     */
+    void finish(bool ok);
+
+    ElegantOTATraceHeader& header() { return _header; }
+
+    /**
+     * @brief bytes of the serialized trace
+     */
+    size_t size() const { return sizeof(_header) + _header.count * sizeof(ElegantOTATraceEntry); }
+
+    /**
+     * @brief copy up to len bytes of the serialized trace from offset
+     * @return bytes copied, 0 past the end
+     */
+    size_t read(size_t offset, uint8_t *buf, size_t len) const;
+
+    /**
+     * @brief records the fragment passed to the constructor when it goes out of scope
+     */
+    class Scope {
+      public:
+        Scope(ElegantOTATrace& trace, size_t index, size_t len, uint16_t flags);
+        ~Scope();
+      private:
+        ElegantOTATrace& _trace;
+        uint32_t _index;
+        size_t   _len;
+        uint16_t _flags;
+        uint32_t _started;
+    };
+
+  private:
+    ElegantOTATraceEntry * _ring = NULL;
+    size_t   _capacity = 0;
+    size_t   _next = 0;       // slot of the next entry
+    uint32_t _start = 0;
+    ElegantOTATraceHeader _header = {};
+};
+
+#endif
@@ -0,0 +1,89 @@
+#include "ElegantOTAUiResponse.h"
+
+ElegantOTAUiResponse::ElegantOTAUiResponse(const ElegantOTAAsset& asset, uint8_t& active)
+  : _asset(asset), _data(asset.data), _len(asset.len), _active(active) {
+  _code = 200;
+  _active++;
+}
+
+ElegantOTAUiResponse::~ElegantOTAUiResponse() {
+  if (_head_data != _head) free(_head_data);
+  if (_active) _active--;
+}
+
+void ElegantOTAUiResponse::_respond(AsyncWebServerRequest *request) {
+  // the head is assembled here, the base class would build it in a heap String
+  int n = snprintf(_head, sizeof(_head),
+    "HTTP/1.%u 200 OK\r\n"
+    "Content-Type: %s\r\n"
+    "Content-Encoding: gzip\r\n"
+    "Content-Length: %u\r\n"
+    "Cache-Control: no-cache\r\n"
+    "ETag: %s\r\n"
+    "Connection: close\r\n",
+    request->version(), _asset.contentType, (unsigned)_len, _asset.etag);
+  if (n < 0 || (size_t)n >= sizeof(_head)) {
+    _error = true;
+    return;
+  }
+
+  // DefaultHeaders and addHeader() end up in _headers, only heads they make too long for _head go to the heap
+  size_t len = n + 2;
+  for (const AsyncWebHeader& header : _headers) len += header.name().length() + header.value().length() + 4;
+  if (len > sizeof(_head)) {
+    _head_data = (char *)malloc(len);
+    if (_head_data == NULL) {
+      _head_data = _head;
+      _error = true;
+      return;
+    }
+    memcpy(_head_data, _head, n);
+  }
+  for (const AsyncWebHeader& header : _headers) {
+    n += sprintf(_head_data + n, "%s: %s\r\n", header.name().c_str(), header.value().c_str());
+  }
+  memcpy(_head_data + n, "\r\n", 2);
+  _head_len = len;
+  _total = _head_len + _len;
+  this->fill(request->client());
+}
+
+size_t ElegantOTAUiResponse::_ack(AsyncWebServerRequest *request, size_t len, uint32_t /* time */) {
+  _acked += len;
+  if (_acked < _total) this->fill(request->client());
+  return len;
+}
+
+void ElegantOTAUiResponse::fill(AsyncClient *client) {
+  size_t slice = client->getMss();
+  if (slice == 0 || slice > ELEGANTOTA_UI_SLICE) slice = ELEGANTOTA_UI_SLICE;
+
+  bool queued = false;
+  while (_sent < _total && _sent - _acked < ELEGANTOTA_UI_WINDOW * slice) {
+    size_t n;
+    size_t added;
+    if (_sent < _head_len) {
+      n = _head_len - _sent;
+      if (client->space() < n) break;
+      added = client->add(_head_data + _sent, n, ASYNC_WRITE_FLAG_COPY);
+    } else {
+      size_t offset = _sent - _head_len;
+      n = _len - offset < slice ? _len - offset : slice;
+      if (client->space() < n) break;
+      #if defined(ESP32)
+        // the blob stays valid for the lifetime of the program, lwIP may reference it
+        added = client->add((const char *)_data + offset, n, 0);
+      #else
+        memcpy_P(_slice, _data + offset, n);
+        added = client->add((const char *)_slice, n, ASYNC_WRITE_FLAG_COPY);
+      #endif
+    }
+    _sent += added;
+    queued = queued || added;
+    if (added != n) {
+      _error = !client->connected();
+      break;
+    }
+  }
+  if (queued) client->send();
+}
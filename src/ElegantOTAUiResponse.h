@@ -0,0 +1,69 @@
+#ifndef ElegantOTAUiResponse_h
+#define ElegantOTAUiResponse_h
+
+#include "Arduino.h"
+#if defined(ESP8266)
+  #include "ESPAsyncTCP.h"
+#elif defined(ESP32)
+  #include "AsyncTCP.h"
+#endif
+#include "ESPAsyncWebServer.h"
+#include "ElegantOTAAssets.h"
+
+// segments of the UI blob that may be unacknowledged at once
+#ifndef ELEGANTOTA_UI_WINDOW
+  #define ELEGANTOTA_UI_WINDOW 2
+#endif
+
+// size of the slices taken from flash, the MSS of the connection caps it further
+#ifndef ELEGANTOTA_UI_SLICE
+  #define ELEGANTOTA_UI_SLICE 1460
+#endif
+
+/**
+ * @brief response that streams a gzipped asset in MSS sized slices straight from flash
+ *
+ * The stock callback and PROGMEM responses allocate a buffer as large as the free TCP
+ * send space on every ack. This response keeps at most ELEGANTOTA_UI_WINDOW segments
+ * in flight and hands them to the TCP stack directly: ESP32 maps flash into the data
+ * bus, so lwIP references the blob without a copy. ESP8266 flash needs aligned reads,
+ * each slice passes through one fixed buffer inside the response.
+ */
+class ElegantOTAUiResponse : public AsyncWebServerResponse {
+  public:
+    /**
+     * @param asset the gzipped file in flash, see ElegantOTAAssets.h
+     * @param active counter of running UI responses, incremented until the response is deleted
+     */
+    ElegantOTAUiResponse(const ElegantOTAAsset& asset, uint8_t& active);
+    ~ElegantOTAUiResponse();
+
+    void _respond(AsyncWebServerRequest *request) override;
+    size_t _ack(AsyncWebServerRequest *request, size_t len, uint32_t time) override;
+    bool _finished() const override { return _total && _acked >= _total; }
+    bool _failed() const override { return _error; }
+    bool _sourceValid() const override { return true; }
+
+  private:
+    const ElegantOTAAsset& _asset;
+    const uint8_t *_data;
+    size_t   _len;
+    uint8_t& _active;
+    char     _head[352];
+    char *   _head_data = _head;
+    size_t   _head_len = 0;
+    size_t   _total = 0;
+    size_t   _sent = 0;
+    size_t   _acked = 0;
+    bool     _error = false;
+    #if defined(ESP8266)
+      uint8_t _slice[ELEGANTOTA_UI_SLICE];
+    #endif
+
+    /**
+     * @brief queue slices until the window is full or the connection has no space
+     */
+    void fill(AsyncClient *client);
+};
+
+#endif
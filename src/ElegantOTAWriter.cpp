@@ -0,0 +1,55 @@
+#include "ElegantOTAWriter.h"
+
+#if defined(ESP8266)
+  #include "Updater.h"
+#elif defined(ESP32)
+  #include "Update.h"
+#endif
+
+bool ElegantOTAWriter::begin(ElegantOTAArena *arena) {
+  _len = 0;
+  if (_chunk == 0 || _buf != NULL) return true;
+  _owned = arena == NULL;
+  _buf = (uint8_t *)(_owned ? malloc(_chunk) : arena->alloc(_chunk, true));
+  return _buf != NULL;
+}
+
+bool ElegantOTAWriter::write(const uint8_t *data, size_t len) {
+  if (_buf == NULL) {
+    return Update.write((uint8_t *)data, len) == len;
+  }
+  while (len) {
+    if (_len == 0 && len >= _chunk) {
+      // whole blocks go straight from the fragment
+      size_t n = len - len % _chunk;
+      if (Update.write((uint8_t *)data, n) != n) return false;
+      data += n;
+      len -= n;
+      continue;
+    }
+    size_t n = _chunk - _len < len ? _chunk - _len : len;
+    memcpy(_buf + _len, data, n);
+    _len += n;
+    data += n;
+    len -= n;
+    if (_len == _chunk) {
+      _len = 0;
+      if (Update.write(_buf, _chunk) != _chunk) return false;
+    }
+  }
+  return true;
+}
+
+bool ElegantOTAWriter::flush() {
+  if (_buf == NULL || _len == 0) return true;
+  size_t n = _len;
+  _len = 0;
+  return Update.write(_buf, n) == n;
+}
+
+void ElegantOTAWriter::end() {
+  if (_owned) free(_buf);
+  _owned = false;
+  _buf = NULL;
+  _len = 0;
+}
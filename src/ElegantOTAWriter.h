@@ -0,0 +1,58 @@
+#ifndef ElegantOTAWriter_h
+#define ElegantOTAWriter_h
+
+#include "Arduino.h"
+#include "ElegantOTAArena.h"
+
+// block size the writer coalesces fragments to unless ElegantOTAClass::setWriteChunk() is called,
+// 0 forwards every fragment; measure a board with examples/WriteBenchmark before raising it
+#ifndef ELEGANTOTA_WRITE_CHUNK
+  #define ELEGANTOTA_WRITE_CHUNK 0
+#endif
+
+/**
+ * @brief write stage between the upload fragments and Update.write()
+ *
+ * With a chunk of 0 every fragment goes to Update.write() as it arrives. Otherwise
+ * fragments are coalesced to blocks of chunk bytes, runs of whole blocks are passed
+ * through without a copy. The chunk starts as ELEGANTOTA_WRITE_CHUNK for every chip
+ * family, see examples/WriteBenchmark and scripts/write_benchmark.py.
+ */
+class ElegantOTAWriter {
+  public:
+    ~ElegantOTAWriter() { this->end(); }
+
+    void setChunk(size_t chunk) { this->end(); _chunk = chunk; }
+    size_t chunk() const { return _chunk; }
+
+    /**
+     * @brief start an image, allocates the block buffer
+     * @param arena the buffer is taken from its external region, chunk() bytes reserved, the heap is used without
+     * @return false if the buffer could not be allocated, fragments are forwarded then
+     */
+    bool begin(ElegantOTAArena *arena = NULL);
+
+    /**
+     * @brief pass the next bytes of the image on to Update.write()
+     * @return false if the Update object failed
+     */
+    bool write(const uint8_t *data, size_t len);
+
+    /**
+     * @brief write the buffered rest of the image, call before Update.end()
+     */
+    bool flush();
+
+    /**
+     * @brief drop buffered data and release the buffer
+     */
+    void end();
+
+  private:
+    size_t    _chunk = ELEGANTOTA_WRITE_CHUNK;
+    uint8_t * _buf = NULL;
+    size_t    _len = 0;
+    bool      _owned = false;
+};
+
+#endif
@@ -1,1061 +0,0 @@
-unsigned char include_ElegantOTA_html_gz[] = {
-  0x1f, 0x8b, 0x08, 0x08, 0xf7, 0xc9, 0x99, 0x68, 0x04, 0x00, 0x45, 0x6c,
-  0x65, 0x67, 0x61, 0x6e, 0x74, 0x4f, 0x54, 0x41, 0x2e, 0x68, 0x74, 0x6d,
-  0x6c, 0x00, 0xed, 0x5d, 0x69, 0x7b, 0xdb, 0xc6, 0x11, 0xfe, 0xdc, 0x3e,
-  0x4f, 0xff, 0x03, 0xcc, 0xb6, 0x12, 0x61, 0x01, 0x10, 0x6e, 0x5e, 0xa2,
-  0x53, 0xdb, 0xb1, 0x6b, 0xb7, 0x3e, 0x52, 0xdb, 0xe9, 0xa5, 0xa8, 0x29,
-  0x44, 0x82, 0x24, 0x62, 0x92, 0x60, 0x01, 0x52, 0xb2, 0x2c, 0xb3, 0xbf,
-  0xbd, 0xef, 0xec, 0x2e, 0xb0, 0xb8, 0x28, 0x51, 0x6e, 0xd2, 0x33, 0x71,
-  0x44, 0x00, 0xb3, 0xb3, 0x33, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x07, 0x16,
-  0x27, 0xf7, 0x74, 0xfd, 0x67, 0x3f, 0x9d, 0x7e, 0x8c, 0x56, 0x8a, 0x3e,
-  0x52, 0xa2, 0xe5, 0x68, 0xbe, 0x19, 0x87, 0xc7, 0xe1, 0x3c, 0x9c, 0x06,
-  0xcb, 0xf5, 0xb7, 0xf1, 0x3a, 0x30, 0x66, 0xeb, 0xc5, 0x5c, 0x79, 0xd0,
-  0x98, 0x34, 0xfd, 0xf8, 0xb3, 0x9f, 0xfe, 0xec, 0xa7, 0xc9, 0x62, 0x67,
-  0x62, 0xe7, 0xa3, 0x12, 0x28, 0xfa, 0x9a, 0xc8, 0xef, 0xc0, 0x51, 0x76,
-  0xf2, 0xfc, 0xd9, 0x4f, 0x3f, 0x7c, 0x18, 0x2b, 0xfa, 0x52, 0x79, 0xf2,
-  0xe2, 0xc9, 0xaf, 0x1f, 0xbe, 0x7a, 0xf7, 0xed, 0xeb, 0x77, 0x0f, 0xbf,
-  0x7d, 0xf6, 0xee, 0xe5, 0x0b, 0x45, 0x8f, 0x76, 0x11, 0x4b, 0x93, 0x51,
-  0x0e, 0x22, 0x1a, 0xc6, 0x68, 0xb5, 0x22, 0x11, 0x47, 0x63, 0xe5, 0xef,
-  0xc7, 0x2f, 0xaf, 0xde, 0xbe, 0x0f, 0xd7, 0xa3, 0xd9, 0x79, 0x1c, 0xbf,
-  0x3f, 0x7e, 0x16, 0x2f, 0xc2, 0xb7, 0xeb, 0x60, 0xbd, 0x49, 0xbf, 0x8c,
-  0xd2, 0xd5, 0x3c, 0xb8, 0x3a, 0x56, 0x0e, 0x0e, 0x94, 0xba, 0x1e, 0x24,
-  0x2d, 0xa9, 0x88, 0x7a, 0x1a, 0x78, 0x53, 0x76, 0x26, 0x70, 0xb4, 0x0b,
-  0x63, 0x07, 0x55, 0x92, 0x4f, 0xd7, 0x1f, 0xd0, 0xe5, 0xe4, 0xde, 0x38,
-  0x1e, 0xad, 0xaf, 0x56, 0xa1, 0x42, 0x49, 0x0f, 0x00, 0x60, 0x3c, 0xe7,
-  0xc1, 0x72, 0x3a, 0x6c, 0x85, 0xcb, 0x16, 0x20, 0x8a, 0x72, 0x32, 0x0b,
-  0x83, 0x31, 0xbb, 0xc3, 0xfd, 0x22, 0x5c, 0x07, 0xca, 0x68, 0x16, 0x24,
-  0x69, 0xb8, 0x1e, 0xb6, 0xbe, 0x7e, 0xf7, 0x54, 0xef, 0xb6, 0x94, 0xe3,
-  0x52, 0xea, 0x32, 0x58, 0x84, 0xc3, 0xd6, 0x45, 0x14, 0x5e, 0xae, 0xe2,
-  0x64, 0xdd, 0x52, 0x46, 0xf1, 0x72, 0x1d, 0x2e, 0x81, 0x7d, 0x19, 0x8d,
-  0xd7, 0xb3, 0xe1, 0x38, 0xbc, 0x88, 0x46, 0xa1, 0xce, 0x1e, 0x34, 0x88,
-  0x18, 0xad, 0xa3, 0x60, 0xae, 0xa7, 0xa3, 0x60, 0x1e, 0x0e, 0x2d, 0xc3,
-  0x2c, 0x50, 0x5b, 0x47, 0xeb, 0x79, 0xf8, 0xe0, 0x09, 0x17, 0x1e, 0x95,
-  0xa1, 0xbc, 0x88, 0xd6, 0xe1, 0xc9, 0x31, 0x03, 0x67, 0x38, 0xe9, 0x28,
-  0x89, 0x56, 0x6b, 0x05, 0x65, 0x00, 0xcf, 0x45, 0x3c, 0xde, 0xcc, 0x43,
-  0x70, 0x4c, 0xe2, 0x34, 0x8d, 0x93, 0x68, 0x1a, 0x2d, 0x81, 0xd7, 0x9e,
-  0x6c, 0x96, 0xa3, 0x75, 0x14, 0x2f, 0xdb, 0xea, 0x35, 0x64, 0x49, 0xd7,
-  0xca, 0x64, 0x88, 0x62, 0x6f, 0x16, 0x10, 0xca, 0x18, 0x25, 0x61, 0xb0,
-  0x0e, 0xc1, 0x83, 0x9e, 0xda, 0xad, 0x79, 0xb4, 0x7c, 0xdf, 0x52, 0x8d,
-  0x24, 0x9c, 0xbf, 0x88, 0xd2, 0xf5, 0x20, 0x9a, 0xb4, 0x27, 0x07, 0x07,
-  0x13, 0x23, 0xdd, 0xac, 0xa8, 0x2c, 0x69, 0xf1, 0xbe, 0x2d, 0xd8, 0xad,
-  0x80, 0x1c, 0x07, 0xe3, 0x96, 0xaa, 0x26, 0xe1, 0x7a, 0x93, 0x2c, 0x07,
-  0x93, 0x38, 0x69, 0x73, 0x3e, 0x81, 0x12, 0x4f, 0x94, 0x9c, 0xd5, 0xdf,
-  0x36, 0x61, 0x72, 0xf5, 0x16, 0x75, 0x31, 0x5a, 0xc7, 0xc9, 0xc3, 0xf9,
-  0xbc, 0x7d, 0x48, 0xdc, 0x4e, 0x91, 0x7d, 0x58, 0x21, 0x75, 0x76, 0xa8,
-  0xaa, 0xe3, 0x76, 0xa0, 0x0e, 0x96, 0xe1, 0xa5, 0xf2, 0x72, 0xb3, 0x0e,
-  0x48, 0xfa, 0xd7, 0xe7, 0x69, 0x98, 0x5c, 0x84, 0x49, 0x3b, 0x18, 0x3e,
-  0xb8, 0x96, 0x3c, 0x46, 0xc4, 0x23, 0x50, 0x21, 0xe9, 0xc8, 0x60, 0x5a,
-  0x18, 0x0e, 0x5b, 0xa3, 0x59, 0x34, 0x1f, 0x53, 0x01, 0x5a, 0xaa, 0x44,
-  0x8c, 0x08, 0x71, 0x64, 0x04, 0xe3, 0x71, 0x38, 0x7e, 0x15, 0x8f, 0xc3,
-  0x54, 0x8d, 0x8c, 0x75, 0x30, 0x7d, 0x15, 0x2c, 0x58, 0x9e, 0x17, 0xcf,
-  0x5f, 0xfd, 0xb6, 0x75, 0x70, 0x10, 0x51, 0xd9, 0xf1, 0x5c, 0x96, 0x08,
-  0x09, 0xe3, 0x76, 0xa4, 0x6e, 0x55, 0x23, 0xe6, 0x52, 0xb4, 0xb3, 0x52,
-  0x69, 0xd7, 0x39, 0xb3, 0xfe, 0x3d, 0x53, 0x4b, 0x37, 0xe7, 0xeb, 0x24,
-  0x0c, 0x71, 0xbb, 0x55, 0x07, 0x99, 0xde, 0x95, 0x14, 0x65, 0xb9, 0x16,
-  0xe2, 0x0e, 0xaf, 0xb7, 0x03, 0xae, 0x28, 0x25, 0x30, 0x22, 0x58, 0xc6,
-  0x34, 0x89, 0xd6, 0x57, 0x07, 0x07, 0xed, 0x91, 0x7c, 0x1a, 0x16, 0x52,
-  0x54, 0x2d, 0x80, 0x48, 0x93, 0x30, 0x49, 0xc2, 0xe4, 0xab, 0x78, 0x1e,
-  0x8d, 0x18, 0x6e, 0x05, 0x34, 0xac, 0xe0, 0xb0, 0x5c, 0xcc, 0x0a, 0x5e,
-  0x33, 0x2b, 0xa0, 0x02, 0x6d, 0xd2, 0x50, 0x47, 0x6d, 0x8f, 0xc3, 0x25,
-  0x19, 0x5c, 0xda, 0xfa, 0x62, 0x64, 0x14, 0x1e, 0x87, 0x2d, 0xd1, 0x58,
-  0x5a, 0xfd, 0x5a, 0xce, 0x60, 0x19, 0x2f, 0xaf, 0x16, 0xf1, 0xa6, 0x9e,
-  0x27, 0x5e, 0x44, 0xeb, 0x56, 0xbf, 0x02, 0x4c, 0xa1, 0x51, 0x9d, 0x5b,
-  0x5f, 0x4b, 0x1b, 0x6d, 0x73, 0x2d, 0x8c, 0x49, 0x0b, 0xa8, 0xa7, 0xc0,
-  0x08, 0x57, 0x99, 0xad, 0xd0, 0xfd, 0xf0, 0x9e, 0x39, 0xc8, 0x94, 0x93,
-  0x52, 0xad, 0x4f, 0xc8, 0x69, 0x00, 0x6d, 0x86, 0x32, 0x69, 0x23, 0x75,
-  0xbb, 0x55, 0xdb, 0xea, 0x60, 0x1e, 0xa3, 0x85, 0xbc, 0x85, 0xe5, 0x04,
-  0xd3, 0xd0, 0x58, 0xcf, 0x42, 0x5e, 0x6b, 0xe3, 0x20, 0x79, 0xdf, 0xfa,
-  0xf4, 0xe9, 0x5e, 0xbb, 0xc5, 0x40, 0x28, 0x84, 0x52, 0x44, 0x54, 0x0f,
-  0x0e, 0x2e, 0xa3, 0xe5, 0x38, 0xbe, 0x34, 0x16, 0x01, 0x68, 0xbe, 0x0c,
-  0xc7, 0x51, 0xd0, 0x6e, 0xb5, 0x57, 0x4c, 0x59, 0xa9, 0x3e, 0x8a, 0xe7,
-  0x71, 0x82, 0xa6, 0x47, 0x59, 0xfb, 0x0a, 0xd1, 0x52, 0x5b, 0x2a, 0x47,
-  0x0d, 0xd3, 0x2f, 0xf2, 0x3a, 0x36, 0xb2, 0x1b, 0xd1, 0x4c, 0x8c, 0xd1,
-  0x3c, 0x48, 0x53, 0xaa, 0x72, 0xb2, 0xa6, 0x36, 0x17, 0x42, 0xd5, 0x72,
-  0xf4, 0x69, 0x98, 0x61, 0x3e, 0xba, 0x7a, 0x2e, 0xd2, 0x5f, 0xc2, 0xe2,
-  0x1e, 0xcf, 0xc2, 0xd1, 0xfb, 0xf3, 0xf8, 0x03, 0x78, 0x8c, 0xe8, 0x36,
-  0x1c, 0xa3, 0xe8, 0x6a, 0x7f, 0x1f, 0x3e, 0x49, 0xb8, 0x88, 0x2f, 0xc2,
-  0x7f, 0x8e, 0x95, 0xa5, 0x0e, 0xee, 0x92, 0x0f, 0x45, 0x7b, 0x72, 0x01,
-  0x04, 0xe2, 0x1f, 0x2e, 0xd1, 0xee, 0x5a, 0x23, 0x58, 0xd6, 0xfb, 0x96,
-  0x56, 0x70, 0x27, 0x77, 0xa1, 0x27, 0xe4, 0xb8, 0xb3, 0x5a, 0x1b, 0x2a,
-  0x9e, 0x27, 0x7d, 0x96, 0xe6, 0x9a, 0xa8, 0xcd, 0xa3, 0xe9, 0x0c, 0xae,
-  0xa2, 0xd8, 0x62, 0x1f, 0xb6, 0xe7, 0xea, 0xb5, 0x68, 0xa6, 0xf3, 0x83,
-  0x83, 0xb9, 0xf1, 0xed, 0xb7, 0x61, 0xfa, 0x92, 0xb9, 0x84, 0x83, 0x83,
-  0xd7, 0xe7, 0xdf, 0xc1, 0x87, 0x19, 0xab, 0x24, 0x5e, 0xc7, 0xe4, 0x72,
-  0x8c, 0x59, 0x90, 0xbe, 0xbe, 0x5c, 0x7e, 0x95, 0xc4, 0xab, 0x30, 0x59,
-  0x5f, 0x19, 0xe0, 0x30, 0x6f, 0xcf, 0xb5, 0xd6, 0x38, 0x9c, 0x04, 0x9b,
-  0x39, 0x28, 0x7f, 0x31, 0x37, 0xc4, 0x7d, 0x7f, 0xbe, 0xbd, 0x08, 0x12,
-  0xe5, 0xc5, 0xf0, 0x3a, 0xfc, 0xc0, 0xbc, 0x68, 0xff, 0x7a, 0xbb, 0xd5,
-  0x3e, 0x94, 0x1e, 0x07, 0x45, 0x87, 0x4d, 0xd8, 0xf0, 0x8f, 0x0f, 0x1f,
-  0x3d, 0xfe, 0xf2, 0xc9, 0xd3, 0x5f, 0x3f, 0x7b, 0xfe, 0x9b, 0xdf, 0xbe,
-  0x78, 0xf9, 0xea, 0xf5, 0x57, 0xbf, 0x7b, 0xf3, 0xf6, 0xdd, 0xd7, 0xbf,
-  0xff, 0xc3, 0x1f, 0xff, 0xf4, 0xe7, 0xe0, 0x7c, 0x04, 0xda, 0xd3, 0x59,
-  0xf4, 0xdd, 0xfb, 0xf9, 0x62, 0x19, 0xaf, 0xfe, 0x96, 0xa4, 0xeb, 0xcd,
-  0xc5, 0xe5, 0x87, 0xab, 0x8f, 0xa6, 0x65, 0x3b, 0xae, 0xe7, 0x77, 0xba,
-  0xbd, 0xa3, 0x63, 0xd4, 0xda, 0xf0, 0x1a, 0xf2, 0xce, 0xfb, 0x39, 0xed,
-  0x54, 0x1b, 0xe7, 0x45, 0x4c, 0x4f, 0x4e, 0xc6, 0x9f, 0xd2, 0x07, 0x0f,
-  0x1e, 0x38, 0xb6, 0x3e, 0xde, 0x6a, 0x40, 0x4c, 0x76, 0x22, 0x02, 0x85,
-  0xe3, 0x02, 0x31, 0x5c, 0xa2, 0x41, 0x2d, 0x0b, 0xa8, 0xac, 0x81, 0xa7,
-  0x06, 0x6b, 0xce, 0xc9, 0x86, 0x1c, 0xfd, 0x70, 0xf8, 0x6a, 0xb3, 0x38,
-  0x0f, 0x13, 0x55, 0x50, 0x98, 0x18, 0x24, 0x06, 0x88, 0x76, 0xd5, 0x03,
-  0xcb, 0xef, 0x58, 0x56, 0xcf, 0xf1, 0x3e, 0xe5, 0x40, 0xdb, 0x55, 0x0f,
-  0x5c, 0xbb, 0xd3, 0xb5, 0x3d, 0xcf, 0xf1, 0x4d, 0xd6, 0x95, 0x90, 0x06,
-  0xc6, 0x43, 0x73, 0x30, 0x3e, 0x49, 0x8d, 0x79, 0xb8, 0x9c, 0xae, 0x67,
-  0x83, 0xf1, 0xd1, 0x91, 0x9a, 0x9e, 0x8e, 0xcf, 0x86, 0x13, 0x83, 0x4b,
-  0xd0, 0xa6, 0x27, 0x75, 0x90, 0x09, 0x89, 0x12, 0x04, 0x68, 0xf5, 0x8b,
-  0x47, 0x57, 0xeb, 0x30, 0x2d, 0x49, 0x27, 0x09, 0x9e, 0x9e, 0x0d, 0xd2,
-  0x07, 0xe6, 0x20, 0xd5, 0x75, 0x75, 0x6c, 0xac, 0x36, 0xe9, 0xac, 0xfd,
-  0x32, 0x58, 0xcf, 0x8c, 0xc9, 0x3c, 0x06, 0x0a, 0xbb, 0xe5, 0x34, 0xda,
-  0xea, 0x7d, 0xdb, 0xf3, 0xd5, 0x9c, 0x38, 0x4a, 0x7d, 0x4e, 0x64, 0xdf,
-  0xc5, 0x7f, 0x88, 0x93, 0xf1, 0x6e, 0xea, 0x5a, 0x30, 0x34, 0xb5, 0x11,
-  0xe4, 0x0e, 0xa4, 0xdc, 0xc1, 0xd1, 0x91, 0x36, 0x3a, 0x1a, 0x76, 0xd5,
-  0xf1, 0xe9, 0x08, 0x0a, 0xf4, 0xce, 0x3e, 0x0d, 0xd3, 0xd3, 0xe0, 0xec,
-  0xe4, 0xc4, 0x76, 0xf5, 0xd1, 0x2f, 0x1d, 0xbb, 0xc0, 0xe3, 0x12, 0xc4,
-  0xc1, 0x83, 0x4a, 0x70, 0x13, 0x8f, 0x12, 0xfd, 0xfb, 0xa0, 0x10, 0x80,
-  0x7c, 0x56, 0x20, 0xd0, 0x66, 0x5c, 0xf0, 0x03, 0x06, 0x01, 0x18, 0x1c,
-  0x40, 0xaf, 0x0d, 0x25, 0x79, 0x16, 0x7e, 0xd8, 0x97, 0x07, 0x95, 0x21,
-  0xa3, 0x4f, 0x0c, 0x88, 0xb8, 0xab, 0x1a, 0xeb, 0xf8, 0xed, 0x3a, 0x89,
-  0x96, 0xd3, 0xb6, 0x05, 0x55, 0x69, 0xc5, 0xf4, 0x03, 0xcb, 0x2b, 0x27,
-  0x4b, 0xfe, 0xc6, 0x77, 0x71, 0xb4, 0x6c, 0xb7, 0xd0, 0xf2, 0xb4, 0x59,
-  0xf8, 0xe1, 0x8e, 0x85, 0xa5, 0x92, 0xda, 0x99, 0x24, 0x2b, 0x8a, 0xc7,
-  0x9e, 0x2f, 0xd7, 0x30, 0x3d, 0xf4, 0xc0, 0x30, 0xbd, 0x76, 0xa0, 0xd9,
-  0xaa, 0x66, 0x35, 0xd6, 0xdb, 0xa3, 0x20, 0x0d, 0x7d, 0xf7, 0x2e, 0x7c,
-  0x1c, 0x35, 0x43, 0x18, 0x89, 0x0a, 0xb3, 0xfc, 0x4f, 0xb8, 0x39, 0xb2,
-  0x70, 0xdb, 0x65, 0x77, 0xf6, 0x99, 0x16, 0x21, 0x5f, 0x74, 0xe2, 0x0e,
-  0x22, 0x68, 0x28, 0xb8, 0xdf, 0x3d, 0x8a, 0xee, 0xfb, 0x27, 0xc3, 0xbc,
-  0x6e, 0xba, 0x5f, 0x08, 0x59, 0xe7, 0x06, 0x85, 0x8f, 0x0f, 0xd7, 0x6d,
-  0x32, 0x01, 0xff, 0x7e, 0xdb, 0xd1, 0x23, 0xf5, 0xc0, 0x77, 0x54, 0xb5,
-  0x2f, 0x10, 0x5a, 0xc3, 0x56, 0xa3, 0x8e, 0xce, 0x99, 0xdc, 0x4d, 0x6a,
-  0x4a, 0xc1, 0x26, 0x09, 0x11, 0x54, 0x8f, 0xc2, 0xf6, 0xf1, 0xe9, 0x5f,
-  0x1e, 0xea, 0x7f, 0x36, 0xf5, 0xde, 0xd1, 0x37, 0xc7, 0x67, 0xc7, 0xd1,
-  0x54, 0x43, 0xde, 0xc1, 0x6d, 0x86, 0x39, 0x1a, 0x1e, 0x1d, 0x05, 0xbf,
-  0x74, 0xd5, 0xd1, 0xbd, 0xa1, 0x79, 0x70, 0x20, 0xe4, 0x80, 0xa4, 0xe8,
-  0x3b, 0xc3, 0x0f, 0xaf, 0xd1, 0xa2, 0x33, 0x99, 0x03, 0xdd, 0x52, 0xd5,
-  0x03, 0xd6, 0x3c, 0x56, 0xf1, 0x65, 0xdb, 0xd6, 0x74, 0xfb, 0xfe, 0xe8,
-  0xa8, 0xab, 0x02, 0x7c, 0x72, 0x32, 0xba, 0x6f, 0x7f, 0x6a, 0xca, 0xa3,
-  0xaa, 0x54, 0x52, 0x1d, 0xc9, 0x85, 0xda, 0xd8, 0x0e, 0x3e, 0x18, 0xc2,
-  0xe9, 0x0d, 0x27, 0xac, 0x87, 0x27, 0x01, 0x9f, 0x0d, 0x73, 0xa8, 0xf6,
-  0x74, 0x78, 0xbd, 0x59, 0x4f, 0xba, 0xfd, 0xeb, 0x94, 0xd9, 0x4e, 0xad,
-  0xe0, 0xd2, 0x43, 0x3f, 0x35, 0xce, 0xa3, 0xa5, 0x51, 0x42, 0x6b, 0x6f,
-  0x96, 0x21, 0x62, 0xea, 0x55, 0xd8, 0x0e, 0x97, 0x23, 0x74, 0x44, 0x5f,
-  0xbf, 0x79, 0xfe, 0x38, 0x5e, 0xac, 0xe2, 0x25, 0x7a, 0x07, 0xe4, 0x54,
-  0xd5, 0xcc, 0x1c, 0x84, 0x65, 0x36, 0x91, 0x1d, 0x87, 0xb5, 0x9c, 0x82,
-  0x26, 0x67, 0x58, 0x22, 0xc0, 0x89, 0x6e, 0x35, 0x24, 0xdc, 0x24, 0x71,
-  0x56, 0x13, 0x13, 0xaa, 0x89, 0x14, 0xb5, 0x90, 0x9e, 0xcc, 0xb3, 0x5a,
-  0x48, 0x61, 0x38, 0x93, 0xa2, 0x91, 0x3c, 0x06, 0xfb, 0x87, 0x6b, 0xd4,
-  0x70, 0xa9, 0xdd, 0x4e, 0x2a, 0xa2, 0x7f, 0x0e, 0x7d, 0x9e, 0xd3, 0x98,
-  0x24, 0xf1, 0xe2, 0xb1, 0x60, 0xd4, 0x9e, 0x9f, 0xa6, 0x67, 0xaa, 0xe4,
-  0x22, 0x2d, 0x0f, 0xa5, 0x7a, 0x3e, 0x7c, 0x3a, 0x38, 0xbe, 0x7f, 0x0f,
-  0x83, 0x8e, 0xfb, 0xca, 0x97, 0xe1, 0x3a, 0x4c, 0x16, 0xd1, 0x32, 0x54,
-  0x22, 0x44, 0xde, 0x4b, 0x25, 0x66, 0xdd, 0xa1, 0x12, 0xa5, 0x88, 0xf7,
-  0x1f, 0x6d, 0x26, 0x88, 0xac, 0x08, 0x8d, 0xa1, 0xfe, 0x2a, 0xd8, 0xac,
-  0x67, 0x71, 0x82, 0x81, 0xca, 0xd3, 0x90, 0x62, 0x4a, 0xe5, 0xe1, 0x79,
-  0xbc, 0x79, 0x3f, 0x0b, 0xc6, 0xd1, 0x77, 0xe1, 0x4c, 0xc1, 0x60, 0x6b,
-  0xbd, 0x4a, 0xfb, 0xc7, 0xc7, 0x13, 0x96, 0x68, 0xc4, 0xc9, 0xf4, 0x01,
-  0xcf, 0x36, 0xc7, 0x08, 0x69, 0x99, 0x86, 0x8a, 0xf2, 0xf2, 0xf9, 0x3b,
-  0x82, 0x1c, 0x53, 0x91, 0x5e, 0x0f, 0x1b, 0xea, 0x68, 0x7e, 0x6f, 0xb8,
-  0xdc, 0xcc, 0xd1, 0x45, 0xb7, 0x5f, 0x02, 0xfa, 0xe9, 0xd3, 0x57, 0xec,
-  0xf7, 0xde, 0x3d, 0xf4, 0xd8, 0x51, 0xca, 0xa5, 0x51, 0xb7, 0xb2, 0x5f,
-  0x7f, 0x29, 0xb3, 0x02, 0xa7, 0xd8, 0x4f, 0x1d, 0x1c, 0x50, 0x57, 0x8e,
-  0x21, 0x42, 0x09, 0x6a, 0x64, 0x44, 0x10, 0x6b, 0x66, 0x44, 0x30, 0x18,
-  0x68, 0xc6, 0x01, 0x6d, 0x19, 0xed, 0x7e, 0x55, 0x10, 0x32, 0xa7, 0x9c,
-  0x60, 0x24, 0xf9, 0x14, 0x03, 0x8a, 0xf5, 0x8b, 0x27, 0x65, 0x82, 0x39,
-  0x46, 0x4a, 0x45, 0x2f, 0xa7, 0xbd, 0x6c, 0x0b, 0x70, 0xdb, 0xd4, 0x4c,
-  0xd8, 0x58, 0x3d, 0x3c, 0x78, 0x86, 0xde, 0xfd, 0xb9, 0x41, 0x8d, 0x05,
-  0x55, 0xfe, 0x5a, 0x1b, 0xe3, 0x01, 0x66, 0x88, 0x86, 0x9e, 0x63, 0x8e,
-  0xb4, 0x08, 0x23, 0x90, 0x72, 0xbf, 0xcc, 0x6d, 0xe0, 0x8b, 0x88, 0x06,
-  0x3d, 0xac, 0x91, 0xe0, 0x89, 0x62, 0x6a, 0x64, 0x0d, 0x92, 0x2b, 0xc4,
-  0xfa, 0xc3, 0x71, 0xa5, 0x4d, 0x8d, 0xd4, 0xfe, 0x68, 0x38, 0xa9, 0x03,
-  0xe9, 0x07, 0xe8, 0x0f, 0x93, 0x24, 0xb8, 0x92, 0x61, 0x11, 0x17, 0x9a,
-  0x47, 0x43, 0x23, 0x48, 0xde, 0xbf, 0xc7, 0x11, 0xa2, 0x94, 0x5d, 0x91,
-  0xe7, 0xe0, 0xa0, 0x24, 0xd2, 0xbd, 0xe1, 0xf0, 0x6b, 0x8c, 0x7b, 0xba,
-  0x94, 0xcc, 0x46, 0x39, 0xc3, 0x91, 0xec, 0x39, 0x54, 0xe9, 0xc5, 0x92,
-  0xe1, 0xdc, 0x28, 0xf4, 0xc1, 0xc4, 0x5d, 0x5b, 0x01, 0x37, 0xf3, 0xb4,
-  0xda, 0x72, 0x68, 0x75, 0x1c, 0xdb, 0xeb, 0xba, 0x08, 0x2e, 0xb4, 0x70,
-  0xa8, 0xdb, 0x1d, 0x3c, 0x3b, 0xdd, 0x4e, 0x4f, 0x8b, 0x87, 0x7a, 0x9e,
-  0xe4, 0x6a, 0xeb, 0x61, 0x96, 0xd2, 0xd5, 0x36, 0x68, 0x2b, 0x9b, 0x93,
-  0x24, 0x6b, 0x2b, 0x1b, 0xb4, 0x95, 0xe4, 0x74, 0x73, 0x36, 0x6c, 0xe3,
-  0x97, 0x79, 0x79, 0x5c, 0x79, 0x4f, 0x5a, 0x88, 0x5b, 0x44, 0xa2, 0xed,
-  0x66, 0xa9, 0xdd, 0x52, 0xf8, 0x92, 0x9c, 0xae, 0x44, 0x37, 0x6f, 0xd9,
-  0xdd, 0x93, 0x93, 0x15, 0x7a, 0x60, 0x2d, 0x39, 0x6d, 0xaf, 0x8e, 0x7c,
-  0x17, 0xf0, 0xde, 0xc9, 0x89, 0xab, 0x1e, 0x59, 0xee, 0xd9, 0x70, 0x95,
-  0x17, 0x6d, 0x81, 0x91, 0xdc, 0xb7, 0x93, 0x89, 0x36, 0xa5, 0xeb, 0x74,
-  0xaa, 0xcd, 0xe8, 0x3a, 0x9b, 0x69, 0x57, 0x74, 0x8d, 0xa2, 0xba, 0x94,
-  0x43, 0xcb, 0xe7, 0x56, 0xf0, 0x78, 0xb8, 0xd4, 0xde, 0x0e, 0x43, 0xed,
-  0xfd, 0x30, 0xd6, 0xbe, 0x1d, 0xae, 0x07, 0xcb, 0xe1, 0xa2, 0xbd, 0xd4,
-  0x42, 0x2d, 0xd6, 0xd6, 0xe0, 0xb9, 0x39, 0x32, 0xcf, 0xb4, 0x8e, 0xa6,
-  0xfb, 0x5d, 0xb3, 0xdb, 0xf1, 0x7b, 0x8e, 0xaf, 0x6a, 0x6b, 0x20, 0xac,
-  0x35, 0x86, 0xc2, 0x10, 0xac, 0x33, 0xcd, 0x82, 0x3f, 0x77, 0xba, 0x3d,
-  0xcf, 0x77, 0xbd, 0x2e, 0x30, 0x62, 0x60, 0x20, 0x3b, 0xe1, 0x30, 0x0c,
-  0x1b, 0x18, 0x1d, 0xcd, 0x37, 0x7d, 0xcb, 0xf4, 0xba, 0x56, 0x4f, 0xd5,
-  0x42, 0x20, 0x70, 0x0e, 0x4b, 0x86, 0xe0, 0x9c, 0x69, 0x36, 0x48, 0x58,
-  0xa6, 0xeb, 0x7a, 0xb6, 0xe7, 0x38, 0xa6, 0xaa, 0x55, 0xc5, 0x70, 0x99,
-  0x18, 0x56, 0xc7, 0x77, 0xad, 0x6e, 0xb7, 0xd7, 0xa9, 0x8b, 0xe1, 0x91,
-  0x18, 0xf8, 0xdf, 0x34, 0xcd, 0xae, 0xe9, 0xda, 0x0d, 0x62, 0xf8, 0xc0,
-  0x20, 0x1a, 0x2e, 0x2a, 0xd2, 0xb1, 0x1c, 0xd7, 0xaa, 0x0b, 0xd2, 0xe1,
-  0x82, 0xb8, 0x5e, 0xc7, 0xf4, 0x7a, 0x5d, 0xa7, 0x2e, 0x46, 0x17, 0x62,
-  0x80, 0x4a, 0xc7, 0x34, 0x1d, 0xcf, 0xb5, 0x1a, 0xb4, 0xd1, 0xe3, 0xda,
-  0xb0, 0x7a, 0x64, 0x2a, 0xae, 0x6b, 0x75, 0xea, 0x72, 0x58, 0x26, 0x17,
-  0xc4, 0xb5, 0x4d, 0xdf, 0xa9, 0xcb, 0x60, 0x59, 0x42, 0x1b, 0xbd, 0x9e,
-  0xe9, 0x9a, 0x60, 0x62, 0xd7, 0xc5, 0xb0, 0x6c, 0x26, 0x07, 0x0a, 0xea,
-  0x9b, 0x8e, 0xdf, 0xb5, 0x1b, 0x6a, 0xc5, 0xe1, 0x82, 0xb8, 0x26, 0x0a,
-  0x6a, 0x99, 0x56, 0x83, 0x18, 0xae, 0xd0, 0x87, 0x67, 0x42, 0x69, 0xb6,
-  0xdd, 0x33, 0x1b, 0x64, 0xf1, 0x98, 0x2c, 0x18, 0x10, 0xf8, 0x9e, 0xe3,
-  0x39, 0x76, 0x8f, 0x44, 0x99, 0x66, 0xa2, 0x64, 0xd5, 0xef, 0x81, 0x88,
-  0xef, 0x75, 0x7a, 0xbe, 0x67, 0x99, 0x24, 0xc9, 0x34, 0x93, 0x24, 0x53,
-  0x7b, 0x8f, 0xea, 0xd6, 0xef, 0x79, 0xa6, 0xe5, 0x3b, 0x36, 0x49, 0x32,
-  0x2d, 0x4b, 0x42, 0x26, 0xe4, 0x6a, 0xbe, 0xeb, 0x74, 0xa0, 0x5a, 0x8b,
-  0xe9, 0x64, 0x5a, 0x92, 0xc3, 0x84, 0x18, 0x26, 0x6c, 0xac, 0xe3, 0xa0,
-  0xee, 0x1d, 0xd3, 0xae, 0x8b, 0xe1, 0x31, 0x31, 0x3a, 0xa6, 0xe5, 0xc1,
-  0x04, 0x7b, 0x56, 0x5d, 0x0c, 0xcb, 0x24, 0x39, 0x9c, 0x2e, 0x64, 0x30,
-  0xbb, 0x4e, 0x83, 0x10, 0x1e, 0x13, 0x42, 0xf7, 0x7d, 0xd3, 0xed, 0x74,
-  0x1d, 0xc7, 0xab, 0x4b, 0xe1, 0x72, 0x29, 0x5c, 0x13, 0xad, 0xb4, 0xd3,
-  0x75, 0xbb, 0x75, 0x29, 0x7a, 0x24, 0x85, 0xe7, 0x77, 0x5d, 0x17, 0x85,
-  0xe9, 0x36, 0x08, 0xe1, 0x0a, 0x65, 0x58, 0xbd, 0x2e, 0x2a, 0xae, 0x67,
-  0xd6, 0xe5, 0x70, 0xb8, 0x18, 0x56, 0xb7, 0xe3, 0xf8, 0x4e, 0xcf, 0xb7,
-  0xea, 0x62, 0x74, 0x99, 0x18, 0x96, 0xe5, 0xa3, 0x46, 0x2c, 0xe8, 0xb4,
-  0xa1, 0x4e, 0x1c, 0x5e, 0x29, 0x2e, 0xe4, 0xe8, 0x5a, 0xae, 0xdf, 0xa9,
-  0x4b, 0x62, 0x33, 0x41, 0x3c, 0xcb, 0x35, 0xa9, 0x28, 0x75, 0x31, 0x3a,
-  0x4c, 0x0c, 0xab, 0x43, 0xb5, 0xde, 0x75, 0x3b, 0x0d, 0x75, 0x62, 0xd9,
-  0x5c, 0x1d, 0x56, 0xcf, 0x86, 0xce, 0x3a, 0x1d, 0xc7, 0x25, 0x41, 0x66,
-  0xd5, 0x5a, 0x41, 0x59, 0xc0, 0xc1, 0xf3, 0x98, 0x36, 0x66, 0x99, 0x0c,
-  0xa2, 0x20, 0x28, 0x05, 0x22, 0x41, 0x18, 0x9f, 0xd7, 0x81, 0xa8, 0xac,
-  0x56, 0x66, 0x75, 0xd3, 0xf0, 0x61, 0xe9, 0x4e, 0xcf, 0x74, 0x4c, 0xcf,
-  0xb7, 0x49, 0x8e, 0x59, 0x59, 0x0e, 0xaa, 0x16, 0x07, 0x5c, 0x3c, 0xc7,
-  0xec, 0x79, 0x9e, 0x5f, 0x97, 0x02, 0x34, 0x48, 0xa3, 0x94, 0xde, 0x43,
-  0x9b, 0x33, 0xeb, 0x92, 0xb8, 0x4c, 0x12, 0xcb, 0xee, 0xd8, 0xdd, 0x1e,
-  0xaa, 0xbe, 0x41, 0x90, 0x0e, 0xc9, 0x41, 0x44, 0x3c, 0xb7, 0xd7, 0xf1,
-  0x9d, 0x26, 0x39, 0x4c, 0x2e, 0x87, 0x65, 0xf6, 0xa0, 0x2f, 0xd3, 0x77,
-  0xcd, 0x06, 0x49, 0x1c, 0x12, 0xc5, 0xef, 0x82, 0x53, 0xcf, 0xea, 0xb8,
-  0x75, 0x41, 0x4c, 0x12, 0x84, 0xca, 0xd2, 0x85, 0x89, 0xd9, 0xb6, 0x5d,
-  0x17, 0xc4, 0xe1, 0x82, 0x20, 0xd1, 0xb3, 0xad, 0x5e, 0xa7, 0x57, 0x17,
-  0xc4, 0x67, 0x72, 0x74, 0x7c, 0xd3, 0xee, 0x59, 0xdd, 0x5e, 0x5d, 0x88,
-  0x1e, 0x53, 0x07, 0xe4, 0x73, 0x7c, 0xd7, 0xed, 0x76, 0xea, 0x42, 0x58,
-  0x36, 0x97, 0xc2, 0xb5, 0xad, 0xae, 0xe5, 0x75, 0x1d, 0xaf, 0xa1, 0x5e,
-  0x3c, 0x26, 0x06, 0x54, 0xda, 0x71, 0x21, 0x88, 0x59, 0x97, 0xc2, 0xe6,
-  0xda, 0xe8, 0xf5, 0x3c, 0xf4, 0x93, 0xbe, 0xc7, 0xac, 0xf4, 0xaa, 0xda,
-  0xb3, 0x90, 0x46, 0x7b, 0x5d, 0xdf, 0x31, 0xbb, 0x2e, 0x53, 0xc6, 0x55,
-  0x26, 0x47, 0xae, 0x73, 0x32, 0x74, 0xdb, 0xef, 0xf6, 0x2c, 0xd7, 0x62,
-  0x62, 0x5c, 0xd5, 0x7d, 0x18, 0xb3, 0x74, 0x6a, 0x0d, 0x6e, 0xcf, 0x64,
-  0xad, 0xf6, 0xaa, 0x24, 0x08, 0xb9, 0x30, 0x14, 0x06, 0x16, 0xe6, 0x50,
-  0xcb, 0x2d, 0xc9, 0x91, 0x17, 0x17, 0x26, 0x06, 0x9f, 0xee, 0xc2, 0x4e,
-  0x3b, 0x56, 0x5d, 0x10, 0x87, 0x09, 0xa2, 0x43, 0x9b, 0x2e, 0xa4, 0x45,
-  0x47, 0xd6, 0x20, 0x89, 0x29, 0x24, 0x31, 0x3d, 0xcb, 0xb3, 0x9d, 0xba,
-  0x18, 0xe4, 0xd5, 0x99, 0xb1, 0x43, 0x4c, 0x1b, 0xd5, 0xdf, 0xab, 0x0b,
-  0xd2, 0x25, 0x39, 0xa8, 0xe1, 0x3b, 0x16, 0x8c, 0xb0, 0x57, 0x92, 0x43,
-  0x6a, 0x9d, 0xfc, 0x20, 0xba, 0x52, 0x0b, 0x2d, 0xa6, 0x2e, 0x86, 0x2f,
-  0xa4, 0xf0, 0x7c, 0x72, 0x31, 0xf0, 0x76, 0x0d, 0x82, 0x38, 0x4c, 0x12,
-  0x0b, 0xad, 0xc1, 0xf2, 0x2c, 0xdf, 0x6d, 0x10, 0xc4, 0xe5, 0x35, 0xe3,
-  0x7a, 0x28, 0x89, 0xd9, 0x31, 0x1b, 0x04, 0xb1, 0x84, 0x46, 0x2c, 0x34,
-  0x5e, 0x0b, 0x2e, 0xa4, 0x57, 0x17, 0xc5, 0x66, 0xa2, 0x74, 0x50, 0x9e,
-  0x6e, 0xc7, 0xf6, 0x7a, 0x75, 0x41, 0x7a, 0x5c, 0x23, 0x8e, 0xeb, 0x90,
-  0xde, 0xb9, 0x85, 0x2c, 0x8f, 0x1e, 0x23, 0xc2, 0x31, 0x81, 0x1b, 0x1e,
-  0xbd, 0xa5, 0x3b, 0x90, 0x8d, 0x8f, 0xde, 0xd3, 0x1d, 0x84, 0x58, 0x1f,
-  0x7d, 0x4b, 0x77, 0xdb, 0x2c, 0x86, 0xcf, 0x66, 0x71, 0x4e, 0x85, 0xf0,
-  0x67, 0x08, 0xd9, 0x59, 0x1c, 0x54, 0x0a, 0x60, 0xb5, 0x44, 0x5b, 0x71,
-  0xd9, 0x79, 0xc4, 0xb3, 0x1e, 0x8e, 0x8e, 0xda, 0xd1, 0x41, 0xf2, 0xe9,
-  0xef, 0xd1, 0xc1, 0x4a, 0x3d, 0x6a, 0x2f, 0x89, 0xa6, 0x7a, 0x14, 0x8b,
-  0x11, 0x4c, 0x7b, 0x7d, 0x72, 0x12, 0x7e, 0x5a, 0xf3, 0x49, 0xad, 0x50,
-  0x3d, 0x8a, 0xb6, 0x1a, 0x8b, 0xa9, 0xf6, 0xa1, 0xb9, 0xfa, 0x94, 0x1c,
-  0xfc, 0x7d, 0x6f, 0x9a, 0xb3, 0xd9, 0x1e, 0x34, 0xff, 0x92, 0xfc, 0x65,
-  0x6f, 0x82, 0x51, 0x74, 0x3b, 0xc1, 0xe4, 0x2f, 0xed, 0xe8, 0x13, 0x64,
-  0xdc, 0x97, 0xe6, 0x39, 0x66, 0x3e, 0xdf, 0xa7, 0xd1, 0xc7, 0x10, 0x11,
-  0x23, 0x3d, 0x8f, 0xa3, 0x69, 0x98, 0xae, 0x33, 0xc0, 0x8b, 0x6c, 0xd4,
-  0x5d, 0x19, 0x32, 0xd0, 0xb2, 0xca, 0x90, 0x8d, 0xb0, 0xd4, 0xf5, 0x2c,
-  0x89, 0x2f, 0x15, 0x5a, 0x91, 0x79, 0x92, 0x24, 0x08, 0x57, 0x5b, 0xcf,
-  0xe7, 0xb4, 0x32, 0x35, 0x57, 0x82, 0x64, 0xca, 0xe6, 0x5e, 0x95, 0xd6,
-  0xd1, 0x48, 0x1d, 0x64, 0x01, 0x7a, 0x71, 0x02, 0xab, 0x1d, 0x10, 0x35,
-  0x39, 0xb6, 0x64, 0x43, 0x8e, 0x20, 0x65, 0x69, 0x5f, 0x24, 0x7d, 0xf1,
-  0x28, 0xc6, 0x23, 0xe3, 0xca, 0xb8, 0x3a, 0x51, 0xfb, 0x73, 0x43, 0x4e,
-  0x54, 0xe1, 0x79, 0x9b, 0x4f, 0x17, 0x7c, 0x3d, 0xcc, 0x05, 0x17, 0x4b,
-  0x08, 0x6f, 0x86, 0x0f, 0xdb, 0x5f, 0xab, 0xda, 0xc5, 0x70, 0x3e, 0x7c,
-  0xb0, 0x73, 0x7a, 0x7a, 0xae, 0x36, 0x4c, 0x10, 0xcf, 0xa2, 0x31, 0xd6,
-  0x30, 0x68, 0xa2, 0xe5, 0xd1, 0xfe, 0x99, 0xd9, 0x44, 0xb5, 0xcc, 0x79,
-  0x79, 0x63, 0xce, 0x16, 0x86, 0x46, 0xd3, 0x24, 0x4c, 0xd3, 0x77, 0xb4,
-  0x82, 0xd7, 0x52, 0x31, 0x55, 0x82, 0x79, 0x75, 0x5a, 0x61, 0x1d, 0xce,
-  0xb7, 0xda, 0x93, 0x9b, 0xf3, 0x86, 0xa4, 0xf4, 0xc6, 0x8c, 0xef, 0xf6,
-  0xc8, 0xf8, 0x26, 0x0c, 0xd2, 0x78, 0x59, 0xcd, 0xf9, 0xe5, 0x30, 0x48,
-  0xaf, 0x96, 0x23, 0x05, 0xf9, 0xa9, 0x5e, 0xbf, 0x4a, 0xb0, 0x9e, 0x93,
-  0x86, 0xed, 0xf6, 0x44, 0x4b, 0x55, 0x90, 0x9c, 0x87, 0x6b, 0xcc, 0x18,
-  0xb5, 0x5a, 0x18, 0x48, 0x52, 0xf2, 0xd3, 0x68, 0x1e, 0x82, 0xce, 0x38,
-  0x4c, 0xd0, 0x38, 0xe3, 0x25, 0xad, 0x8b, 0x15, 0xac, 0x05, 0x8b, 0x01,
-  0xc3, 0x37, 0xb4, 0x06, 0x07, 0x73, 0x08, 0x49, 0xab, 0x29, 0xa6, 0xbb,
-  0x55, 0x6d, 0xd2, 0x1e, 0x43, 0x2f, 0x01, 0x1b, 0xf9, 0x3e, 0xe4, 0x03,
-  0x3f, 0x39, 0x58, 0x56, 0xb5, 0x57, 0x52, 0x82, 0xeb, 0x47, 0xed, 0xd6,
-  0x66, 0x45, 0x54, 0x1f, 0xc7, 0xf3, 0xcd, 0x02, 0xc2, 0x6a, 0x80, 0x60,
-  0x99, 0x75, 0x0d, 0x2b, 0x48, 0x73, 0xd8, 0x45, 0xae, 0xc6, 0x1c, 0x36,
-  0x20, 0x41, 0x27, 0xc3, 0x9d, 0x1a, 0xc0, 0x5a, 0x35, 0xad, 0x45, 0xa0,
-  0xf4, 0x17, 0xc1, 0x7c, 0x13, 0x0e, 0xd6, 0xc9, 0x15, 0x2b, 0x5b, 0x3a,
-  0x0c, 0x2e, 0x83, 0x68, 0xad, 0x7c, 0x09, 0x59, 0x06, 0x97, 0xed, 0xd6,
-  0x5b, 0xc8, 0x4e, 0xcc, 0x14, 0xac, 0xb5, 0x92, 0x32, 0x46, 0xe0, 0x01,
-  0xea, 0xdc, 0xb0, 0xc6, 0x02, 0x99, 0x2f, 0x4e, 0xfd, 0xf5, 0x18, 0x44,
-  0x8f, 0x53, 0xca, 0xf0, 0xc5, 0x02, 0xb4, 0x87, 0xbf, 0xb8, 0x9e, 0x6c,
-  0x0f, 0xb0, 0x0e, 0x30, 0xc3, 0x5d, 0xba, 0xfd, 0xab, 0x4a, 0x4b, 0xa7,
-  0xf7, 0xc6, 0x46, 0xfc, 0xbe, 0xda, 0x6e, 0x04, 0x1b, 0xc6, 0x63, 0xc5,
-  0x79, 0x28, 0x93, 0x00, 0xaa, 0x1d, 0xe7, 0xac, 0x02, 0xc1, 0x6a, 0x6c,
-  0xac, 0xc3, 0x0f, 0xeb, 0x36, 0x07, 0xc7, 0xf3, 0xd0, 0x98, 0xc7, 0xd3,
-  0x62, 0x76, 0xe8, 0x60, 0x85, 0x94, 0xb0, 0x8f, 0x1a, 0xca, 0xf2, 0x8e,
-  0x78, 0x55, 0xc5, 0xc9, 0xe2, 0xcb, 0x60, 0x1d, 0x30, 0xcd, 0x44, 0x0c,
-  0xf4, 0xc7, 0x97, 0x2f, 0x9e, 0x61, 0xba, 0xe5, 0x4d, 0x88, 0x65, 0x58,
-  0x5a, 0xd9, 0x35, 0xb0, 0x58, 0x81, 0xe9, 0x9d, 0xaf, 0x5e, 0xbf, 0x7d,
-  0xd7, 0xd2, 0x5a, 0xac, 0x38, 0x5c, 0xfb, 0xd0, 0x71, 0x64, 0xf0, 0xdb,
-  0xda, 0x1a, 0x90, 0xd4, 0x7d, 0x61, 0x19, 0x28, 0x51, 0x99, 0x36, 0x57,
-  0x43, 0x3e, 0x6b, 0x1e, 0x6f, 0x96, 0xe3, 0x76, 0x62, 0x50, 0xfe, 0x70,
-  0x7c, 0x9c, 0x18, 0x6b, 0x90, 0x9e, 0xdf, 0xb7, 0x4c, 0x53, 0x1d, 0xdc,
-  0xda, 0x30, 0x1e, 0x05, 0x09, 0x6a, 0x29, 0x5d, 0x5f, 0xa1, 0xb0, 0x7c,
-  0xb5, 0x7c, 0x75, 0xd4, 0xfa, 0x65, 0x4b, 0xbb, 0x35, 0xe3, 0xef, 0x51,
-  0xb1, 0xa5, 0x86, 0xc1, 0x33, 0x6e, 0xb5, 0x7b, 0x56, 0xa1, 0x38, 0xf1,
-  0x32, 0xc3, 0x1f, 0x16, 0xa5, 0x47, 0x55, 0x65, 0x23, 0x6a, 0x9a, 0xe9,
-  0xc3, 0x7a, 0xf3, 0xf9, 0x3c, 0xfc, 0x0f, 0x2e, 0xd4, 0x56, 0x8b, 0x50,
-  0x14, 0x6a, 0x51, 0x57, 0xb0, 0xc0, 0x75, 0x88, 0xa9, 0xc2, 0xe5, 0x34,
-  0x94, 0x45, 0x62, 0x25, 0x8a, 0x0c, 0x86, 0xf0, 0x96, 0x10, 0x86, 0x43,
-  0x57, 0x65, 0xa0, 0x94, 0x6d, 0xc0, 0x18, 0x0e, 0x6d, 0x08, 0x7e, 0x2b,
-  0xfb, 0xba, 0xdc, 0x2d, 0x14, 0x78, 0x1f, 0xc1, 0x59, 0x4e, 0x29, 0x76,
-  0x96, 0xef, 0x51, 0x8e, 0x51, 0x6a, 0xce, 0xe9, 0x66, 0x34, 0x2a, 0xb6,
-  0xe6, 0x70, 0x8e, 0x99, 0xbf, 0x92, 0xb8, 0x2e, 0xc4, 0xbd, 0xdd, 0xab,
-  0xfe, 0xab, 0xe4, 0x65, 0x0e, 0x35, 0x07, 0x3c, 0x69, 0xb7, 0xbe, 0x66,
-  0xd6, 0x95, 0xb7, 0x62, 0xd6, 0xe8, 0x92, 0x61, 0x64, 0x64, 0xed, 0xf3,
-  0x1d, 0x5a, 0xf1, 0xe0, 0x1d, 0x75, 0x5c, 0xac, 0x68, 0x7b, 0x8a, 0xf3,
-  0xef, 0x2f, 0x88, 0xf6, 0x0e, 0xde, 0x86, 0xed, 0xb9, 0x50, 0x78, 0xc7,
-  0x1d, 0x8e, 0x15, 0x5e, 0x25, 0x0a, 0x4d, 0x8c, 0xa3, 0xbf, 0xcf, 0xaa,
-  0x08, 0x2e, 0x1e, 0x3b, 0x2b, 0x56, 0xf0, 0x28, 0x10, 0x66, 0x82, 0xdc,
-  0x2d, 0x6d, 0xae, 0xcd, 0x0d, 0xda, 0x09, 0x43, 0xcd, 0x2f, 0x05, 0x9c,
-  0x26, 0xe9, 0x2e, 0x33, 0x16, 0x70, 0xb2, 0xc8, 0x2d, 0x10, 0xb6, 0x23,
-  0x5a, 0x70, 0xa7, 0x75, 0x8c, 0xcf, 0x97, 0x33, 0x35, 0x16, 0xc8, 0x44,
-  0x2b, 0xfe, 0x68, 0x1d, 0xbf, 0xa7, 0x0e, 0x31, 0x9b, 0xf5, 0x7e, 0x60,
-  0x1d, 0x1c, 0xdc, 0x5b, 0xa0, 0x2f, 0x8a, 0x56, 0xf3, 0xf0, 0x8b, 0x36,
-  0x76, 0xd9, 0x24, 0xd8, 0xe7, 0xf2, 0xa7, 0x78, 0xa3, 0x8c, 0x68, 0xee,
-  0x7a, 0x39, 0xbf, 0x52, 0xb8, 0x77, 0xc0, 0x7d, 0xa8, 0xb4, 0x69, 0xe2,
-  0x54, 0x55, 0xa8, 0x08, 0x4a, 0x40, 0x1b, 0x58, 0xd6, 0xd1, 0x22, 0x34,
-  0xc0, 0x02, 0x7e, 0xa4, 0x3f, 0x3f, 0x35, 0xcf, 0x98, 0xc8, 0x06, 0x36,
-  0x30, 0x45, 0xa0, 0x82, 0x04, 0x2c, 0x83, 0xac, 0xda, 0xea, 0x3d, 0x36,
-  0x6b, 0xda, 0xba, 0x89, 0x7c, 0x91, 0x74, 0x9a, 0x51, 0xbc, 0x67, 0xb2,
-  0x30, 0xe6, 0x6f, 0xbb, 0xfb, 0x2e, 0x9e, 0xf9, 0xd1, 0x66, 0xbd, 0x8e,
-  0xa9, 0xf0, 0xbf, 0xd8, 0x8d, 0x49, 0x84, 0x9f, 0x2f, 0xe1, 0xbd, 0x60,
-  0x81, 0x7f, 0xdb, 0x63, 0xf5, 0x7e, 0x0e, 0x0f, 0x87, 0xc9, 0xda, 0x90,
-  0xb0, 0xbe, 0xe4, 0xab, 0xd3, 0x6d, 0x30, 0x30, 0x18, 0x5e, 0xbb, 0xb4,
-  0x1a, 0xfe, 0x91, 0x90, 0xa9, 0x43, 0xfb, 0x3d, 0x6e, 0x54, 0x31, 0x7d,
-  0x6e, 0x0d, 0x5e, 0xb5, 0x49, 0x23, 0x85, 0x39, 0xef, 0x5f, 0xc3, 0xf5,
-  0x88, 0xfd, 0x16, 0xb4, 0xce, 0x4e, 0x30, 0x83, 0x6f, 0xa0, 0x01, 0x3d,
-  0x91, 0x10, 0x2f, 0x9f, 0x66, 0x82, 0x0e, 0x3f, 0x0e, 0x38, 0x10, 0x48,
-  0xe8, 0xe7, 0x7f, 0x8f, 0x1d, 0x53, 0xc3, 0x5f, 0x0f, 0xd8, 0xbe, 0xac,
-  0x63, 0xbe, 0xaf, 0x29, 0xdb, 0xe5, 0xc4, 0xda, 0x02, 0x1e, 0xee, 0x6b,
-  0xfd, 0xf3, 0x10, 0x73, 0xa5, 0xa1, 0xd6, 0x0f, 0x26, 0x58, 0x85, 0xb8,
-  0xc6, 0xd6, 0x02, 0x1d, 0x31, 0x2c, 0xad, 0x82, 0x9c, 0xc7, 0x09, 0x42,
-  0x13, 0x1d, 0x90, 0x81, 0xb8, 0x65, 0x6d, 0xa7, 0x6f, 0x66, 0x8f, 0x8c,
-  0x48, 0x1f, 0x1d, 0x69, 0x34, 0x16, 0x20, 0xbe, 0x01, 0xa4, 0xff, 0xf3,
-  0xd0, 0x0b, 0x3b, 0xe1, 0xf9, 0xb6, 0x42, 0x5b, 0xd7, 0xd7, 0x97, 0xba,
-  0xd8, 0xbc, 0xd5, 0x57, 0x5a, 0xad, 0x2d, 0xed, 0x0d, 0xbb, 0x9e, 0x63,
-  0xe1, 0x43, 0x9f, 0x85, 0xb4, 0x65, 0xa0, 0x6f, 0x19, 0xde, 0x40, 0xbf,
-  0x0c, 0xcf, 0xdf, 0x47, 0x6b, 0x9d, 0xba, 0x6a, 0x12, 0x25, 0xd4, 0x83,
-  0xf1, 0x77, 0x9b, 0x14, 0x89, 0x68, 0x7a, 0x03, 0x7d, 0x11, 0x7f, 0xd4,
-  0xd1, 0x9f, 0xb0, 0x94, 0xbe, 0x3b, 0xd0, 0xe3, 0xe2, 0x53, 0xe1, 0x76,
-  0x02, 0x3e, 0xfa, 0x24, 0x58, 0x44, 0xf3, 0xab, 0xfe, 0x26, 0xd2, 0xd3,
-  0x60, 0x99, 0xea, 0xd8, 0x69, 0x14, 0x21, 0x14, 0xbb, 0x42, 0x0d, 0x2e,
-  0xf4, 0x4d, 0xa4, 0xe9, 0xc1, 0x0a, 0x36, 0xac, 0x73, 0x80, 0xf6, 0x88,
-  0x76, 0x4f, 0xbd, 0x0c, 0x46, 0x6f, 0xd9, 0xe3, 0x53, 0xe4, 0xd7, 0xde,
-  0x86, 0xd3, 0x38, 0x54, 0xbe, 0x7e, 0xae, 0xbd, 0x89, 0xcf, 0x31, 0x09,
-  0xaf, 0x3d, 0x0b, 0xe7, 0x17, 0xe1, 0x3a, 0x1a, 0x05, 0xca, 0xab, 0x70,
-  0x13, 0x6a, 0x0f, 0x13, 0x6c, 0xd0, 0xd1, 0x5e, 0x21, 0x45, 0x79, 0x0b,
-  0xfa, 0x5a, 0x81, 0x49, 0xeb, 0x21, 0x91, 0x56, 0x1e, 0x93, 0x3e, 0x94,
-  0x27, 0x8b, 0xf8, 0xbb, 0x08, 0x41, 0x41, 0x46, 0x2e, 0x03, 0xe4, 0xcf,
-  0x6f, 0xaf, 0x16, 0xe7, 0x31, 0x36, 0x38, 0x10, 0xa9, 0x52, 0x1e, 0x51,
-  0x8c, 0x30, 0x80, 0x85, 0x84, 0x7a, 0x16, 0xbb, 0xf5, 0x97, 0x08, 0x47,
-  0x82, 0x39, 0x4f, 0x84, 0xbd, 0x47, 0xcc, 0x32, 0xaa, 0xc9, 0xdb, 0xf3,
-  0x78, 0x7c, 0x75, 0xbd, 0x40, 0xf8, 0x18, 0x2d, 0x51, 0x69, 0x45, 0x3d,
-  0x47, 0xcb, 0x19, 0xa4, 0x5c, 0x6f, 0x67, 0xc9, 0x35, 0x87, 0x20, 0x9d,
-  0x55, 0x5d, 0x96, 0x92, 0xd5, 0xe7, 0x3a, 0x5e, 0x89, 0x5a, 0xb7, 0x56,
-  0x1f, 0xb6, 0xc1, 0xf9, 0x79, 0xd2, 0xbf, 0x04, 0x42, 0xd8, 0x3e, 0x65,
-  0x9b, 0xe6, 0xce, 0xd4, 0xeb, 0x52, 0x75, 0xd1, 0x02, 0x5f, 0xc2, 0x84,
-  0xe9, 0x6f, 0x96, 0xc8, 0x0f, 0x9e, 0xe4, 0x9e, 0xd7, 0xeb, 0x70, 0x3c,
-  0xb8, 0x0d, 0x61, 0x3b, 0xb3, 0xb4, 0x99, 0xad, 0xcd, 0x1c, 0x6d, 0xe6,
-  0x6a, 0x33, 0x4f, 0x9b, 0xf9, 0xd7, 0x54, 0x3e, 0x56, 0x9f, 0xb9, 0x58,
-  0x0c, 0x72, 0x59, 0x2e, 0x44, 0x70, 0x5d, 0x12, 0xbd, 0xca, 0x28, 0xc7,
-  0x3b, 0xd7, 0xb0, 0x2e, 0x12, 0x2f, 0xa7, 0xd7, 0x45, 0x22, 0x50, 0x3b,
-  0xc4, 0xd8, 0x92, 0xfb, 0xd5, 0xde, 0x9f, 0x8f, 0x51, 0x85, 0x8b, 0x95,
-  0x86, 0x46, 0x7c, 0x5d, 0xb1, 0x9f, 0x45, 0xbc, 0x8c, 0xd3, 0x15, 0xd6,
-  0x83, 0xb5, 0xb7, 0x4f, 0x5f, 0xe2, 0x5e, 0x7f, 0x13, 0x4e, 0x37, 0xf3,
-  0x20, 0xd1, 0x5e, 0x86, 0x08, 0xdc, 0x35, 0x80, 0x82, 0x51, 0xac, 0x3d,
-  0x66, 0x71, 0x65, 0x90, 0x6a, 0x2f, 0xa2, 0xf3, 0x90, 0xb3, 0x57, 0x90,
-  0x44, 0x09, 0x9b, 0x24, 0x0a, 0x13, 0x98, 0xcd, 0xa5, 0x96, 0x93, 0x1a,
-  0xc8, 0xf2, 0x59, 0xe1, 0x62, 0x9b, 0xa2, 0xce, 0xe6, 0x85, 0x32, 0x77,
-  0xcd, 0x5f, 0x6e, 0xd3, 0x0d, 0xa4, 0xde, 0xac, 0x0a, 0xd0, 0x8e, 0xf7,
-  0x4b, 0x5e, 0x95, 0x79, 0xc5, 0xad, 0xe2, 0x34, 0x62, 0x05, 0x85, 0x67,
-  0x00, 0xcb, 0x8b, 0x70, 0x80, 0x0e, 0x86, 0x8c, 0x74, 0xae, 0x07, 0xd8,
-  0x89, 0xb3, 0xec, 0xd3, 0x3a, 0x37, 0x65, 0x21, 0x6a, 0x68, 0xe0, 0xf0,
-  0x7c, 0x8b, 0xbe, 0x6e, 0xd8, 0x1e, 0x78, 0x12, 0x6d, 0xd4, 0x31, 0x1e,
-  0xe9, 0x89, 0xc5, 0x69, 0xd7, 0x4c, 0x7f, 0x70, 0x23, 0x68, 0xa5, 0xb2,
-  0xad, 0x97, 0x55, 0x2c, 0x81, 0xf3, 0x60, 0x85, 0x78, 0x39, 0xbb, 0xd9,
-  0x9e, 0x33, 0xbf, 0xaa, 0x45, 0xe4, 0x8d, 0xb4, 0x78, 0xb5, 0x9e, 0x22,
-  0xd0, 0x5b, 0x69, 0x29, 0xdb, 0xa3, 0xa8, 0x11, 0xe1, 0x00, 0x41, 0x54,
-  0x51, 0xb7, 0x19, 0xc9, 0x66, 0x43, 0xcf, 0x52, 0x2b, 0x96, 0x5e, 0x4b,
-  0x97, 0x9a, 0x64, 0x5e, 0xa2, 0xc9, 0x4c, 0x9a, 0xec, 0xbf, 0x62, 0xf3,
-  0x79, 0x53, 0x59, 0xc1, 0xd9, 0x93, 0x07, 0x34, 0x45, 0x79, 0x44, 0x01,
-  0xb8, 0x66, 0xd6, 0x09, 0x5a, 0xf9, 0x04, 0x2d, 0x0c, 0xcd, 0x6c, 0x99,
-  0x97, 0xf8, 0x94, 0x6d, 0x95, 0xe4, 0x0f, 0x67, 0xe2, 0x89, 0x39, 0xe1,
-  0xec, 0x01, 0xba, 0xc7, 0xde, 0xbe, 0xb3, 0xbc, 0xbd, 0x50, 0xe7, 0x1e,
-  0x80, 0xd4, 0x28, 0xec, 0xf3, 0x5c, 0x83, 0xf3, 0x60, 0xf4, 0x7e, 0xca,
-  0x02, 0x63, 0xa1, 0x6d, 0xc6, 0x09, 0x3b, 0x31, 0x50, 0x11, 0xc5, 0xc4,
-  0x68, 0x81, 0x6e, 0x99, 0x33, 0xef, 0x33, 0x77, 0x38, 0x41, 0x0f, 0x96,
-  0xd2, 0xd0, 0xfe, 0x3a, 0xde, 0xac, 0xa9, 0x98, 0x7d, 0xac, 0x12, 0xc7,
-  0x22, 0x71, 0x13, 0xa1, 0x2e, 0x2f, 0x60, 0x08, 0x63, 0xee, 0xdb, 0x67,
-  0x01, 0xfa, 0x07, 0x9e, 0x3b, 0x0b, 0x0d, 0xae, 0x77, 0xd9, 0x4b, 0xbf,
-  0x9f, 0x49, 0xcb, 0x22, 0x20, 0x3d, 0x5d, 0x45, 0x4b, 0x5d, 0x14, 0x58,
-  0xa6, 0x81, 0x69, 0x39, 0x4d, 0xf8, 0x14, 0x2e, 0x85, 0x28, 0x3d, 0xca,
-  0x3a, 0x9a, 0x35, 0x96, 0x9e, 0x94, 0x3a, 0x89, 0xc2, 0xf9, 0x78, 0x20,
-  0xa4, 0xd7, 0xe3, 0xc9, 0x04, 0x8a, 0xeb, 0xeb, 0xf6, 0xea, 0x43, 0x41,
-  0x04, 0x4e, 0xa2, 0xd0, 0xb0, 0xeb, 0xc4, 0x84, 0x56, 0x64, 0x1e, 0xea,
-  0xc2, 0x75, 0xde, 0xe3, 0x0b, 0xd9, 0x76, 0xeb, 0x9f, 0x8c, 0x46, 0x3a,
-  0x95, 0x74, 0xb3, 0x80, 0x39, 0x5c, 0x5d, 0x8f, 0xf9, 0xde, 0xea, 0xfe,
-  0x3c, 0x4a, 0xa1, 0x85, 0x35, 0x1a, 0x09, 0x9b, 0xf7, 0xf9, 0xdb, 0x26,
-  0x5e, 0x87, 0xda, 0x78, 0xae, 0x8d, 0xc7, 0x5a, 0xcd, 0x6f, 0x69, 0xb3,
-  0x44, 0x9b, 0x44, 0x53, 0x18, 0xb2, 0xc6, 0x7d, 0x49, 0x66, 0x58, 0x5b,
-  0x56, 0x4e, 0x94, 0xed, 0xba, 0xc1, 0xd4, 0x30, 0xf7, 0x83, 0xa8, 0xee,
-  0x5a, 0x02, 0xd0, 0x21, 0x6c, 0xe6, 0x1a, 0xe2, 0x91, 0xcd, 0x35, 0x71,
-  0x67, 0xdd, 0x2d, 0x2f, 0x61, 0x93, 0xa5, 0x62, 0xbe, 0x0f, 0xa3, 0xd9,
-  0x42, 0xf6, 0xbc, 0xb5, 0x25, 0x21, 0x6b, 0x18, 0x59, 0x25, 0x6f, 0x59,
-  0xe3, 0xec, 0x73, 0xeb, 0x60, 0x5b, 0x5c, 0x66, 0xcc, 0x07, 0xe6, 0xcd,
-  0xb3, 0x9e, 0x74, 0x1d, 0xc3, 0x5d, 0x61, 0xeb, 0x6c, 0xdf, 0x12, 0x2d,
-  0xe6, 0xe7, 0xbd, 0x51, 0xe0, 0x04, 0x93, 0x8c, 0x54, 0x33, 0x95, 0x7d,
-  0x08, 0x64, 0xad, 0x27, 0x89, 0xe7, 0x79, 0xeb, 0xb9, 0x1e, 0x6d, 0x92,
-  0x14, 0x38, 0xab, 0x98, 0xf6, 0xec, 0x26, 0xdb, 0x3e, 0xea, 0x80, 0x1c,
-  0xd3, 0x38, 0x4b, 0x10, 0x5b, 0xff, 0xb6, 0xd1, 0x62, 0xaa, 0xa5, 0x17,
-  0x53, 0xed, 0x22, 0x1a, 0x87, 0xb1, 0x86, 0xf0, 0xf0, 0x02, 0x9e, 0x37,
-  0xd8, 0x8c, 0xa3, 0x58, 0x8b, 0x26, 0x09, 0xc2, 0x4a, 0x2d, 0xc4, 0x46,
-  0xb9, 0xb1, 0xc6, 0xf7, 0x53, 0xe4, 0x55, 0xc9, 0x2a, 0xb0, 0xea, 0x23,
-  0x17, 0x98, 0x72, 0x9a, 0x87, 0x20, 0x29, 0xc8, 0xa1, 0x86, 0x3e, 0xf0,
-  0x9e, 0x8f, 0x7b, 0x94, 0x92, 0x49, 0xf3, 0xf9, 0xa9, 0xb3, 0x8c, 0x22,
-  0xb7, 0xba, 0xfb, 0x5a, 0x53, 0xb8, 0x93, 0x85, 0x4a, 0x54, 0xfe, 0xe5,
-  0x54, 0xff, 0xd0, 0x57, 0xcc, 0x41, 0x53, 0xc2, 0x55, 0x9e, 0xc0, 0x5a,
-  0x3d, 0x1c, 0x79, 0x28, 0x91, 0x25, 0xac, 0x80, 0x87, 0x5d, 0x01, 0x00,
-  0xe4, 0x8f, 0xe9, 0xfb, 0xf0, 0x92, 0xe5, 0x90, 0x8f, 0x12, 0x99, 0xef,
-  0x86, 0xa7, 0x64, 0xab, 0xf8, 0x7c, 0x95, 0x3f, 0xaf, 0x82, 0x25, 0xa5,
-  0xca, 0x87, 0xab, 0xfc, 0x21, 0x5a, 0xa2, 0xd5, 0x7d, 0x8c, 0xd1, 0x67,
-  0x28, 0x59, 0x5e, 0xd4, 0x16, 0x36, 0xd8, 0x2f, 0x83, 0x95, 0x4e, 0x3b,
-  0x17, 0x46, 0xeb, 0x25, 0x9c, 0x48, 0x9f, 0x26, 0x5f, 0x3e, 0x44, 0x0b,
-  0xd4, 0x32, 0x47, 0x9b, 0x26, 0x18, 0x96, 0x84, 0xe4, 0xd4, 0x31, 0x0b,
-  0xa6, 0xe7, 0x9d, 0x94, 0x52, 0x49, 0xbd, 0x88, 0x82, 0xdd, 0x89, 0xeb,
-  0xb8, 0x96, 0x06, 0xb5, 0x61, 0x3b, 0xc5, 0x3c, 0x17, 0x06, 0xbd, 0xed,
-  0x2c, 0x1c, 0xeb, 0x1f, 0xb1, 0xe3, 0x25, 0x83, 0x2d, 0x11, 0xcf, 0x43,
-  0x2c, 0x9d, 0xb7, 0xc1, 0x0a, 0x34, 0xd3, 0x78, 0x0d, 0x39, 0x09, 0x46,
-  0x45, 0x3e, 0xe4, 0x4f, 0xe1, 0xf6, 0xd0, 0x58, 0x8b, 0x10, 0xe1, 0x9b,
-  0x84, 0x65, 0x28, 0xe6, 0xea, 0x43, 0x3d, 0x8d, 0x5b, 0xb8, 0xf2, 0xf3,
-  0xc9, 0x64, 0x22, 0x13, 0x33, 0x68, 0x32, 0x3d, 0x6f, 0x7b, 0x3d, 0x05,
-  0x8b, 0x0c, 0x8a, 0xed, 0xfa, 0xca, 0xb1, 0x62, 0x78, 0x6a, 0x8d, 0x84,
-  0xf0, 0xd2, 0xa0, 0x8f, 0x7f, 0x3f, 0x37, 0xf1, 0x9f, 0x44, 0xd9, 0x91,
-  0x76, 0x33, 0x98, 0x73, 0x0f, 0xc7, 0xb5, 0xe4, 0xf3, 0xf9, 0x06, 0x42,
-  0x89, 0xfb, 0x04, 0x26, 0x2e, 0xea, 0x72, 0x90, 0xc7, 0xea, 0x49, 0x90,
-  0xae, 0x0b, 0xf5, 0x72, 0xc5, 0x2c, 0x27, 0x03, 0xcc, 0x36, 0x21, 0xb7,
-  0xc3, 0x1c, 0x12, 0x2d, 0xa9, 0x61, 0xe5, 0xb5, 0x43, 0xdd, 0x79, 0x21,
-  0x35, 0x0d, 0x57, 0x51, 0x90, 0x3d, 0x8c, 0xb1, 0xbd, 0x57, 0xc8, 0x97,
-  0x81, 0xa8, 0x97, 0x63, 0x60, 0x29, 0x97, 0x04, 0xd6, 0x04, 0x94, 0x49,
-  0xb9, 0xa4, 0xd5, 0x04, 0x29, 0x72, 0x35, 0x45, 0xca, 0x5e, 0x4b, 0x12,
-  0x85, 0xa8, 0x81, 0x85, 0x13, 0xab, 0xc2, 0xf3, 0x52, 0x56, 0x13, 0xb2,
-  0xe2, 0xa2, 0x43, 0xca, 0x40, 0x3f, 0x3a, 0x85, 0x1f, 0x9d, 0xc2, 0x8f,
-  0x4e, 0xe1, 0x47, 0xa7, 0x00, 0xa7, 0x60, 0xa4, 0x89, 0x4e, 0xd3, 0x59,
-  0xd7, 0xb9, 0x31, 0x07, 0xe7, 0x18, 0x3c, 0x22, 0x98, 0x1e, 0xe4, 0x23,
-  0x6e, 0x11, 0x76, 0xd0, 0xad, 0x0c, 0xf5, 0xb2, 0xe8, 0x4f, 0x27, 0x68,
-  0x0c, 0xa1, 0x26, 0x73, 0x28, 0x8b, 0xc7, 0x24, 0x03, 0x4c, 0x36, 0xad,
-  0xfa, 0x09, 0xc2, 0x1d, 0xec, 0x6d, 0x64, 0xff, 0xb0, 0x10, 0x33, 0x43,
-  0xdc, 0x4a, 0x16, 0xce, 0xe2, 0xe3, 0xcb, 0x24, 0x58, 0x55, 0xe6, 0x73,
-  0xb6, 0x46, 0xc6, 0xb9, 0x2e, 0xcb, 0xd6, 0xc8, 0x46, 0x95, 0x32, 0x4d,
-  0x40, 0x90, 0xc6, 0x07, 0x93, 0xba, 0x29, 0x46, 0x95, 0x44, 0x6a, 0x1e,
-  0x4e, 0xd6, 0x00, 0xd0, 0x85, 0x1e, 0xa9, 0x76, 0xe8, 0x99, 0x5d, 0x25,
-  0xc0, 0x16, 0x00, 0xc3, 0x4b, 0x10, 0x52, 0x1b, 0x34, 0xcd, 0x60, 0xb2,
-  0x81, 0xa8, 0xc9, 0x1f, 0x6c, 0x7a, 0xc8, 0x52, 0x3f, 0xea, 0x9e, 0x79,
-  0xfd, 0x91, 0x0d, 0x49, 0x3f, 0xf4, 0x3d, 0x60, 0x2c, 0xce, 0xb1, 0x9d,
-  0x40, 0xc4, 0xd0, 0xba, 0x60, 0x6d, 0x33, 0x64, 0x9e, 0xe6, 0x57, 0xd2,
-  0xdc, 0x2c, 0xc5, 0xae, 0x24, 0xc8, 0x3c, 0x6e, 0x25, 0xc5, 0xe2, 0x09,
-  0x73, 0x99, 0x85, 0x4a, 0x94, 0x67, 0x48, 0x24, 0xbc, 0x54, 0x90, 0xc5,
-  0xba, 0x20, 0x19, 0x15, 0xc1, 0x2e, 0x24, 0xd8, 0xc5, 0x04, 0x27, 0x07,
-  0xbb, 0x25, 0xb0, 0xc4, 0x2f, 0xa1, 0x4b, 0x70, 0x09, 0xdd, 0xca, 0xa0,
-  0x7e, 0x09, 0x2a, 0xb0, 0x59, 0xa4, 0x5b, 0x8e, 0x7b, 0xb7, 0x98, 0xcc,
-  0xa6, 0x41, 0x56, 0x0e, 0xe5, 0x8f, 0x5b, 0xbc, 0xa7, 0x11, 0x7e, 0xc8,
-  0x81, 0xf4, 0x90, 0x61, 0xea, 0xa5, 0x14, 0x01, 0xe3, 0x08, 0xdc, 0xe6,
-  0x4a, 0x61, 0x30, 0x80, 0x10, 0x7c, 0x16, 0x4a, 0xa5, 0x30, 0xc8, 0x37,
-  0x86, 0x97, 0x03, 0x7d, 0x3b, 0x03, 0x67, 0x30, 0x08, 0x2c, 0x60, 0x97,
-  0x7a, 0xef, 0x9a, 0x5b, 0xa5, 0x2d, 0x41, 0xdf, 0x9c, 0xda, 0x5d, 0x38,
-  0xd5, 0x6f, 0xce, 0x44, 0x12, 0x7b, 0xe2, 0x09, 0x8e, 0x59, 0x4c, 0xc0,
-  0x53, 0x9e, 0x60, 0x97, 0x12, 0x6c, 0x91, 0x30, 0xd9, 0x60, 0x8a, 0x45,
-  0x86, 0xf5, 0xdb, 0x5f, 0xbd, 0x0f, 0xaf, 0xd8, 0x50, 0x21, 0x55, 0x68,
-  0x00, 0x0b, 0xab, 0xbb, 0x96, 0xe3, 0x7b, 0xee, 0x08, 0xda, 0xd8, 0x78,
-  0x3a, 0x0e, 0xa7, 0xea, 0x16, 0xcd, 0x64, 0x19, 0x2d, 0xa8, 0xbf, 0x65,
-  0xa8, 0xec, 0x81, 0xb5, 0x07, 0x7a, 0x54, 0xac, 0x54, 0x21, 0xcd, 0x60,
-  0xf2, 0x39, 0x5a, 0x4e, 0xe8, 0x25, 0x54, 0xa8, 0x82, 0x8f, 0x57, 0x74,
-  0x31, 0x90, 0xa9, 0x8e, 0x6b, 0x0c, 0x3e, 0xab, 0xa0, 0x93, 0xda, 0xf2,
-  0x61, 0xe9, 0x26, 0x45, 0xbb, 0xe4, 0x09, 0x4c, 0x9f, 0x6c, 0xc2, 0xb3,
-  0x0e, 0xad, 0x00, 0xc0, 0x4b, 0x8e, 0x67, 0xcb, 0x04, 0x25, 0x5c, 0xd2,
-  0xab, 0x01, 0x4b, 0xcf, 0x99, 0x35, 0xc0, 0x11, 0x5e, 0x5e, 0xb3, 0x9b,
-  0x71, 0x94, 0x84, 0xbc, 0x1f, 0x04, 0x88, 0x27, 0x52, 0xe7, 0x51, 0x4d,
-  0x1c, 0xb1, 0x15, 0x85, 0xad, 0x41, 0xc3, 0x64, 0xbc, 0x0b, 0x18, 0xb2,
-  0x42, 0xb3, 0xe1, 0x95, 0xce, 0x40, 0x7d, 0x80, 0x58, 0xc1, 0x69, 0x3a,
-  0x37, 0x9a, 0x5c, 0x65, 0x28, 0xe2, 0x31, 0x9b, 0x1a, 0xae, 0xa1, 0x9d,
-  0x87, 0xeb, 0xcb, 0x30, 0x5c, 0xd6, 0xf0, 0x98, 0x4b, 0x13, 0xa9, 0x60,
-  0x3b, 0x45, 0xe8, 0x61, 0x5d, 0xe3, 0xb7, 0xcf, 0x4d, 0x87, 0x43, 0x6c,
-  0x0e, 0x91, 0x00, 0x87, 0x03, 0x3a, 0x12, 0xe2, 0x02, 0x22, 0x9a, 0x12,
-  0x5f, 0x98, 0x0c, 0xc7, 0xdc, 0x50, 0x84, 0x9b, 0xa4, 0xc0, 0x63, 0x93,
-  0xf6, 0x7b, 0xf8, 0x6f, 0xf5, 0x41, 0xa2, 0xcc, 0xa7, 0x65, 0x04, 0xce,
-  0x44, 0xa6, 0x7f, 0xa8, 0x10, 0xc8, 0x79, 0x72, 0x68, 0x96, 0x98, 0x3b,
-  0xfb, 0x2c, 0x41, 0x1f, 0xb3, 0xe8, 0xe5, 0xba, 0x34, 0xcb, 0xce, 0x61,
-  0x39, 0xca, 0x37, 0xa7, 0xdf, 0xfc, 0xdc, 0xc2, 0x96, 0x61, 0x2b, 0xf8,
-  0xe6, 0xac, 0x18, 0x53, 0xca, 0xee, 0xc8, 0x2a, 0xcf, 0xdc, 0x51, 0x88,
-  0x61, 0xbb, 0x8a, 0xed, 0x29, 0x36, 0x05, 0x18, 0x98, 0x4a, 0x6b, 0x37,
-  0x64, 0x53, 0xd5, 0x12, 0x87, 0x73, 0xf3, 0xdc, 0x39, 0xef, 0xde, 0x81,
-  0x03, 0xb6, 0x21, 0x2b, 0x56, 0x07, 0x91, 0x4c, 0xd7, 0xdd, 0x8b, 0x09,
-  0x75, 0xc4, 0x3a, 0xd6, 0x4e, 0xf7, 0x66, 0x80, 0xdd, 0xb8, 0x0a, 0xf6,
-  0x28, 0xe3, 0xcf, 0xdb, 0x8b, 0x01, 0x87, 0x80, 0xc7, 0x0e, 0x16, 0x86,
-  0x5d, 0x43, 0x75, 0x76, 0xa1, 0x3a, 0x35, 0x54, 0x77, 0x17, 0xaa, 0x0b,
-  0xd4, 0x29, 0xc5, 0x2b, 0xa1, 0xee, 0xe7, 0xa5, 0x9b, 0x96, 0x4a, 0x26,
-  0xe7, 0xf3, 0x64, 0xe9, 0x9c, 0x8e, 0xd2, 0xeb, 0xd5, 0xca, 0x36, 0x2d,
-  0x95, 0x6b, 0x2a, 0x94, 0x76, 0x07, 0xb2, 0x42, 0x69, 0xfb, 0x11, 0xf6,
-  0xee, 0x40, 0xd7, 0x05, 0x5d, 0xcf, 0xc4, 0x9f, 0x75, 0x23, 0x5d, 0x16,
-  0x80, 0xec, 0x4f, 0xd5, 0xf3, 0x14, 0xf1, 0xb7, 0x9b, 0x2a, 0x35, 0x63,
-  0x11, 0x10, 0xe5, 0xcd, 0x6a, 0xf5, 0x01, 0x7d, 0x6f, 0x06, 0x65, 0xdd,
-  0xb5, 0xe8, 0x7d, 0xb3, 0xd0, 0x89, 0x75, 0xd5, 0x04, 0xcc, 0xf1, 0xed,
-  0x32, 0x7a, 0x13, 0xb6, 0x44, 0x76, 0xcb, 0xc8, 0x56, 0x1d, 0xd7, 0xca,
-  0x50, 0xbd, 0x0a, 0xaa, 0x61, 0xd7, 0x28, 0x73, 0x68, 0x96, 0xc1, 0xaf,
-  0x66, 0x68, 0xc4, 0x17, 0xe8, 0x57, 0xba, 0x95, 0xa1, 0xb3, 0xee, 0xbe,
-  0x4c, 0x3d, 0x8f, 0x6d, 0xec, 0x1c, 0x5d, 0xaa, 0x25, 0x8f, 0x49, 0xea,
-  0xf8, 0xb6, 0x24, 0x6f, 0x97, 0xd0, 0x1b, 0xb1, 0x25, 0xb2, 0x53, 0x46,
-  0xee, 0x34, 0x60, 0xcb, 0x2a, 0x4a, 0x32, 0xd5, 0xd4, 0xb5, 0x40, 0x13,
-  0x87, 0x59, 0x8f, 0x40, 0xf7, 0x62, 0x62, 0x8e, 0x43, 0x44, 0x72, 0xba,
-  0x28, 0xac, 0x84, 0x18, 0x5d, 0x46, 0x35, 0x9f, 0xd8, 0xaf, 0x53, 0xfb,
-  0x90, 0x16, 0xd1, 0x1b, 0xb0, 0x19, 0x2a, 0x43, 0x59, 0x84, 0x70, 0xd1,
-  0x8b, 0xd2, 0xd2, 0x90, 0x67, 0x22, 0xd4, 0xdc, 0xa0, 0x67, 0x4c, 0x46,
-  0x98, 0x10, 0xaf, 0x4e, 0xfe, 0xe7, 0x09, 0x82, 0xd7, 0xf9, 0x1c, 0xc6,
-  0xcc, 0x8d, 0x9c, 0x9e, 0x8b, 0x66, 0x2e, 0x6d, 0xdb, 0x54, 0xf0, 0x2f,
-  0xb3, 0x6a, 0x89, 0x2a, 0xed, 0x9a, 0x9e, 0x79, 0x3b, 0xc4, 0xae, 0xdb,
-  0xdb, 0xa8, 0xa1, 0x81, 0xf8, 0x9e, 0xd2, 0xb5, 0xf6, 0x23, 0xd8, 0xbb,
-  0x9d, 0xa0, 0xd5, 0x51, 0xd0, 0x47, 0x38, 0xbd, 0x3d, 0x08, 0xa2, 0xc7,
-  0xd5, 0xbd, 0xdb, 0x29, 0x3a, 0xae, 0x62, 0xf5, 0xe0, 0xd5, 0xdc, 0x5b,
-  0x49, 0x62, 0x20, 0xba, 0x0f, 0x41, 0x1b, 0xd2, 0xf9, 0x5d, 0xfc, 0x7f,
-  0x2b, 0xc1, 0xab, 0x70, 0x3e, 0xc7, 0x20, 0xd7, 0xdd, 0x83, 0x26, 0xf9,
-  0x30, 0x13, 0x9d, 0xe3, 0xed, 0x9a, 0xe4, 0x44, 0xf7, 0x13, 0xd4, 0x65,
-  0x5d, 0xe1, 0xed, 0x82, 0x56, 0x7b, 0x93, 0x0c, 0x28, 0xfb, 0x92, 0x0c,
-  0xc3, 0x37, 0xf3, 0x89, 0x74, 0xc3, 0x47, 0x6e, 0x18, 0x23, 0x1f, 0x92,
-  0x71, 0xf7, 0x99, 0x5e, 0x17, 0x20, 0x2b, 0xf1, 0xf2, 0x7c, 0x9f, 0x25,
-  0x69, 0x55, 0x57, 0xab, 0x15, 0xbb, 0x56, 0xad, 0xb2, 0x64, 0x2a, 0xa0,
-  0x58, 0x3d, 0x99, 0xb3, 0x35, 0xd3, 0xf7, 0xe1, 0xa0, 0x40, 0x19, 0x3b,
-  0x38, 0xa8, 0xf9, 0x66, 0x9b, 0x14, 0xfa, 0xa3, 0xcd, 0x79, 0x34, 0x42,
-  0x18, 0xf6, 0x11, 0x0b, 0x9c, 0x6d, 0xc3, 0xc5, 0xa0, 0xd3, 0xc0, 0x9b,
-  0x31, 0x6a, 0x31, 0xcb, 0x78, 0x23, 0xd6, 0x62, 0x0d, 0xcb, 0x4b, 0xb7,
-  0x06, 0x9b, 0x1f, 0xff, 0x26, 0x1f, 0x63, 0x8a, 0xf9, 0xf2, 0x2c, 0xac,
-  0xcb, 0xb5, 0x25, 0x00, 0xea, 0xa0, 0x36, 0x2a, 0xcd, 0x49, 0x90, 0xb7,
-  0xa4, 0xf1, 0x01, 0xc5, 0xfa, 0xb7, 0x92, 0x61, 0xae, 0x15, 0xa8, 0x79,
-  0x6e, 0x38, 0xac, 0xbd, 0x33, 0x03, 0xb7, 0x94, 0x77, 0xa6, 0xbb, 0xb7,
-  0xe6, 0x29, 0xb8, 0x99, 0x3c, 0xdf, 0xe5, 0x1e, 0xf9, 0x58, 0x48, 0x58,
-  0xce, 0x56, 0x8c, 0x4b, 0x6f, 0xcd, 0xdf, 0x14, 0xb7, 0xe6, 0x94, 0x78,
-  0xe2, 0xbe, 0x34, 0x84, 0x28, 0xb5, 0xfc, 0xdc, 0xa7, 0x60, 0xc0, 0x75,
-  0x2b, 0xa1, 0xbd, 0x43, 0x3b, 0xb3, 0x87, 0x16, 0xe8, 0xe0, 0xaf, 0x77,
-  0x53, 0x68, 0x97, 0xcb, 0xc1, 0x03, 0x8b, 0x3d, 0xac, 0xe7, 0x7b, 0x0d,
-  0x3c, 0x04, 0xf3, 0x82, 0x6d, 0x07, 0x7b, 0x54, 0x48, 0x53, 0xbb, 0x44,
-  0xbe, 0x1f, 0xa4, 0x55, 0x09, 0xa6, 0x14, 0xc0, 0x1f, 0xe2, 0xdf, 0xd9,
-  0x8e, 0xcd, 0x37, 0x83, 0x9d, 0xd2, 0x62, 0x64, 0x1e, 0x5f, 0x10, 0xa5,
-  0x4a, 0xb4, 0xdb, 0x35, 0xfb, 0x2c, 0x61, 0x47, 0xcc, 0xdb, 0xcd, 0xf3,
-  0xc9, 0x18, 0x55, 0xe4, 0xd8, 0x3f, 0xf6, 0xdb, 0x27, 0x52, 0x65, 0xcb,
-  0xdd, 0x99, 0x74, 0x3c, 0xc8, 0xf6, 0xc0, 0x89, 0x81, 0xf7, 0x1e, 0x48,
-  0xc8, 0xe9, 0xd6, 0x1b, 0x8c, 0x4d, 0x32, 0xe3, 0x4b, 0xd3, 0x7c, 0x68,
-  0x2d, 0x38, 0x09, 0x10, 0x39, 0x05, 0x85, 0xed, 0x81, 0x52, 0x0a, 0xeb,
-  0xf5, 0x95, 0xb5, 0x6c, 0x42, 0xca, 0x69, 0xb1, 0x09, 0x5b, 0x57, 0x50,
-  0xd9, 0x35, 0xcb, 0x2b, 0x65, 0x92, 0x73, 0xce, 0xaa, 0x62, 0xd2, 0xbf,
-  0x3c, 0xa9, 0x3e, 0xf9, 0xac, 0x36, 0xa6, 0xf1, 0x62, 0x17, 0x66, 0x94,
-  0xf7, 0x61, 0x82, 0xe9, 0xd1, 0x51, 0xdb, 0x45, 0xd9, 0x8e, 0x6e, 0xe2,
-  0x57, 0x61, 0x98, 0x71, 0x2a, 0xec, 0x34, 0x68, 0xca, 0x2c, 0xd2, 0x54,
-  0xad, 0x94, 0x58, 0x83, 0x0a, 0x80, 0x26, 0xe7, 0xa7, 0xd5, 0x92, 0x12,
-  0x1b, 0xeb, 0x9e, 0x25, 0xc8, 0x9a, 0xdf, 0x63, 0xb2, 0xbd, 0x2c, 0x44,
-  0xbd, 0xee, 0x01, 0xce, 0x0c, 0xfa, 0x33, 0x58, 0x15, 0x4c, 0xfa, 0x4e,
-  0xbc, 0x9c, 0xcf, 0xe1, 0x25, 0x5d, 0xe8, 0x4d, 0xbc, 0x56, 0x21, 0xfc,
-  0xbf, 0x38, 0x3d, 0xe8, 0xef, 0xec, 0x49, 0x17, 0x4f, 0xdf, 0xf4, 0x7f,
-  0xa0, 0x61, 0xeb, 0xcd, 0x2c, 0x79, 0x3c, 0x79, 0x27, 0x9e, 0xb6, 0xad,
-  0xe0, 0xcd, 0x36, 0xa5, 0xe3, 0x7e, 0x1e, 0xcf, 0xcc, 0x8d, 0xcb, 0x65,
-  0xb5, 0xfd, 0x7a, 0xd6, 0xfa, 0x62, 0x1c, 0xdb, 0x1d, 0x20, 0x87, 0x05,
-  0x79, 0x5a, 0x9b, 0x32, 0x57, 0xd1, 0x55, 0xad, 0x01, 0x0a, 0x61, 0x15,
-  0x31, 0xd5, 0x98, 0xa7, 0xf2, 0x67, 0x24, 0xd0, 0x92, 0x1d, 0x07, 0xcb,
-  0xf5, 0x3c, 0x01, 0xfe, 0x53, 0x19, 0xce, 0xe8, 0xb0, 0x55, 0x8d, 0x3f,
-  0x8a, 0x04, 0xb9, 0xc4, 0x97, 0xa5, 0xfc, 0xa9, 0x9a, 0xb2, 0xaf, 0xa2,
-  0xb8, 0x63, 0xbc, 0x53, 0x87, 0x7b, 0xbb, 0x0f, 0xae, 0x77, 0xb8, 0xf5,
-  0x9c, 0xb9, 0x80, 0xbc, 0x31, 0x08, 0xf1, 0x1a, 0xbc, 0xf2, 0x67, 0xf8,
-  0xe3, 0x1a, 0xd9, 0x92, 0x83, 0xfe, 0xd1, 0x35, 0xdf, 0xd5, 0x35, 0xd7,
-  0xf4, 0x59, 0xf5, 0xd5, 0xe4, 0xd4, 0xee, 0xe0, 0xce, 0x70, 0x20, 0x01,
-  0x1b, 0x3d, 0xe2, 0xe4, 0x83, 0x5b, 0xdd, 0x59, 0x33, 0x5b, 0xe1, 0x59,
-  0xee, 0xca, 0x17, 0x43, 0x37, 0x1a, 0x67, 0x5a, 0x1d, 0xfb, 0x06, 0xbe,
-  0xfd, 0x28, 0x6d, 0x1b, 0x74, 0x08, 0x9a, 0xc2, 0x7e, 0xbf, 0xe9, 0x17,
-  0x26, 0x4e, 0x6d, 0x7a, 0xf7, 0xd7, 0xff, 0xe6, 0x4c, 0xdd, 0x3b, 0x1e,
-  0x71, 0x7c, 0x05, 0x6e, 0xd4, 0xe9, 0xd6, 0x1b, 0xc2, 0x9e, 0x2c, 0x9d,
-  0xc0, 0x39, 0x77, 0x46, 0x77, 0x61, 0xe9, 0x75, 0x15, 0xf4, 0x83, 0xbe,
-  0xf9, 0xd9, 0x2c, 0x43, 0x37, 0xf4, 0xc3, 0xf3, 0xbb, 0xb0, 0xb4, 0xed,
-  0x2e, 0x34, 0x6b, 0xde, 0x3a, 0x7d, 0x5b, 0xe7, 0x2a, 0x07, 0x1d, 0xd4,
-  0x4d, 0xec, 0xcf, 0xb1, 0x83, 0x09, 0x12, 0x0f, 0xdd, 0xd3, 0x67, 0xb1,
-  0x93, 0xb3, 0xc7, 0xea, 0xce, 0xe9, 0xe3, 0x7a, 0xde, 0x69, 0x69, 0x76,
-  0x5e, 0xdd, 0xbf, 0x4b, 0x6b, 0x9a, 0x9e, 0xbf, 0xd9, 0xe2, 0xa6, 0x05,
-  0x6b, 0xbb, 0x0b, 0xab, 0xcc, 0xda, 0xee, 0xc4, 0x2a, 0x9b, 0x96, 0xda,
-  0x9f, 0x4d, 0x36, 0x41, 0x75, 0x27, 0x36, 0x05, 0xaf, 0xad, 0x5e, 0xdf,
-  0xb4, 0x27, 0xb6, 0x9e, 0x9b, 0x4d, 0x63, 0xc8, 0x85, 0x0b, 0xd2, 0xc8,
-  0xad, 0x33, 0x5e, 0xd9, 0x82, 0xc5, 0x0d, 0x33, 0x54, 0x3b, 0x18, 0xc9,
-  0x26, 0xb0, 0x07, 0xa3, 0x82, 0xe5, 0xdf, 0x99, 0x11, 0xeb, 0x75, 0x6f,
-  0xe7, 0x90, 0xf7, 0xa6, 0x77, 0xe7, 0x20, 0x27, 0x98, 0x1a, 0xd9, 0x18,
-  0x7e, 0x2d, 0x5f, 0xbe, 0xbb, 0x33, 0x6f, 0x96, 0xf4, 0x4e, 0x59, 0x7d,
-  0xeb, 0x28, 0x23, 0x57, 0x04, 0xec, 0xa8, 0x07, 0xcf, 0x67, 0xf1, 0x9c,
-  0xd5, 0xc9, 0x84, 0xaf, 0xe6, 0x93, 0x65, 0xd8, 0x5b, 0x96, 0x7f, 0xb5,
-  0x18, 0x99, 0x16, 0x71, 0xd8, 0x8b, 0x9c, 0xa7, 0xb3, 0xea, 0x78, 0x37,
-  0x0f, 0xaf, 0x77, 0xb9, 0x9a, 0xee, 0x6e, 0x42, 0xd3, 0x52, 0x0f, 0xc0,
-  0xc1, 0x77, 0x68, 0xa5, 0xa2, 0x1f, 0xd8, 0xbf, 0x95, 0xde, 0x34, 0x02,
-  0xdf, 0xdf, 0x35, 0xef, 0x39, 0x04, 0xaf, 0x71, 0x97, 0xdd, 0x7b, 0xb9,
-  0xdc, 0x82, 0xff, 0x1d, 0x3a, 0xfa, 0xac, 0xe4, 0x77, 0xe9, 0xe5, 0x9b,
-  0xc6, 0x9f, 0x9f, 0xc1, 0x79, 0x9f, 0x01, 0xa8, 0xe4, 0x5d, 0x8c, 0x71,
-  0x84, 0x1c, 0xcd, 0x01, 0x56, 0xd7, 0x34, 0xef, 0x22, 0x06, 0x44, 0xf0,
-  0x5d, 0xb2, 0xf6, 0xef, 0x4d, 0x0a, 0x16, 0x6f, 0xdd, 0x55, 0x0c, 0x1a,
-  0xcc, 0x99, 0x96, 0xe2, 0xdd, 0x14, 0x6e, 0xf1, 0xb7, 0xd8, 0xf8, 0x7b,
-  0x6b, 0x74, 0xbf, 0xcf, 0x41, 0xdd, 0x38, 0x9a, 0x7d, 0x41, 0x67, 0x19,
-  0x28, 0xd7, 0xca, 0x6b, 0x9c, 0x87, 0xf6, 0x1e, 0xaf, 0x80, 0x6f, 0x15,
-  0xda, 0x79, 0xa8, 0xb4, 0xb2, 0x93, 0xf2, 0x46, 0x63, 0x9c, 0x73, 0xf8,
-  0xfe, 0x0a, 0x6c, 0xde, 0x1b, 0x38, 0x48, 0xfc, 0xf8, 0x57, 0x31, 0x47,
-  0x3c, 0xc6, 0x5c, 0x78, 0xd8, 0x1a, 0x10, 0x0d, 0xf1, 0x4a, 0x5d, 0x46,
-  0x61, 0x98, 0xd1, 0x1a, 0xc8, 0xd7, 0xea, 0x1a, 0x24, 0x22, 0x0f, 0x7a,
-  0xfc, 0x5d, 0x70, 0x11, 0x70, 0x68, 0x55, 0x34, 0x4e, 0xb4, 0xfe, 0x56,
-  0xe1, 0xe1, 0x97, 0xaf, 0x5f, 0x3e, 0xe6, 0x03, 0xa9, 0x17, 0xec, 0xdd,
-  0xe8, 0x43, 0x7e, 0xa4, 0xb9, 0x86, 0x97, 0x33, 0xf1, 0xae, 0xab, 0xca,
-  0xde, 0xe6, 0xcb, 0x26, 0x09, 0x59, 0x4a, 0x5b, 0x55, 0xae, 0x21, 0xa6,
-  0x78, 0x8f, 0xbe, 0x75, 0x8c, 0xd7, 0x18, 0xf9, 0x89, 0xe8, 0xd8, 0x87,
-  0x12, 0xb7, 0xd4, 0x9f, 0x50, 0xda, 0xf1, 0x31, 0x4f, 0xcd, 0x8b, 0xbd,
-  0x8e, 0xcf, 0xa3, 0x20, 0xc5, 0x36, 0xfa, 0x14, 0xef, 0x3d, 0x46, 0xeb,
-  0xd9, 0xe6, 0xdc, 0x88, 0xe2, 0xe3, 0x35, 0x5e, 0x64, 0x67, 0x3f, 0xc6,
-  0x77, 0x38, 0xdc, 0x80, 0xe7, 0x65, 0xff, 0xd1, 0xc1, 0xbe, 0xcb, 0x76,
-  0xf6, 0xfa, 0xad, 0x32, 0x7c, 0xa0, 0x64, 0xf7, 0x0c, 0x13, 0x67, 0xc9,
-  0x95, 0x31, 0xc7, 0x78, 0x55, 0x1e, 0x58, 0x4c, 0x30, 0xf1, 0x9f, 0xd4,
-  0xe3, 0x1f, 0x5e, 0x3d, 0x79, 0x03, 0x2d, 0x12, 0x8e, 0x11, 0x5f, 0xa2,
-  0xd0, 0x83, 0x06, 0xac, 0x37, 0x4f, 0xf0, 0x22, 0xfd, 0xf3, 0x77, 0xaf,
-  0xdf, 0xfc, 0x29, 0x43, 0x4d, 0x42, 0xb6, 0x0c, 0x10, 0x27, 0x57, 0x4d,
-  0xf8, 0x38, 0x34, 0x7c, 0xf5, 0x94, 0xbd, 0x51, 0x24, 0xf0, 0x19, 0x64,
-  0x42, 0x90, 0x46, 0xfc, 0xa7, 0x7f, 0xf8, 0x3d, 0x0e, 0xac, 0x86, 0x0e,
-  0x05, 0xba, 0x04, 0x0c, 0x94, 0x66, 0x74, 0x7a, 0xf9, 0x68, 0xb9, 0x16,
-  0xe8, 0x12, 0xd0, 0x44, 0xfc, 0xd9, 0xe5, 0xf3, 0xb1, 0x40, 0x64, 0xf7,
-  0x03, 0x24, 0x81, 0x6a, 0x01, 0x53, 0xbc, 0xff, 0x9b, 0x9d, 0x10, 0x61,
-  0xd0, 0x91, 0x7e, 0xa7, 0x3c, 0x5d, 0xfe, 0x77, 0x7c, 0xac, 0xcc, 0x61,
-  0x02, 0x0a, 0xb6, 0xbd, 0x2a, 0xd2, 0x92, 0xd2, 0x0a, 0x5a, 0x76, 0x80,
-  0x42, 0x56, 0xb5, 0xbf, 0xb8, 0x66, 0x1a, 0xde, 0xca, 0x7a, 0x05, 0x48,
-  0xaa, 0x73, 0x2b, 0x8d, 0x92, 0xaa, 0xf9, 0xaf, 0x6a, 0x91, 0xdc, 0xad,
-  0xb5, 0xcd, 0xcf, 0x4f, 0xd8, 0x99, 0x87, 0x93, 0x15, 0xf6, 0x9b, 0x19,
-  0x40, 0xed, 0x3f, 0x7e, 0xb0, 0x02, 0xc3, 0xe5, 0x6f, 0xdc, 0x32, 0xb5,
-  0xee, 0x38, 0x41, 0xff, 0x90, 0xe3, 0x1d, 0xaa, 0x83, 0x06, 0x52, 0x65,
-  0x22, 0x24, 0x9d, 0x64, 0xae, 0x94, 0x84, 0x69, 0xca, 0x2d, 0x59, 0xd2,
-  0x07, 0x09, 0xc4, 0xeb, 0xd6, 0x8f, 0xe9, 0xf4, 0xf9, 0x76, 0x89, 0x2e,
-  0xb1, 0x96, 0xd9, 0x6b, 0xb5, 0xfd, 0x6b, 0x6a, 0xb8, 0x90, 0x98, 0x9d,
-  0xc4, 0x4f, 0x2d, 0x99, 0x98, 0xd7, 0x81, 0x83, 0x1b, 0x48, 0xa0, 0xcd,
-  0x3e, 0xbc, 0xc0, 0xcb, 0xd7, 0xf4, 0x9a, 0x8b, 0xb0, 0xab, 0x14, 0x44,
-  0x9a, 0xc0, 0x0d, 0x64, 0xb6, 0x4d, 0xf5, 0xc1, 0xdf, 0x01, 0x67, 0x6f,
-  0x7a, 0x53, 0x45, 0x64, 0x27, 0x5e, 0x30, 0x40, 0xfb, 0xf0, 0x09, 0x83,
-  0x67, 0x6f, 0x8e, 0x43, 0x6d, 0x61, 0x82, 0xfd, 0xd3, 0xca, 0x77, 0x69,
-  0x1f, 0xfe, 0x86, 0xe1, 0xe0, 0xd4, 0xe1, 0x9f, 0xfd, 0xf4, 0x26, 0x8b,
-  0xbc, 0xe0, 0xcd, 0x25, 0x55, 0x10, 0x4d, 0x28, 0x09, 0x8a, 0x89, 0xb5,
-  0xf0, 0x7f, 0xda, 0x36, 0x27, 0x51, 0xb2, 0xb8, 0x44, 0x74, 0x7f, 0x9c,
-  0x51, 0x67, 0xfe, 0xe5, 0x8e, 0x46, 0xca, 0x5d, 0xd2, 0x3f, 0xab, 0x14,
-  0x21, 0x41, 0x49, 0x23, 0xdf, 0x5b, 0xf1, 0x84, 0xbe, 0xee, 0x52, 0xbc,
-  0xc6, 0xa6, 0xa4, 0xd0, 0x91, 0xb1, 0x39, 0x9a, 0x21, 0x0e, 0x13, 0xc0,
-  0xa1, 0xa3, 0x0a, 0x4e, 0x48, 0xe4, 0x1d, 0xc3, 0x8e, 0xff, 0x8a, 0x47,
-  0xa0, 0x1c, 0xbe, 0x8a, 0xf3, 0x1a, 0x54, 0x26, 0x14, 0x1e, 0x1a, 0x0d,
-  0xed, 0xad, 0xe6, 0xbc, 0x4e, 0xcf, 0x76, 0xe0, 0xa0, 0xb3, 0xde, 0x9d,
-  0xad, 0x52, 0x4f, 0x9c, 0xcf, 0x1d, 0x4c, 0xba, 0xad, 0x42, 0x1b, 0xe0,
-  0x5d, 0xc2, 0x38, 0x93, 0x64, 0xb6, 0x95, 0xbe, 0xa8, 0x7d, 0xfa, 0x5d,
-  0xaa, 0xe5, 0xb5, 0xa9, 0xe5, 0x05, 0x3d, 0x53, 0x77, 0xf5, 0x50, 0xb9,
-  0x65, 0x0f, 0xf3, 0x6c, 0x4d, 0x5e, 0x3e, 0xd7, 0xd8, 0x30, 0xa3, 0x59,
-  0x46, 0xab, 0xbb, 0x80, 0x76, 0x5d, 0x0a, 0xd1, 0xaf, 0xe7, 0xdd, 0x3b,
-  0x9a, 0xd8, 0xbe, 0x19, 0xb1, 0x07, 0xf4, 0x4d, 0xfe, 0xf0, 0x55, 0x22,
-  0xd0, 0x9f, 0x61, 0xc9, 0x19, 0x3d, 0xf8, 0xa3, 0x0d, 0xdc, 0x58, 0x49,
-  0x45, 0xec, 0x6d, 0xd4, 0xcc, 0x8b, 0x48, 0xb5, 0xcb, 0xb4, 0xd7, 0xfc,
-  0x54, 0x9f, 0x4a, 0x1a, 0x1d, 0x1c, 0x22, 0x3b, 0x57, 0xfa, 0x46, 0x8c,
-  0x7c, 0x12, 0x27, 0x42, 0xe0, 0x93, 0x32, 0x26, 0x6c, 0x6d, 0xe7, 0x39,
-  0x1c, 0x87, 0x32, 0x07, 0x3b, 0x81, 0xe5, 0x50, 0xad, 0x78, 0x6a, 0x99,
-  0x3e, 0x40, 0x80, 0x46, 0x67, 0x7a, 0xec, 0x47, 0xed, 0x30, 0x3b, 0xd4,
-  0x43, 0xec, 0x40, 0x06, 0xa9, 0x43, 0x9a, 0x0b, 0x3e, 0x04, 0x99, 0x4a,
-  0x11, 0xf2, 0xee, 0x9d, 0x4a, 0x90, 0x3f, 0xec, 0x5b, 0x80, 0x3c, 0x43,
-  0xb3, 0xfc, 0x79, 0xf2, 0x3e, 0xe2, 0xe7, 0xc8, 0x77, 0x90, 0x9e, 0x82,
-  0x08, 0x12, 0x9c, 0xae, 0xfb, 0xca, 0x4c, 0xb8, 0xcd, 0xe2, 0x52, 0xca,
-  0x3e, 0x92, 0x12, 0xde, 0x1d, 0x84, 0xcc, 0x43, 0x22, 0x92, 0x34, 0x7f,
-  0xd8, 0x57, 0xdc, 0x3c, 0x43, 0xb3, 0xcc, 0x79, 0xf2, 0x3e, 0x82, 0xe7,
-  0xc8, 0xfb, 0x48, 0x4f, 0xfe, 0xe2, 0xfb, 0xe9, 0x1e, 0xd0, 0x6c, 0xb6,
-  0x4a, 0x29, 0x3e, 0x2f, 0xb6, 0x2a, 0x7a, 0x87, 0x97, 0x79, 0xe4, 0x2c,
-  0x00, 0xc2, 0x2c, 0x16, 0x2b, 0xdb, 0xee, 0x72, 0xc4, 0x3c, 0x2f, 0xf7,
-  0xc5, 0x02, 0x5f, 0x1e, 0x46, 0x43, 0x85, 0x39, 0x64, 0x0e, 0xe3, 0x31,
-  0xbc, 0x40, 0x82, 0x5e, 0x1c, 0x1c, 0x48, 0x34, 0xe2, 0xf4, 0xb3, 0x9f,
-  0x4a, 0x46, 0x78, 0x5f, 0xf6, 0x86, 0xf8, 0x2a, 0x5e, 0x91, 0xa8, 0x9c,
-  0x07, 0xa1, 0xf2, 0x33, 0xbd, 0x18, 0xf1, 0x0c, 0xc4, 0xea, 0x82, 0x20,
-  0xcc, 0xc5, 0xf0, 0xb3, 0xb2, 0x48, 0x30, 0x89, 0x90, 0xbd, 0xa2, 0x0b,
-  0x24, 0x9c, 0x3d, 0x1d, 0x66, 0x70, 0xb1, 0xc5, 0x5d, 0xc2, 0x65, 0x39,
-  0x4a, 0xe1, 0x16, 0x50, 0x79, 0x90, 0xc5, 0xfb, 0x33, 0x2a, 0x00, 0x7d,
-  0x03, 0xa4, 0x7d, 0x48, 0x2f, 0x70, 0xf3, 0xe3, 0x39, 0x0e, 0x55, 0xa1,
-  0xbc, 0xac, 0x54, 0xf1, 0xbe, 0x65, 0x52, 0x94, 0x58, 0x96, 0x69, 0x92,
-  0x1e, 0x66, 0xc0, 0xbc, 0x54, 0x4f, 0x73, 0x26, 0x3c, 0xad, 0x51, 0xc4,
-  0x98, 0x13, 0xdb, 0x36, 0x49, 0x99, 0x75, 0xeb, 0xdf, 0x97, 0x8c, 0x49,
-  0x83, 0x8c, 0x82, 0xc5, 0x5e, 0x12, 0x6e, 0x8b, 0x46, 0x58, 0x71, 0xee,
-  0xc2, 0x6e, 0xf9, 0x37, 0x44, 0xa8, 0x45, 0x4a, 0x3b, 0x21, 0x65, 0xbf,
-  0xbb, 0x5a, 0x51, 0x8f, 0xc6, 0x8e, 0x57, 0x7b, 0x1b, 0xae, 0xdb, 0xa2,
-  0x5a, 0xc8, 0xca, 0xd8, 0x9a, 0xa0, 0x12, 0x10, 0x5e, 0x02, 0x6c, 0x74,
-  0xae, 0x32, 0x68, 0xc0, 0x14, 0xe5, 0x68, 0x46, 0x76, 0xa1, 0x33, 0x2e,
-  0x0a, 0xa4, 0x53, 0x82, 0x2c, 0x74, 0x45, 0x48, 0x91, 0x30, 0xf4, 0xdc,
-  0x1a, 0x84, 0x10, 0x0a, 0x3e, 0x08, 0x52, 0x70, 0xfe, 0xe0, 0xc3, 0x50,
-  0xf9, 0xf7, 0xa5, 0x32, 0xe2, 0xf8, 0xca, 0x54, 0xce, 0x47, 0xa8, 0x97,
-  0xeb, 0x5f, 0x00, 0x8d, 0x73, 0xea, 0xea, 0x14, 0x84, 0x3c, 0xd5, 0xa2,
-  0x65, 0xed, 0xba, 0x84, 0x98, 0x1a, 0x60, 0xf1, 0x24, 0x40, 0x3b, 0x67,
-  0x8f, 0x85, 0x18, 0x40, 0xd0, 0xe5, 0xf0, 0xd2, 0x80, 0xb2, 0xd8, 0x43,
-  0x55, 0x82, 0x2a, 0x8e, 0x8c, 0xda, 0x58, 0x4b, 0xc2, 0xf4, 0x54, 0x8f,
-  0xd8, 0xa4, 0x7a, 0x69, 0xd4, 0xcf, 0x90, 0x0c, 0x02, 0xd1, 0x74, 0x41,
-  0xb9, 0xc7, 0xdd, 0xca, 0x47, 0x56, 0x9d, 0x05, 0xa8, 0x80, 0xb0, 0x9f,
-  0xb2, 0xba, 0xb2, 0xd2, 0x43, 0x5d, 0xd9, 0x6d, 0x59, 0x5d, 0x02, 0x78,
-  0xbb, 0xba, 0x04, 0xfc, 0x7f, 0x51, 0x5d, 0x24, 0xef, 0xbd, 0x52, 0xb9,
-  0x95, 0x4f, 0x9f, 0x0a, 0x9c, 0x68, 0xa3, 0x30, 0xc9, 0x6f, 0x32, 0xb1,
-  0x6b, 0x52, 0x14, 0x5b, 0xfa, 0xa0, 0x31, 0x5d, 0xfa, 0x2b, 0x86, 0x21,
-  0xb8, 0x73, 0xd6, 0xe5, 0xa6, 0x87, 0x4e, 0xb2, 0xca, 0xf8, 0x81, 0x62,
-  0xa9, 0xbb, 0x3b, 0x83, 0x19, 0xde, 0x1a, 0x7a, 0x29, 0x8e, 0xdd, 0x62,
-  0x8d, 0xac, 0xa9, 0x73, 0xa3, 0x37, 0x72, 0x98, 0x8b, 0x60, 0x7d, 0xe4,
-  0x3f, 0x49, 0x8c, 0xf5, 0x94, 0xa2, 0x9c, 0xf8, 0x2d, 0xf5, 0x66, 0xb9,
-  0xe8, 0x54, 0x4c, 0x56, 0x48, 0xe9, 0x71, 0x2a, 0xa1, 0x66, 0x93, 0x9d,
-  0x09, 0x93, 0xbd, 0x79, 0xa8, 0xdb, 0x18, 0xf5, 0x96, 0xa8, 0x69, 0x45,
-  0x4b, 0x63, 0x5d, 0x61, 0xf6, 0x25, 0x38, 0x72, 0x5e, 0x68, 0x0a, 0xd2,
-  0x09, 0xe5, 0xcc, 0x7e, 0xf6, 0xd3, 0xbb, 0x74, 0xc1, 0x59, 0xae, 0xcf,
-  0xef, 0x83, 0x91, 0xf6, 0x70, 0x3c, 0x86, 0x44, 0xe2, 0xd8, 0x0a, 0x85,
-  0x3b, 0x7e, 0xb2, 0xc5, 0x65, 0x9c, 0x49, 0x55, 0xf1, 0x98, 0x99, 0xad,
-  0x66, 0xa9, 0x75, 0xc3, 0xcc, 0x32, 0x0a, 0xbb, 0x13, 0xb4, 0x33, 0xa3,
-  0x63, 0xd5, 0x55, 0x21, 0x22, 0x8d, 0x4c, 0xd0, 0xf8, 0x8c, 0xf0, 0xa0,
-  0x31, 0x40, 0x68, 0x0c, 0x11, 0x44, 0x1d, 0x72, 0x8c, 0xdd, 0x31, 0xc2,
-  0xee, 0x28, 0xe1, 0x86, 0x38, 0x41, 0xb6, 0x67, 0x51, 0x34, 0xe9, 0x4b,
-  0x38, 0x80, 0xdc, 0xc9, 0xf7, 0xd0, 0x11, 0x0b, 0x62, 0xd5, 0xbe, 0x58,
-  0x82, 0x29, 0x81, 0x57, 0x30, 0x93, 0x91, 0x77, 0x89, 0x08, 0x0f, 0x63,
-  0x85, 0x8e, 0x32, 0x11, 0xfd, 0x1b, 0x2a, 0x34, 0x9c, 0x2b, 0xeb, 0x98,
-  0xa5, 0xd2, 0x1e, 0x99, 0x20, 0x82, 0xf1, 0xdc, 0xda, 0x8b, 0xd3, 0x85,
-  0x95, 0xf2, 0xf8, 0x3e, 0xff, 0xf4, 0x8b, 0x9c, 0xf4, 0x4d, 0x69, 0x07,
-  0x08, 0x29, 0xf2, 0x12, 0xe3, 0x5b, 0x71, 0x1a, 0x5e, 0xc6, 0xf1, 0x32,
-  0x48, 0x95, 0x15, 0x1d, 0xea, 0x83, 0x64, 0xf0, 0x14, 0x89, 0x41, 0xad,
-  0xeb, 0xc5, 0xd1, 0x6f, 0xc7, 0x85, 0x16, 0x8b, 0x91, 0x0d, 0x87, 0xb3,
-  0xea, 0xcb, 0xe6, 0x94, 0xf9, 0x97, 0x68, 0x6e, 0x6e, 0x1f, 0x3c, 0x1b,
-  0xb5, 0x8f, 0xbc, 0x42, 0xf6, 0x6d, 0x51, 0x5c, 0xd1, 0xe4, 0x81, 0x69,
-  0x6f, 0xf3, 0x04, 0x6a, 0x19, 0x33, 0xa6, 0xeb, 0x80, 0x4e, 0x80, 0xdd,
-  0x2b, 0x30, 0x6e, 0x20, 0x21, 0xea, 0xa5, 0x74, 0xc4, 0x6b, 0x16, 0xb0,
-  0x62, 0xe3, 0xab, 0x72, 0x94, 0x31, 0x50, 0x07, 0x35, 0x3c, 0x61, 0xb5,
-  0x0c, 0x2d, 0x2b, 0x8b, 0x0c, 0x4c, 0xdb, 0x5c, 0x1d, 0x99, 0x7d, 0x0c,
-  0xb1, 0x8b, 0x56, 0x04, 0x50, 0xf8, 0x8f, 0x1f, 0x54, 0x78, 0xf8, 0x15,
-  0xf3, 0x53, 0x42, 0xdd, 0x4a, 0x90, 0x77, 0xa6, 0x99, 0x79, 0x09, 0x07,
-  0x55, 0x8d, 0x25, 0xf9, 0xe7, 0x6a, 0x64, 0xd1, 0x41, 0xfc, 0x30, 0x2f,
-  0xd1, 0x21, 0xb8, 0xdc, 0xc4, 0x64, 0x99, 0x07, 0xe4, 0x7b, 0xb2, 0x11,
-  0x25, 0xbb, 0x23, 0x9b, 0x2c, 0x5b, 0x33, 0x13, 0xfa, 0xa9, 0xea, 0xf3,
-  0xaf, 0x55, 0xab, 0xeb, 0x2b, 0xbf, 0xb8, 0x2e, 0x2a, 0x71, 0xab, 0x68,
-  0x19, 0x55, 0x4a, 0x12, 0xb7, 0x5b, 0x2d, 0x2f, 0x10, 0x41, 0x85, 0x52,
-  0xe8, 0x0c, 0xe0, 0xbc, 0xd5, 0x53, 0xcb, 0x61, 0xfd, 0xc6, 0xe9, 0x99,
-  0x0c, 0x50, 0xe7, 0xf8, 0x2c, 0x2e, 0x7c, 0xef, 0xee, 0x70, 0x33, 0x5a,
-  0x96, 0xa2, 0xd6, 0x7f, 0x36, 0xde, 0x2c, 0x96, 0x84, 0xba, 0xf3, 0x0c,
-  0x41, 0xaa, 0x37, 0x2b, 0xdc, 0xbf, 0x28, 0x18, 0x15, 0x4a, 0x29, 0x46,
-  0x59, 0x7b, 0x87, 0x46, 0xc7, 0xc7, 0xbc, 0x47, 0x5a, 0xf3, 0x09, 0x40,
-  0xe8, 0x4a, 0x76, 0xba, 0x4c, 0xb3, 0x99, 0xf6, 0xb2, 0x16, 0x9f, 0xd9,
-  0x14, 0x63, 0x23, 0x46, 0xf9, 0xc5, 0x2e, 0x6a, 0xef, 0xe0, 0xb4, 0x14,
-  0x9e, 0xee, 0xd4, 0x6e, 0x96, 0x6f, 0xb7, 0x76, 0xef, 0x1c, 0xbd, 0x7e,
-  0x86, 0x86, 0x6f, 0xd6, 0xb1, 0xd4, 0xb2, 0xd4, 0xb3, 0xb8, 0xdd, 0xa1,
-  0x70, 0xae, 0x6c, 0x52, 0x70, 0xc0, 0xbb, 0x0f, 0xfe, 0xad, 0x28, 0x16,
-  0x19, 0x36, 0x2a, 0xf8, 0x81, 0xd4, 0x2f, 0xcb, 0xf4, 0x88, 0xe1, 0xd3,
-  0x08, 0x96, 0xe3, 0x31, 0x96, 0x62, 0x8a, 0x44, 0xe0, 0x55, 0xe7, 0x31,
-  0x5e, 0xc5, 0xac, 0x79, 0x21, 0x4f, 0x36, 0xdb, 0x4b, 0x35, 0xd5, 0x38,
-  0x38, 0x2b, 0x36, 0xf9, 0x5c, 0xf4, 0xad, 0xd2, 0xd4, 0x2d, 0x95, 0xfa,
-  0xa4, 0x40, 0xc1, 0x8a, 0x30, 0x5e, 0xfc, 0x2b, 0x16, 0x07, 0xfd, 0x56,
-  0xce, 0x03, 0x39, 0x2b, 0xdd, 0x0f, 0x49, 0x23, 0xfb, 0x9e, 0xcf, 0xeb,
-  0x06, 0x98, 0x88, 0xf9, 0xa9, 0xad, 0x37, 0x65, 0xcc, 0x91, 0x44, 0xb9,
-  0x0a, 0x67, 0xa8, 0xb6, 0xf3, 0x34, 0x83, 0x05, 0xf3, 0xd5, 0x7e, 0x58,
-  0x56, 0x15, 0x7b, 0x7f, 0x51, 0x94, 0x90, 0x15, 0x90, 0x25, 0xff, 0x0a,
-  0xd5, 0x10, 0x2c, 0x94, 0x6b, 0x76, 0x32, 0xfb, 0x56, 0x22, 0x0a, 0xc3,
-  0x49, 0x43, 0x51, 0xe2, 0x49, 0xa6, 0x8c, 0x5c, 0xc9, 0x95, 0xd1, 0xb0,
-  0x22, 0x94, 0xc4, 0xce, 0x73, 0xcf, 0xd5, 0x5c, 0xad, 0x74, 0x2e, 0xa3,
-  0x72, 0x5d, 0x1b, 0xc5, 0xdf, 0x45, 0x71, 0x30, 0x79, 0x3e, 0xed, 0xa0,
-  0x7c, 0xa1, 0xc8, 0x21, 0x8e, 0xd2, 0xa7, 0x07, 0x39, 0x35, 0x52, 0x0a,
-  0x9b, 0x49, 0xbd, 0x2c, 0x11, 0x5a, 0x5a, 0x8e, 0xf3, 0x31, 0x5c, 0x71,
-  0x98, 0xc6, 0xc8, 0xe6, 0xe2, 0x14, 0x9c, 0x37, 0x83, 0x0d, 0x64, 0x1b,
-  0x48, 0xf8, 0x11, 0xea, 0xe1, 0x38, 0xb7, 0x93, 0x00, 0x26, 0x94, 0x62,
-  0x0c, 0xc1, 0x17, 0xeb, 0x03, 0xe1, 0x89, 0x4a, 0x2d, 0xc2, 0x60, 0x08,
-  0xdf, 0x06, 0xab, 0xe8, 0xeb, 0x64, 0x5e, 0x1c, 0xae, 0x81, 0x2d, 0x5f,
-  0xde, 0xc7, 0x82, 0xcc, 0xe5, 0xe5, 0x25, 0xc2, 0x4e, 0xc4, 0xc6, 0xe1,
-  0x06, 0xf4, 0x0d, 0xf4, 0x27, 0x0e, 0x7d, 0x05, 0xeb, 0x98, 0xba, 0xf7,
-  0x1a, 0x11, 0x26, 0x51, 0xa5, 0x03, 0x23, 0x7a, 0xd2, 0x21, 0xf2, 0x65,
-  0x1d, 0x21, 0x0d, 0xeb, 0x9b, 0x18, 0x91, 0x15, 0x4e, 0x34, 0x67, 0xbd,
-  0x53, 0x3d, 0x3f, 0xe6, 0xe8, 0x79, 0x49, 0x44, 0xd1, 0xa0, 0x3d, 0x2c,
-  0x35, 0x52, 0xce, 0x1a, 0x7b, 0x4e, 0x41, 0xb6, 0xdd, 0x7d, 0xa5, 0xc1,
-  0x0b, 0x45, 0x2c, 0x48, 0x9b, 0xb0, 0xfd, 0x49, 0x35, 0xa1, 0x4a, 0x7a,
-  0xc9, 0x53, 0x64, 0x6b, 0xce, 0x16, 0xb1, 0x08, 0x43, 0xcb, 0xb8, 0x2e,
-  0x42, 0x7c, 0x65, 0x10, 0x62, 0x1e, 0xfe, 0xfa, 0xc9, 0xbb, 0x43, 0xb1,
-  0xea, 0x35, 0x63, 0x5f, 0x2a, 0x48, 0xfb, 0xd2, 0x21, 0x1e, 0x3e, 0xc4,
-  0x39, 0xe3, 0x58, 0x9a, 0x05, 0x1e, 0x1d, 0xa4, 0x1b, 0xf1, 0x03, 0x8a,
-  0x8f, 0x63, 0x18, 0x35, 0x9d, 0x56, 0x88, 0x28, 0x7b, 0x71, 0x58, 0xf4,
-  0x7b, 0x2a, 0x7e, 0x6f, 0x5a, 0xb7, 0x0b, 0x0a, 0x1f, 0x33, 0x50, 0x0b,
-  0xc8, 0xe7, 0x0c, 0x54, 0x70, 0xde, 0x99, 0x1d, 0xe2, 0x44, 0x93, 0x73,
-  0x31, 0x57, 0xf5, 0x08, 0xb7, 0xed, 0x53, 0x8e, 0x79, 0x86, 0x72, 0xb0,
-  0x5d, 0x18, 0x37, 0x09, 0x26, 0xbd, 0x73, 0xb1, 0xe1, 0x08, 0x6a, 0xac,
-  0x69, 0x9d, 0x12, 0x79, 0xd0, 0xca, 0x95, 0x26, 0x4e, 0xa9, 0x3e, 0x3c,
-  0x3e, 0x14, 0xa7, 0x54, 0xdf, 0x95, 0x4f, 0xd1, 0xcd, 0x9c, 0x12, 0x3b,
-  0x2c, 0x5b, 0x65, 0x9a, 0xb9, 0xe3, 0xf4, 0x33, 0xb3, 0xc1, 0xcc, 0xb8,
-  0x8a, 0x73, 0xd0, 0x3c, 0x0e, 0xdb, 0x96, 0x0e, 0x7d, 0xe6, 0x0f, 0xf9,
-  0x57, 0xf7, 0x4f, 0xe8, 0x60, 0x60, 0x85, 0x7d, 0x73, 0x83, 0x7f, 0xf9,
-  0x99, 0x76, 0x90, 0x9d, 0x8a, 0x1d, 0xab, 0x67, 0x4a, 0xf6, 0x62, 0x9d,
-  0x42, 0x49, 0x7c, 0x7f, 0xe0, 0xa9, 0xd8, 0xe8, 0x78, 0xa6, 0xd0, 0xbb,
-  0xea, 0x2d, 0x71, 0x8a, 0x34, 0xff, 0x3d, 0x19, 0x47, 0x17, 0x19, 0x31,
-  0x9a, 0x7e, 0x50, 0xb2, 0xe3, 0x41, 0x94, 0xe2, 0x39, 0x20, 0x0a, 0x3b,
-  0x00, 0x47, 0xa1, 0xd3, 0x79, 0x44, 0x7e, 0x96, 0xf7, 0x9e, 0xae, 0x2b,
-  0x2f, 0xe2, 0x69, 0xac, 0xe8, 0xba, 0x04, 0xa6, 0x17, 0xf9, 0xf4, 0xfa,
-  0xb0, 0x85, 0x37, 0xba, 0x5b, 0xca, 0x87, 0xc5, 0x7c, 0x09, 0xf2, 0x85,
-  0x56, 0x7d, 0xe9, 0xd0, 0xd7, 0x2d, 0x8f, 0xe9, 0xab, 0x76, 0xc7, 0xc0,
-  0x6f, 0x29, 0x17, 0x38, 0xec, 0xfa, 0x51, 0xfc, 0x61, 0xd8, 0xa2, 0x1d,
-  0xe9, 0x5d, 0xd7, 0xa4, 0x9d, 0xe3, 0x2d, 0x45, 0x9c, 0xf6, 0x6e, 0xdb,
-  0x66, 0x4b, 0xe1, 0x6f, 0x63, 0x0e, 0x5b, 0x3e, 0xee, 0xb3, 0xc2, 0xd7,
-  0x4b, 0xc8, 0x85, 0x13, 0x92, 0x50, 0xad, 0x93, 0x5d, 0xcc, 0xf5, 0x64,
-  0x33, 0xc7, 0xa6, 0x1e, 0x3a, 0xdb, 0x3b, 0x1e, 0x8f, 0x5b, 0x0c, 0x36,
-  0x6c, 0xe1, 0x40, 0x17, 0x1a, 0xbf, 0xb1, 0x03, 0x9b, 0x5b, 0xf4, 0x65,
-  0x8f, 0x85, 0x65, 0x1a, 0x8e, 0xe2, 0x59, 0x46, 0x6f, 0xae, 0xd3, 0xad,
-  0xee, 0x19, 0xbd, 0x8b, 0x8e, 0x3f, 0x82, 0x34, 0x46, 0x47, 0x31, 0x8d,
-  0x9e, 0xe2, 0x18, 0xd8, 0xe5, 0x8b, 0x3f, 0xd7, 0xb0, 0xe7, 0x1d, 0xa3,
-  0x87, 0xab, 0xff, 0x71, 0x61, 0xf5, 0x0c, 0x4f, 0xb1, 0x2c, 0xe4, 0xc1,
-  0xa9, 0x37, 0xba, 0x4f, 0x79, 0x7a, 0x73, 0xba, 0x57, 0x3a, 0x79, 0xa2,
-  0x51, 0x4e, 0xc6, 0x23, 0x47, 0x30, 0xac, 0x3a, 0x4a, 0x87, 0x10, 0xdc,
-  0x9c, 0x82, 0x6f, 0x58, 0x7a, 0xd7, 0x35, 0xdc, 0x91, 0x8e, 0x23, 0x04,
-  0x74, 0x48, 0xa1, 0x3b, 0x86, 0xc3, 0xae, 0xae, 0xd1, 0x55, 0xcc, 0xb9,
-  0xee, 0xd3, 0x5e, 0x60, 0x08, 0xc8, 0x32, 0x80, 0xbe, 0xe2, 0xf7, 0x08,
-  0xa9, 0x67, 0x20, 0xb3, 0xee, 0x11, 0xd0, 0x05, 0x60, 0x6e, 0x99, 0x94,
-  0x84, 0x27, 0x24, 0x77, 0x29, 0xd9, 0xd7, 0x09, 0x04, 0x89, 0x1c, 0xc8,
-  0xd0, 0x45, 0xa9, 0xf0, 0xe8, 0x96, 0xd0, 0x7c, 0x42, 0xf3, 0x08, 0xad,
-  0x5b, 0x46, 0xf3, 0xe6, 0x96, 0x03, 0xe1, 0x5d, 0x42, 0xf2, 0x08, 0xc9,
-  0xd5, 0x2d, 0x47, 0xef, 0x18, 0x1e, 0x50, 0x7c, 0x48, 0x65, 0x39, 0x46,
-  0x97, 0x97, 0xc2, 0xf7, 0x91, 0x06, 0xf1, 0x9c, 0x91, 0x90, 0x9e, 0xf4,
-  0xa7, 0xe3, 0xb4, 0x02, 0x76, 0x85, 0x1e, 0x2f, 0xf4, 0x8e, 0xff, 0xb1,
-  0x75, 0x5c, 0xad, 0xb7, 0x9d, 0x75, 0x64, 0x7b, 0x50, 0x1a, 0x6d, 0xbf,
-  0xbb, 0xd0, 0x2d, 0xdc, 0xcd, 0x74, 0x07, 0xea, 0xc0, 0xbd, 0x67, 0x78,
-  0x33, 0xc7, 0x34, 0x2c, 0x76, 0xdb, 0x03, 0x38, 0xbb, 0x77, 0x66, 0xc0,
-  0xb0, 0x09, 0x7b, 0x86, 0x0f, 0xc3, 0xe1, 0xae, 0x8b, 0xe2, 0x7c, 0x5c,
-  0x38, 0x16, 0xea, 0x1a, 0x44, 0xba, 0x36, 0x32, 0x22, 0x11, 0x44, 0x70,
-  0x8b, 0x02, 0xd8, 0x5d, 0x92, 0xd8, 0x33, 0xac, 0x11, 0x99, 0x80, 0x4b,
-  0xea, 0xd3, 0xa1, 0x0a, 0xaa, 0x21, 0x87, 0xdd, 0x74, 0x01, 0x32, 0x59,
-  0x85, 0x29, 0xa0, 0x4e, 0x37, 0xae, 0x02, 0x38, 0x72, 0x3a, 0x28, 0x9e,
-  0xe5, 0x1a, 0x1d, 0x54, 0x15, 0xf0, 0x5c, 0xd0, 0x01, 0x19, 0xd2, 0x93,
-  0x4e, 0x48, 0xec, 0xc6, 0x27, 0x4b, 0xa2, 0x7a, 0xf6, 0x40, 0xda, 0xa7,
-  0x9b, 0x1e, 0xab, 0x86, 0x19, 0x69, 0x1a, 0x1c, 0x2d, 0xdd, 0x04, 0x26,
-  0x71, 0x76, 0xd8, 0xaf, 0x87, 0x27, 0xe0, 0x83, 0x27, 0xaf, 0x06, 0xbb,
-  0x07, 0x14, 0x12, 0x91, 0xdf, 0x11, 0x37, 0xa4, 0xdb, 0x48, 0x27, 0x41,
-  0x3a, 0xfc, 0x0e, 0x49, 0x3d, 0x12, 0x91, 0xb6, 0x29, 0x92, 0xd5, 0x9a,
-  0x1c, 0xe6, 0xf1, 0x3b, 0xe4, 0x01, 0x6d, 0xec, 0x65, 0x06, 0x11, 0x86,
-  0xed, 0x13, 0xa1, 0x2e, 0xe4, 0xb7, 0x41, 0x0c, 0x60, 0x7f, 0x44, 0xe2,
-  0x83, 0x9d, 0x05, 0x9a, 0x54, 0x63, 0x2c, 0x3f, 0x50, 0xc5, 0x1d, 0xd3,
-  0x1c, 0xd1, 0x72, 0x89, 0xbf, 0xcd, 0xef, 0xf0, 0xe3, 0x5d, 0xe8, 0x2e,
-  0x14, 0x01, 0x6d, 0xfa, 0x86, 0x7f, 0x01, 0xaa, 0x4c, 0x0f, 0xba, 0xa3,
-  0xfb, 0x28, 0x2d, 0xea, 0x8a, 0x6a, 0xa3, 0x93, 0xdd, 0x78, 0x24, 0x36,
-  0x8c, 0x8a, 0xcc, 0xb6, 0xcb, 0xef, 0xec, 0x0e, 0x15, 0x46, 0x41, 0x62,
-  0x17, 0x8c, 0x19, 0x00, 0x72, 0x88, 0x24, 0xa9, 0x78, 0x07, 0x04, 0x1c,
-  0xca, 0xe8, 0xb1, 0xf6, 0xe4, 0x5e, 0xd8, 0x06, 0x6b, 0xa3, 0x42, 0x5d,
-  0x54, 0x3e, 0x8f, 0x04, 0xb3, 0xf8, 0x9d, 0xcf, 0x35, 0x68, 0xe9, 0x90,
-  0xd6, 0x46, 0x56, 0x58, 0x25, 0x8a, 0x4a, 0x76, 0x6b, 0x9b, 0x54, 0x55,
-  0xa2, 0x3e, 0x6c, 0x6a, 0x4e, 0xec, 0x06, 0x3f, 0x4c, 0xba, 0x0e, 0xc4,
-  0x80, 0xc0, 0xfc, 0x51, 0x26, 0xf8, 0x94, 0x88, 0x67, 0xd0, 0x87, 0xf2,
-  0xf9, 0x0d, 0xcf, 0xa1, 0x40, 0x7e, 0x56, 0xe3, 0xac, 0x7a, 0xf3, 0x04,
-  0xd8, 0x1a, 0xb3, 0x1f, 0xa3, 0x07, 0x29, 0x7b, 0x40, 0x42, 0x15, 0xb0,
-  0x1f, 0xb4, 0x50, 0x7e, 0xd7, 0xe1, 0x24, 0x51, 0xe7, 0x78, 0x20, 0xf3,
-  0xd5, 0xbb, 0xa4, 0x60, 0xaa, 0x44, 0xa4, 0x78, 0x74, 0x05, 0x01, 0x14,
-  0x64, 0x86, 0x44, 0x7f, 0xa4, 0x73, 0x33, 0xf1, 0xf1, 0xd7, 0x81, 0xd4,
-  0x2e, 0xbb, 0x76, 0xd1, 0xe2, 0x74, 0xd2, 0xe0, 0x88, 0x0a, 0x8b, 0x44,
-  0x9f, 0xac, 0xc1, 0x02, 0x2d, 0x1b, 0x22, 0xb1, 0x3b, 0x56, 0x2f, 0xa4,
-  0x76, 0xa6, 0x1b, 0x64, 0xc2, 0x1d, 0xa9, 0x1a, 0x59, 0xe7, 0x16, 0x8c,
-  0x83, 0x4c, 0x9e, 0x37, 0x4a, 0xdc, 0x13, 0x45, 0x47, 0xe9, 0x89, 0xab,
-  0xc7, 0x24, 0xa4, 0x3b, 0xd4, 0x16, 0xbb, 0xa2, 0x7a, 0x01, 0x81, 0x4e,
-  0x80, 0x4b, 0x79, 0x70, 0x65, 0x7e, 0xd3, 0x21, 0x1c, 0xaa, 0xfa, 0x1e,
-  0x6e, 0xa8, 0xc9, 0x30, 0x87, 0xd0, 0xe1, 0x17, 0x6a, 0xb1, 0xa2, 0x9d,
-  0xb8, 0x28, 0x08, 0xf7, 0x60, 0x4c, 0x52, 0x90, 0x65, 0x57, 0x8f, 0x41,
-  0xe0, 0x65, 0xd9, 0x7d, 0x47, 0xf1, 0x41, 0x01, 0x7f, 0x73, 0x26, 0x2e,
-  0x0c, 0xfc, 0x02, 0x0a, 0x1d, 0x91, 0x24, 0x5d, 0x24, 0xdb, 0xbc, 0x51,
-  0x52, 0xcd, 0xb3, 0xbb, 0x8f, 0x0b, 0xaf, 0xc7, 0xca, 0x4a, 0x38, 0x94,
-  0x9d, 0x95, 0x83, 0x1a, 0x03, 0x2a, 0x9d, 0x5d, 0x7d, 0x66, 0xba, 0x3d,
-  0x6a, 0xd4, 0xf8, 0xeb, 0xb1, 0xbf, 0xee, 0x85, 0x63, 0xc3, 0x6a, 0x21,
-  0x9b, 0x7b, 0xa1, 0x3b, 0xa4, 0x60, 0x32, 0x08, 0x6a, 0xab, 0xd4, 0xca,
-  0x90, 0xc4, 0x0c, 0x85, 0xdd, 0x09, 0xf1, 0xc8, 0x64, 0x99, 0x84, 0xcc,
-  0x54, 0xbb, 0x17, 0x64, 0xe0, 0x33, 0x56, 0xc2, 0x0b, 0x0f, 0x85, 0x00,
-  0x29, 0x92, 0xa5, 0x43, 0xb2, 0xb9, 0x26, 0x9e, 0x99, 0xbd, 0x5f, 0x00,
-  0x08, 0xc9, 0xc9, 0x68, 0x6d, 0x26, 0x91, 0x4d, 0x75, 0x46, 0xd7, 0x19,
-  0x95, 0xfe, 0x82, 0xcc, 0x79, 0x66, 0x99, 0x17, 0x36, 0x24, 0x03, 0x1e,
-  0x95, 0x87, 0xdb, 0x0a, 0xb4, 0x4d, 0x3f, 0x68, 0xcc, 0xa5, 0x9a, 0xd0,
-  0x09, 0xa1, 0x47, 0x2d, 0x0c, 0xbe, 0x8d, 0xf7, 0x0f, 0xcc, 0x63, 0x50,
-  0x23, 0x26, 0xe3, 0x80, 0xed, 0xb3, 0xab, 0xc3, 0x75, 0xcc, 0x33, 0xe0,
-  0xca, 0xbb, 0x35, 0x28, 0x89, 0xd8, 0x71, 0x17, 0x69, 0x43, 0x42, 0xd4,
-  0x0b, 0xde, 0x28, 0x71, 0x6c, 0x32, 0x20, 0x51, 0x59, 0x10, 0x94, 0x88,
-  0xd8, 0xa8, 0x52, 0x76, 0x07, 0x99, 0xa8, 0x05, 0x32, 0x00, 0xd9, 0x3a,
-  0xbf, 0x61, 0x29, 0x90, 0x17, 0x3d, 0x0f, 0xb7, 0x79, 0x9b, 0x4c, 0x52,
-  0x24, 0x31, 0xd7, 0x47, 0x3a, 0x27, 0x00, 0xeb, 0x21, 0x74, 0x41, 0x8e,
-  0x5a, 0x21, 0xbc, 0x0e, 0x13, 0xd6, 0x1a, 0xd1, 0x31, 0x44, 0xd4, 0x46,
-  0x58, 0xcd, 0xb0, 0xa6, 0x25, 0xae, 0x36, 0x2b, 0x0e, 0xee, 0x49, 0x26,
-  0x8f, 0xae, 0x04, 0x06, 0x3d, 0xc2, 0xd7, 0x81, 0xef, 0x30, 0x00, 0x7e,
-  0xf8, 0x15, 0xf8, 0x54, 0x5c, 0x64, 0x27, 0x7c, 0x9d, 0x91, 0x61, 0x9d,
-  0xac, 0xe7, 0x13, 0x5b, 0xd1, 0x13, 0x50, 0x89, 0xfd, 0x0e, 0xd4, 0xc0,
-  0x6e, 0x6d, 0x17, 0x77, 0xbe, 0x43, 0x36, 0x80, 0xba, 0xa4, 0x1b, 0x18,
-  0x12, 0x95, 0x8f, 0xc3, 0xd0, 0x78, 0xe7, 0xac, 0x3b, 0xd1, 0xa9, 0xe7,
-  0x98, 0x91, 0x35, 0xf4, 0x18, 0xc0, 0x55, 0x18, 0x80, 0xea, 0x66, 0xee,
-  0x91, 0xf3, 0xa0, 0x16, 0xea, 0x30, 0x3b, 0x64, 0xea, 0xd5, 0x7d, 0x24,
-  0xcf, 0x91, 0x1d, 0xee, 0x8b, 0xba, 0x24, 0xa2, 0x44, 0x49, 0x1d, 0x2a,
-  0xa9, 0x4d, 0xd6, 0x42, 0x6d, 0x8b, 0x0c, 0x87, 0x2a, 0xc4, 0x61, 0x96,
-  0x02, 0x85, 0x5c, 0x38, 0x3d, 0xc8, 0xeb, 0x90, 0x56, 0x59, 0x8b, 0x76,
-  0x00, 0x25, 0x2f, 0xd7, 0x61, 0x84, 0xc9, 0xc0, 0x1d, 0x8f, 0x6a, 0x49,
-  0x61, 0xee, 0x9a, 0x99, 0x72, 0x2f, 0xff, 0x13, 0xea, 0x42, 0x5d, 0x88,
-  0x14, 0x9d, 0xa0, 0x26, 0x59, 0x05, 0x41, 0xe8, 0x29, 0xff, 0x63, 0xb8,
-  0x2c, 0x5d, 0xa4, 0x10, 0x3e, 0x9a, 0x27, 0xf3, 0x98, 0x28, 0x0a, 0x55,
-  0xd7, 0x05, 0xe4, 0x60, 0xac, 0x3c, 0x66, 0x6f, 0xa8, 0x6b, 0xde, 0x25,
-  0x32, 0x83, 0x87, 0x54, 0x24, 0x1e, 0xa9, 0x8f, 0x3a, 0x1f, 0x66, 0xdd,
-  0x2e, 0x0b, 0x92, 0xb8, 0x65, 0x5b, 0xec, 0x8a, 0x76, 0x43, 0x22, 0x91,
-  0xc7, 0x42, 0x3e, 0xba, 0xb2, 0x16, 0xd3, 0x23, 0x3f, 0xe6, 0x51, 0xed,
-  0x13, 0x21, 0x61, 0xba, 0x36, 0xbb, 0x5a, 0x4c, 0x64, 0x87, 0x7b, 0x39,
-  0x76, 0xb5, 0xc1, 0x82, 0xda, 0xb9, 0x3d, 0xf3, 0xa8, 0x95, 0x32, 0xa5,
-  0xe0, 0x0e, 0x7a, 0xea, 0xb0, 0xd6, 0x41, 0x4d, 0x8b, 0x1a, 0x16, 0x79,
-  0x59, 0xea, 0x58, 0x49, 0x10, 0x76, 0x05, 0x61, 0x26, 0x94, 0xcd, 0x60,
-  0x9e, 0x88, 0xd8, 0xd0, 0x68, 0x28, 0xf6, 0x82, 0x04, 0x24, 0x1f, 0x65,
-  0xa4, 0xce, 0x91, 0xda, 0xb7, 0xb8, 0x3a, 0xcc, 0x66, 0xa9, 0x63, 0x64,
-  0x41, 0x1b, 0xfe, 0x28, 0x90, 0xb0, 0x7a, 0xa2, 0x87, 0xa6, 0x96, 0x66,
-  0x73, 0xb1, 0x29, 0x33, 0xf3, 0xaa, 0xcc, 0x25, 0x91, 0xf0, 0x2e, 0x39,
-  0xc1, 0x0e, 0x5d, 0x3b, 0x84, 0xc8, 0x9e, 0xc0, 0xdb, 0xe7, 0x37, 0xd4,
-  0x54, 0x85, 0x0b, 0xf2, 0xf9, 0xa3, 0xcf, 0x7a, 0x64, 0x7e, 0xe7, 0xf3,
-  0x8e, 0x9b, 0x79, 0x0e, 0xea, 0x3c, 0x7c, 0x32, 0x88, 0x62, 0x78, 0x74,
-  0x42, 0xf1, 0x72, 0x39, 0x02, 0x17, 0x9f, 0xff, 0xe1, 0x5f, 0x04, 0xca,
-  0x42, 0xf1, 0x3c, 0xb6, 0x8f, 0xc6, 0xc3, 0xf2, 0x77, 0xe4, 0x9a, 0xa3,
-  0x7d, 0x71, 0x3a, 0x5f, 0x2d, 0xde, 0x77, 0x45, 0x44, 0x2d, 0xd9, 0x3d,
-  0x66, 0xeb, 0x2f, 0x4a, 0xc0, 0xd7, 0x2c, 0x38, 0x43, 0x89, 0xc1, 0x3e,
-  0x42, 0x51, 0x02, 0x24, 0x0f, 0x4e, 0xd6, 0x7c, 0xe4, 0x22, 0xa5, 0xaa,
-  0x45, 0xf0, 0x62, 0xcc, 0x52, 0x3a, 0x40, 0x49, 0xa1, 0xe3, 0xa9, 0x14,
-  0x3a, 0xac, 0x53, 0x29, 0xcb, 0xca, 0xce, 0x01, 0xac, 0x48, 0xdc, 0x7a,
-  0x20, 0xe6, 0xac, 0xb2, 0x09, 0x10, 0x62, 0x98, 0xb3, 0xa4, 0x97, 0xbb,
-  0xb9, 0x08, 0x12, 0xc6, 0xc5, 0xcf, 0xf4, 0x23, 0xbf, 0x2a, 0xb4, 0x4b,
-  0x36, 0x79, 0xc4, 0x9a, 0xc2, 0xdf, 0x72, 0x11, 0x17, 0xfd, 0x54, 0xbc,
-  0xb0, 0x76, 0xa6, 0xd4, 0x0e, 0x98, 0x53, 0xd8, 0xcb, 0x3c, 0xc5, 0x23,
-  0x35, 0x2a, 0x45, 0x64, 0x2f, 0x5f, 0x94, 0xde, 0x84, 0xe6, 0x20, 0xf1,
-  0x16, 0xb3, 0x7c, 0x28, 0x50, 0x28, 0x1e, 0x26, 0x43, 0x23, 0x3a, 0xaf,
-  0xaa, 0xa8, 0xec, 0xf8, 0x47, 0xae, 0xa8, 0xf2, 0x40, 0x2e, 0x1f, 0x30,
-  0x8a, 0xf7, 0x0e, 0xcf, 0x38, 0x24, 0x97, 0xf3, 0x54, 0xbc, 0x90, 0x23,
-  0xe0, 0x39, 0xff, 0x5a, 0x0a, 0x2f, 0xab, 0x84, 0xb6, 0x4a, 0xfa, 0x95,
-  0x63, 0xc1, 0x7d, 0x46, 0x7f, 0x62, 0x9c, 0x27, 0x87, 0x79, 0x74, 0x5f,
-  0x19, 0x14, 0xda, 0x2e, 0xfe, 0xcf, 0x86, 0x6e, 0xa4, 0xa8, 0x96, 0xc2,
-  0x0f, 0x37, 0x2a, 0x0f, 0x12, 0x32, 0xa8, 0x2e, 0x68, 0x22, 0x14, 0xc8,
-  0x41, 0xa4, 0xe3, 0x51, 0xb0, 0x1a, 0xb6, 0x98, 0x06, 0x4b, 0xe0, 0xef,
-  0x70, 0xaa, 0xa7, 0x80, 0xe7, 0x06, 0x30, 0xdf, 0x8c, 0x22, 0xcc, 0x60,
-  0xf2, 0x4b, 0xf6, 0x31, 0x8a, 0xd6, 0x03, 0x3e, 0x3c, 0x81, 0xd5, 0xbc,
-  0xb4, 0x58, 0xef, 0xf8, 0xcc, 0x0f, 0x10, 0x13, 0xf3, 0x97, 0xbb, 0x75,
-  0xdc, 0x5d, 0x58, 0x05, 0x00, 0xae, 0xe8, 0x65, 0xed, 0x22, 0x40, 0xb7,
-  0x7f, 0x0f, 0xbf, 0xfa, 0x82, 0x67, 0x46, 0xd3, 0x06, 0xc1, 0x78, 0x7e,
-  0xc5, 0x3e, 0xa5, 0xc3, 0xce, 0x16, 0x05, 0x67, 0xcb, 0x05, 0x3a, 0x7e,
-  0xe0, 0x9b, 0xd0, 0xd5, 0x13, 0x8a, 0xe4, 0x89, 0x04, 0xfb, 0xc2, 0x2f,
-  0xc2, 0x16, 0x16, 0x7a, 0x66, 0x8c, 0xc2, 0xe8, 0x9f, 0xe2, 0x50, 0x0a,
-  0x69, 0xb5, 0xb1, 0x3a, 0x70, 0x0c, 0x78, 0x03, 0x9c, 0xcf, 0xdc, 0xb2,
-  0x69, 0x93, 0x86, 0x4c, 0xc7, 0x22, 0x57, 0x19, 0xc8, 0x5a, 0x4f, 0x0d,
-  0x4c, 0x5f, 0x94, 0x10, 0xaf, 0xd0, 0xf0, 0xef, 0x9e, 0xb1, 0xe6, 0x95,
-  0xcf, 0xc9, 0x66, 0xaa, 0xcd, 0x3e, 0x11, 0xaa, 0x04, 0x6c, 0x0a, 0x6a,
-  0xd8, 0xa2, 0x6f, 0x81, 0x69, 0xf4, 0x63, 0x4c, 0x3f, 0xb6, 0x30, 0xd1,
-  0x22, 0x3e, 0xe1, 0xd7, 0x2a, 0xcf, 0x2c, 0x73, 0x13, 0x93, 0x32, 0x88,
-  0x56, 0x2d, 0x01, 0xf0, 0x2c, 0x0f, 0x14, 0xa5, 0x08, 0x59, 0x8f, 0x73,
-  0xef, 0xf3, 0x43, 0xfb, 0x1f, 0xac, 0xdb, 0x8e, 0xf0, 0xb9, 0x44, 0xfa,
-  0x06, 0x5b, 0xc5, 0x09, 0x55, 0x9c, 0xa3, 0x74, 0x89, 0xe5, 0xca, 0x61,
-  0xa5, 0x64, 0x0a, 0xcb, 0x16, 0x59, 0x5a, 0x4a, 0xad, 0x3e, 0x7e, 0xf4,
-  0x4e, 0x9f, 0xe7, 0x9d, 0xea, 0x9a, 0x2c, 0x98, 0x59, 0x79, 0xc7, 0xcb,
-  0x7a, 0x16, 0xa5, 0x7c, 0x66, 0x5d, 0x1d, 0x14, 0x77, 0xdf, 0x95, 0x52,
-  0x5a, 0xb5, 0x16, 0xc1, 0xeb, 0x4f, 0x80, 0xab, 0x16, 0xb8, 0x77, 0xe7,
-  0x13, 0x2f, 0xd9, 0x07, 0xe7, 0x86, 0xad, 0xda, 0x9a, 0xfe, 0x8f, 0x1d,
-  0xd3, 0x67, 0x56, 0x3d, 0x74, 0xff, 0x3f, 0xde, 0x2d, 0x8d, 0xf1, 0x22,
-  0xde, 0x7f, 0x67, 0xc7, 0x54, 0xed, 0x48, 0x64, 0xa3, 0xc1, 0x4f, 0x82,
-  0x1f, 0x19, 0x4f, 0x96, 0xdc, 0x3c, 0x20, 0xfb, 0x60, 0x57, 0x42, 0x57,
-  0xda, 0x37, 0x47, 0x4b, 0x50, 0xd9, 0xf7, 0x2f, 0xe5, 0x96, 0x57, 0xbe,
-  0xf5, 0x2b, 0xcd, 0x82, 0xd9, 0x4a, 0xfc, 0x5c, 0xdb, 0x6f, 0x47, 0x95,
-  0x74, 0x45, 0x53, 0xca, 0xd9, 0xe1, 0xe9, 0x0a, 0x3b, 0x88, 0x7b, 0xaf,
-  0xd8, 0x3a, 0xb7, 0x47, 0xd9, 0x27, 0x67, 0xd9, 0x0a, 0x87, 0xa8, 0x2a,
-  0xe2, 0x08, 0x54, 0x39, 0x8d, 0x9f, 0x37, 0xe7, 0x9a, 0x45, 0x8b, 0x9d,
-  0x1e, 0x13, 0xfa, 0x6e, 0x46, 0xde, 0xf5, 0x28, 0x0f, 0x5f, 0x7d, 0xa9,
-  0xc8, 0x05, 0x40, 0x6c, 0x27, 0xc2, 0x32, 0x22, 0xbe, 0x8e, 0x75, 0x2f,
-  0xcf, 0x5b, 0xef, 0xdc, 0xa5, 0x72, 0x1b, 0xd5, 0x27, 0xc3, 0xe8, 0x9a,
-  0x86, 0xe8, 0xdb, 0x08, 0x1f, 0xa1, 0x82, 0x5c, 0x03, 0xec, 0x38, 0x5f,
-  0x6a, 0xff, 0x56, 0xee, 0x95, 0xe4, 0xc9, 0xda, 0x4a, 0xe9, 0xa8, 0x6c,
-  0x56, 0xc4, 0xfa, 0xa1, 0x1d, 0x4a, 0x1d, 0x22, 0x3d, 0x42, 0xfd, 0xf5,
-  0x7b, 0x65, 0x17, 0x5c, 0x1c, 0x3d, 0x5b, 0xe2, 0x22, 0x57, 0x44, 0x04,
-  0x40, 0xae, 0x9f, 0xd4, 0x8e, 0xe5, 0x54, 0xca, 0xe7, 0xc0, 0x2b, 0xc5,
-  0x4a, 0xba, 0xd4, 0xf9, 0x51, 0xf5, 0xb5, 0x2a, 0x39, 0x59, 0x3d, 0xf8,
-  0x32, 0x09, 0xa6, 0x6c, 0x51, 0x98, 0x74, 0xa3, 0xd0, 0x67, 0x17, 0xe1,
-  0xf6, 0x93, 0xe3, 0x07, 0xa5, 0x1a, 0x6f, 0xa8, 0x5d, 0x26, 0x68, 0xf5,
-  0x60, 0x07, 0x45, 0x9e, 0x52, 0xcb, 0x6f, 0xa5, 0x2b, 0x6f, 0x3d, 0x88,
-  0x13, 0x4e, 0x59, 0x61, 0x5d, 0x07, 0x6a, 0x5a, 0x2c, 0x4e, 0x17, 0xbf,
-  0xb1, 0x7a, 0x72, 0xbc, 0xfa, 0xd7, 0x04, 0x6b, 0x2c, 0xaf, 0x58, 0xd8,
-  0x6e, 0xdd, 0xd2, 0x70, 0x99, 0x3d, 0x65, 0x6d, 0xae, 0x8e, 0x52, 0x1a,
-  0xe5, 0x7e, 0x25, 0x3e, 0x77, 0x77, 0xd3, 0x38, 0x77, 0x25, 0x70, 0xee,
-  0x3a, 0xd2, 0x75, 0xd9, 0xca, 0x96, 0xa9, 0xf0, 0x92, 0x96, 0xd7, 0x90,
-  0x72, 0xc2, 0xf2, 0x4b, 0xf5, 0x4d, 0xcd, 0x95, 0x3e, 0x4f, 0x91, 0x99,
-  0x5a, 0x73, 0x9b, 0xcd, 0x6a, 0xa0, 0x1e, 0x85, 0x96, 0xfa, 0xc6, 0x72,
-  0xaf, 0xc8, 0x0e, 0xb8, 0x27, 0x33, 0xb3, 0xbb, 0xd2, 0xcc, 0x9a, 0x68,
-  0x5c, 0xf2, 0x5e, 0xf7, 0x7c, 0x57, 0x77, 0x3c, 0xa3, 0x29, 0x8e, 0x7a,
-  0x27, 0x2b, 0x09, 0xd6, 0x54, 0x29, 0x3f, 0xa1, 0x9c, 0xf1, 0x28, 0x9c,
-  0x2e, 0xc7, 0xe9, 0x95, 0x58, 0xe4, 0x3e, 0x31, 0xfb, 0x90, 0xce, 0x2f,
-  0xa9, 0xcc, 0xa0, 0x77, 0x93, 0x11, 0xd4, 0x55, 0xcc, 0x5e, 0x20, 0xca,
-  0x59, 0x0a, 0x8d, 0x56, 0xc4, 0x04, 0xed, 0x32, 0xcd, 0xd5, 0x2e, 0x17,
-  0x26, 0x9f, 0xa4, 0x25, 0xbd, 0xc5, 0x07, 0xb6, 0x6f, 0x36, 0xa4, 0xca,
-  0x37, 0xb8, 0xf7, 0x58, 0x1f, 0x65, 0xf5, 0x24, 0x66, 0x4d, 0xa4, 0x15,
-  0x7d, 0x66, 0xc0, 0xe1, 0xda, 0x59, 0xc0, 0x41, 0xf7, 0xdf, 0x4f, 0xc0,
-  0x61, 0x7f, 0x6e, 0xb8, 0x51, 0x3e, 0x31, 0xba, 0x18, 0x65, 0x60, 0x62,
-  0xd9, 0xc3, 0x04, 0x9f, 0x6f, 0x07, 0x2e, 0x4d, 0xb3, 0xe1, 0x1f, 0x5b,
-  0x11, 0xe9, 0xea, 0xf8, 0xe9, 0x28, 0x39, 0x8c, 0xa6, 0xb9, 0xe8, 0xb6,
-  0x8c, 0xc4, 0x7f, 0x24, 0xcc, 0x64, 0x68, 0x12, 0xc0, 0x88, 0x54, 0x90,
-  0x68, 0x81, 0xc0, 0x2b, 0x52, 0xd2, 0x1b, 0xd8, 0xf1, 0xf5, 0x04, 0xff,
-  0xcf, 0xa5, 0x40, 0xa4, 0xa7, 0xa0, 0x5e, 0xe8, 0x1f, 0x26, 0x05, 0x1b,
-  0xe2, 0x90, 0x93, 0xb2, 0x6f, 0xfc, 0x7a, 0x35, 0xc6, 0x0c, 0x57, 0x66,
-  0x27, 0xb0, 0x6d, 0x9e, 0x28, 0x4d, 0xad, 0x12, 0xc6, 0xcb, 0xa0, 0x1d,
-  0xc7, 0x0c, 0xcb, 0x4f, 0x3d, 0xcf, 0x92, 0x70, 0x32, 0xc4, 0x76, 0x83,
-  0x41, 0x4b, 0x38, 0xd9, 0xf3, 0x7f, 0xc3, 0x04, 0x93, 0x08, 0x23, 0xee,
-  0x1c, 0xcf, 0x3b, 0xc8, 0x5b, 0x38, 0x5a, 0xbd, 0x16, 0xdb, 0xbb, 0xd4,
-  0xb7, 0xdb, 0x3c, 0xb6, 0x5f, 0xac, 0x1b, 0x03, 0x7c, 0xfb, 0xdf, 0x12,
-  0xe0, 0xdf, 0xb1, 0xad, 0x59, 0x6e, 0xd6, 0xd6, 0xe8, 0xfe, 0xdf, 0xdc,
-  0xd6, 0xca, 0xa1, 0x7d, 0x90, 0x40, 0x93, 0xec, 0x8b, 0x02, 0xad, 0x62,
-  0x4c, 0x4d, 0x0b, 0x87, 0x7a, 0x07, 0xcb, 0x96, 0xf8, 0x2b, 0x47, 0xe0,
-  0x64, 0xe5, 0xcf, 0xbc, 0xc6, 0x38, 0xfb, 0xd7, 0xb1, 0xf2, 0x08, 0xb1,
-  0x43, 0x06, 0x92, 0x81, 0x77, 0xcd, 0x51, 0x96, 0x5c, 0x25, 0xdb, 0xb5,
-  0x72, 0x93, 0xa3, 0x64, 0xfb, 0x56, 0xee, 0xe6, 0x26, 0xed, 0xff, 0x5d,
-  0x37, 0x29, 0x4e, 0xc1, 0x2f, 0x56, 0x97, 0x8d, 0x75, 0x11, 0x5a, 0xa0,
-  0xd0, 0xbb, 0x08, 0x33, 0x0a, 0xe3, 0x31, 0x2c, 0x92, 0xb0, 0xcd, 0x1b,
-  0x5d, 0x0c, 0xa7, 0x1e, 0xca, 0x41, 0x18, 0x1d, 0x63, 0x3f, 0x2b, 0x8d,
-  0xd3, 0x28, 0xbf, 0xee, 0xfc, 0xb9, 0x3a, 0xd6, 0xea, 0x5d, 0xb8, 0x55,
-  0x10, 0x36, 0x38, 0x18, 0xa6, 0xd5, 0xe8, 0xde, 0x64, 0x5d, 0x95, 0x23,
-  0x18, 0x6a, 0xb9, 0xe5, 0xe6, 0xf3, 0xf5, 0x32, 0xfc, 0xb0, 0x62, 0x1b,
-  0x1b, 0x79, 0xe5, 0xd7, 0x5d, 0x5f, 0x9d, 0xe6, 0x1b, 0x0c, 0x3f, 0x0a,
-  0x7e, 0x6d, 0xef, 0x91, 0x8b, 0x18, 0xb7, 0xac, 0xb1, 0xc5, 0x34, 0x98,
-  0xe2, 0xbd, 0x8a, 0xbd, 0xdd, 0x6c, 0xfe, 0x7d, 0xfc, 0xb6, 0xfa, 0x7f,
-  0xe0, 0x5b, 0xdd, 0x1f, 0x7d, 0xeb, 0xf7, 0xd0, 0x40, 0xff, 0xe3, 0x7c,
-  0xeb, 0x5b, 0xfe, 0x15, 0xf4, 0x9b, 0xe3, 0x50, 0x8e, 0x73, 0xe7, 0x01,
-  0x8d, 0xd9, 0xda, 0x6b, 0xa8, 0x51, 0xce, 0x59, 0x77, 0xd5, 0x96, 0x92,
-  0x7f, 0x27, 0x25, 0x37, 0xf6, 0xc2, 0x67, 0xcf, 0x2a, 0xc6, 0xb1, 0xba,
-  0x61, 0x50, 0x5b, 0x1f, 0x56, 0x57, 0x42, 0xfa, 0x5c, 0x1d, 0xfb, 0x06,
-  0xf6, 0x0d, 0x5a, 0x12, 0xe7, 0x0d, 0x34, 0xab, 0x49, 0x86, 0xe8, 0x3e,
-  0x1b, 0xb6, 0x9b, 0x72, 0x3c, 0xb5, 0xbf, 0xa2, 0xc4, 0xd7, 0xca, 0x1a,
-  0x62, 0xff, 0xfa, 0x04, 0x40, 0x75, 0xda, 0x31, 0x7f, 0x2b, 0x46, 0xc0,
-  0x65, 0x19, 0x6f, 0x58, 0x09, 0x10, 0x5b, 0xbd, 0xf3, 0x22, 0xb1, 0xaf,
-  0x00, 0x2a, 0x95, 0xaf, 0xc5, 0xb1, 0x69, 0x16, 0x72, 0x1c, 0x72, 0x04,
-  0x5a, 0xfc, 0x70, 0x4c, 0xc5, 0xe5, 0xd5, 0x07, 0x88, 0xf3, 0x69, 0xc1,
-  0x3f, 0xe6, 0xde, 0x4a, 0x9e, 0x90, 0x27, 0x60, 0xd5, 0x13, 0x03, 0x77,
-  0x78, 0x1d, 0x81, 0x56, 0x81, 0x36, 0x9e, 0xf2, 0xa8, 0x54, 0xdc, 0x74,
-  0xd5, 0x3b, 0x55, 0x58, 0x35, 0x4a, 0xb1, 0xd7, 0x44, 0x7c, 0x66, 0x3a,
-  0xff, 0xc2, 0xda, 0x16, 0xcb, 0x09, 0x77, 0xa9, 0xec, 0xec, 0xdd, 0xba,
-  0x1f, 0x6b, 0xfb, 0xbf, 0xae, 0xb6, 0xbf, 0xa4, 0x13, 0x16, 0xbf, 0x7e,
-  0x7e, 0x6b, 0x6d, 0xb3, 0xd7, 0x49, 0x33, 0x39, 0xb2, 0x2f, 0xb1, 0x2a,
-  0x85, 0xcf, 0x72, 0x96, 0xd8, 0x57, 0xa6, 0x1e, 0xb9, 0x1c, 0x3b, 0xe7,
-  0xf0, 0xd8, 0x09, 0x0f, 0x38, 0x20, 0x9c, 0xcf, 0xe3, 0x91, 0x0e, 0xc9,
-  0x75, 0x3c, 0xce, 0xa1, 0xb4, 0x70, 0x05, 0xb4, 0xdc, 0xba, 0xc4, 0x17,
-  0x6c, 0x95, 0x55, 0x28, 0x49, 0xef, 0x9a, 0x5c, 0xea, 0x61, 0xc2, 0xc7,
-  0x2b, 0xce, 0x2e, 0xb1, 0x5c, 0x7a, 0x3d, 0xf2, 0xc9, 0xe1, 0x32, 0xfc,
-  0x91, 0x90, 0xe2, 0x59, 0xe2, 0x59, 0x35, 0x37, 0xa6, 0x76, 0x6b, 0xab,
-  0x49, 0xa1, 0x8c, 0x72, 0x64, 0x00, 0x56, 0x3c, 0xec, 0x9e, 0x9f, 0x6b,
-  0x5f, 0xfb, 0x26, 0x40, 0x03, 0x4e, 0xe9, 0x38, 0x7c, 0x85, 0x81, 0xf2,
-  0xcf, 0xae, 0x9c, 0x1e, 0x1e, 0x9e, 0x71, 0x50, 0xfe, 0xb5, 0x22, 0xfe,
-  0xc8, 0xbe, 0x36, 0x44, 0x1f, 0x1b, 0xca, 0x92, 0x29, 0x76, 0x28, 0x02,
-  0x20, 0x58, 0x91, 0x62, 0xf5, 0x43, 0x3b, 0x25, 0xa8, 0x78, 0x28, 0x96,
-  0x90, 0x83, 0xe8, 0xbb, 0x44, 0xe2, 0xee, 0x32, 0xbb, 0xab, 0x7c, 0xad,
-  0x86, 0x69, 0xa1, 0x7a, 0xa2, 0x76, 0xb9, 0x94, 0x85, 0x79, 0x3a, 0x31,
-  0x05, 0x57, 0x6b, 0x35, 0xcc, 0x0e, 0x6f, 0x9c, 0x98, 0x6b, 0x9c, 0xe6,
-  0x97, 0xef, 0x37, 0xb5, 0x7e, 0xc0, 0xc6, 0xf4, 0xe4, 0xed, 0x57, 0xca,
-  0xe3, 0x9c, 0xd3, 0xad, 0x6d, 0x2a, 0x03, 0x54, 0x16, 0x55, 0x2a, 0x02,
-  0xf3, 0x79, 0xc5, 0x07, 0x3b, 0xb6, 0x33, 0xac, 0x1a, 0x74, 0x01, 0x15,
-  0x34, 0x2a, 0x21, 0x3f, 0x02, 0xea, 0x87, 0xd4, 0x41, 0xce, 0xe4, 0x9f,
-  0x2a, 0x7e, 0x4e, 0xe5, 0xee, 0xa5, 0xdf, 0x59, 0x78, 0xd1, 0xb1, 0xfd,
-  0xc0, 0x85, 0xdf, 0xb3, 0xf7, 0xbc, 0xa9, 0xf0, 0x39, 0x95, 0xef, 0xad,
-  0xf0, 0x74, 0xa4, 0xd6, 0x0f, 0x59, 0xee, 0x67, 0x41, 0x32, 0x66, 0x6b,
-  0x77, 0xcf, 0xbf, 0xfc, 0xa7, 0x4a, 0x4e, 0x72, 0xde, 0xbd, 0xd0, 0xa5,
-  0x26, 0x2f, 0xef, 0x4f, 0x66, 0x49, 0x29, 0xb0, 0x97, 0xe7, 0x64, 0x2b,
-  0x72, 0x7d, 0xaa, 0x75, 0x5c, 0x22, 0xb8, 0xcf, 0x6c, 0x7c, 0x76, 0x4f,
-  0x77, 0xf4, 0x4a, 0xd3, 0x03, 0xf6, 0x96, 0xd3, 0x7a, 0x41, 0x6e, 0xe9,
-  0x1f, 0x37, 0x7c, 0x41, 0x4e, 0x16, 0xb6, 0x00, 0x00
-};
-unsigned int include_ElegantOTA_html_gz_len = 12693;
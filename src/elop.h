@@ -1,9 +0,0 @@
-#ifndef elop_h
-#define elop_h
-
-#include <Arduino.h>
-
-extern unsigned char include_ElegantOTA_html_gz[];
-extern unsigned int include_ElegantOTA_html_gz_len;
-
-#endif
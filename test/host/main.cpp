@@ -0,0 +1,27 @@
+// Runs the registered host tests, a name on the command line selects the tests containing it
+#include "test.h"
+#include <cstring>
+#include <string>
+
+int host_failures = 0;
+
+std::vector<HostTest>& hostTests() {
+  static std::vector<HostTest> tests;
+  return tests;
+}
+
+int main(int argc, char **argv) {
+  int failed = 0;
+  int run = 0;
+  for (const HostTest& test : hostTests()) {
+    if (argc > 1 && strstr(test.name, argv[1]) == NULL) continue;
+    int before = host_failures;
+    test.fn();
+    run++;
+    bool ok = host_failures == before;
+    if (!ok) failed++;
+    printf("%-4s %s\n", ok ? "ok" : "FAIL", test.name);
+  }
+  printf("%d tests, %d failed\n", run, failed);
+  return failed ? 1 : 0;
+}
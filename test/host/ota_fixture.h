@@ -0,0 +1,107 @@
+// Helpers of the host tests: a device with its own server, images and requests
+#pragma once
+#include "ElegantOTA.h"
+#include "host.h"
+#include "test.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief ElegantOTA on its own server, the fake flash is reset
+ */
+struct Device {
+  AsyncWebServer server{80};
+  ElegantOTAClass ota;
+  int starts = 0;
+  int ends = 0;
+  int successes = 0;
+
+  /**
+   * @param setup configures the instance before begin()
+   */
+  explicit Device(const char *username = "", const char *password = "", std::function<void(ElegantOTAClass&)> setup = NULL) {
+    host::resetFlash();
+    host::resetDevice();
+    // begin() registers its headers on the global instance, every device starts from none
+    DefaultHeaders::Instance().clear();
+    ota.setAutoReboot(false);
+    ota.onStart([this]() { starts++; });
+    ota.onEnd([this](bool ok) {
+      ends++;
+      if (ok) successes++;
+    });
+    if (setup) setup(ota);
+    ota.begin(&server, username, password);
+  }
+  // the Update object is shared by all instances, a session left open is timed out
+  ~Device() {
+    host::advance(24UL * 3600 * 1000);
+    ota.loop();
+  }
+};
+
+/**
+ * @brief firmware image with a valid ESP32 header for chipId and pseudo random content
+ */
+inline std::vector<uint8_t> makeImage(size_t size, uint16_t chipId = CONFIG_IDF_FIRMWARE_CHIP_ID, uint8_t seed = 1) {
+  std::vector<uint8_t> image(size);
+  for (size_t i = 0; i < size; i++) image[i] = (uint8_t)(i * 31 + seed * 17 + (i >> 8));
+  image[0] = 0xE9;
+  image[1] = 3;                       // segments
+  image[12] = (uint8_t)chipId;
+  image[13] = (uint8_t)(chipId >> 8);
+  image[32] = 0x32; image[33] = 0x54; image[34] = 0xCD; image[35] = 0xAB;   // app descriptor magic
+  return image;
+}
+
+inline std::string md5Hex(const uint8_t *data, size_t len) {
+  MD5Builder md5;
+  md5.begin();
+  md5.add(data, len);
+  md5.calculate();
+  return md5.toString().c_str();
+}
+
+inline std::string md5Hex(const std::vector<uint8_t>& data) { return md5Hex(data.data(), data.size()); }
+
+/**
+ * @brief client connection of a test, the address tells the session owners apart
+ */
+inline std::unique_ptr<AsyncClient> makeClient(uint8_t lastOctet) {
+  std::unique_ptr<AsyncClient> client(new AsyncClient());
+  client->_connected = true;
+  client->_remote = IPAddress(192, 168, 4, lastOctet);
+  return client;
+}
+
+/**
+ * @brief GET url and return the status code, body and headers stay in the request
+ */
+inline std::unique_ptr<AsyncWebServerRequest> request(Device& device, WebRequestMethodComposite method, const char *url, AsyncClient *client = NULL) {
+  return std::unique_ptr<AsyncWebServerRequest>(new AsyncWebServerRequest(device.server, method, url, client));
+}
+
+inline int get(Device& device, const char *url, AsyncClient *client = NULL) {
+  auto req = request(device, HTTP_GET, url, client);
+  return req->hostEnd();
+}
+
+/**
+ * @brief POST data to /ota/upload as multipart upload in fragments of fragment bytes
+ * @return the status code of the answer
+ */
+inline int upload(Device& device, const std::vector<uint8_t>& data, AsyncClient *client = NULL, size_t fragment = 1436, std::string *body = NULL) {
+  auto req = request(device, HTTP_POST, "/ota/upload", client);
+  req->_content_length = data.size() + 200;
+  size_t offset = 0;
+  do {
+    size_t n = data.size() - offset < fragment ? data.size() - offset : fragment;
+    req->hostUpload("firmware.bin", data.data() + offset, n, offset + n == data.size());
+    offset += n;
+  } while (offset < data.size());
+  int code = req->hostEnd();
+  if (body != NULL) *body = req->body();
+  return code;
+}
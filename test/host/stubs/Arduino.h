@@ -0,0 +1,178 @@
+// Host build of the parts of the Arduino core the library uses, see test/host/Makefile
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cstdarg>
+#include <cstdlib>
+#include <strings.h>
+#include <string>
+#include <functional>
+
+#define PROGMEM
+#define LOW 0
+#define HIGH 1
+#define memcpy_P memcpy
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+typedef bool boolean;
+
+class String {
+  public:
+    String() {}
+    String(const char *c) : _s(c ? c : "") {}
+    String(const std::string& s) : _s(s) {}
+    String(int v) : _s(std::to_string(v)) {}
+    String(unsigned v) : _s(std::to_string(v)) {}
+    String(long v) : _s(std::to_string(v)) {}
+    String(unsigned long v) : _s(std::to_string(v)) {}
+
+    const char *c_str() const { return _s.c_str(); }
+    unsigned length() const { return _s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    bool reserve(unsigned n) { _s.reserve(n); return true; }
+    int toInt() const { return atoi(_s.c_str()); }
+    void concat(const char *c) { _s += c; }
+    bool startsWith(const char *p) const { return _s.rfind(p, 0) == 0; }
+    bool endsWith(const char *p) const { size_t n = strlen(p); return _s.size() >= n && _s.compare(_s.size() - n, n, p) == 0; }
+    int indexOf(char c) const { size_t p = _s.find(c); return p == std::string::npos ? -1 : (int)p; }
+    int lastIndexOf(char c) const { size_t p = _s.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+    String substring(unsigned a) const { return String(_s.substr(a)); }
+    String substring(unsigned a, unsigned b) const { return String(_s.substr(a, b - a)); }
+    char operator[](unsigned i) const { return _s[i]; }
+
+    bool operator==(const char *o) const { return o != NULL && _s == o; }
+    bool operator!=(const char *o) const { return !(*this == o); }
+    bool operator==(const String& o) const { return _s == o._s; }
+    bool operator!=(const String& o) const { return _s != o._s; }
+    String& operator+=(const char *c) { _s += c; return *this; }
+    String& operator+=(const String& c) { _s += c._s; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+
+  private:
+    std::string _s;
+};
+inline String operator+(const String& a, const char *b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+      size_t n = 0;
+      while (n < size && this->write(buffer[n])) n++;
+      return n;
+    }
+    size_t write(const char *str) { return this->write((const uint8_t *)str, strlen(str)); }
+    size_t print(const char *str) { return this->write((const uint8_t *)str, strlen(str)); }
+    size_t print(const String& str) { return this->print(str.c_str()); }
+    size_t print(char c) { return this->write((uint8_t)c); }
+    size_t print(unsigned long v) { return this->print(std::to_string(v).c_str()); }
+    size_t print(long v) { return this->print(std::to_string(v).c_str()); }
+    size_t print(unsigned v) { return this->print(std::to_string(v).c_str()); }
+    size_t print(int v) { return this->print(std::to_string(v).c_str()); }
+    size_t println(const char *str) { return this->print(str) + this->println(); }
+    size_t println(const String& str) { return this->println(str.c_str()); }
+    size_t println() { return this->print("\r\n"); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual int peek() { return -1; }
+    virtual size_t readBytes(uint8_t *buffer, size_t len) {
+      size_t n = 0;
+      int c;
+      while (n < len && (c = this->read()) >= 0) buffer[n++] = (uint8_t)c;
+      return n;
+    }
+    size_t write(uint8_t) override { return 1; }
+    using Print::write;
+    void setTimeout(unsigned long) {}
+};
+
+/**
+ * @brief Serial of the host build, keeps the last lines for the tests and prints them with ELEGANTOTA_HOST_VERBOSE set
+ */
+class HardwareSerial : public Stream {
+  public:
+    size_t write(uint8_t c) override;
+    using Print::write;
+    void setDebugOutput(bool) {}
+    void begin(unsigned long) {}
+};
+extern HardwareSerial Serial;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+long random(long max);
+long random(long min, long max);
+size_t strlcpy(char *dst, const char *src, size_t size);
+
+class IPAddress {
+  public:
+    IPAddress() {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr((uint32_t)a | (uint32_t)b << 8 | (uint32_t)c << 16 | (uint32_t)d << 24) {}
+    IPAddress(uint32_t addr) : _addr(addr) {}
+    operator uint32_t() const { return _addr; }
+    bool operator==(const IPAddress& o) const { return _addr == o._addr; }
+    bool operator!=(const IPAddress& o) const { return _addr != o._addr; }
+    uint8_t operator[](int i) const { return (uint8_t)(_addr >> (8 * i)); }
+    String toString() const {
+      char buf[16];
+      snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+      return String(buf);
+    }
+    bool fromString(const char *str) {
+      unsigned a, b, c, d;
+      char tail;
+      if (str == NULL || sscanf(str, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 || a > 255 || b > 255 || c > 255 || d > 255) return false;
+      *this = IPAddress(a, b, c, d);
+      return true;
+    }
+
+  private:
+    uint32_t _addr = 0;
+};
+
+struct EspClass {
+  void wdtFeed() {}
+  void restart();
+  uint32_t getFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getMaxFreeBlockSize();
+  uint32_t getMinFreeHeap();
+  uint32_t getFreePsram();
+  uint32_t getFreeSketchSpace();
+  uint32_t getSketchSize();
+  String getSketchMD5();
+  bool flashRead(uint32_t address, uint32_t *data, size_t size);
+  bool flashRead(uint32_t address, uint8_t *data, size_t size);
+  bool flashEraseSector(uint32_t sector);
+  bool flashWrite(uint32_t address, const uint32_t *data, size_t size);
+  uint32_t getCpuFreqMHz();
+  uint32_t getFreeContStack();
+  const char *getChipModel() { return "host"; }
+  uint32_t random();
+};
+extern EspClass ESP;
+
+typedef void *TaskHandle_t;
+unsigned uxTaskGetStackHighWaterMark(TaskHandle_t task);
+bool psramFound();
+uint32_t esp_random();
+
+// board of the host build, a LOLIN S3: the variant does not name the chip, the sdkconfig does.
+// Tests select another chip with -DCONFIG_IDF_TARGET_... -DCONFIG_IDF_FIRMWARE_CHIP_ID=...
+#if defined(ESP32) && !defined(CONFIG_IDF_FIRMWARE_CHIP_ID)
+  #define CONFIG_IDF_TARGET_ESP32S3 1
+  #define CONFIG_IDF_FIRMWARE_CHIP_ID 0x0009
+#endif
+#if defined(ESP32) && !defined(ARDUINO_VARIANT)
+  #define ARDUINO_VARIANT "lolin_s3"
+#endif
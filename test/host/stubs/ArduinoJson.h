@@ -0,0 +1,271 @@
+// Host build of the ArduinoJson 7 API the library uses, a small tree with parser and serializer
+#pragma once
+#include "Arduino.h"
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ArduinoJson {
+
+struct JsonNode {
+  enum Type { NUL, BOOL, INT, FLOAT, STRING, ARRAY, OBJECT } type = NUL;
+  bool b = false;
+  long long i = 0;
+  double f = 0;
+  std::string s;
+  std::vector<std::shared_ptr<JsonNode>> items;
+  std::vector<std::pair<std::string, std::shared_ptr<JsonNode>>> members;
+
+  std::shared_ptr<JsonNode> member(const char *key) const {
+    for (const auto& m : members) {
+      if (m.first == key) return m.second;
+    }
+    return nullptr;
+  }
+  void reset(Type t) {
+    type = t;
+    items.clear();
+    members.clear();
+    s.clear();
+  }
+};
+typedef std::shared_ptr<JsonNode> JsonNodePtr;
+
+class JsonArray;
+class JsonObject;
+
+/**
+ * @brief reference to a value, members of objects are created when they are written
+ */
+class JsonVariant {
+  public:
+    JsonVariant() {}
+    explicit JsonVariant(JsonNodePtr node) : _node(node) {}
+    JsonVariant(JsonNodePtr parent, const char *key) : _parent(parent), _key(key) {}
+
+    JsonNodePtr node() const {
+      if (_node || !_parent || _parent->type != JsonNode::OBJECT) return _node;
+      return _parent->member(_key.c_str());
+    }
+    JsonNodePtr create() {
+      JsonNodePtr n = this->node();
+      if (n) return n;
+      if (!_parent) return nullptr;
+      if (_parent->type != JsonNode::OBJECT) _parent->reset(JsonNode::OBJECT);
+      n = std::make_shared<JsonNode>();
+      _parent->members.emplace_back(_key, n);
+      return n;
+    }
+
+    bool isNull() const { JsonNodePtr n = this->node(); return !n || n->type == JsonNode::NUL; }
+
+    JsonVariant& operator=(bool v) { JsonNodePtr n = this->create(); if (n) { n->reset(JsonNode::BOOL); n->b = v; } return *this; }
+    JsonVariant& operator=(const char *v) {
+      JsonNodePtr n = this->create();
+      if (n) {
+        if (v == NULL) { n->reset(JsonNode::NUL); return *this; }
+        n->reset(JsonNode::STRING);
+        n->s = v;
+      }
+      return *this;
+    }
+    JsonVariant& operator=(char *v) { return *this = (const char *)v; }
+    JsonVariant& operator=(const String& v) { return *this = v.c_str(); }
+    JsonVariant& operator=(double v) { JsonNodePtr n = this->create(); if (n) { n->reset(JsonNode::FLOAT); n->f = v; } return *this; }
+    JsonVariant& operator=(float v) { return *this = (double)v; }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+    JsonVariant& operator=(T v) { JsonNodePtr n = this->create(); if (n) { n->reset(JsonNode::INT); n->i = (long long)v; } return *this; }
+
+    JsonVariant operator[](const char *key) const {
+      JsonNodePtr n = this->node();
+      return n ? JsonVariant(n, key) : JsonVariant();
+    }
+    JsonVariant operator[](const String& key) const { return (*this)[key.c_str()]; }
+    JsonVariant operator[](size_t index) const {
+      JsonNodePtr n = this->node();
+      if (!n || n->type != JsonNode::ARRAY || index >= n->items.size()) return JsonVariant();
+      return JsonVariant(n->items[index]);
+    }
+    JsonVariant operator[](int index) const { return (*this)[(size_t)index]; }
+
+    template <typename T> T as() const;
+    template <typename T> bool is() const;
+    template <typename T> T to();
+    template <typename T> operator T() const { return this->as<T>(); }
+
+    const char *operator|(const char *d) const {
+      JsonNodePtr n = this->node();
+      return n && n->type == JsonNode::STRING ? n->s.c_str() : d;
+    }
+    bool operator|(bool d) const {
+      JsonNodePtr n = this->node();
+      return n && n->type == JsonNode::BOOL ? n->b : d;
+    }
+    template <typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+    T operator|(T d) const {
+      JsonNodePtr n = this->node();
+      if (n && n->type == JsonNode::INT) return (T)n->i;
+      if (n && n->type == JsonNode::FLOAT) return (T)n->f;
+      return d;
+    }
+
+    size_t size() const {
+      JsonNodePtr n = this->node();
+      if (!n) return 0;
+      return n->type == JsonNode::ARRAY ? n->items.size() : n->type == JsonNode::OBJECT ? n->members.size() : 0;
+    }
+
+  protected:
+    JsonNodePtr _node;
+    JsonNodePtr _parent;
+    std::string _key;
+};
+
+class JsonObject : public JsonVariant {
+  public:
+    JsonObject() {}
+    explicit JsonObject(JsonNodePtr node) : JsonVariant(node && node->type == JsonNode::OBJECT ? node : nullptr) {}
+    JsonVariant operator[](const char *key) const { return _node ? JsonVariant(_node, key) : JsonVariant(); }
+    JsonVariant operator[](const String& key) const { return (*this)[key.c_str()]; }
+    bool containsKey(const char *key) const { return _node && _node->member(key) != nullptr; }
+};
+
+class JsonArray : public JsonVariant {
+  public:
+    JsonArray() {}
+    explicit JsonArray(JsonNodePtr node) : JsonVariant(node && node->type == JsonNode::ARRAY ? node : nullptr) {}
+
+    template <typename T> bool add(const T& value) {
+      if (!_node) return false;
+      JsonNodePtr n = std::make_shared<JsonNode>();
+      _node->items.push_back(n);
+      JsonVariant v(n);
+      v = value;
+      return true;
+    }
+    bool add(const char *value) {
+      if (!_node) return false;
+      JsonNodePtr n = std::make_shared<JsonNode>();
+      _node->items.push_back(n);
+      JsonVariant v(n);
+      v = value;
+      return true;
+    }
+    bool add(char *value) { return this->add((const char *)value); }
+    template <typename T> T add() {
+      if (!_node) return T();
+      JsonNodePtr n = std::make_shared<JsonNode>();
+      _node->items.push_back(n);
+      return JsonVariant(n).to<T>();
+    }
+
+    class iterator {
+      public:
+        iterator(JsonNodePtr node, size_t index) : _node(node), _index(index) {}
+        JsonVariant operator*() const { return JsonVariant(_node->items[_index]); }
+        iterator& operator++() { _index++; return *this; }
+        bool operator!=(const iterator& o) const { return _index != o._index; }
+
+      private:
+        JsonNodePtr _node;
+        size_t _index;
+    };
+    iterator begin() const { return iterator(_node, 0); }
+    iterator end() const { return iterator(_node, _node ? _node->items.size() : 0); }
+};
+
+template <typename T> inline T JsonVariant::as() const {
+  JsonNodePtr n = this->node();
+  if (!n) return T();
+  if (n->type == JsonNode::INT) return (T)n->i;
+  if (n->type == JsonNode::FLOAT) return (T)n->f;
+  if (n->type == JsonNode::BOOL) return (T)n->b;
+  return T();
+}
+template <> inline const char *JsonVariant::as<const char *>() const {
+  JsonNodePtr n = this->node();
+  return n && n->type == JsonNode::STRING ? n->s.c_str() : NULL;
+}
+template <> inline String JsonVariant::as<String>() const {
+  const char *s = this->as<const char *>();
+  return String(s ? s : "null");
+}
+template <> inline JsonObject JsonVariant::as<JsonObject>() const { return JsonObject(this->node()); }
+template <> inline JsonArray JsonVariant::as<JsonArray>() const { return JsonArray(this->node()); }
+template <> inline JsonVariant JsonVariant::as<JsonVariant>() const { return *this; }
+
+template <typename T> inline bool JsonVariant::is() const {
+  JsonNodePtr n = this->node();
+  return n && (n->type == JsonNode::INT || (std::is_floating_point<T>::value && n->type == JsonNode::FLOAT));
+}
+template <> inline bool JsonVariant::is<bool>() const { JsonNodePtr n = this->node(); return n && n->type == JsonNode::BOOL; }
+template <> inline bool JsonVariant::is<const char *>() const { JsonNodePtr n = this->node(); return n && n->type == JsonNode::STRING; }
+template <> inline bool JsonVariant::is<JsonObject>() const { JsonNodePtr n = this->node(); return n && n->type == JsonNode::OBJECT; }
+template <> inline bool JsonVariant::is<JsonArray>() const { JsonNodePtr n = this->node(); return n && n->type == JsonNode::ARRAY; }
+
+template <> inline JsonArray JsonVariant::to<JsonArray>() {
+  JsonNodePtr n = this->create();
+  if (!n) return JsonArray();
+  n->reset(JsonNode::ARRAY);
+  return JsonArray(n);
+}
+template <> inline JsonObject JsonVariant::to<JsonObject>() {
+  JsonNodePtr n = this->create();
+  if (!n) return JsonObject();
+  n->reset(JsonNode::OBJECT);
+  return JsonObject(n);
+}
+
+class JsonDocument : public JsonVariant {
+  public:
+    JsonDocument() : JsonVariant(std::make_shared<JsonNode>()) {}
+    JsonDocument(const JsonDocument&) = delete;
+    JsonDocument& operator=(const JsonDocument&) = delete;
+
+    JsonVariant operator[](const char *key) {
+      if (_node->type == JsonNode::NUL) _node->reset(JsonNode::OBJECT);
+      return JsonVariant(_node, key);
+    }
+    JsonVariant operator[](const char *key) const { return JsonVariant(_node, key); }
+    JsonVariant operator[](size_t index) const { return JsonVariant::operator[](index); }
+    void clear() { _node->reset(JsonNode::NUL); }
+    bool overflowed() const { return false; }
+};
+
+class DeserializationError {
+  public:
+    enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory };
+    DeserializationError(Code code = Ok) : _code(code) {}
+    explicit operator bool() const { return _code != Ok; }
+    bool operator==(Code code) const { return _code == code; }
+    const char *c_str() const {
+      static const char *names[] = {"Ok", "EmptyInput", "IncompleteInput", "InvalidInput", "NoMemory"};
+      return names[_code];
+    }
+    Code code() const { return _code; }
+
+  private:
+    Code _code;
+};
+
+size_t serializeJson(const JsonVariant& value, Print& out);
+size_t serializeJson(const JsonVariant& value, String& out);
+size_t serializeJson(const JsonVariant& value, char *out, size_t size);
+size_t measureJson(const JsonVariant& value);
+DeserializationError deserializeJson(JsonDocument& doc, const char *input, size_t len);
+DeserializationError deserializeJson(JsonDocument& doc, const char *input);
+DeserializationError deserializeJson(JsonDocument& doc, const uint8_t *input, size_t len);
+DeserializationError deserializeJson(JsonDocument& doc, const String& input);
+DeserializationError deserializeJson(JsonDocument& doc, Stream& input);
+
+}  // namespace ArduinoJson
+
+using ArduinoJson::DeserializationError;
+using ArduinoJson::JsonArray;
+using ArduinoJson::JsonDocument;
+using ArduinoJson::JsonObject;
+using ArduinoJson::JsonVariant;
+using ArduinoJson::deserializeJson;
+using ArduinoJson::measureJson;
+using ArduinoJson::serializeJson;
@@ -0,0 +1,120 @@
+// Host build of AsyncTCP: connections are driven by the tests, see host.h
+#pragma once
+#include "Arduino.h"
+#include <functional>
+#include <string>
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+
+class AsyncClient;
+typedef std::function<void(void *, AsyncClient *)> AcConnectHandler;
+typedef std::function<void(void *, AsyncClient *, void *data, size_t len)> AcDataHandler;
+typedef std::function<void(void *, AsyncClient *, size_t len, uint32_t time)> AcAckHandler;
+typedef std::function<void(void *, AsyncClient *, int8_t error)> AcErrorHandler;
+typedef std::function<void(void *, AsyncClient *, uint32_t time)> AcTimeoutHandler;
+
+class AsyncClient {
+  public:
+    AsyncClient() {}
+    virtual ~AsyncClient() {}
+
+    bool connect(IPAddress ip, uint16_t port);
+    bool connect(const char *host, uint16_t port);
+    void close(bool now = false);
+    bool connected() const { return _connected; }
+    bool disconnected() const { return !_connected; }
+
+    size_t space() const { return _space > _queued ? _space - _queued : 0; }
+    size_t add(const char *data, size_t size, uint8_t apiflags = ASYNC_WRITE_FLAG_COPY);
+    bool send();
+    size_t write(const char *data) { return this->write(data, strlen(data)); }
+    size_t write(const char *data, size_t size, uint8_t apiflags = ASYNC_WRITE_FLAG_COPY) {
+      size_t n = this->add(data, size, apiflags);
+      this->send();
+      return n;
+    }
+
+    void ackLater() { _ack_later = true; }
+    size_t ack(size_t len);
+    void setRxTimeout(uint32_t timeout) { _rx_timeout = timeout; }
+    void setNoDelay(bool) {}
+    uint16_t getMss() const { return _mss; }
+    IPAddress remoteIP() const { return _remote; }
+    uint16_t remotePort() const { return _remote_port; }
+
+    void onConnect(AcConnectHandler cb, void *arg = NULL) { _connect_cb = cb; _connect_arg = arg; }
+    void onDisconnect(AcConnectHandler cb, void *arg = NULL) { _disconnect_cb = cb; _disconnect_arg = arg; }
+    void onData(AcDataHandler cb, void *arg = NULL) { _data_cb = cb; _data_arg = arg; }
+    void onAck(AcAckHandler cb, void *arg = NULL) { _ack_cb = cb; _ack_arg = arg; }
+    void onError(AcErrorHandler cb, void *arg = NULL) { _error_cb = cb; _error_arg = arg; }
+    void onTimeout(AcTimeoutHandler cb, void *arg = NULL) { _timeout_cb = cb; _timeout_arg = arg; }
+
+    // host side of the connection
+    IPAddress   _remote;
+    uint16_t    _remote_port = 0;
+    std::string _host;               // name given to connect()
+    bool        _connected = false;
+    bool        _connecting = false;
+    bool        _closed = false;     // close() was called
+    std::string _sent;               // bytes passed to send()
+    size_t      _space = 5744;       // TCP_SND_BUF
+    size_t      _queued = 0;         // added, not acknowledged by the peer
+    size_t      _pending = 0;        // added, not yet sent
+    uint16_t    _mss = 1436;
+    uint32_t    _rx_timeout = 0;
+    bool        _ack_later = false;
+    size_t      _unacked = 0;        // received bytes the application did not acknowledge yet
+
+    /**
+     * @brief deliver received bytes to onData, acknowledged right away unless ackLater() was called
+     */
+    void hostReceive(const void *data, size_t len);
+
+    /**
+     * @brief complete a pending connect(), false reports a connection error
+     */
+    void hostConnected(bool ok = true);
+
+    /**
+     * @brief the peer acknowledged sent bytes
+     */
+    void hostAck(size_t len);
+
+    /**
+     * @brief the peer closed the connection, onDisconnect may delete the client
+     */
+    void hostDisconnect();
+
+  private:
+    AcConnectHandler _connect_cb;    void *_connect_arg = NULL;
+    AcConnectHandler _disconnect_cb; void *_disconnect_arg = NULL;
+    AcDataHandler    _data_cb;       void *_data_arg = NULL;
+    AcAckHandler     _ack_cb;        void *_ack_arg = NULL;
+    AcErrorHandler   _error_cb;      void *_error_arg = NULL;
+    AcTimeoutHandler _timeout_cb;    void *_timeout_arg = NULL;
+};
+
+class AsyncServer {
+  public:
+    AsyncServer(uint16_t port) : _port(port) {}
+    ~AsyncServer() { this->end(); }
+    void begin();
+    void end();
+    void setNoDelay(bool) {}
+    void onClient(AcConnectHandler cb, void *arg) { _client_cb = cb; _client_arg = arg; }
+
+    /**
+     * @brief a client connected, the server takes it over
+     */
+    void hostAccept(AsyncClient *client) {
+      client->_connected = true;
+      if (_client_cb) _client_cb(_client_arg, client);
+    }
+
+    uint16_t _port;
+    bool     _listening = false;
+
+  private:
+    AcConnectHandler _client_cb;
+    void *_client_arg = NULL;
+};
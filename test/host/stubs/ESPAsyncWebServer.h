@@ -0,0 +1,251 @@
+// Host build of ESPAsyncWebServer (v3 API): requests are built and driven by the tests
+#pragma once
+#include "Arduino.h"
+#include "AsyncTCP.h"
+#include <functional>
+#include <list>
+#include <vector>
+#include <string>
+
+typedef enum { HTTP_GET = 1, HTTP_POST = 2, HTTP_DELETE = 4, HTTP_PUT = 8, HTTP_PATCH = 16, HTTP_HEAD = 32, HTTP_OPTIONS = 64, HTTP_ANY = 127 } WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebParameter {
+  public:
+    AsyncWebParameter(const String& name, const String& value, bool form = false, bool file = false)
+      : _name(name), _value(value), _form(form), _file(file) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+    bool isPost() const { return _form; }
+    bool isFile() const { return _file; }
+
+  private:
+    String _name;
+    String _value;
+    bool   _form;
+    bool   _file;
+};
+
+class AsyncWebHeader {
+  public:
+    AsyncWebHeader(const String& name, const String& value) : _name(name), _value(value) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+    String toString() const { return _name + ": " + _value + "\r\n"; }
+
+  private:
+    String _name;
+    String _value;
+};
+
+class DefaultHeaders {
+  public:
+    typedef std::list<AsyncWebHeader> headers_t;
+    void addHeader(const char *name, const char *value) { _headers.emplace_back(String(name), String(value)); }
+    headers_t::const_iterator begin() const { return _headers.begin(); }
+    headers_t::const_iterator end() const { return _headers.end(); }
+    void clear() { _headers.clear(); }
+    static DefaultHeaders& Instance() {
+      static DefaultHeaders instance;
+      return instance;
+    }
+
+  private:
+    headers_t _headers;
+};
+
+class AsyncWebServerRequest;
+
+class AsyncWebServerResponse {
+  public:
+    AsyncWebServerResponse() {
+      for (const AsyncWebHeader& header : DefaultHeaders::Instance()) _headers.push_back(header);
+    }
+    virtual ~AsyncWebServerResponse() {}
+    bool addHeader(const char *name, const char *value) { _headers.emplace_back(String(name), String(value)); return true; }
+    bool addHeader(const char *name, const String& value) { return this->addHeader(name, value.c_str()); }
+    void setCode(int code) { _code = code; }
+    void setContentType(const char *type) { _contentType = type; }
+    int code() const { return _code; }
+
+    virtual void _respond(AsyncWebServerRequest *request);
+    virtual size_t _ack(AsyncWebServerRequest *request, size_t len, uint32_t time);
+    virtual bool _finished() const { return _state_done; }
+    virtual bool _failed() const { return false; }
+    virtual bool _sourceValid() const { return true; }
+
+    /**
+     * @brief the body as the server would send it, without head
+     */
+    virtual std::string hostBody() { return _content; }
+
+    /**
+     * @brief value of a header added to the response, NULL if missing
+     */
+    const char *hostHeader(const char *name) const;
+
+  protected:
+    int _code = 0;
+    String _contentType;
+    std::list<AsyncWebHeader> _headers;
+    std::string _content;
+    bool _state_done = false;
+};
+
+class AsyncBasicResponse : public AsyncWebServerResponse {
+  public:
+    AsyncBasicResponse(int code, const char *contentType = "", const char *content = "") {
+      _code = code;
+      _contentType = contentType;
+      _content = content != NULL ? content : "";
+    }
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+  public:
+    AsyncResponseStream(const char *contentType) {
+      _code = 200;
+      _contentType = contentType;
+    }
+    size_t write(uint8_t c) override { _content += (char)c; return 1; }
+    size_t write(const uint8_t *data, size_t len) override { _content.append((const char *)data, len); return len; }
+    using Print::write;
+};
+
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+typedef std::function<size_t(uint8_t *buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+class AsyncCallbackResponse : public AsyncWebServerResponse {
+  public:
+    AsyncCallbackResponse(const char *contentType, size_t len, AwsResponseFiller callback) : _len(len), _callback(callback) {
+      _code = 200;
+      _contentType = contentType;
+    }
+    std::string hostBody() override;
+
+  private:
+    size_t _len;
+    AwsResponseFiller _callback;
+};
+
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+
+class AsyncCallbackWebHandler {
+  public:
+    String _uri;
+    WebRequestMethodComposite _method = HTTP_ANY;
+    ArRequestHandlerFunction _onRequest;
+    ArUploadHandlerFunction _onUpload;
+    ArBodyHandlerFunction _onBody;
+
+    bool canHandle(WebRequestMethodComposite method, const String& url) const;
+};
+
+class AsyncWebServer;
+
+class AsyncWebServerRequest {
+  public:
+    /**
+     * @brief request to url, the handler is selected like the real server does
+     */
+    AsyncWebServerRequest(AsyncWebServer& server, WebRequestMethodComposite method, const char *url, AsyncClient *client = NULL);
+    ~AsyncWebServerRequest();
+
+    bool authenticate(const char *username, const char *password, const char *realm = NULL, bool passwordIsHash = false) const;
+    void requestAuthentication(const char *realm = NULL, bool isDigest = true);
+
+    AsyncWebServerResponse *beginResponse(int code, const char *contentType = "", const char *content = "") { return new AsyncBasicResponse(code, contentType, content); }
+    AsyncWebServerResponse *beginResponse(int code, const String& contentType, const String& content) { return new AsyncBasicResponse(code, contentType.c_str(), content.c_str()); }
+    AsyncWebServerResponse *beginResponse(const char *contentType, size_t len, AwsResponseFiller callback) { return new AsyncCallbackResponse(contentType, len, callback); }
+    AsyncResponseStream *beginResponseStream(const char *contentType, size_t = 1460) { return new AsyncResponseStream(contentType); }
+
+    void send(AsyncWebServerResponse *response);
+    void send(int code, const char *contentType = "", const char *content = "") { this->send(this->beginResponse(code, contentType, content)); }
+    void send(int code, const char *contentType, const String& content) { this->send(code, contentType, content.c_str()); }
+
+    bool hasParam(const char *name, bool post = false, bool file = false) const { return this->getParam(name, post, file) != NULL; }
+    const AsyncWebParameter *getParam(const char *name, bool post = false, bool file = false) const;
+    bool hasHeader(const char *name) const { return this->getHeader(name) != NULL; }
+    const String& header(const char *name) const;
+    const AsyncWebHeader *getHeader(const char *name) const;
+    size_t contentLength() const { return _content_length; }
+    AsyncClient *client() { return _client; }
+    uint8_t version() const { return 1; }
+    void onDisconnect(std::function<void()> fn) { _disconnect_cbs.push_back(fn); }
+
+    void *_tempObject = NULL;
+
+    // host side
+    std::vector<AsyncWebParameter> _params;
+    std::vector<AsyncWebHeader> _request_headers;
+    const char *_user = NULL;           // basic auth credentials sent with the request
+    const char *_pass = NULL;
+    size_t _content_length = 0;
+    AsyncWebServerResponse *_response = NULL;
+    int _ignored_sends = 0;             // send() calls after the response was set
+    size_t _upload_allocs = 0;          // allocations made inside the upload handler, the copies of hostUpload() excluded
+
+    void hostParam(const char *name, const char *value) { _params.emplace_back(String(name), String(value)); }
+    void hostHeader(const char *name, const char *value) { _request_headers.emplace_back(String(name), String(value)); }
+
+    /**
+     * @brief pass one part of a multipart upload to the handler, index is counted here
+     */
+    void hostUpload(const char *filename, const uint8_t *data, size_t len, bool final);
+
+    /**
+     * @brief pass the body to the body handler in parts of at most part bytes
+     */
+    void hostBody(const uint8_t *data, size_t len, size_t part = 1436);
+
+    /**
+     * @brief the request is complete, runs the request handler unless a response was sent already
+     * @return the response code, 0 if none was sent
+     */
+    int hostEnd();
+
+    /**
+     * @brief the client acknowledged len bytes of the response
+     */
+    void hostAck(size_t len);
+
+    /**
+     * @brief run the onDisconnect callbacks
+     */
+    void hostDisconnect();
+
+    int code() const { return _response != NULL ? _response->code() : 0; }
+    std::string body() const { return _response != NULL ? _response->hostBody() : std::string(); }
+    const char *responseHeader(const char *name) const { return _response != NULL ? _response->hostHeader(name) : NULL; }
+
+  private:
+    AsyncCallbackWebHandler *_handler = NULL;
+    AsyncClient *_client;
+    AsyncClient  _own_client;
+    size_t _upload_index = 0;
+    std::vector<std::function<void()>> _disconnect_cbs;
+    bool _disconnected = false;
+};
+
+class AsyncWebServer {
+  public:
+    AsyncWebServer(uint16_t port) : _port(port) {}
+    ~AsyncWebServer();
+    void begin() { _listening = true; _begin_count++; }
+    void end() { _listening = false; _end_count++; }
+
+    AsyncCallbackWebHandler& on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                ArUploadHandlerFunction onUpload = NULL, ArBodyHandlerFunction onBody = NULL);
+
+    AsyncCallbackWebHandler *hostFind(WebRequestMethodComposite method, const String& url);
+
+    uint16_t _port;
+    bool _listening = false;
+    int  _begin_count = 0;
+    int  _end_count = 0;
+
+  private:
+    std::vector<AsyncCallbackWebHandler *> _handlers;
+};
@@ -0,0 +1,12 @@
+// Host build of the mDNS responder, the registered TXT record is kept in host.h
+#pragma once
+#include "Arduino.h"
+
+class MDNSResponder {
+  public:
+    bool begin(const char *hostname);
+    bool addService(const char *service, const char *proto, uint16_t port);
+    bool addServiceTxt(const char *service, const char *proto, const char *key, const char *value);
+    void update() {}
+};
+extern MDNSResponder MDNS;
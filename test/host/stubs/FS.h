@@ -0,0 +1,93 @@
+// Host build of the Arduino FS API on an in-memory filesystem
+#pragma once
+#include "Arduino.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fs {
+
+struct FileImpl;
+
+class File : public Stream {
+  public:
+    File() {}
+    explicit File(std::shared_ptr<FileImpl> impl) : _impl(impl) {}
+    explicit operator bool() const { return _impl != nullptr; }
+
+    size_t write(uint8_t c) override { return this->write(&c, 1); }
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t *buf, size_t size);
+    size_t readBytes(uint8_t *buf, size_t size) override { return this->read(buf, size); }
+    bool seek(uint32_t pos);
+    size_t position() const;
+    size_t size() const;
+    void flush() {}
+    void close();
+    bool isDirectory() const;
+    File openNextFile(const char *mode = "r");
+    const char *name() const;
+    const char *path() const;
+    const char *fullName() const { return this->path(); }
+
+  private:
+    std::shared_ptr<FileImpl> _impl;
+};
+
+class Dir {
+  public:
+    Dir() {}
+    Dir(std::vector<std::string> names, std::vector<bool> dirs, std::vector<size_t> sizes) : _names(names), _dirs(dirs), _sizes(sizes) {}
+    bool next() { return ++_index < (int)_names.size(); }
+    String fileName() const { return String(_names[_index].c_str()); }
+    bool isDirectory() const { return _dirs[_index]; }
+    bool isFile() const { return !_dirs[_index]; }
+    size_t fileSize() const { return _sizes[_index]; }
+
+  private:
+    std::vector<std::string> _names;
+    std::vector<bool> _dirs;
+    std::vector<size_t> _sizes;
+    int _index = -1;
+};
+
+/**
+ * @brief flat map of paths to contents, directories exist implicitly while they hold a file
+ */
+class FS {
+  public:
+    bool begin() { _mounted = true; return true; }
+    void end() { _mounted = false; }
+    File open(const char *path, const char *mode = "r", bool create = false);
+    File open(const String& path, const char *mode = "r", bool create = false) { return this->open(path.c_str(), mode, create); }
+    Dir openDir(const char *path);
+    bool exists(const char *path);
+    bool exists(const String& path) { return this->exists(path.c_str()); }
+    bool remove(const char *path);
+    bool rename(const char *from, const char *to);
+    bool mkdir(const char *) { return _mounted; }
+
+    // host side
+    bool _mounted = true;
+    std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> _files;
+    void hostWrite(const char *path, const std::string& content);
+    std::string hostRead(const char *path) const;
+    void hostClear() { _files.clear(); }
+
+  private:
+    bool isDir(const std::string& path) const;
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
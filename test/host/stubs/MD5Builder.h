@@ -0,0 +1,23 @@
+// Host build of MD5Builder, a plain MD5 implementation
+#pragma once
+#include "Arduino.h"
+
+class MD5Builder {
+  public:
+    void begin();
+    void add(const uint8_t *data, size_t len);
+    void add(const char *data) { this->add((const uint8_t *)data, strlen(data)); }
+    bool addHexString(const char *data);
+    bool addStream(Stream& stream, size_t maxLen);
+    void calculate();
+    void getBytes(uint8_t *output) const { memcpy(output, _digest, 16); }
+    void getChars(char *output) const;
+    String toString() const;
+
+  private:
+    uint32_t _state[4];
+    uint64_t _count;
+    uint8_t  _buffer[64];
+    uint8_t  _digest[16];
+    void transform(const uint8_t block[64]);
+};
@@ -0,0 +1,63 @@
+// Host build of the ESP32 Update class, writes to the fake flash of host.h
+#pragma once
+#include "Arduino.h"
+#include "MD5Builder.h"
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+#define U_FLASH   0
+#define U_SPIFFS  100
+#define U_FS      U_SPIFFS
+
+#define UPDATE_ERROR_OK           (0)
+#define UPDATE_ERROR_WRITE        (1)
+#define UPDATE_ERROR_ERASE        (2)
+#define UPDATE_ERROR_READ         (3)
+#define UPDATE_ERROR_SPACE        (4)
+#define UPDATE_ERROR_SIZE         (5)
+#define UPDATE_ERROR_STREAM       (6)
+#define UPDATE_ERROR_MD5          (7)
+#define UPDATE_ERROR_MAGIC_BYTE   (8)
+#define UPDATE_ERROR_ACTIVATE     (9)
+#define UPDATE_ERROR_NO_PARTITION (10)
+#define UPDATE_ERROR_BAD_ARGUMENT (11)
+#define UPDATE_ERROR_ABORT        (12)
+
+/**
+ * @brief same state machine as the ESP32 core: begin() clears the expected MD5, end() compares it
+ */
+class UpdateClass {
+  public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN, int command = U_FLASH, int ledPin = -1, uint8_t ledOn = LOW, const char *label = NULL);
+    size_t write(uint8_t *data, size_t len);
+    bool end(bool evenIfRemaining = false);
+    void abort();
+    void printError(Print& out);
+    const char *errorString();
+    bool hasError() { return _error != UPDATE_ERROR_OK; }
+    uint8_t getError() { return _error; }
+    bool setMD5(const char *expected_md5);
+    bool isRunning() { return _size > 0; }
+    bool isFinished() { return _progress == _size; }
+    size_t size() { return _size; }
+    size_t progress() { return _progress; }
+    size_t remaining() { return _size - _progress; }
+    void runAsync(bool) {}
+    bool canRollBack() { return false; }
+    bool rollBack() { return false; }
+
+    // host side
+    std::string _target_md5;
+    int         _command = U_FLASH;
+    std::string _label;
+    int         _begin_count = 0;
+    int         _end_count = 0;
+    int         _abort_count = 0;
+    bool        _committed = false;   // the last end() succeeded
+
+  private:
+    size_t  _size = 0;
+    size_t  _progress = 0;
+    uint8_t _error = UPDATE_ERROR_OK;
+    MD5Builder _md5;
+};
+extern UpdateClass Update;
@@ -0,0 +1,14 @@
+// Host build of the WiFi object, records the power save setting
+#pragma once
+#include "WiFiClient.h"
+
+class WiFiClass {
+  public:
+    IPAddress localIP() { return _ip; }
+    bool setSleep(bool enable) { _sleep = enable; return true; }
+    bool getSleep() { return _sleep; }
+
+    IPAddress _ip = IPAddress(192, 168, 4, 2);
+    bool _sleep = true;
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,13 @@
+#pragma once
+#include "Arduino.h"
+
+class WiFiClient : public Stream {
+  public:
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int read(uint8_t *, size_t) { return 0; }
+    size_t readBytes(uint8_t *, size_t) override { return 0; }
+    uint8_t connected() { return 0; }
+    void stop() {}
+    void setNoDelay(bool) {}
+};
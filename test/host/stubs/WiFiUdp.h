@@ -0,0 +1,24 @@
+// Host build of WiFiUDP, packets are queued by the tests, see host.h
+#pragma once
+#include "Arduino.h"
+#include <string>
+
+class WiFiUDP : public Stream {
+  public:
+    uint8_t beginMulticast(IPAddress group, uint16_t port);
+    int parsePacket();
+    int available() override { return (int)(_packet.size() - _pos); }
+    int read() override { return _pos < _packet.size() ? (uint8_t)_packet[_pos++] : -1; }
+    int read(uint8_t *buf, size_t len);
+    int read(char *buf, size_t len) { return this->read((uint8_t *)buf, len); }
+    IPAddress remoteIP() { return IPAddress(192, 168, 4, 1); }
+    void stop() { _joined = false; }
+
+    bool        _joined = false;
+    IPAddress   _group;
+    uint16_t    _port = 0;
+
+  private:
+    std::string _packet;
+    size_t      _pos = 0;
+};
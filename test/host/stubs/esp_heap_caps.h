@@ -0,0 +1,6 @@
+#pragma once
+#include <cstdlib>
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+inline void *heap_caps_malloc(size_t size, unsigned) { return malloc(size); }
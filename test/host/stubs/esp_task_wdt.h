@@ -0,0 +1,5 @@
+#pragma once
+#include "Arduino.h"
+typedef int esp_err_t;
+inline esp_err_t esp_task_wdt_status(TaskHandle_t) { return -1; }
+inline esp_err_t esp_task_wdt_reset() { return 0; }
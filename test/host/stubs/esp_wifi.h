@@ -0,0 +1,9 @@
+#pragma once
+#include <cstdint>
+typedef int esp_err_t;
+#define ESP_OK 0
+typedef enum { WIFI_PS_NONE, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM } wifi_ps_type_t;
+esp_err_t esp_wifi_get_ps(wifi_ps_type_t *type);
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type);
+uint32_t getCpuFrequencyMhz();
+bool setCpuFrequencyMhz(uint32_t mhz);
@@ -0,0 +1,66 @@
+// Control side of the host build: time, heap accounting, flash, network fakes
+#pragma once
+#include "Arduino.h"
+#include "AsyncTCP.h"
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace host {
+
+// ---- time, millis() and micros() only move when a test advances them ----
+void advance(unsigned long ms);
+void setMillis(unsigned long ms);
+
+// ---- heap, every malloc/free/new/delete of the process is counted ----
+struct AllocStats {
+  size_t allocs = 0;     // allocations since resetAllocStats()
+  size_t frees = 0;
+  size_t live = 0;       // bytes allocated and not freed
+  size_t peak = 0;       // highest live since resetAllocStats()
+};
+void resetAllocStats();
+AllocStats allocStats();
+
+/**
+ * @brief size of the simulated device heap, ESP.getFreeHeap() is this minus live bytes
+ */
+void setHeapSize(size_t bytes);
+
+// ---- flash, the running and the update partition of the fake device ----
+std::vector<uint8_t>& runningImage();
+std::vector<uint8_t>& updatePartition();
+std::vector<uint8_t>& fsPartition();
+bool bootSwitched();            // esp_ota_set_boot_partition() was called
+void resetFlash(size_t partitionSize = 1310720);
+
+// ---- device, resetDevice() also takes the current heap use as the empty device heap ----
+bool restarted();               // ESP.restart() was called
+void resetDevice();
+
+// ---- TCP, connect() of every AsyncClient is recorded, the test completes it ----
+extern std::vector<AsyncClient *> connects;
+// servers between begin() and end(), clients are handed to them with hostAccept()
+extern std::vector<AsyncServer *> listeners;
+
+// ---- mDNS, services answered by mdns_query_async_new() ----
+struct MdnsService {
+  std::string host;
+  IPAddress ip;
+  uint16_t port = 80;
+  std::map<std::string, std::string> txt;
+};
+extern std::vector<MdnsService> mdnsServices;
+extern int mdnsQueries;                               // queries not deleted yet
+extern std::map<std::string, std::string> mdnsTxt;   // TXT record registered by the library
+
+// ---- UDP, packets read by WiFiUDP::parsePacket() ----
+extern std::deque<std::string> udpPackets;
+
+// ---- Serial output ----
+std::string log();
+void clearLog();
+bool logContains(const char *text);
+
+}  // namespace host
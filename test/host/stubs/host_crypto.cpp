@@ -0,0 +1,336 @@
+// MD5, SHA-256, HMAC-SHA256 and AES encryption for the host build, plain reference implementations
+#include "MD5Builder.h"
+#include "mbedtls/md.h"
+#include "mbedtls/aes.h"
+
+// ---- MD5 (RFC 1321) ----
+
+static inline uint32_t rol(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+
+static const uint32_t md5_k[64] = {
+  0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+  0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+  0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+  0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+  0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+  0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+  0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+  0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+static const int md5_r[64] = {7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+                              4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
+
+void MD5Builder::begin() {
+  _state[0] = 0x67452301;
+  _state[1] = 0xefcdab89;
+  _state[2] = 0x98badcfe;
+  _state[3] = 0x10325476;
+  _count = 0;
+  memset(_digest, 0, sizeof(_digest));
+}
+
+void MD5Builder::transform(const uint8_t block[64]) {
+  uint32_t m[16];
+  for (int i = 0; i < 16; i++) m[i] = (uint32_t)block[4 * i] | (uint32_t)block[4 * i + 1] << 8 | (uint32_t)block[4 * i + 2] << 16 | (uint32_t)block[4 * i + 3] << 24;
+  uint32_t a = _state[0], b = _state[1], c = _state[2], d = _state[3];
+  for (int i = 0; i < 64; i++) {
+    uint32_t f;
+    int g;
+    if (i < 16) { f = (b & c) | (~b & d); g = i; }
+    else if (i < 32) { f = (d & b) | (~d & c); g = (5 * i + 1) & 15; }
+    else if (i < 48) { f = b ^ c ^ d; g = (3 * i + 5) & 15; }
+    else { f = c ^ (b | ~d); g = (7 * i) & 15; }
+    uint32_t t = d;
+    d = c;
+    c = b;
+    b = b + rol(a + f + md5_k[i] + m[g], md5_r[i]);
+    a = t;
+  }
+  _state[0] += a;
+  _state[1] += b;
+  _state[2] += c;
+  _state[3] += d;
+}
+
+void MD5Builder::add(const uint8_t *data, size_t len) {
+  size_t fill = _count & 63;
+  _count += len;
+  while (len) {
+    size_t n = 64 - fill < len ? 64 - fill : len;
+    memcpy(_buffer + fill, data, n);
+    fill += n;
+    data += n;
+    len -= n;
+    if (fill == 64) {
+      this->transform(_buffer);
+      fill = 0;
+    }
+  }
+}
+
+bool MD5Builder::addHexString(const char *data) {
+  size_t len = strlen(data);
+  for (size_t i = 0; i + 1 < len; i += 2) {
+    char byte[3] = {data[i], data[i + 1], 0};
+    uint8_t b = (uint8_t)strtoul(byte, NULL, 16);
+    this->add(&b, 1);
+  }
+  return true;
+}
+
+bool MD5Builder::addStream(Stream& stream, size_t maxLen) {
+  uint8_t buf[256];
+  while (maxLen) {
+    size_t n = stream.readBytes(buf, maxLen < sizeof(buf) ? maxLen : sizeof(buf));
+    if (n == 0) return false;
+    this->add(buf, n);
+    maxLen -= n;
+  }
+  return true;
+}
+
+void MD5Builder::calculate() {
+  uint64_t bits = _count * 8;
+  uint8_t pad = 0x80;
+  this->add(&pad, 1);
+  pad = 0;
+  while ((_count & 63) != 56) this->add(&pad, 1);
+  uint8_t len[8];
+  for (int i = 0; i < 8; i++) len[i] = (uint8_t)(bits >> (8 * i));
+  this->add(len, 8);
+  for (int i = 0; i < 16; i++) _digest[i] = (uint8_t)(_state[i / 4] >> (8 * (i % 4)));
+}
+
+void MD5Builder::getChars(char *output) const {
+  for (int i = 0; i < 16; i++) snprintf(output + 2 * i, 3, "%02x", _digest[i]);
+}
+
+String MD5Builder::toString() const {
+  char out[33];
+  this->getChars(out);
+  return String(out);
+}
+
+// ---- SHA-256 (FIPS 180-4) ----
+
+static const uint32_t sha_k[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+static inline uint32_t ror(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+static void sha256_init(mbedtls_sha256_context *c) {
+  static const uint32_t iv[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  memcpy(c->state, iv, sizeof(iv));
+  c->count = 0;
+}
+
+static void sha256_transform(mbedtls_sha256_context *c, const uint8_t block[64]) {
+  uint32_t w[64];
+  for (int i = 0; i < 16; i++) w[i] = (uint32_t)block[4 * i] << 24 | (uint32_t)block[4 * i + 1] << 16 | (uint32_t)block[4 * i + 2] << 8 | block[4 * i + 3];
+  for (int i = 16; i < 64; i++) {
+    uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+  uint32_t a = c->state[0], b = c->state[1], cc = c->state[2], d = c->state[3];
+  uint32_t e = c->state[4], f = c->state[5], g = c->state[6], h = c->state[7];
+  for (int i = 0; i < 64; i++) {
+    uint32_t t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + sha_k[i] + w[i];
+    uint32_t t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & b) ^ (a & cc) ^ (b & cc));
+    h = g; g = f; f = e; e = d + t1; d = cc; cc = b; b = a; a = t1 + t2;
+  }
+  c->state[0] += a; c->state[1] += b; c->state[2] += cc; c->state[3] += d;
+  c->state[4] += e; c->state[5] += f; c->state[6] += g; c->state[7] += h;
+}
+
+static void sha256_update(mbedtls_sha256_context *c, const uint8_t *data, size_t len) {
+  size_t fill = c->count & 63;
+  c->count += len;
+  while (len) {
+    size_t n = 64 - fill < len ? 64 - fill : len;
+    memcpy(c->buffer + fill, data, n);
+    fill += n;
+    data += n;
+    len -= n;
+    if (fill == 64) {
+      sha256_transform(c, c->buffer);
+      fill = 0;
+    }
+  }
+}
+
+static void sha256_finish(mbedtls_sha256_context *c, uint8_t out[32]) {
+  uint64_t bits = c->count * 8;
+  uint8_t pad = 0x80;
+  sha256_update(c, &pad, 1);
+  pad = 0;
+  while ((c->count & 63) != 56) sha256_update(c, &pad, 1);
+  uint8_t len[8];
+  for (int i = 0; i < 8; i++) len[i] = (uint8_t)(bits >> (56 - 8 * i));
+  sha256_update(c, len, 8);
+  for (int i = 0; i < 32; i++) out[i] = (uint8_t)(c->state[i / 4] >> (24 - 8 * (i % 4)));
+}
+
+const mbedtls_md_info_t *mbedtls_md_info_from_type(mbedtls_md_type_t type) {
+  static const mbedtls_md_info_t sha256 = {MBEDTLS_MD_SHA256};
+  return type == MBEDTLS_MD_SHA256 ? &sha256 : NULL;
+}
+
+void mbedtls_md_init(mbedtls_md_context_t *ctx) { memset(ctx, 0, sizeof(*ctx)); }
+void mbedtls_md_free(mbedtls_md_context_t *ctx) { memset(ctx, 0, sizeof(*ctx)); }
+
+int mbedtls_md_setup(mbedtls_md_context_t *ctx, const mbedtls_md_info_t *info, int hmac) {
+  if (info == NULL) return -1;
+  ctx->info = info;
+  ctx->hmac = hmac;
+  return 0;
+}
+
+int mbedtls_md_starts(mbedtls_md_context_t *ctx) { sha256_init(&ctx->sha); return 0; }
+int mbedtls_md_update(mbedtls_md_context_t *ctx, const unsigned char *input, size_t len) { sha256_update(&ctx->sha, input, len); return 0; }
+int mbedtls_md_finish(mbedtls_md_context_t *ctx, unsigned char *output) { sha256_finish(&ctx->sha, output); return 0; }
+
+int mbedtls_md(const mbedtls_md_info_t *info, const unsigned char *input, size_t len, unsigned char *output) {
+  if (info == NULL) return -1;
+  mbedtls_sha256_context c;
+  sha256_init(&c);
+  sha256_update(&c, input, len);
+  sha256_finish(&c, output);
+  return 0;
+}
+
+int mbedtls_md_hmac_starts(mbedtls_md_context_t *ctx, const unsigned char *key, size_t keylen) {
+  if (ctx->info == NULL || !ctx->hmac) return -1;
+  uint8_t k[64] = {0};
+  if (keylen > 64) {
+    mbedtls_md(ctx->info, key, keylen, k);
+  } else {
+    memcpy(k, key, keylen);
+  }
+  for (int i = 0; i < 64; i++) {
+    ctx->ipad[i] = k[i] ^ 0x36;
+    ctx->opad[i] = k[i] ^ 0x5c;
+  }
+  return mbedtls_md_hmac_reset(ctx);
+}
+
+int mbedtls_md_hmac_reset(mbedtls_md_context_t *ctx) {
+  sha256_init(&ctx->sha);
+  sha256_update(&ctx->sha, ctx->ipad, 64);
+  return 0;
+}
+
+int mbedtls_md_hmac_update(mbedtls_md_context_t *ctx, const unsigned char *input, size_t len) {
+  sha256_update(&ctx->sha, input, len);
+  return 0;
+}
+
+int mbedtls_md_hmac_finish(mbedtls_md_context_t *ctx, unsigned char *output) {
+  uint8_t inner[32];
+  sha256_finish(&ctx->sha, inner);
+  sha256_init(&ctx->sha);
+  sha256_update(&ctx->sha, ctx->opad, 64);
+  sha256_update(&ctx->sha, inner, 32);
+  sha256_finish(&ctx->sha, output);
+  return 0;
+}
+
+// ---- AES (FIPS 197), encryption only ----
+
+static uint8_t aes_sbox[256];
+
+static uint8_t xtime(uint8_t x) { return (uint8_t)((x << 1) ^ ((x & 0x80) ? 0x1b : 0)); }
+
+static void aes_tables() {
+  if (aes_sbox[0] == 0x63) return;
+  // the S-box from the multiplicative inverse in GF(2^8) and the affine transform
+  uint8_t p = 1, q = 1;
+  do {
+    p = p ^ (uint8_t)(p << 1) ^ ((p & 0x80) ? 0x1b : 0);
+    q ^= q << 1;
+    q ^= q << 2;
+    q ^= q << 4;
+    if (q & 0x80) q ^= 0x09;
+    uint8_t x = q ^ (uint8_t)((q << 1) | (q >> 7)) ^ (uint8_t)((q << 2) | (q >> 6)) ^ (uint8_t)((q << 3) | (q >> 5)) ^ (uint8_t)((q << 4) | (q >> 4));
+    aes_sbox[p] = x ^ 0x63;
+  } while (p != 1);
+  aes_sbox[0] = 0x63;
+}
+
+void mbedtls_aes_init(mbedtls_aes_context *ctx) { memset(ctx, 0, sizeof(*ctx)); }
+void mbedtls_aes_free(mbedtls_aes_context *ctx) { memset(ctx, 0, sizeof(*ctx)); }
+
+int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits) {
+  if (keybits != 128 && keybits != 192 && keybits != 256) return -1;
+  aes_tables();
+  int nk = keybits / 32;
+  ctx->nr = nk + 6;
+  uint8_t *w = (uint8_t *)ctx->rk;
+  memcpy(w, key, 4 * nk);
+  uint8_t rcon = 1;
+  for (int i = nk; i < 4 * (ctx->nr + 1); i++) {
+    uint8_t t[4];
+    memcpy(t, w + 4 * (i - 1), 4);
+    if (i % nk == 0) {
+      uint8_t x = t[0];
+      t[0] = aes_sbox[t[1]] ^ rcon;
+      t[1] = aes_sbox[t[2]];
+      t[2] = aes_sbox[t[3]];
+      t[3] = aes_sbox[x];
+      rcon = xtime(rcon);
+    } else if (nk > 6 && i % nk == 4) {
+      for (int j = 0; j < 4; j++) t[j] = aes_sbox[t[j]];
+    }
+    for (int j = 0; j < 4; j++) w[4 * i + j] = w[4 * (i - nk) + j] ^ t[j];
+  }
+  return 0;
+}
+
+int mbedtls_aes_crypt_ecb(mbedtls_aes_context *ctx, int, const unsigned char input[16], unsigned char output[16]) {
+  const uint8_t *rk = (const uint8_t *)ctx->rk;
+  uint8_t s[16];
+  for (int i = 0; i < 16; i++) s[i] = input[i] ^ rk[i];
+  for (int round = 1; round <= ctx->nr; round++) {
+    uint8_t t[16];
+    // SubBytes and ShiftRows, the state is column major
+    for (int c = 0; c < 4; c++) {
+      for (int r = 0; r < 4; r++) t[4 * c + r] = aes_sbox[s[4 * ((c + r) & 3) + r]];
+    }
+    if (round != ctx->nr) {
+      for (int c = 0; c < 4; c++) {
+        uint8_t *col = t + 4 * c;
+        uint8_t a0 = col[0], a1 = col[1], a2 = col[2], a3 = col[3], all = a0 ^ a1 ^ a2 ^ a3;
+        col[0] ^= all ^ xtime(a0 ^ a1);
+        col[1] ^= all ^ xtime(a1 ^ a2);
+        col[2] ^= all ^ xtime(a2 ^ a3);
+        col[3] ^= all ^ xtime(a3 ^ a0);
+      }
+    }
+    for (int i = 0; i < 16; i++) s[i] = t[i] ^ rk[16 * round + i];
+  }
+  memcpy(output, s, 16);
+  return 0;
+}
+
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context *ctx, size_t length, size_t *nc_off, unsigned char nonce_counter[16],
+                          unsigned char stream_block[16], const unsigned char *input, unsigned char *output) {
+  size_t n = *nc_off;
+  for (size_t i = 0; i < length; i++) {
+    if (n == 0) {
+      mbedtls_aes_crypt_ecb(ctx, MBEDTLS_AES_ENCRYPT, nonce_counter, stream_block);
+      for (int j = 16; j > 0; j--) {
+        if (++nonce_counter[j - 1] != 0) break;
+      }
+    }
+    output[i] = input[i] ^ stream_block[n];
+    n = (n + 1) & 15;
+  }
+  *nc_off = n;
+  return 0;
+}
@@ -0,0 +1,170 @@
+// In-memory filesystem of the host build
+#include "FS.h"
+#include "LittleFS.h"
+#include <set>
+
+fs::FS LittleFS;
+
+namespace fs {
+
+struct FileImpl {
+  std::string path;
+  std::shared_ptr<std::vector<uint8_t>> data;   // NULL for directories
+  size_t pos = 0;
+  bool writable = false;
+  std::vector<std::string> children;            // directories: full paths of the entries
+  size_t next = 0;
+  FS *fs = nullptr;
+};
+
+size_t File::write(const uint8_t *buf, size_t size) {
+  if (!_impl || !_impl->data || !_impl->writable) return 0;
+  std::vector<uint8_t>& d = *_impl->data;
+  if (_impl->pos + size > d.size()) d.resize(_impl->pos + size);
+  memcpy(d.data() + _impl->pos, buf, size);
+  _impl->pos += size;
+  return size;
+}
+
+int File::available() {
+  if (!_impl || !_impl->data) return 0;
+  return (int)(_impl->data->size() - _impl->pos);
+}
+
+int File::read() {
+  if (this->available() <= 0) return -1;
+  return (*_impl->data)[_impl->pos++];
+}
+
+int File::peek() {
+  if (this->available() <= 0) return -1;
+  return (*_impl->data)[_impl->pos];
+}
+
+size_t File::read(uint8_t *buf, size_t size) {
+  size_t n = (size_t)this->available();
+  if (n > size) n = size;
+  if (n) memcpy(buf, _impl->data->data() + _impl->pos, n);
+  if (_impl) _impl->pos += n;
+  return n;
+}
+
+bool File::seek(uint32_t pos) {
+  if (!_impl || !_impl->data || pos > _impl->data->size()) return false;
+  _impl->pos = pos;
+  return true;
+}
+
+size_t File::position() const { return _impl ? _impl->pos : 0; }
+size_t File::size() const { return _impl && _impl->data ? _impl->data->size() : 0; }
+void File::close() { _impl.reset(); }
+bool File::isDirectory() const { return _impl && !_impl->data; }
+
+File File::openNextFile(const char *mode) {
+  if (!_impl || _impl->data || _impl->next >= _impl->children.size()) return File();
+  return _impl->fs->open(_impl->children[_impl->next++].c_str(), mode);
+}
+
+const char *File::name() const {
+  if (!_impl) return "";
+  size_t slash = _impl->path.rfind('/');
+  return _impl->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+const char *File::path() const { return _impl ? _impl->path.c_str() : ""; }
+
+static std::string normalize(const char *path) {
+  std::string p = path ? path : "";
+  if (p.empty() || p[0] != '/') p = "/" + p;
+  while (p.size() > 1 && p.back() == '/') p.pop_back();
+  return p;
+}
+
+bool FS::isDir(const std::string& path) const {
+  if (path == "/") return true;
+  std::string prefix = path + "/";
+  for (const auto& f : _files) {
+    if (f.first.compare(0, prefix.size(), prefix) == 0) return true;
+  }
+  return false;
+}
+
+File FS::open(const char *path, const char *mode, bool) {
+  if (!_mounted) return File();
+  std::string p = normalize(path);
+  auto impl = std::make_shared<FileImpl>();
+  impl->path = p;
+  impl->fs = this;
+  auto it = _files.find(p);
+  if (mode[0] == 'r') {
+    if (it != _files.end()) {
+      impl->data = it->second;
+      return File(impl);
+    }
+    if (!this->isDir(p)) return File();
+    // immediate entries of the directory
+    std::set<std::string> children;
+    std::string prefix = p == "/" ? "/" : p + "/";
+    for (const auto& f : _files) {
+      if (f.first.compare(0, prefix.size(), prefix) != 0) continue;
+      size_t slash = f.first.find('/', prefix.size());
+      children.insert(slash == std::string::npos ? f.first : f.first.substr(0, slash));
+    }
+    impl->children.assign(children.begin(), children.end());
+    return File(impl);
+  }
+  if (this->isDir(p)) return File();
+  if (it == _files.end() || mode[0] == 'w') {
+    auto data = std::make_shared<std::vector<uint8_t>>();
+    _files[p] = data;
+    impl->data = data;
+  } else {
+    impl->data = it->second;
+    impl->pos = impl->data->size();
+  }
+  impl->writable = true;
+  return File(impl);
+}
+
+Dir FS::openDir(const char *path) {
+  std::vector<std::string> names;
+  std::vector<bool> dirs;
+  std::vector<size_t> sizes;
+  File dir = this->open(path, "r");
+  if (dir && dir.isDirectory()) {
+    File entry;
+    while ((entry = dir.openNextFile())) {
+      names.push_back(entry.name());
+      dirs.push_back(entry.isDirectory());
+      sizes.push_back(entry.size());
+    }
+  }
+  return Dir(names, dirs, sizes);
+}
+
+bool FS::exists(const char *path) {
+  std::string p = normalize(path);
+  return _mounted && (_files.count(p) || this->isDir(p));
+}
+
+bool FS::remove(const char *path) { return _mounted && _files.erase(normalize(path)) > 0; }
+
+bool FS::rename(const char *from, const char *to) {
+  auto it = _files.find(normalize(from));
+  if (!_mounted || it == _files.end()) return false;
+  auto data = it->second;
+  _files.erase(it);
+  _files[normalize(to)] = data;
+  return true;
+}
+
+void FS::hostWrite(const char *path, const std::string& content) {
+  _files[normalize(path)] = std::make_shared<std::vector<uint8_t>>(content.begin(), content.end());
+}
+
+std::string FS::hostRead(const char *path) const {
+  auto it = _files.find(normalize(path));
+  return it == _files.end() ? std::string() : std::string(it->second->begin(), it->second->end());
+}
+
+}  // namespace fs
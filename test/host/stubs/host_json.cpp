@@ -0,0 +1,252 @@
+// Serializer and parser of the host ArduinoJson
+#include "ArduinoJson.h"
+
+namespace ArduinoJson {
+
+static void writeString(std::string& out, const std::string& s) {
+  out += '"';
+  for (char c : s) {
+    switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\r': out += "\\r"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if ((unsigned char)c < 0x20) {
+          char buf[8];
+          snprintf(buf, sizeof(buf), "\\u%04x", c);
+          out += buf;
+        } else {
+          out += c;
+        }
+    }
+  }
+  out += '"';
+}
+
+static void writeNode(std::string& out, const JsonNodePtr& n) {
+  if (!n) {
+    out += "null";
+    return;
+  }
+  switch (n->type) {
+    case JsonNode::NUL: out += "null"; break;
+    case JsonNode::BOOL: out += n->b ? "true" : "false"; break;
+    case JsonNode::INT: out += std::to_string(n->i); break;
+    case JsonNode::FLOAT: {
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%.9g", n->f);
+      out += buf;
+      break;
+    }
+    case JsonNode::STRING: writeString(out, n->s); break;
+    case JsonNode::ARRAY:
+      out += '[';
+      for (size_t i = 0; i < n->items.size(); i++) {
+        if (i) out += ',';
+        writeNode(out, n->items[i]);
+      }
+      out += ']';
+      break;
+    case JsonNode::OBJECT:
+      out += '{';
+      for (size_t i = 0; i < n->members.size(); i++) {
+        if (i) out += ',';
+        writeString(out, n->members[i].first);
+        out += ':';
+        writeNode(out, n->members[i].second);
+      }
+      out += '}';
+      break;
+  }
+}
+
+static std::string toJson(const JsonVariant& value) {
+  std::string out;
+  writeNode(out, value.node());
+  return out;
+}
+
+size_t serializeJson(const JsonVariant& value, Print& out) {
+  std::string s = toJson(value);
+  return out.write((const uint8_t *)s.data(), s.size());
+}
+
+size_t serializeJson(const JsonVariant& value, String& out) {
+  std::string s = toJson(value);
+  out = String(s);
+  return s.size();
+}
+
+size_t serializeJson(const JsonVariant& value, char *out, size_t size) {
+  std::string s = toJson(value);
+  if (size == 0) return 0;
+  size_t n = s.size() < size - 1 ? s.size() : size - 1;
+  memcpy(out, s.data(), n);
+  out[n] = 0;
+  return n;
+}
+
+size_t measureJson(const JsonVariant& value) { return toJson(value).size(); }
+
+namespace {
+
+struct Parser {
+  const char *p;
+  const char *end;
+  int depth = 0;
+
+  void ws() {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++;
+  }
+
+  DeserializationError::Code string(std::string& out) {
+    p++;
+    while (p < end && *p != '"') {
+      if (*p == '\\') {
+        if (++p >= end) return DeserializationError::IncompleteInput;
+        switch (*p) {
+          case 'n': out += '\n'; break;
+          case 'r': out += '\r'; break;
+          case 't': out += '\t'; break;
+          case 'b': out += '\b'; break;
+          case 'f': out += '\f'; break;
+          case 'u': {
+            if (end - p < 5) return DeserializationError::IncompleteInput;
+            unsigned cp = (unsigned)strtoul(std::string(p + 1, 4).c_str(), NULL, 16);
+            if (cp < 0x80) {
+              out += (char)cp;
+            } else if (cp < 0x800) {
+              out += (char)(0xC0 | (cp >> 6));
+              out += (char)(0x80 | (cp & 0x3F));
+            } else {
+              out += (char)(0xE0 | (cp >> 12));
+              out += (char)(0x80 | ((cp >> 6) & 0x3F));
+              out += (char)(0x80 | (cp & 0x3F));
+            }
+            p += 4;
+            break;
+          }
+          default: out += *p;
+        }
+        p++;
+      } else {
+        out += *p++;
+      }
+    }
+    if (p >= end) return DeserializationError::IncompleteInput;
+    p++;
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code value(JsonNode& n) {
+    ws();
+    if (p >= end) return DeserializationError::IncompleteInput;
+    if (++depth > 10) return DeserializationError::NoMemory;
+    DeserializationError::Code rc = DeserializationError::Ok;
+    if (*p == '{') {
+      n.reset(JsonNode::OBJECT);
+      p++;
+      ws();
+      if (p < end && *p == '}') {
+        p++;
+      } else {
+        while (rc == DeserializationError::Ok) {
+          ws();
+          if (p >= end) return DeserializationError::IncompleteInput;
+          if (*p != '"') return DeserializationError::InvalidInput;
+          std::string key;
+          if ((rc = this->string(key)) != DeserializationError::Ok) return rc;
+          ws();
+          if (p >= end) return DeserializationError::IncompleteInput;
+          if (*p++ != ':') return DeserializationError::InvalidInput;
+          JsonNodePtr child = std::make_shared<JsonNode>();
+          if ((rc = this->value(*child)) != DeserializationError::Ok) return rc;
+          n.members.emplace_back(key, child);
+          ws();
+          if (p >= end) return DeserializationError::IncompleteInput;
+          if (*p == ',') { p++; continue; }
+          if (*p++ != '}') return DeserializationError::InvalidInput;
+          break;
+        }
+      }
+    } else if (*p == '[') {
+      n.reset(JsonNode::ARRAY);
+      p++;
+      ws();
+      if (p < end && *p == ']') {
+        p++;
+      } else {
+        while (rc == DeserializationError::Ok) {
+          JsonNodePtr child = std::make_shared<JsonNode>();
+          if ((rc = this->value(*child)) != DeserializationError::Ok) return rc;
+          n.items.push_back(child);
+          ws();
+          if (p >= end) return DeserializationError::IncompleteInput;
+          if (*p == ',') { p++; continue; }
+          if (*p++ != ']') return DeserializationError::InvalidInput;
+          break;
+        }
+      }
+    } else if (*p == '"') {
+      n.reset(JsonNode::STRING);
+      rc = this->string(n.s);
+    } else if (end - p >= 4 && !strncmp(p, "true", 4)) {
+      n.reset(JsonNode::BOOL);
+      n.b = true;
+      p += 4;
+    } else if (end - p >= 5 && !strncmp(p, "false", 5)) {
+      n.reset(JsonNode::BOOL);
+      p += 5;
+    } else if (end - p >= 4 && !strncmp(p, "null", 4)) {
+      n.reset(JsonNode::NUL);
+      p += 4;
+    } else if (*p == '-' || (*p >= '0' && *p <= '9')) {
+      const char *start = p;
+      bool real = false;
+      while (p < end && strchr("+-0123456789.eE", *p)) {
+        if (*p == '.' || *p == 'e' || *p == 'E') real = true;
+        p++;
+      }
+      std::string num(start, p);
+      if (real) {
+        n.reset(JsonNode::FLOAT);
+        n.f = strtod(num.c_str(), NULL);
+      } else {
+        n.reset(JsonNode::INT);
+        n.i = strtoll(num.c_str(), NULL, 10);
+      }
+    } else {
+      return DeserializationError::InvalidInput;
+    }
+    depth--;
+    return rc;
+  }
+};
+
+}  // namespace
+
+DeserializationError deserializeJson(JsonDocument& doc, const char *input, size_t len) {
+  doc.clear();
+  if (input == NULL || len == 0) return DeserializationError::EmptyInput;
+  Parser parser{input, input + len};
+  parser.ws();
+  if (parser.p >= parser.end) return DeserializationError::EmptyInput;
+  DeserializationError::Code rc = parser.value(*doc.node());
+  if (rc != DeserializationError::Ok) doc.clear();
+  return rc;
+}
+
+DeserializationError deserializeJson(JsonDocument& doc, const char *input) { return deserializeJson(doc, input, input ? strlen(input) : 0); }
+DeserializationError deserializeJson(JsonDocument& doc, const uint8_t *input, size_t len) { return deserializeJson(doc, (const char *)input, len); }
+DeserializationError deserializeJson(JsonDocument& doc, const String& input) { return deserializeJson(doc, input.c_str(), input.length()); }
+
+DeserializationError deserializeJson(JsonDocument& doc, Stream& input) {
+  std::string s;
+  int c;
+  while ((c = input.read()) >= 0) s += (char)c;
+  return deserializeJson(doc, s.data(), s.size());
+}
+
+}  // namespace ArduinoJson
@@ -0,0 +1,499 @@
+// Runtime of the host build: Arduino core, heap accounting, Update, flash and network fakes
+#include "host.h"
+#include "Arduino.h"
+#include "Update.h"
+#include "WiFi.h"
+#include "WiFiUdp.h"
+#include "ESPmDNS.h"
+#include "mdns.h"
+#include "esp_ota_ops.h"
+#include "esp_wifi.h"
+#include "esp_pm.h"
+#include <malloc.h>
+#include <new>
+
+// ---- heap accounting, the binary is linked with --wrap=malloc,free,calloc,realloc ----
+
+extern "C" void *__real_malloc(size_t size);
+extern "C" void __real_free(void *ptr);
+extern "C" void *__real_calloc(size_t n, size_t size);
+extern "C" void *__real_realloc(void *ptr, size_t size);
+
+static host::AllocStats alloc_stats;
+static size_t heap_size = 320 * 1024;
+static size_t heap_base = 0;     // live bytes of the test process itself, see resetDevice()
+
+static void countAlloc(void *ptr) {
+  if (ptr == NULL) return;
+  alloc_stats.allocs++;
+  alloc_stats.live += malloc_usable_size(ptr);
+  if (alloc_stats.live > alloc_stats.peak) alloc_stats.peak = alloc_stats.live;
+}
+
+static void countFree(void *ptr) {
+  if (ptr == NULL) return;
+  size_t n = malloc_usable_size(ptr);
+  alloc_stats.frees++;
+  alloc_stats.live = alloc_stats.live > n ? alloc_stats.live - n : 0;
+}
+
+extern "C" void *__wrap_malloc(size_t size) {
+  void *ptr = __real_malloc(size);
+  countAlloc(ptr);
+  return ptr;
+}
+
+extern "C" void *__wrap_calloc(size_t n, size_t size) {
+  void *ptr = __real_calloc(n, size);
+  countAlloc(ptr);
+  return ptr;
+}
+
+extern "C" void *__wrap_realloc(void *ptr, size_t size) {
+  countFree(ptr);
+  void *moved = __real_realloc(ptr, size);
+  countAlloc(moved);
+  return moved;
+}
+
+extern "C" void __wrap_free(void *ptr) {
+  countFree(ptr);
+  __real_free(ptr);
+}
+
+void *operator new(size_t size) {
+  void *ptr = __wrap_malloc(size ? size : 1);
+  if (ptr == NULL) throw std::bad_alloc();
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void *operator new(size_t size, const std::nothrow_t&) noexcept { return __wrap_malloc(size ? size : 1); }
+void *operator new[](size_t size, const std::nothrow_t&) noexcept { return __wrap_malloc(size ? size : 1); }
+void operator delete(void *ptr) noexcept { __wrap_free(ptr); }
+void operator delete[](void *ptr) noexcept { __wrap_free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { __wrap_free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { __wrap_free(ptr); }
+
+namespace host {
+
+void resetAllocStats() {
+  size_t live = alloc_stats.live;
+  alloc_stats = AllocStats();
+  alloc_stats.live = live;
+  alloc_stats.peak = live;
+}
+
+AllocStats allocStats() { return alloc_stats; }
+void setHeapSize(size_t bytes) { heap_size = bytes; }
+
+}  // namespace host
+
+// ---- time and Serial ----
+
+static unsigned long now_ms = 0;
+static unsigned long micros_extra = 0;
+static std::string serial_log;
+
+namespace host {
+
+void advance(unsigned long ms) { now_ms += ms; }
+void setMillis(unsigned long ms) { now_ms = ms; }
+std::string log() { return serial_log; }
+void clearLog() { serial_log.clear(); }
+bool logContains(const char *text) { return serial_log.find(text) != std::string::npos; }
+
+}  // namespace host
+
+unsigned long millis() { return now_ms; }
+unsigned long micros() { return now_ms * 1000 + (micros_extra++ % 1000); }
+void delay(unsigned long ms) { now_ms += ms; }
+void yield() {}
+long random(long max) { return max > 0 ? rand() % max : 0; }
+long random(long min, long max) { return max > min ? min + rand() % (max - min) : min; }
+
+size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return len;
+}
+
+size_t Print::printf(const char *format, ...) {
+  char buf[512];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (n < 0) return 0;
+  return this->write((const uint8_t *)buf, (size_t)n < sizeof(buf) ? n : sizeof(buf) - 1);
+}
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::write(uint8_t c) {
+  // the log is capped and its buffer reserved once, it must not show up as device heap
+  static const size_t cap = 1 << 18;
+  if (serial_log.capacity() < cap) serial_log.reserve(cap);
+  if (serial_log.size() + 1 >= cap) serial_log.erase(0, cap / 2);
+  serial_log += (char)c;
+  static const bool verbose = getenv("ELEGANTOTA_HOST_VERBOSE") != NULL;
+  if (verbose) fputc(c, stderr);
+  return 1;
+}
+
+// ---- flash and partitions ----
+
+static std::vector<uint8_t> running_image;
+static std::vector<uint8_t> update_partition;
+static std::vector<uint8_t> fs_partition;
+static bool boot_switched = false;
+static bool restart_called = false;
+static esp_partition_t running_part = {0x10000, 1310720, "app0", 0, 0x10};
+static esp_partition_t update_part = {0x150000, 1310720, "app1", 0, 0x11};
+
+static std::vector<uint8_t>& partitionData(const esp_partition_t *partition) {
+  return partition == &running_part ? running_image : update_partition;
+}
+
+namespace host {
+
+std::vector<uint8_t>& runningImage() { return running_image; }
+std::vector<uint8_t>& updatePartition() { return update_partition; }
+std::vector<uint8_t>& fsPartition() { return fs_partition; }
+bool bootSwitched() { return boot_switched; }
+
+void resetFlash(size_t partitionSize) {
+  running_part.size = update_part.size = partitionSize;
+  update_partition.assign(partitionSize, 0xFF);
+  fs_partition.assign(partitionSize, 0xFF);
+  if (running_image.empty()) {
+    // a valid image header, the content does not matter
+    running_image.assign(4096, 0);
+    running_image[0] = 0xE9;
+    for (size_t i = 64; i < running_image.size(); i++) running_image[i] = (uint8_t)(i * 7);
+  }
+  boot_switched = false;
+}
+
+bool restarted() { return restart_called; }
+
+void resetDevice() {
+  heap_base = alloc_stats.live;
+  restart_called = false;
+  boot_switched = false;
+}
+
+}  // namespace host
+
+const esp_partition_t *esp_ota_get_running_partition() { return &running_part; }
+const esp_partition_t *esp_ota_get_next_update_partition(const esp_partition_t *) { return &update_part; }
+const esp_partition_t *esp_ota_get_boot_partition() { return boot_switched ? &update_part : &running_part; }
+
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition) {
+  if (partition != &update_part || update_partition.empty() || update_partition[0] != 0xE9) return ESP_FAIL;
+  boot_switched = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t offset, void *dst, size_t size) {
+  std::vector<uint8_t>& data = partitionData(partition);
+  if (offset + size > data.size()) {
+    // the running image is shorter than its partition, the rest reads as erased
+    if (partition != &running_part || offset + size > partition->size) return ESP_FAIL;
+    memset(dst, 0xFF, size);
+    if (offset < data.size()) memcpy(dst, data.data() + offset, data.size() - offset);
+    return ESP_OK;
+  }
+  memcpy(dst, data.data() + offset, size);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t offset, const void *src, size_t size) {
+  std::vector<uint8_t>& data = partitionData(partition);
+  if (offset + size > data.size()) return ESP_FAIL;
+  const uint8_t *bytes = (const uint8_t *)src;
+  // NOR flash only clears bits
+  for (size_t i = 0; i < size; i++) data[offset + i] &= bytes[i];
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size) {
+  std::vector<uint8_t>& data = partitionData(partition);
+  if (offset % 4096 || size % 4096 || offset + size > data.size()) return ESP_FAIL;
+  memset(data.data() + offset, 0xFF, size);
+  return ESP_OK;
+}
+
+// ---- ESP ----
+
+EspClass ESP;
+
+void EspClass::restart() { restart_called = true; }
+uint32_t EspClass::getFreeHeap() {
+  size_t used = alloc_stats.live > heap_base ? alloc_stats.live - heap_base : 0;
+  return heap_size > used ? heap_size - used : 0;
+}
+uint32_t EspClass::getMaxAllocHeap() { return this->getFreeHeap() * 3 / 4; }
+uint32_t EspClass::getMaxFreeBlockSize() { return this->getMaxAllocHeap(); }
+uint32_t EspClass::getMinFreeHeap() { return this->getFreeHeap(); }
+uint32_t EspClass::getFreePsram() { return 0; }
+uint32_t EspClass::getFreeSketchSpace() { return update_part.size; }
+uint32_t EspClass::getSketchSize() { return running_image.size(); }
+
+String EspClass::getSketchMD5() {
+  MD5Builder md5;
+  md5.begin();
+  md5.add(running_image.data(), running_image.size());
+  md5.calculate();
+  return md5.toString();
+}
+
+bool EspClass::flashRead(uint32_t address, uint32_t *data, size_t size) { return this->flashRead(address, (uint8_t *)data, size); }
+
+bool EspClass::flashRead(uint32_t address, uint8_t *data, size_t size) {
+  return esp_partition_read(&running_part, address, data, size) == ESP_OK;
+}
+
+bool EspClass::flashEraseSector(uint32_t sector) {
+  return esp_partition_erase_range(&update_part, sector * 4096, 4096) == ESP_OK;
+}
+
+bool EspClass::flashWrite(uint32_t address, const uint32_t *data, size_t size) {
+  return esp_partition_write(&update_part, address, data, size) == ESP_OK;
+}
+
+static uint32_t cpu_mhz = 160;
+uint32_t EspClass::getCpuFreqMHz() { return cpu_mhz; }
+uint32_t EspClass::getFreeContStack() { return 4096; }
+uint32_t EspClass::random() { return (uint32_t)rand() << 16 ^ (uint32_t)rand(); }
+
+uint32_t esp_random() { return ESP.random(); }
+unsigned uxTaskGetStackHighWaterMark(TaskHandle_t) { return 4096; }
+bool psramFound() { return false; }
+
+uint32_t getCpuFrequencyMhz() { return cpu_mhz; }
+bool setCpuFrequencyMhz(uint32_t mhz) { cpu_mhz = mhz; return true; }
+
+// ---- Update ----
+
+UpdateClass Update;
+
+bool UpdateClass::begin(size_t size, int command, int, uint8_t, const char *label) {
+  if (_size > 0) return false;
+  _target_md5.clear();
+  _error = UPDATE_ERROR_OK;
+  _progress = 0;
+  _committed = false;
+  _command = command;
+  _label = label != NULL ? label : "";
+  std::vector<uint8_t>& target = command == U_FLASH ? update_partition : fs_partition;
+  if (target.empty()) host::resetFlash();
+  if (size == UPDATE_SIZE_UNKNOWN) size = target.size();
+  if (size == 0) {
+    _error = UPDATE_ERROR_SIZE;
+    return false;
+  }
+  if (size > target.size()) {
+    _error = UPDATE_ERROR_SIZE;
+    return false;
+  }
+  _size = size;
+  _md5.begin();
+  _begin_count++;
+  return true;
+}
+
+size_t UpdateClass::write(uint8_t *data, size_t len) {
+  if (this->hasError() || !this->isRunning()) return 0;
+  if (len > this->remaining()) {
+    _error = UPDATE_ERROR_SPACE;
+    return 0;
+  }
+  if (_command == U_FLASH && _progress == 0 && len && data[0] != 0xE9) {
+    _error = UPDATE_ERROR_MAGIC_BYTE;
+    return 0;
+  }
+  std::vector<uint8_t>& target = _command == U_FLASH ? update_partition : fs_partition;
+  memcpy(target.data() + _progress, data, len);
+  _md5.add(data, len);
+  _progress += len;
+  return len;
+}
+
+bool UpdateClass::setMD5(const char *expected_md5) {
+  if (expected_md5 == NULL || strlen(expected_md5) != 32) return false;
+  _target_md5 = expected_md5;
+  for (char& c : _target_md5) c = (char)tolower((unsigned char)c);
+  return true;
+}
+
+bool UpdateClass::end(bool evenIfRemaining) {
+  if (this->hasError() || _size == 0) return false;
+  if (!this->isFinished() && !evenIfRemaining) {
+    _error = UPDATE_ERROR_ABORT;
+    _size = 0;
+    return false;
+  }
+  _end_count++;
+  if (evenIfRemaining) _size = _progress;
+  _md5.calculate();
+  if (!_target_md5.empty() && _target_md5 != _md5.toString().c_str()) {
+    _error = UPDATE_ERROR_MD5;
+    _size = 0;
+    return false;
+  }
+  if (_command == U_FLASH && esp_ota_set_boot_partition(&update_part) != ESP_OK) {
+    _error = UPDATE_ERROR_ACTIVATE;
+    _size = 0;
+    return false;
+  }
+  _size = 0;
+  _committed = true;
+  return true;
+}
+
+void UpdateClass::abort() {
+  _abort_count++;
+  _size = 0;
+  _progress = 0;
+  _error = UPDATE_ERROR_ABORT;
+}
+
+const char *UpdateClass::errorString() {
+  static const char *names[] = {"No Error", "Flash Write Failed", "Flash Erase Failed", "Flash Read Failed", "Not Enough Space",
+                                "Bad Size Given", "Stream Read Timeout", "MD5 Check Failed", "Wrong Magic Byte",
+                                "Could Not Activate The Firmware", "Partition Could Not be Found", "Bad Argument", "Aborted"};
+  return _error < sizeof(names) / sizeof(names[0]) ? names[_error] : "UNKNOWN";
+}
+
+void UpdateClass::printError(Print& out) { out.println(this->errorString()); }
+
+// ---- WiFi, power management ----
+
+WiFiClass WiFi;
+static wifi_ps_type_t wifi_ps = WIFI_PS_MIN_MODEM;
+
+esp_err_t esp_wifi_get_ps(wifi_ps_type_t *type) { *type = wifi_ps; return ESP_OK; }
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type) { wifi_ps = type; return ESP_OK; }
+
+struct esp_pm_lock { int held; };
+esp_err_t esp_pm_lock_create(esp_pm_lock_type_t, int, const char *, esp_pm_lock_handle_t *handle) {
+  static esp_pm_lock locks[8];
+  static size_t used = 0;
+  if (used == 8) return -1;
+  *handle = &locks[used++];
+  return ESP_OK;
+}
+esp_err_t esp_pm_lock_acquire(esp_pm_lock_handle_t handle) { handle->held++; return ESP_OK; }
+esp_err_t esp_pm_lock_release(esp_pm_lock_handle_t handle) { handle->held--; return ESP_OK; }
+
+// ---- UDP ----
+
+namespace host {
+std::deque<std::string> udpPackets;
+}
+
+uint8_t WiFiUDP::beginMulticast(IPAddress group, uint16_t port) {
+  _joined = true;
+  _group = group;
+  _port = port;
+  return 1;
+}
+
+int WiFiUDP::parsePacket() {
+  if (!_joined || host::udpPackets.empty()) return 0;
+  _packet = host::udpPackets.front();
+  host::udpPackets.pop_front();
+  _pos = 0;
+  return (int)_packet.size();
+}
+
+int WiFiUDP::read(uint8_t *buf, size_t len) {
+  size_t n = _packet.size() - _pos < len ? _packet.size() - _pos : len;
+  memcpy(buf, _packet.data() + _pos, n);
+  _pos += n;
+  return (int)n;
+}
+
+// ---- mDNS ----
+
+namespace host {
+std::vector<MdnsService> mdnsServices;
+std::map<std::string, std::string> mdnsTxt;
+}
+
+MDNSResponder MDNS;
+
+bool MDNSResponder::begin(const char *) { return true; }
+bool MDNSResponder::addService(const char *, const char *, uint16_t) { return true; }
+
+bool MDNSResponder::addServiceTxt(const char *, const char *, const char *key, const char *value) {
+  host::mdnsTxt[key] = value;
+  return true;
+}
+
+// ---- asynchronous mDNS query ----
+
+struct mdns_search_once_s {
+  unsigned long started;
+  uint32_t timeout;
+  size_t max_results;
+};
+
+namespace host {
+int mdnsQueries = 0;
+}
+
+mdns_search_once_t *mdns_query_async_new(const char *, const char *, const char *, uint16_t, uint32_t timeout, size_t max_results, mdns_query_notify_t) {
+  host::mdnsQueries++;
+  return new mdns_search_once_t{millis(), timeout, max_results};
+}
+
+bool mdns_query_async_get_results(mdns_search_once_t *search, uint32_t, mdns_result_t **results, uint8_t *num_results) {
+  if (millis() - search->started < search->timeout) return false;
+  // built from the back, the list keeps the order of host::mdnsServices
+  mdns_result_t *list = NULL;
+  size_t count = host::mdnsServices.size() < search->max_results ? host::mdnsServices.size() : search->max_results;
+  for (size_t i = count; i-- > 0;) {
+    const host::MdnsService& service = host::mdnsServices[i];
+    mdns_result_t *r = new mdns_result_t();
+    r->hostname = strdup(service.host.c_str());
+    r->port = service.port;
+    r->addr = new mdns_ip_addr_t();
+    r->addr->addr.type = ESP_IPADDR_TYPE_V4;
+    r->addr->addr.u_addr.ip4.addr = (uint32_t)service.ip;
+    r->txt_count = service.txt.size();
+    r->txt = new mdns_txt_item_t[r->txt_count];
+    size_t t = 0;
+    for (const auto& kv : service.txt) r->txt[t++] = {strdup(kv.first.c_str()), strdup(kv.second.c_str())};
+    r->next = list;
+    list = r;
+  }
+  *results = list;
+  if (num_results != NULL) *num_results = (uint8_t)count;
+  return true;
+}
+
+esp_err_t mdns_query_async_delete(mdns_search_once_t *search) {
+  host::mdnsQueries--;
+  delete search;
+  return 0;
+}
+
+void mdns_query_results_free(mdns_result_t *results) {
+  while (results != NULL) {
+    mdns_result_t *next = results->next;
+    for (size_t t = 0; t < results->txt_count; t++) {
+      free((void *)results->txt[t].key);
+      free((void *)results->txt[t].value);
+    }
+    delete[] results->txt;
+    delete results->addr;
+    free(results->hostname);
+    delete results;
+    results = next;
+  }
+}
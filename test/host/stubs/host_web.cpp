@@ -0,0 +1,290 @@
+// AsyncTCP and ESPAsyncWebServer of the host build
+#include "host.h"
+#include "ESPAsyncWebServer.h"
+#include <algorithm>
+
+namespace host {
+std::vector<AsyncClient *> connects;
+std::vector<AsyncServer *> listeners;
+}
+
+// ---- AsyncServer ----
+
+void AsyncServer::begin() {
+  if (!_listening) host::listeners.push_back(this);
+  _listening = true;
+}
+
+void AsyncServer::end() {
+  if (_listening) host::listeners.erase(std::find(host::listeners.begin(), host::listeners.end(), this));
+  _listening = false;
+}
+
+// ---- AsyncClient ----
+
+bool AsyncClient::connect(IPAddress ip, uint16_t port) {
+  _remote = ip;
+  _remote_port = port;
+  _connecting = true;
+  host::connects.push_back(this);
+  return true;
+}
+
+bool AsyncClient::connect(const char *host, uint16_t port) {
+  _host = host;
+  _remote_port = port;
+  _connecting = true;
+  host::connects.push_back(this);
+  return true;
+}
+
+void AsyncClient::close(bool) {
+  _closed = true;
+  if (!_connected && !_connecting) return;
+  _connected = false;
+  _connecting = false;
+  // like AsyncTCP the disconnect callback runs, it may delete the client
+  if (_disconnect_cb) _disconnect_cb(_disconnect_arg, this);
+}
+
+size_t AsyncClient::add(const char *data, size_t size, uint8_t) {
+  if (!_connected) return 0;
+  size_t n = size < this->space() ? size : this->space();
+  _sent.append(data, n);
+  _queued += n;
+  _pending += n;
+  return n;
+}
+
+bool AsyncClient::send() {
+  _pending = 0;
+  return _connected;
+}
+
+size_t AsyncClient::ack(size_t len) {
+  if (len > _unacked) len = _unacked;
+  _unacked -= len;
+  return len;
+}
+
+void AsyncClient::hostReceive(const void *data, size_t len) {
+  _ack_later = false;
+  _unacked += len;
+  if (_data_cb) _data_cb(_data_arg, this, (void *)data, len);
+  if (!_ack_later) this->ack(len);
+}
+
+void AsyncClient::hostConnected(bool ok) {
+  _connecting = false;
+  if (ok) {
+    _connected = true;
+    if (_connect_cb) _connect_cb(_connect_arg, this);
+    return;
+  }
+  if (_error_cb) _error_cb(_error_arg, this, -14);
+  if (_disconnect_cb) _disconnect_cb(_disconnect_arg, this);
+}
+
+void AsyncClient::hostAck(size_t len) {
+  if (len > _queued) len = _queued;
+  _queued -= len;
+  if (_ack_cb) _ack_cb(_ack_arg, this, len, 0);
+}
+
+void AsyncClient::hostDisconnect() {
+  if (!_connected && !_connecting) return;
+  _connected = false;
+  _connecting = false;
+  if (_disconnect_cb) _disconnect_cb(_disconnect_arg, this);
+}
+
+// ---- responses ----
+
+void AsyncWebServerResponse::_respond(AsyncWebServerRequest *) { _state_done = true; }
+
+size_t AsyncWebServerResponse::_ack(AsyncWebServerRequest *, size_t len, uint32_t) { return len; }
+
+const char *AsyncWebServerResponse::hostHeader(const char *name) const {
+  for (const AsyncWebHeader& header : _headers) {
+    if (strcasecmp(header.name().c_str(), name) == 0) return header.value().c_str();
+  }
+  return NULL;
+}
+
+std::string AsyncCallbackResponse::hostBody() {
+  std::string body;
+  uint8_t buf[1460];
+  while (true) {
+    size_t n = _callback(buf, sizeof(buf), body.size());
+    if (n == 0 || n == RESPONSE_TRY_AGAIN) break;
+    body.append((const char *)buf, n);
+    if (_len != (size_t)-1 && body.size() >= _len) break;
+  }
+  return body;
+}
+
+// ---- handlers and server ----
+
+bool AsyncCallbackWebHandler::canHandle(WebRequestMethodComposite method, const String& url) const {
+  if (!(_method & method)) return false;
+  return _uri == url || url.startsWith((_uri + "/").c_str());
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                            ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody) {
+  AsyncCallbackWebHandler *handler = new AsyncCallbackWebHandler();
+  handler->_uri = uri;
+  handler->_method = method;
+  handler->_onRequest = onRequest;
+  handler->_onUpload = onUpload;
+  handler->_onBody = onBody;
+  _handlers.push_back(handler);
+  return *handler;
+}
+
+AsyncCallbackWebHandler *AsyncWebServer::hostFind(WebRequestMethodComposite method, const String& url) {
+  for (AsyncCallbackWebHandler *handler : _handlers) {
+    if (handler->canHandle(method, url)) return handler;
+  }
+  return NULL;
+}
+
+AsyncWebServer::~AsyncWebServer() {
+  for (AsyncCallbackWebHandler *handler : _handlers) delete handler;
+}
+
+// ---- requests ----
+
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static std::string urlDecode(const std::string& s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (s[i] == '%' && i + 2 < s.size() && hexValue(s[i + 1]) >= 0 && hexValue(s[i + 2]) >= 0) {
+      out += (char)(hexValue(s[i + 1]) * 16 + hexValue(s[i + 2]));
+      i += 2;
+    } else {
+      out += s[i] == '+' ? ' ' : s[i];
+    }
+  }
+  return out;
+}
+
+AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer& server, WebRequestMethodComposite method, const char *url, AsyncClient *client)
+  : _client(client != NULL ? client : &_own_client) {
+  _own_client._connected = true;
+  _own_client._remote = IPAddress(192, 168, 4, 10);
+  std::string full = url;
+  size_t q = full.find('?');
+  std::string path = full.substr(0, q);
+  if (q != std::string::npos) {
+    std::string query = full.substr(q + 1);
+    size_t start = 0;
+    while (start <= query.size()) {
+      size_t amp = query.find('&', start);
+      std::string pair = query.substr(start, amp == std::string::npos ? std::string::npos : amp - start);
+      if (!pair.empty()) {
+        size_t eq = pair.find('=');
+        std::string name = urlDecode(pair.substr(0, eq));
+        std::string value = eq == std::string::npos ? "" : urlDecode(pair.substr(eq + 1));
+        _params.emplace_back(String(name), String(value));
+      }
+      if (amp == std::string::npos) break;
+      start = amp + 1;
+    }
+  }
+  _handler = server.hostFind(method, String(path));
+}
+
+AsyncWebServerRequest::~AsyncWebServerRequest() {
+  this->hostDisconnect();
+  delete _response;
+  free(_tempObject);
+}
+
+bool AsyncWebServerRequest::authenticate(const char *username, const char *password, const char *, bool) const {
+  return _user != NULL && _pass != NULL && strcmp(_user, username) == 0 && strcmp(_pass, password) == 0;
+}
+
+void AsyncWebServerRequest::requestAuthentication(const char *, bool) {
+  AsyncWebServerResponse *response = this->beginResponse(401);
+  response->addHeader("WWW-Authenticate", "Digest");
+  this->send(response);
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse *response) {
+  if (_response != NULL) {
+    _ignored_sends++;
+    delete response;
+    return;
+  }
+  _response = response;
+  _response->_respond(this);
+}
+
+const AsyncWebParameter *AsyncWebServerRequest::getParam(const char *name, bool, bool) const {
+  for (const AsyncWebParameter& param : _params) {
+    if (param.name() == name) return &param;
+  }
+  return NULL;
+}
+
+const AsyncWebHeader *AsyncWebServerRequest::getHeader(const char *name) const {
+  for (const AsyncWebHeader& header : _request_headers) {
+    if (strcasecmp(header.name().c_str(), name) == 0) return &header;
+  }
+  return NULL;
+}
+
+const String& AsyncWebServerRequest::header(const char *name) const {
+  static const String empty;
+  const AsyncWebHeader *h = this->getHeader(name);
+  return h != NULL ? h->value() : empty;
+}
+
+void AsyncWebServerRequest::hostUpload(const char *filename, const uint8_t *data, size_t len, bool final) {
+  if (_handler == NULL || !_handler->_onUpload) return;
+  std::vector<uint8_t> copy(data, data + len);
+  String name(filename);
+  size_t allocs = host::allocStats().allocs;
+  _handler->_onUpload(this, name, _upload_index, copy.data(), len, final);
+  _upload_allocs += host::allocStats().allocs - allocs;
+  _upload_index += len;
+}
+
+void AsyncWebServerRequest::hostBody(const uint8_t *data, size_t len, size_t part) {
+  _content_length = len;
+  if (_handler == NULL || !_handler->_onBody) return;
+  for (size_t index = 0; index < len; index += part) {
+    size_t n = len - index < part ? len - index : part;
+    std::vector<uint8_t> copy(data + index, data + index + n);
+    _handler->_onBody(this, copy.data(), n, index, len);
+  }
+}
+
+int AsyncWebServerRequest::hostEnd() {
+  if (_response == NULL) {
+    if (_handler != NULL && _handler->_onRequest) {
+      _handler->_onRequest(this);
+    } else {
+      this->send(404);
+    }
+  }
+  return this->code();
+}
+
+void AsyncWebServerRequest::hostAck(size_t len) {
+  _client->hostAck(len);
+  if (_response != NULL) _response->_ack(this, len, 0);
+}
+
+void AsyncWebServerRequest::hostDisconnect() {
+  if (_disconnected) return;
+  _disconnected = true;
+  for (auto& cb : _disconnect_cbs) cb();
+}
@@ -0,0 +1,3 @@
+#pragma once
+#define TCP_MSS 1436
+#define TCP_WND (4 * TCP_MSS)
@@ -0,0 +1,17 @@
+// Host build of the mbedtls AES API, encryption direction and CTR mode only
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+typedef struct {
+  int nr;
+  uint32_t rk[60];
+} mbedtls_aes_context;
+
+void mbedtls_aes_init(mbedtls_aes_context *ctx);
+void mbedtls_aes_free(mbedtls_aes_context *ctx);
+int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits);
+int mbedtls_aes_crypt_ecb(mbedtls_aes_context *ctx, int mode, const unsigned char input[16], unsigned char output[16]);
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context *ctx, size_t length, size_t *nc_off, unsigned char nonce_counter[16],
+                          unsigned char stream_block[16], const unsigned char *input, unsigned char *output);
+#define MBEDTLS_AES_ENCRYPT 1
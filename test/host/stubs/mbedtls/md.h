@@ -0,0 +1,34 @@
+// Host build of the mbedtls message digest API, SHA-256 and HMAC-SHA256 only
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+typedef enum { MBEDTLS_MD_NONE = 0, MBEDTLS_MD_SHA256 = 6 } mbedtls_md_type_t;
+typedef struct { mbedtls_md_type_t type; } mbedtls_md_info_t;
+
+typedef struct {
+  uint32_t state[8];
+  uint64_t count;
+  uint8_t  buffer[64];
+} mbedtls_sha256_context;
+
+typedef struct {
+  const mbedtls_md_info_t *info;
+  mbedtls_sha256_context sha;
+  uint8_t ipad[64];
+  uint8_t opad[64];
+  int hmac;
+} mbedtls_md_context_t;
+
+const mbedtls_md_info_t *mbedtls_md_info_from_type(mbedtls_md_type_t type);
+void mbedtls_md_init(mbedtls_md_context_t *ctx);
+void mbedtls_md_free(mbedtls_md_context_t *ctx);
+int mbedtls_md_setup(mbedtls_md_context_t *ctx, const mbedtls_md_info_t *info, int hmac);
+int mbedtls_md_starts(mbedtls_md_context_t *ctx);
+int mbedtls_md_update(mbedtls_md_context_t *ctx, const unsigned char *input, size_t len);
+int mbedtls_md_finish(mbedtls_md_context_t *ctx, unsigned char *output);
+int mbedtls_md(const mbedtls_md_info_t *info, const unsigned char *input, size_t len, unsigned char *output);
+int mbedtls_md_hmac_starts(mbedtls_md_context_t *ctx, const unsigned char *key, size_t keylen);
+int mbedtls_md_hmac_update(mbedtls_md_context_t *ctx, const unsigned char *input, size_t len);
+int mbedtls_md_hmac_finish(mbedtls_md_context_t *ctx, unsigned char *output);
+int mbedtls_md_hmac_reset(mbedtls_md_context_t *ctx);
@@ -0,0 +1,48 @@
+// Minimal test runner of the host tests: TEST() registers a case, CHECK() records failures
+#pragma once
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+struct HostTest {
+  const char *name;
+  std::function<void()> fn;
+};
+
+std::vector<HostTest>& hostTests();
+extern int host_failures;
+
+struct HostTestRegistrar {
+  HostTestRegistrar(const char *name, std::function<void()> fn) { hostTests().push_back({name, fn}); }
+};
+
+#define TEST(name) \
+  static void test_##name(); \
+  static HostTestRegistrar registrar_##name(#name, test_##name); \
+  static void test_##name()
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      fprintf(stderr, "  %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      host_failures++; \
+    } \
+  } while (0)
+
+#define CHECK_EQ(a, b) \
+  do { \
+    long long va_ = (long long)(a), vb_ = (long long)(b); \
+    if (va_ != vb_) { \
+      fprintf(stderr, "  %s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, va_, vb_); \
+      host_failures++; \
+    } \
+  } while (0)
+
+#define CHECK_STR(a, b) \
+  do { \
+    std::string va_ = (a), vb_ = (b); \
+    if (va_ != vb_) { \
+      fprintf(stderr, "  %s:%d: CHECK_STR(%s, %s) failed: \"%s\" != \"%s\"\n", __FILE__, __LINE__, #a, #b, va_.c_str(), vb_.c_str()); \
+      host_failures++; \
+    } \
+  } while (0)
@@ -0,0 +1,151 @@
+// Upload path: the buffers are reserved when the session starts, receiving the image does not allocate,
+// only the fragment or loop() call that ends the update may
+#include "ota_fixture.h"
+#include <cstring>
+
+namespace {
+
+const uint16_t BLOCK = 1024;
+const uint8_t GROUP = 8;
+const uint16_t ID = 9;
+
+std::unique_ptr<AsyncWebServerRequest> authorized(Device& device, WebRequestMethodComposite method, const char *url) {
+  auto req = request(device, method, url);
+  req->_user = "admin";
+  req->_pass = "secret";
+  return req;
+}
+
+/**
+ * @brief POST data to /ota/upload in fragments of 1436 bytes
+ * @param first receives the allocations of the first fragment, it authenticates the request
+ * @param last receives the allocations of the final fragment, it ends the update
+ * @return the allocations of the fragments in between
+ */
+size_t uploadAllocs(Device& device, const std::vector<uint8_t>& data, size_t *first, size_t *last, int *code) {
+  auto req = authorized(device, HTTP_POST, "/ota/upload");
+  req->_content_length = data.size() + 200;
+  size_t before_last = 0;
+  for (size_t offset = 0; offset < data.size(); offset += 1436) {
+    size_t n = data.size() - offset < 1436 ? data.size() - offset : 1436;
+    if (offset + n == data.size()) before_last = req->_upload_allocs;
+    req->hostUpload("firmware.bin", data.data() + offset, n, offset + n == data.size());
+    if (offset == 0) *first = req->_upload_allocs;
+  }
+  *last = req->_upload_allocs - before_last;
+  *code = req->hostEnd();
+  return before_last - *first;
+}
+
+/**
+ * @brief sparse form of image with one extent, see scripts/sparse_image.py
+ */
+std::vector<uint8_t> makeSparse(const std::vector<uint8_t>& image) {
+  std::vector<uint8_t> out(ElegantOTASparse::HEADER_LEN + ElegantOTASparse::EXTENT_HEADER_LEN, 0);
+  auto put32 = [&out](size_t at, uint32_t v) {
+    for (int i = 0; i < 4; i++) out[at + i] = (uint8_t)(v >> (8 * i));
+  };
+  memcpy(out.data(), "EOTS", 4);
+  out[4] = 1;
+  put32(8, (uint32_t)image.size());
+  put32(12, 1);
+  MD5Builder md5;
+  md5.begin();
+  md5.add(image.data(), image.size());
+  md5.calculate();
+  md5.getBytes(out.data() + 16);
+  put32(ElegantOTASparse::HEADER_LEN + 4, (uint32_t)image.size());
+  out.insert(out.end(), image.begin(), image.end());
+  return out;
+}
+
+std::string packet(uint8_t type, uint32_t index, const uint8_t *payload, size_t len) {
+  std::string p = "EOTM";
+  p += (char)type;
+  p += (char)0;
+  p += (char)(ID & 0xFF);
+  p += (char)(ID >> 8);
+  for (int i = 0; i < 4; i++) p += (char)(index >> (8 * i));
+  p.append((const char *)payload, len);
+  return p;
+}
+
+bool partitionHolds(const std::vector<uint8_t>& image) {
+  const std::vector<uint8_t>& partition = host::updatePartition();
+  return partition.size() >= image.size() && std::equal(image.begin(), image.end(), partition.begin());
+}
+
+}  // namespace
+
+TEST(firmware_upload_does_not_allocate) {
+  std::vector<uint8_t> image = makeImage(1024 * 1024, CONFIG_IDF_FIRMWARE_CHIP_ID, 11);
+  std::string start = "/ota/start?hash=" + md5Hex(image);
+  Device device("admin", "secret");
+
+  CHECK_EQ(authorized(device, HTTP_GET, start.c_str())->hostEnd(), 200);
+  size_t first = 0, last = 0;
+  int code = 0;
+  CHECK_EQ(uploadAllocs(device, image, &first, &last, &code), 0);
+  CHECK_EQ(code, 200);
+  CHECK_EQ(device.successes, 1);
+  CHECK(partitionHolds(image));
+  printf("     alloc: firmware, %zu allocations in the first fragment, %zu in the last, none in %zu between\n", first, last,
+         image.size() / 1436 - 1);
+}
+
+TEST(sparse_upload_does_not_allocate) {
+  std::vector<uint8_t> image = makeImage(512 * 1024, CONFIG_IDF_FIRMWARE_CHIP_ID, 12);
+  std::vector<uint8_t> sparse = makeSparse(image);
+  Device device("admin", "secret");
+
+  CHECK_EQ(authorized(device, HTTP_GET, "/ota/start?sparse=1")->hostEnd(), 200);
+  size_t first = 0, last = 0;
+  int code = 0;
+  CHECK_EQ(uploadAllocs(device, sparse, &first, &last, &code), 0);
+  CHECK_EQ(code, 200);
+  CHECK_EQ(device.successes, 1);
+  CHECK(partitionHolds(image));
+}
+
+TEST(multicast_receive_does_not_allocate) {
+  std::vector<uint8_t> image = makeImage(1024 * BLOCK - 300, CONFIG_IDF_FIRMWARE_CHIP_ID, 13);
+  std::string start = "/ota/start?mode=multicast&size=" + std::to_string(image.size()) + "&hash=" + md5Hex(image) +
+                      "&id=" + std::to_string(ID) + "&block=" + std::to_string(BLOCK) + "&k=" + std::to_string(GROUP);
+  // one block of every group is lost, its parity block rebuilds it from flash
+  host::udpPackets.clear();
+  uint32_t blocks = (image.size() + BLOCK - 1) / BLOCK;
+  std::vector<uint8_t> parity(BLOCK);
+  for (uint32_t group = 0; group * GROUP < blocks; group++) {
+    std::fill(parity.begin(), parity.end(), 0);
+    for (uint32_t i = group * GROUP; i < blocks && i < (group + 1) * GROUP; i++) {
+      size_t len = i + 1 < blocks ? BLOCK : image.size() - (size_t)i * BLOCK;
+      for (size_t b = 0; b < len; b++) parity[b] ^= image[(size_t)i * BLOCK + b];
+      if (i != group * GROUP + group % GROUP) host::udpPackets.push_back(packet(0, i, image.data() + (size_t)i * BLOCK, len));
+    }
+    host::udpPackets.push_back(packet(1, group, parity.data(), BLOCK));
+  }
+  Device device("admin", "secret");
+
+  CHECK_EQ(authorized(device, HTTP_GET, start.c_str())->hostEnd(), 200);
+  // the first loop() sizes the packet buffer of the fake WiFiUDP
+  device.ota.loop();
+  size_t allocs = host::allocStats().allocs;
+  while (!host::udpPackets.empty()) device.ota.loop();
+  CHECK_EQ(host::allocStats().allocs - allocs, 0);
+
+  auto status = authorized(device, HTTP_GET, "/ota/multicast/status");
+  CHECK_EQ(status->hostEnd(), 200);
+  CHECK(status->body().find("\"missing\":0") != std::string::npos);
+  CHECK(status->body().find("\"recovered\":128") != std::string::npos);
+  CHECK_EQ(authorized(device, HTTP_GET, "/ota/multicast/finish")->hostEnd(), 202);
+  // the read back slices do not allocate either, only the call that ends the update does
+  size_t verify = 0;
+  for (int i = 0; i < 200 && device.ends == 0; i++) {
+    allocs = host::allocStats().allocs;
+    device.ota.loop();
+    if (device.ends == 0) verify += host::allocStats().allocs - allocs;
+  }
+  CHECK_EQ(verify, 0);
+  CHECK_EQ(device.successes, 1);
+  CHECK(partitionHolds(image));
+}
@@ -0,0 +1,50 @@
+// Update bundles: the firmware section has to come first
+#include "ota_fixture.h"
+#include <algorithm>
+
+namespace {
+
+void addSection(std::vector<uint8_t>& bundle, uint8_t type, const std::vector<uint8_t>& image) {
+  uint8_t header[24] = {type, 0, 0, 0,
+                        (uint8_t)image.size(), (uint8_t)(image.size() >> 8), (uint8_t)(image.size() >> 16), (uint8_t)(image.size() >> 24)};
+  std::string md5 = md5Hex(image);
+  for (size_t i = 0; i < 16; i++) header[8 + i] = (uint8_t)strtoul(md5.substr(i * 2, 2).c_str(), NULL, 16);
+  bundle.insert(bundle.end(), header, header + sizeof(header));
+  bundle.insert(bundle.end(), image.begin(), image.end());
+}
+
+/**
+ * @brief bundle of the sections in the given order, see scripts/bundle_firmware.py
+ */
+std::vector<uint8_t> makeBundle(const std::vector<std::pair<uint8_t, std::vector<uint8_t>>>& sections) {
+  std::vector<uint8_t> bundle = {'E', 'O', 'T', 'B', 1, (uint8_t)sections.size(), 0, 0};
+  for (const auto& section : sections) addSection(bundle, section.first, section.second);
+  return bundle;
+}
+
+}  // namespace
+
+TEST(bundle_starting_with_the_filesystem_is_rejected) {
+  std::vector<uint8_t> app = makeImage(12000, CONFIG_IDF_FIRMWARE_CHIP_ID, 7);
+  std::vector<uint8_t> fs(8000, 0x5A);
+  std::vector<std::vector<uint8_t>> rejected = {makeBundle({{2, fs}, {1, app}}), makeBundle({{2, fs}})};
+  std::vector<uint8_t> bundle = makeBundle({{1, app}, {2, fs}});
+  Device device;
+
+  for (const auto& bundle : rejected) {
+    CHECK_EQ(get(device, "/ota/start?mode=bundle"), 200);
+    std::string body;
+    CHECK_EQ(upload(device, bundle, NULL, 1436, &body), 400);
+    CHECK_STR(body, "Bundle must start with the firmware");
+  }
+  // not a byte of the filesystem was written
+  CHECK(std::all_of(host::fsPartition().begin(), host::fsPartition().end(), [](uint8_t b) { return b == 0xFF; }));
+  CHECK_EQ(device.successes, 0);
+  CHECK(!host::bootSwitched());
+
+  CHECK_EQ(get(device, "/ota/start?mode=bundle"), 200);
+  CHECK_EQ(upload(device, bundle), 200);
+  CHECK_EQ(device.successes, 1);
+  CHECK(host::bootSwitched());
+  CHECK(std::equal(fs.begin(), fs.end(), host::fsPartition().begin()));
+}
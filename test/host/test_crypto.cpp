@@ -0,0 +1,231 @@
+// Encrypted uploads: containers of scripts/encrypt_firmware.py, any chunk split, nothing committed unless authentic
+#include "ota_fixture.h"
+#include "ElegantOTACrypto.h"
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+// python3 -c "import encrypt_firmware as e; print(e.encrypt(bytes(range(32)),
+//   bytes((i * 7 + 3) & 0xFF for i in range(70)), bytes(range(0xA0, 0xAC))).hex())"
+const char *SCRIPT_CONTAINER =
+  "454f5441010100004600000000000000a0a1a2a3a4a5a6a7a8a9aaab00000000"
+  "540644840661ec9236e71613ffbca366ec65f12c31275fcc0eaa97e747309639"
+  "dfcbf2171255d79b47245cbe08cfaa981a1132c90c8a332133ed67e73369eb86"
+  "b79fb91f62221ae32a3e173da238516a34d3012235a4e7b66b0f5c8b0c9abe36"
+  "f32d644551f8";
+
+const size_t WIFI_LINE_RATE = 20 * 1000 * 1000 / 8;   // bytes/s, what an ESP32 sustains over TCP at best
+
+std::vector<uint8_t> fromHex(const char *hex) {
+  std::vector<uint8_t> out;
+  for (size_t i = 0; hex[i] && hex[i + 1]; i += 2) {
+    char byte[3] = {hex[i], hex[i + 1], 0};
+    out.push_back((uint8_t)strtoul(byte, NULL, 16));
+  }
+  return out;
+}
+
+void testKey(uint8_t key[32]) {
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)i;
+}
+
+std::vector<uint8_t> scriptPlaintext() {
+  std::vector<uint8_t> plain(70);
+  for (size_t i = 0; i < plain.size(); i++) plain[i] = (uint8_t)(i * 7 + 3);
+  return plain;
+}
+
+/**
+ * @brief the container encrypt_firmware.py writes, built with the host AES and HMAC
+ */
+std::vector<uint8_t> encrypt(const uint8_t key[32], const std::vector<uint8_t>& plain, uint8_t nonceSeed = 0xA0) {
+  uint8_t enc_key[32], mac_key[32], buf[33];
+  memcpy(buf, key, 32);
+  buf[32] = 0x01;
+  mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), buf, sizeof(buf), enc_key);
+  buf[32] = 0x02;
+  mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), buf, sizeof(buf), mac_key);
+
+  std::vector<uint8_t> out(ElegantOTADecryptor::HEADER_LEN, 0);
+  memcpy(out.data(), "EOTA", 4);
+  out[4] = 1;
+  out[5] = 1;
+  for (int i = 0; i < 4; i++) out[8 + i] = (uint8_t)(plain.size() >> (8 * i));
+  for (int i = 0; i < 12; i++) out[16 + i] = (uint8_t)(nonceSeed + i);
+  out.insert(out.end(), plain.begin(), plain.end());
+
+  mbedtls_aes_context aes;
+  mbedtls_aes_init(&aes);
+  mbedtls_aes_setkey_enc(&aes, enc_key, 256);
+  uint8_t counter[16] = {0}, stream[16];
+  size_t stream_off = 0;
+  memcpy(counter, out.data() + 16, 12);
+  uint8_t *body = out.data() + ElegantOTADecryptor::HEADER_LEN;
+  mbedtls_aes_crypt_ctr(&aes, plain.size(), &stream_off, counter, stream, body, body);
+  mbedtls_aes_free(&aes);
+
+  const uint8_t *parts[] = {out.data()};
+  size_t lens[] = {out.size()};
+  uint8_t mac[ElegantOTAHmac::LEN];
+  ElegantOTAHmac::sha256(mac_key, sizeof(mac_key), parts, lens, 1, mac);
+  out.insert(out.end(), mac, mac + sizeof(mac));
+  return out;
+}
+
+/**
+ * @brief decrypt container cut at the given offsets, the plaintext is appended to plain
+ * @return the result of finish(), false as soon as a chunk is refused
+ */
+bool decrypt(ElegantOTADecryptor& decryptor, std::vector<uint8_t> container, const std::vector<size_t>& cuts, std::vector<uint8_t>& plain) {
+  decryptor.begin();
+  plain.clear();
+  size_t from = 0;
+  for (size_t i = 0; i <= cuts.size(); i++) {
+    size_t to = i < cuts.size() ? cuts[i] : container.size();
+    size_t offset, len;
+    if (!decryptor.update(container.data() + from, to - from, offset, len)) return false;
+    plain.insert(plain.end(), container.data() + from + offset, container.data() + from + offset + len);
+    from = to;
+  }
+  return decryptor.finish();
+}
+
+std::unique_ptr<AsyncWebServerRequest> authorized(Device& device, const char *url) {
+  auto req = request(device, HTTP_GET, url);
+  req->_user = "admin";
+  req->_pass = "secret";
+  return req;
+}
+
+/**
+ * @brief /ota/start?enc=1 and the upload of container
+ * @return the status code of the upload, body receives its answer
+ */
+int uploadEncrypted(Device& device, const std::vector<uint8_t>& container, std::string *body) {
+  if (authorized(device, "/ota/start?enc=1")->hostEnd() != 200) return 0;
+  auto req = request(device, HTTP_POST, "/ota/upload");
+  req->_user = "admin";
+  req->_pass = "secret";
+  req->_content_length = container.size() + 200;
+  for (size_t offset = 0; offset < container.size(); offset += 1436) {
+    size_t n = container.size() - offset < 1436 ? container.size() - offset : 1436;
+    req->hostUpload("firmware.bin.enc", container.data() + offset, n, offset + n == container.size());
+  }
+  int code = req->hostEnd();
+  *body = req->body();
+  return code;
+}
+
+bool partitionHolds(const std::vector<uint8_t>& image) {
+  const std::vector<uint8_t>& partition = host::updatePartition();
+  return partition.size() >= image.size() && std::equal(image.begin(), image.end(), partition.begin());
+}
+
+}  // namespace
+
+TEST(container_of_encrypt_firmware_py_decrypts) {
+  uint8_t key[32];
+  testKey(key);
+  std::vector<uint8_t> container = fromHex(SCRIPT_CONTAINER);
+  // the host AES and HMAC agree with the script
+  CHECK(encrypt(key, scriptPlaintext()) == container);
+
+  ElegantOTADecryptor decryptor;
+  decryptor.setKey(key);
+  std::vector<uint8_t> plain;
+  CHECK(decrypt(decryptor, container, {}, plain));
+  CHECK(plain == scriptPlaintext());
+  CHECK(decryptor.error() == NULL);
+}
+
+TEST(any_chunk_split_decrypts) {
+  uint8_t key[32];
+  testKey(key);
+  std::vector<uint8_t> image = makeImage(300, CONFIG_IDF_FIRMWARE_CHIP_ID, 8);
+  std::vector<uint8_t> container = encrypt(key, image);
+  size_t mac_at = container.size() - ElegantOTADecryptor::MAC_LEN;
+  ElegantOTADecryptor decryptor;
+  decryptor.setKey(key);
+  std::vector<uint8_t> plain;
+
+  // every single cut, in the header, the ciphertext and the MAC
+  for (size_t cut = 0; cut <= container.size(); cut++) {
+    if (!decrypt(decryptor, container, {cut}, plain) || plain != image) {
+      fprintf(stderr, "  split at %zu failed: %s\n", cut, decryptor.error() ? decryptor.error() : "wrong plaintext");
+      CHECK(false);
+    }
+  }
+  // two cuts, one inside the header and one inside the MAC
+  for (size_t a = 1; a < ElegantOTADecryptor::HEADER_LEN; a += 3) {
+    for (size_t b = mac_at + 1; b < container.size(); b += 5) {
+      CHECK(decrypt(decryptor, container, {a, b}, plain) && plain == image);
+    }
+  }
+  // byte by byte
+  std::vector<size_t> cuts;
+  for (size_t i = 1; i < container.size(); i++) cuts.push_back(i);
+  CHECK(decrypt(decryptor, container, cuts, plain) && plain == image);
+}
+
+TEST(tampered_or_truncated_container_commits_nothing) {
+  uint8_t key[32];
+  testKey(key);
+  std::vector<uint8_t> image = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 9);
+  std::vector<uint8_t> container = encrypt(key, image);
+  std::vector<uint8_t> tampered = container;
+  tampered.back() ^= 0x01;
+  std::vector<uint8_t> truncated(container.begin(), container.end() - 10);
+  Device device("admin", "secret", [&](ElegantOTAClass& ota) { ota.setEncryptionKey(key); });
+
+  std::string body;
+  CHECK_EQ(uploadEncrypted(device, tampered, &body), 400);
+  CHECK_STR(body, "Encrypted image authentication failed");
+  CHECK_EQ(uploadEncrypted(device, truncated, &body), 400);
+  CHECK_STR(body, "Encrypted image incomplete");
+  CHECK_EQ(device.successes, 0);
+  CHECK(!Update.isRunning());
+  CHECK(!host::bootSwitched());
+
+  // the same device takes the authentic container
+  CHECK_EQ(uploadEncrypted(device, container, &body), 200);
+  CHECK_EQ(device.successes, 1);
+  CHECK(partitionHolds(image));
+  CHECK(host::bootSwitched());
+}
+
+TEST(required_encryption_rejects_plain_uploads) {
+  uint8_t key[32];
+  testKey(key);
+  Device device("admin", "secret", [&](ElegantOTAClass& ota) { ota.setEncryptionKey(key, true); });
+
+  auto req = authorized(device, "/ota/start");
+  CHECK_EQ(req->hostEnd(), 400);
+  CHECK_STR(req->body(), "Encrypted image required");
+  CHECK_EQ(device.successes, 0);
+  CHECK(!host::bootSwitched());
+}
+
+TEST(decryption_keeps_up_with_wifi) {
+  uint8_t key[32];
+  testKey(key);
+  std::vector<uint8_t> image = makeImage(1024 * 1024, CONFIG_IDF_FIRMWARE_CHIP_ID, 10);
+  std::vector<uint8_t> container = encrypt(key, image);
+  ElegantOTADecryptor decryptor;
+  decryptor.setKey(key);
+
+  // fragments of a TCP segment, as the upload handler gets them
+  std::vector<size_t> cuts;
+  for (size_t offset = 1436; offset < container.size(); offset += 1436) cuts.push_back(offset);
+  std::vector<uint8_t> plain;
+  plain.reserve(image.size());
+  auto started = std::chrono::steady_clock::now();
+  CHECK(decrypt(decryptor, container, cuts, plain));
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+  CHECK(plain == image);
+
+  double rate = container.size() / (seconds > 0 ? seconds : 1e-9);
+  printf("     crypto: %.1f MB/s decrypted and authenticated with the host reference AES, Wi-Fi line rate %.1f MB/s\n",
+         rate / 1e6, WIFI_LINE_RATE / 1e6);
+  CHECK(rate > WIFI_LINE_RATE);
+}
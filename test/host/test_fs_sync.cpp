@@ -0,0 +1,179 @@
+// File sync: the manifest is hashed by loop(), library files stay, a dry run opens no session
+#include "ota_fixture.h"
+#include <cstring>
+
+namespace {
+
+std::string manifest(const std::vector<std::pair<std::string, std::string>>& files) {
+  std::string json = "{\"files\":[";
+  for (size_t i = 0; i < files.size(); i++) {
+    if (i) json += ",";
+    json += "{\"path\":\"" + files[i].first + "\",\"md5\":\"" + md5Hex((const uint8_t *)files[i].second.data(), files[i].second.size()) + "\"}";
+  }
+  return json + "]}";
+}
+
+int postManifest(Device& device, const std::string& json, const char *url = "/ota/fs/manifest", AsyncClient *client = NULL) {
+  auto req = request(device, HTTP_POST, url, client);
+  req->_content_length = json.size();
+  req->hostBody((const uint8_t *)json.data(), json.size());
+  return req->hostEnd();
+}
+
+/**
+ * @brief GET the plan, body receives the answer
+ */
+int getPlan(Device& device, std::string *body = NULL, AsyncClient *client = NULL) {
+  auto req = request(device, HTTP_GET, "/ota/fs/manifest", client);
+  int code = req->hostEnd();
+  if (body != NULL) *body = req->body();
+  return code;
+}
+
+/**
+ * @brief run loop() until the plan is ready
+ * @return the number of loop() calls it took, -1 if it never got ready
+ */
+int hashInLoop(Device& device, std::string *plan) {
+  for (int calls = 1; calls < 1000; calls++) {
+    device.ota.loop();
+    if (getPlan(device, plan) == 200) return calls;
+  }
+  return -1;
+}
+
+bool listed(const std::string& plan, const char *list, const char *path) {
+  JsonDocument doc;
+  if (deserializeJson(doc, plan.c_str())) return false;
+  for (JsonVariant entry : doc[list].as<JsonArray>()) {
+    if (strcmp(entry.as<const char *>(), path) == 0) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+TEST(manifest_is_hashed_in_loop_not_in_the_handler) {
+  std::string big(100000, 'b');
+  LittleFS.hostClear();
+  LittleFS.hostWrite("/www/app.js", big);
+  LittleFS.hostWrite("/www/index.html", "<html>old</html>");
+  LittleFS.hostWrite("/stale.txt", "gone");
+  Device device;
+
+  CHECK_EQ(get(device, "/ota/start?mode=files"), 200);
+  std::string json = manifest({{"/www/app.js", big}, {"/www/index.html", "<html>new</html>"}, {"/new.txt", "n"}});
+  CHECK_EQ(postManifest(device, json), 202);
+  // nothing is hashed until loop() runs
+  std::string plan;
+  CHECK_EQ(getPlan(device, &plan), 202);
+
+  // 100 KB in slices of ELEGANTOTA_SYNC_HASH_SLICE
+  int calls = hashInLoop(device, &plan);
+  CHECK(calls >= (int)(big.size() / ELEGANTOTA_SYNC_HASH_SLICE));
+  CHECK(!listed(plan, "upload", "/www/app.js"));
+  CHECK(listed(plan, "upload", "/www/index.html"));
+  CHECK(listed(plan, "upload", "/new.txt"));
+  CHECK(listed(plan, "delete", "/stale.txt"));
+
+  // the plan stays for the session, an upload during a new check is refused
+  CHECK_EQ(getPlan(device), 200);
+  CHECK_EQ(postManifest(device, json), 202);
+  std::vector<uint8_t> data = {'x'};
+  auto file = request(device, HTTP_POST, "/ota/fs/file?path=/new.txt");
+  file->_content_length = 200;
+  file->hostUpload("new.txt", data.data(), data.size(), true);
+  CHECK_EQ(file->hostEnd(), 400);
+  CHECK_STR(file->body(), "Manifest check in progress");
+  CHECK_EQ(hashInLoop(device, &plan) > 0, true);
+  CHECK_EQ(get(device, "/ota/fs/commit"), 200);
+  CHECK_EQ(device.successes, 1);
+}
+
+TEST(library_files_survive_a_sync) {
+  LittleFS.hostClear();
+  LittleFS.hostWrite(ELEGANTOTA_HISTORY_FILE, "history");
+  LittleFS.hostWrite("/old.txt", "old");
+  Device device;
+  // begin() drops a prefetch state it cannot resume, this one is written behind it
+  LittleFS.hostWrite(ELEGANTOTA_PREFETCH_FILE, "{}");
+
+  CHECK_EQ(get(device, "/ota/start?mode=files"), 200);
+  CHECK_EQ(postManifest(device, manifest({{"/index.html", "i"}, {ELEGANTOTA_PREFETCH_FILE, "[]"}})), 202);
+  std::string plan;
+  CHECK(hashInLoop(device, &plan) > 0);
+  CHECK(listed(plan, "delete", "/old.txt"));
+  CHECK(!listed(plan, "delete", ELEGANTOTA_HISTORY_FILE));
+  CHECK(!listed(plan, "delete", ELEGANTOTA_PREFETCH_FILE));
+  CHECK(!listed(plan, "upload", ELEGANTOTA_PREFETCH_FILE));
+
+  // and can neither be deleted nor overwritten by hand
+  std::string url = std::string("/ota/fs/delete?path=") + ELEGANTOTA_HISTORY_FILE;
+  auto del = request(device, HTTP_POST, url.c_str());
+  CHECK_EQ(del->hostEnd(), 400);
+  CHECK_STR(del->body(), "Invalid path");
+  url = std::string("/ota/fs/file?path=") + ELEGANTOTA_PREFETCH_FILE;
+  std::vector<uint8_t> data = {'[', ']'};
+  auto file = request(device, HTTP_POST, url.c_str());
+  file->_content_length = 200;
+  file->hostUpload("state.json", data.data(), data.size(), true);
+  CHECK_EQ(file->hostEnd(), 400);
+  CHECK_STR(LittleFS.hostRead(ELEGANTOTA_HISTORY_FILE), "history");
+  CHECK_STR(LittleFS.hostRead(ELEGANTOTA_PREFETCH_FILE), "{}");
+}
+
+TEST(dry_run_opens_no_session) {
+  LittleFS.hostClear();
+  LittleFS.hostWrite("/a.txt", "a");
+  LittleFS.hostWrite("/b.txt", "b");
+  auto me = makeClient(60);
+  auto other = makeClient(61);
+  Device device;
+
+  std::string json = manifest({{"/a.txt", "a"}, {"/c.txt", "c"}});
+  CHECK_EQ(postManifest(device, json, "/ota/fs/manifest?dry=1", me.get()), 202);
+  std::string plan;
+  CHECK_EQ(getPlan(device, &plan, other.get()), 400);
+  device.ota.loop();
+  CHECK_EQ(getPlan(device, &plan, me.get()), 200);
+  CHECK(listed(plan, "upload", "/c.txt"));
+  CHECK(listed(plan, "delete", "/b.txt"));
+  // answered once, no session, no callbacks, no file touched
+  CHECK_EQ(getPlan(device, NULL, me.get()), 400);
+  CHECK_EQ(device.starts, 0);
+  CHECK_EQ(device.ends, 0);
+  CHECK_STR(LittleFS.hostRead("/b.txt"), "b");
+  CHECK_EQ(get(device, "/ota/fs/commit", me.get()), 400);
+
+  // a session of another client keeps dry runs out
+  CHECK_EQ(get(device, "/ota/start?mode=files", other.get()), 200);
+  CHECK_EQ(postManifest(device, json, "/ota/fs/manifest?dry=1", me.get()), 409);
+}
+
+TEST(unauthorized_sync_requests_touch_nothing) {
+  LittleFS.hostClear();
+  LittleFS.hostWrite("/index.html", "<html>old</html>");
+  Device device("admin", "secret");
+
+  auto start = request(device, HTTP_GET, "/ota/start?mode=files");
+  start->_user = "admin";
+  start->_pass = "secret";
+  CHECK_EQ(start->hostEnd(), 200);
+
+  // the same address without credentials, a form posted cross-site by the owner's browser
+  std::vector<uint8_t> data = {'p', 'w', 'n', 'd'};
+  auto file = request(device, HTTP_POST, "/ota/fs/file?path=/index.html");
+  file->_content_length = 200;
+  file->hostUpload("index.html", data.data(), 2, false);
+  file->hostUpload("index.html", data.data() + 2, 2, true);
+  CHECK_EQ(file->hostEnd(), 401);
+  CHECK_STR(LittleFS.hostRead("/index.html"), "<html>old</html>");
+  CHECK(!LittleFS.exists("/index.html.tmp"));
+
+  std::string json = manifest({{"/index.html", "x"}});
+  auto req = request(device, HTTP_POST, "/ota/fs/manifest");
+  req->_content_length = json.size();
+  req->hostBody((const uint8_t *)json.data(), json.size());
+  CHECK(req->_tempObject == NULL);
+  CHECK_EQ(req->hostEnd(), 401);
+}
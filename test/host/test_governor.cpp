@@ -0,0 +1,94 @@
+// Resource governor: the instrumented allocator of the harness drives ESP.getFreeHeap()
+#include "ota_fixture.h"
+#include <cstdlib>
+
+namespace {
+
+const uint32_t throttleHeap = 64 * 1024;
+const uint32_t rejectHeap = 48 * 1024;
+
+void limits(ElegantOTAClass& ota) {
+  ota.setResourceLimits(throttleHeap, rejectHeap, 4096);
+}
+
+/**
+ * @brief allocation that leaves free bytes of device heap, released with the object
+ */
+struct Ballast {
+  void *block = NULL;
+  explicit Ballast(uint32_t free) { this->leave(free); }
+  ~Ballast() { this->release(); }
+  void leave(uint32_t free) {
+    this->release();
+    block = malloc(ESP.getFreeHeap() - free);
+  }
+  void release() {
+    ::free(block);
+    block = NULL;
+  }
+};
+
+}  // namespace
+
+TEST(start_is_refused_below_the_reject_heap) {
+  Device device("", "", limits);
+  Ballast ballast(rejectHeap - 8192);
+  auto req = request(device, HTTP_GET, "/ota/start");
+  CHECK_EQ(req->hostEnd(), 503);
+  CHECK_STR(req->responseHeader("Retry-After"), "5");
+  CHECK_EQ(device.starts, 0);
+
+  // between the two limits a session starts, its uploads are throttled
+  ballast.leave(throttleHeap - 8192);
+  CHECK_EQ(get(device, "/ota/start"), 200);
+  CHECK_EQ(device.starts, 1);
+}
+
+TEST(low_heap_defers_acks_until_loop_sees_it_recover) {
+  std::vector<uint8_t> image = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 6);
+  Device device("", "", limits);
+  CHECK(device.ota.pull("http://files.local/fw.bin"));
+  device.ota.loop();
+  AsyncClient *client = host::connects.back();
+  client->hostConnected();
+  std::string head = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(image.size()) + "\r\n\r\n";
+  client->hostReceive(head.data(), head.size());
+
+  Ballast ballast(throttleHeap - 4096);
+  client->hostReceive(image.data(), 1436);
+  CHECK_EQ(client->_unacked, 1436u);
+  // still short of memory, the sender stays paused
+  device.ota.loop();
+  CHECK_EQ(client->_unacked, 1436u);
+
+  // freed below the hysteresis of a quarter of throttleHeap is not enough
+  ballast.leave(throttleHeap + 4096);
+  device.ota.loop();
+  CHECK_EQ(client->_unacked, 1436u);
+  ballast.release();
+  device.ota.loop();
+  CHECK_EQ(client->_unacked, 0u);
+
+  host::clearLog();
+  for (size_t offset = 1436; offset < image.size(); offset += 1436) {
+    client->hostReceive(image.data() + offset, image.size() - offset < 1436 ? image.size() - offset : 1436);
+    CHECK_EQ(client->_unacked, 0u);
+  }
+  device.ota.loop();
+  CHECK_EQ(device.successes, 1);
+  CHECK(host::logContains("throttled 1 times"));
+}
+
+TEST(stack_samples_of_other_contexts_do_not_count) {
+  ElegantOTAGovernor governor;
+  governor.setLimits(throttleHeap, rejectHeap, 4096);
+  governor.begin({100000, 80000, ELEGANTOTA_STACK_UNKNOWN});
+  governor.update({90000, 70000, ELEGANTOTA_STACK_UNKNOWN});
+  char summary[112];
+  governor.summary(summary, sizeof(summary));
+  CHECK_STR(summary, "min free heap 90000, min largest block 70000, min free stack n/a, throttled 0 times");
+
+  governor.update({95000, 70000, 1500});
+  governor.update({95000, 70000, ELEGANTOTA_STACK_UNKNOWN});
+  CHECK_EQ(governor.low().stackFree, 1500u);
+}
@@ -0,0 +1,123 @@
+// Image header check and chip detection, with the first bytes of images as esptool writes them
+#include "ota_fixture.h"
+#include <cstring>
+
+namespace {
+
+/**
+ * @brief image header of hex bytes (image and extended header, first segment header),
+ * followed by an app descriptor with version and project when version is not NULL
+ */
+std::vector<uint8_t> header(const char *hex, const char *version = NULL, const char *project = NULL) {
+  std::vector<uint8_t> bytes;
+  for (const char *p = hex; *p; p++) {
+    if (*p == ' ') continue;
+    bytes.push_back((uint8_t)strtoul(std::string(p, 2).c_str(), NULL, 16));
+    p++;
+  }
+  if (version != NULL) {
+    bytes.resize(ElegantOTAImageCheck::HEADER_LEN, 0);
+    const uint8_t magic[] = {0x32, 0x54, 0xCD, 0xAB};
+    memcpy(bytes.data() + 32, magic, sizeof(magic));
+    strncpy((char *)bytes.data() + 48, version, 32);
+    strncpy((char *)bytes.data() + 80, project, 32);
+  } else {
+    bytes.resize(ElegantOTAImageCheck::HEADER_LEN, 0xA5);
+  }
+  return bytes;
+}
+
+struct RealHeader {
+  const char *family;
+  std::vector<uint8_t> bytes;
+};
+
+// magic, segments, flash mode, size/freq, entry | wp pin, drive | chip id, min rev, min/max rev full, reserved, hash | segment load address, length
+std::vector<RealHeader> realHeaders() {
+  return {
+    { "ESP32",     header("E9 05 02 2F F4100840 EE000000 0000 00 0000 0000 00000000 01 2000403F E4C90100", "v2.0.17", "arduino-lib-builder") },
+    { "ESP32-S2",  header("E9 05 02 2F 6C0E0240 EE000000 0200 00 0000 6300 00000000 01 2000003F 84770100", "v3.0.7", "arduino-lib-builder") },
+    { "ESP32-S3",  header("E9 06 02 4F 8C593740 EE000000 0900 00 0000 6300 00000000 01 2000103C A0A10100", "v3.0.7", "arduino-lib-builder") },
+    { "ESP32-C2",  header("E9 04 02 1F 14063840 EE000000 0C00 01 6400 6300 00000000 01 2000003C 3C5E0100", "v3.0.7", "arduino-lib-builder") },
+    { "ESP32-C3",  header("E9 05 02 2F C4053840 EE000000 0500 03 0300 6300 00000000 01 2000003C 9C920100", "v3.0.7", "arduino-lib-builder") },
+    { "ESP32-C6",  header("E9 05 02 2F 48054080 EE000000 0D00 00 0000 6300 00000000 01 20000042 D4A20100", "v3.0.7", "arduino-lib-builder") },
+    { "ESP32-H2",  header("E9 05 02 1F 68054080 EE000000 1000 00 0000 6300 00000000 01 20000042 70660100", "v3.0.7", "arduino-lib-builder") },
+    { "ESP32-P4",  header("E9 06 02 4F 3A07F04F EE000000 1200 00 0000 6300 00000000 01 20000040 10C70100", "v3.1.0", "arduino-lib-builder") },
+    { "ESP32-C5",  header("E9 05 02 2F B4054080 EE000000 1700 00 0000 6300 00000000 01 20000042 A89C0100", "v3.3.0", "arduino-lib-builder") },
+    { "ESP32-C61", header("E9 05 02 2F B4054080 EE000000 1400 00 0000 6300 00000000 01 20000042 D0850100", "v3.3.0", "arduino-lib-builder") },
+  };
+}
+
+// eboot at the start of every Arduino ESP8266 sketch, and the same sketch after gzip -9
+const char *esp8266Header = "E9 01 02 40 00F01040 00F01040 A8050000";
+const char *esp8266GzipHeader = "1F 8B 08 00 00 00 00 00 02 03 EC BD 0B 7C 54 D5";
+
+bool validate(const std::vector<uint8_t>& bytes, const char *family, std::string *error = NULL) {
+  ElegantOTAImageCheck check;
+  check.feed(bytes.data(), bytes.size());
+  char reason[96] = "";
+  bool ok = check.validate(family, "", "", reason, sizeof(reason));
+  if (error != NULL) *error = reason;
+  return ok;
+}
+
+}  // namespace
+
+TEST(real_headers_map_to_their_chip) {
+  std::vector<RealHeader> headers = realHeaders();
+  for (const RealHeader& h : headers) {
+    std::string error;
+    if (!validate(h.bytes, h.family, &error)) {
+      fprintf(stderr, "  %s: %s\n", h.family, error.c_str());
+      CHECK(false);
+    }
+    uint16_t chip_id = h.bytes[12] | (h.bytes[13] << 8);
+    CHECK_STR(ElegantOTAImageCheck::chipFamilyName(chip_id), h.family);
+
+    // every other chip rejects the image with both names in the reason
+    for (const RealHeader& other : headers) {
+      if (&other == &h) continue;
+      CHECK(!validate(h.bytes, other.family, &error));
+      CHECK_STR(error, std::string("Image built for ") + h.family + ", device is " + other.family);
+    }
+    CHECK(!validate(h.bytes, "ESP8266"));
+  }
+}
+
+TEST(device_family_follows_idf_target_not_board_variant) {
+  std::vector<uint8_t> esp32 = makeImage(8192, 0x0000);
+  std::vector<uint8_t> s3 = makeImage(8192, 0x0009);
+  Device device;
+  // the host build is a LOLIN S3, its variant name carries no chip
+  CHECK_STR(ARDUINO_VARIANT, "lolin_s3");
+  auto info = request(device, HTTP_GET, "/getdeviceinfo");
+  CHECK_EQ(info->hostEnd(), 200);
+  JsonDocument doc;
+  CHECK(!deserializeJson(doc, info->body().c_str()));
+  CHECK_STR(doc["chipfamily"] | "", "ESP32-S3");
+  CHECK_STR(ElegantOTAImageCheck::deviceChipFamily(), "ESP32-S3");
+
+  std::string body;
+  CHECK_EQ(get(device, "/ota/start"), 200);
+  CHECK_EQ(upload(device, esp32, NULL, 1436, &body), 400);
+  CHECK_STR(body, "Image built for ESP32, device is ESP32-S3");
+  CHECK_EQ(get(device, "/ota/start"), 200);
+  CHECK_EQ(upload(device, s3), 200);
+  CHECK_EQ(device.successes, 1);
+}
+
+TEST(esp8266_accepts_plain_and_gzip_images) {
+  std::string error;
+  CHECK(validate(header(esp8266Header), "ESP8266", &error));
+  CHECK(validate(header(esp8266GzipHeader), "ESP8266", &error));
+  CHECK_STR(error, "");
+
+  // the ESP32 updater has no inflater, a gzip image is no image there
+  CHECK(!validate(header(esp8266GzipHeader), "ESP32-S3", &error));
+  CHECK_STR(error, "Invalid image magic 0x1F");
+  CHECK(!validate(header(esp8266Header), "ESP32", &error));
+
+  // neither is a file that only starts like gzip
+  CHECK(!validate(header("1F 00 08 00"), "ESP8266", &error));
+  CHECK_STR(error, "Invalid image magic 0x1F");
+}
@@ -0,0 +1,39 @@
+// Expected MD5 of an update given to /ota/start
+#include "ota_fixture.h"
+
+namespace {
+
+std::string upper(std::string s) {
+  for (char& c : s) c = (char)toupper((unsigned char)c);
+  return s;
+}
+
+}  // namespace
+
+TEST(start_hash_is_verified_after_update_begin) {
+  std::vector<uint8_t> image = makeImage(16384, CONFIG_IDF_FIRMWARE_CHIP_ID, 1);
+  std::vector<uint8_t> other = makeImage(16384, CONFIG_IDF_FIRMWARE_CHIP_ID, 2);
+  Device device;
+
+  // Update.begin() clears the expected MD5, a hash set before it would never be compared
+  std::string start = "/ota/start?hash=" + md5Hex(other);
+  CHECK_EQ(get(device, start.c_str()), 200);
+  CHECK_EQ(upload(device, image), 400);
+  CHECK_EQ(device.successes, 0);
+  CHECK_EQ(device.ends, 1);
+  CHECK(!host::bootSwitched());
+
+  start = "/ota/start?hash=" + upper(md5Hex(image));
+  CHECK_EQ(get(device, start.c_str()), 200);
+  CHECK_EQ(upload(device, image), 200);
+  CHECK_EQ(device.successes, 1);
+  CHECK(host::bootSwitched());
+}
+
+TEST(malformed_start_hash_is_rejected) {
+  Device device;
+  auto req = request(device, HTTP_GET, "/ota/start?hash=0123456789abcdef");
+  CHECK_EQ(req->hostEnd(), 400);
+  CHECK_STR(req->body(), "MD5 parameter invalid");
+  CHECK_EQ(device.starts, 0);
+}
@@ -0,0 +1,173 @@
+// Background prefetch: acknowledged at the rate, resumed with a Range request, state kept off replaced filesystems
+#include "ota_fixture.h"
+
+namespace {
+
+const char *url = "http://files.local/fw.bin";
+const size_t WINDOW = 5744;   // TCP_WND, the server never has more unacknowledged bytes out
+
+std::string head(int status, size_t length, const std::string& headers = "") {
+  return "HTTP/1.1 " + std::to_string(status) + " X\r\nContent-Length: " + std::to_string(length) + "\r\n" + headers + "\r\n";
+}
+
+/**
+ * @brief the connection the prefetch opened last, completed by the test
+ */
+AsyncClient *accept() {
+  AsyncClient *client = host::connects.back();
+  client->hostConnected();
+  return client;
+}
+
+/**
+ * @brief send data from offset sent on, as much as the receive window takes
+ */
+void pump(AsyncClient *client, const std::vector<uint8_t>& image, size_t& sent) {
+  while (sent < image.size() && client->_unacked < WINDOW && !client->_closed) {
+    size_t n = image.size() - sent;
+    if (n > 1436) n = 1436;
+    if (n > WINDOW - client->_unacked) n = WINDOW - client->_unacked;
+    client->hostReceive(image.data() + sent, n);
+    sent += n;
+  }
+}
+
+bool partitionHolds(const std::vector<uint8_t>& image) {
+  const std::vector<uint8_t>& partition = host::updatePartition();
+  return partition.size() >= image.size() && std::equal(image.begin(), image.end(), partition.begin());
+}
+
+}  // namespace
+
+TEST(rate_limiter_follows_the_rate_and_the_cpu_share) {
+  ElegantOTARateLimiter limiter;
+  limiter.begin(4096, 25, 1000);
+  // a quarter second of the rate as burst
+  CHECK_EQ(limiter.allowance(1000), 1024);
+  limiter.consume(1024);
+  CHECK_EQ(limiter.allowance(1000), 0);
+  // refilled by the rate, capped at the burst after a long pause
+  CHECK_EQ(limiter.allowance(1100), 409);
+  CHECK_EQ(limiter.allowance(60000), 1024);
+  // a slice busy for 10 ms rests 30 ms at 25 %
+  limiter.slice(60000, 60010);
+  CHECK_EQ(limiter.allowance(60039), 0);
+  CHECK_EQ(limiter.allowance(60040), 1024);
+  // a pause before a retry
+  limiter.pause(60040, 30000);
+  CHECK_EQ(limiter.allowance(90039), 0);
+  CHECK(limiter.allowance(90040) > 0);
+
+  limiter.begin(0, 100, 0);
+  CHECK_EQ(limiter.allowance(0), (size_t)-1);
+}
+
+TEST(prefetch_is_acknowledged_at_the_rate) {
+  std::vector<uint8_t> image = makeImage(100000, CONFIG_IDF_FIRMWARE_CHIP_ID, 6);
+  LittleFS.hostClear();
+  Device device("", "", [](ElegantOTAClass& ota) { ota.setPrefetchLimits(4096, 100); });
+
+  CHECK(device.ota.prefetch(url, md5Hex(image).c_str()));
+  size_t connects = host::connects.size();
+  device.ota.loop();
+  CHECK_EQ(host::connects.size(), connects + 1);
+  AsyncClient *client = accept();
+  CHECK(client->_sent.find("GET /fw.bin HTTP/1.0\r\n") == 0);
+  CHECK(client->_sent.find("Range") == std::string::npos);
+
+  std::string h = head(200, image.size());
+  client->hostReceive(h.data(), h.size());
+  size_t sent = 0;
+  pump(client, image, sent);
+  // written, but held back until loop() acknowledges it
+  CHECK_EQ(client->_unacked, WINDOW);
+
+  // 10 s in steps of 100 ms, the server only sends what was acknowledged
+  for (int i = 0; i < 100; i++) {
+    host::advance(100);
+    device.ota.loop();
+    pump(client, image, sent);
+  }
+  size_t acked = sent - client->_unacked;
+  // the burst of a quarter second plus 10 s of the rate
+  CHECK(acked >= 40000 && acked <= 1024 + 41000);
+  CHECK(client->_unacked <= WINDOW);
+  CHECK_EQ(device.ota.prefetchState(), OTA_PREFETCH_DOWNLOADING);
+  device.ota.cancelPrefetch();
+}
+
+TEST(prefetch_resumes_with_a_range_request_after_a_reboot) {
+  std::vector<uint8_t> image = makeImage(100000, CONFIG_IDF_FIRMWARE_CHIP_ID, 7);
+  std::string md5 = md5Hex(image);
+  LittleFS.hostClear();
+  {
+    Device device("", "", [](ElegantOTAClass& ota) { ota.setPrefetchLimits(0, 100); });
+    CHECK(device.ota.prefetch(url, md5.c_str()));
+    device.ota.loop();
+    AsyncClient *client = accept();
+    std::string h = head(200, image.size());
+    client->hostReceive(h.data(), h.size());
+    // 70000 bytes, then the connection drops, the progress is saved at the last whole sector
+    std::vector<uint8_t> part(image.begin(), image.begin() + 70000);
+    size_t sent = 0;
+    while (sent < part.size()) {
+      pump(client, part, sent);
+      device.ota.loop();
+    }
+    client->hostDisconnect();
+    device.ota.loop();
+    CHECK(LittleFS.hostRead(ELEGANTOTA_PREFETCH_FILE).find("\"done\":69632") != std::string::npos);
+  }
+
+  // the flash keeps its content, a new instance reads the state
+  AsyncWebServer server(80);
+  ElegantOTAClass ota;
+  ota.setAutoReboot(false);
+  ota.setPrefetchLimits(0, 100);
+  ota.begin(&server);
+  CHECK_EQ(ota.prefetchState(), OTA_PREFETCH_DOWNLOADING);
+  ota.loop();
+  AsyncClient *client = accept();
+  CHECK(client->_sent.find("Range: bytes=69632-\r\n") != std::string::npos);
+
+  std::vector<uint8_t> rest(image.begin() + 69632, image.end());
+  std::string h = head(206, rest.size(), "Content-Range: bytes 69632-99999/100000\r\n");
+  client->hostReceive(h.data(), h.size());
+  size_t sent = 0;
+  for (int i = 0; i < 1000 && ota.prefetchState() != OTA_PREFETCH_STAGED; i++) {
+    pump(client, rest, sent);
+    host::advance(10);
+    ota.loop();
+  }
+  CHECK_EQ(ota.prefetchState(), OTA_PREFETCH_STAGED);
+  CHECK(partitionHolds(image));
+  CHECK(!host::bootSwitched());
+  CHECK(ota.applyStaged());
+  CHECK(host::bootSwitched());
+}
+
+TEST(prefetch_state_stays_off_a_replaced_filesystem) {
+  std::vector<uint8_t> fsImage(8192, 0x5A);
+  std::vector<uint8_t> image = makeImage(20000);
+  LittleFS.hostClear();
+  Device device;
+
+  CHECK_EQ(get(device, "/ota/start?mode=fs"), 200);
+  CHECK_EQ(upload(device, fsImage), 200);
+  // LittleFS no longer matches the flash, nothing is written to it until the reboot
+  CHECK(device.ota.prefetch(url, md5Hex(image).c_str()));
+  CHECK(!LittleFS.exists(ELEGANTOTA_PREFETCH_FILE));
+  device.ota.cancelPrefetch();
+}
+
+TEST(state_files_are_application_files_on_another_filesystem) {
+  fs::FS state;
+  LittleFS.hostClear();
+  LittleFS.hostWrite(ELEGANTOTA_PREFETCH_FILE, "mine");
+  Device device("", "", [&](ElegantOTAClass& ota) { ota.setStateFileSystem(state); });
+
+  CHECK_EQ(get(device, "/ota/start?mode=files"), 200);
+  std::string delete_url = std::string("/ota/fs/delete?path=") + ELEGANTOTA_PREFETCH_FILE;
+  CHECK_EQ(request(device, HTTP_POST, delete_url.c_str())->hostEnd(), 200);
+  CHECK(!LittleFS.exists(ELEGANTOTA_PREFETCH_FILE));
+}
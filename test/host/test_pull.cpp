@@ -0,0 +1,214 @@
+// pull(): peers only with a hash, no credentials sent, loop() never waits for the network
+#include "ota_fixture.h"
+
+namespace {
+
+const char *origin = "http://files.local/fw.bin";
+
+/**
+ * @brief the connection pull() opened last, completed by the test
+ */
+AsyncClient *accept() {
+  AsyncClient *client = host::connects.back();
+  client->hostConnected();
+  return client;
+}
+
+std::string head(int status, size_t length, const std::string& headers = "") {
+  return "HTTP/1.1 " + std::to_string(status) + " X\r\nContent-Length: " + std::to_string(length) + "\r\n" + headers + "\r\n";
+}
+
+std::string peerHeaders(const std::string& md5, const char *chip = "ESP32-S3") {
+  return "X-Image-MD5: " + md5 + "\r\nX-Chip-Family: " + chip + "\r\nX-FW-Variant: \r\nX-FW-Version: 2.0.0\r\n";
+}
+
+/**
+ * @brief answer the GET with status and image, loop() runs between the fragments
+ */
+void serve(Device& device, AsyncClient *client, const std::vector<uint8_t>& image, const std::string& headers = "") {
+  std::string h = head(200, image.size(), headers);
+  client->hostReceive(h.data(), h.size());
+  for (size_t offset = 0; offset < image.size(); offset += 1436) {
+    client->hostReceive(image.data() + offset, image.size() - offset < 1436 ? image.size() - offset : 1436);
+    device.ota.loop();
+  }
+}
+
+void addPeer(uint8_t lastOctet, const char *version = "2.0.0", uint8_t subnet = 4, uint16_t port = 80) {
+  host::MdnsService peer;
+  peer.host = "peer" + std::to_string(lastOctet);
+  peer.ip = IPAddress(192, 168, subnet, lastOctet);
+  peer.port = port;
+  peer.txt = {{"chip", "ESP32-S3"}, {"variant", ""}, {"version", version}};
+  host::mdnsServices.push_back(peer);
+}
+
+bool partitionHolds(const std::vector<uint8_t>& image) {
+  const std::vector<uint8_t>& partition = host::updatePartition();
+  return partition.size() >= image.size() && std::equal(image.begin(), image.end(), partition.begin());
+}
+
+}  // namespace
+
+TEST(pull_without_hash_uses_only_the_url) {
+  std::vector<uint8_t> image = makeImage(20000);
+  host::mdnsServices.clear();
+  addPeer(30);
+  Device device("admin", "secret");
+
+  size_t connects = host::connects.size();
+  CHECK(device.ota.pull(origin));
+  CHECK_EQ(host::mdnsQueries, 0);
+  device.ota.loop();
+  CHECK_EQ(host::connects.size(), connects + 1);
+  AsyncClient *client = accept();
+  CHECK_STR(client->_host, "files.local");
+  CHECK_EQ(client->_remote_port, 80);
+  CHECK(client->_sent.find("GET /fw.bin HTTP/1.0\r\n") == 0);
+  CHECK(client->_sent.find("Authorization") == std::string::npos);
+
+  serve(device, client, image);
+  device.ota.loop();
+  CHECK_EQ(device.starts, 1);
+  CHECK_EQ(device.successes, 1);
+  CHECK(partitionHolds(image));
+}
+
+TEST(pull_tries_peers_with_the_hash_and_never_sends_credentials) {
+  std::vector<uint8_t> image = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 2);
+  std::vector<uint8_t> other = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 3);
+  std::string md5 = md5Hex(image);
+  host::mdnsServices.clear();
+  addPeer(30);
+  addPeer(31);
+  addPeer(32, "1.0.0");
+  Device device("admin", "secret");
+  device.ota.setFWVersion("1.0.0");
+
+  size_t connects = host::connects.size();
+  CHECK(device.ota.pull(origin, md5.c_str(), "2.0.0"));
+  CHECK_EQ(host::mdnsQueries, 1);
+  // the query runs in the background, loop() goes on
+  device.ota.loop();
+  CHECK_EQ(host::connects.size(), connects);
+  host::advance(1000);
+  device.ota.loop();
+  CHECK_EQ(host::mdnsQueries, 0);
+  CHECK_EQ(host::connects.size(), connects + 1);
+
+  // the first peer claims the image but serves another one, Update's MD5 check catches it
+  AsyncClient *peer = accept();
+  CHECK_EQ(peer->_remote_port, 80);
+  CHECK_STR(peer->_host, "192.168.4.30");
+  CHECK(peer->_sent.find("GET /ota/self.bin HTTP/1.0\r\n") == 0);
+  CHECK(peer->_sent.find("Authorization") == std::string::npos);
+  serve(device, peer, other, peerHeaders(md5));
+  device.ota.loop();
+  CHECK_EQ(device.ends, 0);
+  CHECK_EQ(host::connects.size(), connects + 2);
+
+  // the second one has another image, it is not downloaded at all
+  peer = accept();
+  CHECK_STR(peer->_host, "192.168.4.31");
+  std::string h = head(200, other.size(), peerHeaders(md5Hex(other)));
+  peer->hostReceive(h.data(), h.size());
+  CHECK(peer->_closed);
+  device.ota.loop();
+
+  // the third one advertises another version and is skipped, the url is left
+  CHECK_EQ(host::connects.size(), connects + 3);
+  AsyncClient *client = accept();
+  CHECK_STR(client->_host, "files.local");
+  serve(device, client, image);
+  device.ota.loop();
+  CHECK_EQ(device.ends, 1);
+  CHECK_EQ(device.successes, 1);
+  CHECK(partitionHolds(image));
+}
+
+TEST(busy_peer_is_waited_for_and_a_stalled_download_times_out) {
+  std::vector<uint8_t> image = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 4);
+  std::string md5 = md5Hex(image);
+  host::mdnsServices.clear();
+  addPeer(40);
+  Device device;
+
+  size_t connects = host::connects.size();
+  CHECK(device.ota.pull(origin, md5.c_str()));
+  host::advance(1000);
+  device.ota.loop();
+  AsyncClient *peer = accept();
+  std::string busy = head(503, 4);
+  peer->hostReceive(busy.data(), busy.size());
+  device.ota.loop();
+  // uploads wait for the pull
+  CHECK_EQ(get(device, "/ota/start"), 409);
+  // the peer is asked again a second later instead of going to the url
+  for (int i = 0; i < 3; i++) {
+    host::advance(1000);
+    device.ota.loop();
+  }
+  CHECK_EQ(host::connects.size(), connects + 2);
+  CHECK_STR(host::connects.back()->_host, "192.168.4.40");
+
+  // this time the peer stops sending halfway
+  peer = accept();
+  std::string h = head(200, image.size(), peerHeaders(md5));
+  peer->hostReceive(h.data(), h.size());
+  peer->hostReceive(image.data(), 8000);
+  device.ota.loop();
+  host::advance(10001);
+  device.ota.loop();
+  CHECK_EQ(device.ends, 0);
+  CHECK(!Update.isRunning());
+  CHECK_EQ(host::connects.size(), connects + 3);
+  serve(device, accept(), image);
+  device.ota.loop();
+  CHECK_EQ(device.successes, 1);
+  CHECK(partitionHolds(image));
+}
+
+TEST(self_bin_is_served_without_credentials) {
+  host::runningImage() = makeImage(10000, CONFIG_IDF_FIRMWARE_CHIP_ID, 5);
+  Device device("admin", "secret", [](ElegantOTAClass& ota) { ota.setPeerServing(true); });
+  auto req = request(device, HTTP_GET, "/ota/self.bin");
+  CHECK_EQ(req->hostEnd(), 200);
+  CHECK(req->responseHeader("X-Image-MD5") != NULL);
+  // pulling stays protected
+  CHECK_EQ(get(device, "/ota/pull?url=http://files.local/fw.bin"), 401);
+  CHECK_EQ(get(device, "/ota/pull?url=http://files.local/fw.bin&hash=1234"), 401);
+}
+
+TEST(self_bin_is_refused_with_an_encryption_key) {
+  host::runningImage() = makeImage(10000, CONFIG_IDF_FIRMWARE_CHIP_ID, 6);
+  uint8_t key[32] = {1};
+  Device device("admin", "secret", [&](ElegantOTAClass& ota) {
+    ota.setPeerServing(true);
+    ota.enableDiscovery();
+    ota.setEncryptionKey(key);
+  });
+  // the running image holds the key
+  auto req = request(device, HTTP_GET, "/ota/self.bin");
+  req->_user = "admin";
+  req->_pass = "secret";
+  CHECK_EQ(req->hostEnd(), 403);
+  CHECK(host::mdnsTxt["modes"].find("enc") != std::string::npos);
+  CHECK(host::mdnsTxt["modes"].find("peer") == std::string::npos);
+}
+
+TEST(peer_url_holds_the_longest_address) {
+  std::vector<uint8_t> image = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 7);
+  host::mdnsServices.clear();
+  addPeer(200, "2.0.0", 100, 8080);
+  Device device;
+
+  size_t connects = host::connects.size();
+  CHECK(device.ota.pull(origin, md5Hex(image).c_str()));
+  host::advance(1000);
+  device.ota.loop();
+  CHECK_EQ(host::connects.size(), connects + 1);
+  AsyncClient *peer = accept();
+  CHECK_STR(peer->_host, "192.168.100.200");
+  CHECK_EQ(peer->_remote_port, 8080);
+  CHECK(peer->_sent.find("GET /ota/self.bin HTTP/1.0\r\n") == 0);
+}
@@ -0,0 +1,197 @@
+// Upload sessions: uploads without a session and several clients at the same time
+#include "ota_fixture.h"
+
+namespace {
+
+/**
+ * @brief multipart upload of one client, the test sends its fragments one by one
+ */
+struct Upload {
+  std::unique_ptr<AsyncWebServerRequest> req;
+  const std::vector<uint8_t>& data;
+  size_t offset = 0;
+
+  Upload(Device& device, const std::vector<uint8_t>& image, AsyncClient *client, const char *token = NULL)
+    : req(request(device, HTTP_POST, "/ota/upload", client)), data(image) {
+    req->_content_length = data.size() + 200;
+    if (token != NULL) req->hostHeader("X-OTA-Session", token);
+  }
+  // the last fragment closes the session, holdLast keeps it back for send(..., false)
+  bool send(size_t fragment = 1436, bool holdLast = false) {
+    if (offset >= data.size() || (holdLast && data.size() - offset <= fragment)) return false;
+    size_t n = data.size() - offset < fragment ? data.size() - offset : fragment;
+    req->hostUpload("firmware.bin", data.data() + offset, n, offset + n == data.size());
+    offset += n;
+    return true;
+  }
+};
+
+std::string startSession(Device& device, AsyncClient *client, int expected = 200) {
+  auto req = request(device, HTTP_GET, "/ota/start", client);
+  CHECK_EQ(req->hostEnd(), expected);
+  const char *token = req->responseHeader("X-OTA-Session");
+  return token != NULL ? token : "";
+}
+
+bool partitionHolds(const std::vector<uint8_t>& image) {
+  const std::vector<uint8_t>& partition = host::updatePartition();
+  return partition.size() >= image.size() && std::equal(image.begin(), image.end(), partition.begin());
+}
+
+}  // namespace
+
+TEST(upload_without_session_is_rejected) {
+  std::vector<uint8_t> image = makeImage(8192);
+  Device device;
+  int begins = Update._begin_count;
+  std::string body;
+  CHECK_EQ(upload(device, image, NULL, 1436, &body), 400);
+  CHECK_STR(body, "No session started");
+  CHECK_EQ(Update._begin_count, begins);
+  CHECK_EQ(device.ends, 0);
+
+  // an empty POST of the owner is no success either
+  startSession(device, NULL);
+  auto empty = request(device, HTTP_POST, "/ota/upload");
+  CHECK_EQ(empty->hostEnd(), 400);
+  CHECK_STR(empty->body(), "No image received");
+}
+
+TEST(upload_after_finished_session_is_rejected) {
+  std::vector<uint8_t> image = makeImage(8192);
+  Device device;
+  startSession(device, NULL);
+  CHECK_EQ(upload(device, image), 200);
+  CHECK_EQ(device.successes, 1);
+
+  // a second POST of the same image does not report the old result again
+  std::string body;
+  CHECK_EQ(upload(device, image, NULL, 1436, &body), 400);
+  CHECK_STR(body, "No session started");
+  CHECK_EQ(device.ends, 1);
+}
+
+TEST(second_client_cannot_start_or_upload) {
+  auto a = makeClient(21);
+  auto b = makeClient(22);
+  std::vector<uint8_t> image_a = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 1);
+  std::vector<uint8_t> image_b = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 2);
+  Device device;
+
+  startSession(device, a.get());
+  startSession(device, b.get(), 409);
+
+  // fragments of both uploads arrive interleaved, only the owner's reach the flash
+  Upload up_a(device, image_a, a.get());
+  Upload up_b(device, image_b, b.get());
+  while (up_a.send(1436, true) | up_b.send()) {}
+  CHECK_EQ(up_b.req->hostEnd(), 409);
+  CHECK(up_b.req->responseHeader("Retry-After") != NULL);
+  CHECK(up_a.send());
+  CHECK_EQ(up_a.req->hostEnd(), 200);
+  CHECK_EQ(device.successes, 1);
+  CHECK(partitionHolds(image_a));
+
+  // once the session is closed the other client may start its own
+  startSession(device, b.get());
+  CHECK_EQ(upload(device, image_b, b.get()), 200);
+  CHECK_EQ(device.successes, 2);
+  CHECK(partitionHolds(image_b));
+}
+
+TEST(intruder_upload_first_does_not_disturb_owner) {
+  auto a = makeClient(31);
+  auto b = makeClient(32);
+  std::vector<uint8_t> image_a = makeImage(12000, CONFIG_IDF_FIRMWARE_CHIP_ID, 3);
+  std::vector<uint8_t> image_b = makeImage(12000, CONFIG_IDF_FIRMWARE_CHIP_ID, 4);
+  Device device;
+
+  startSession(device, a.get());
+  // the other client opens its upload before the owner does
+  Upload up_b(device, image_b, b.get());
+  up_b.send();
+  Upload up_a(device, image_a, a.get());
+  while (up_b.send() | up_a.send()) {}
+  // the owner's request completes first, the intruder still gets no result of it
+  CHECK_EQ(up_a.req->hostEnd(), 200);
+  CHECK_EQ(up_b.req->hostEnd(), 400);
+  CHECK_STR(up_b.req->body(), "No session started");
+  CHECK_EQ(device.successes, 1);
+  CHECK_EQ(device.ends, 1);
+  CHECK(partitionHolds(image_a));
+}
+
+TEST(session_token_separates_clients_behind_one_address) {
+  auto a = makeClient(40);
+  auto b = makeClient(40);
+  std::vector<uint8_t> image_a = makeImage(9000, CONFIG_IDF_FIRMWARE_CHIP_ID, 5);
+  std::vector<uint8_t> image_b = makeImage(9000, CONFIG_IDF_FIRMWARE_CHIP_ID, 6);
+  Device device;
+
+  std::string token = startSession(device, a.get());
+  CHECK_EQ(token.size(), 16);
+  Upload up_a(device, image_a, a.get(), token.c_str());
+  Upload up_b(device, image_b, b.get(), "0000000000000000");
+  while (up_a.send(1000, true) | up_b.send(1000)) {}
+  CHECK_EQ(up_b.req->hostEnd(), 409);
+  CHECK(up_a.send(1000));
+  CHECK_EQ(up_a.req->hostEnd(), 200);
+  CHECK(partitionHolds(image_a));
+}
+
+TEST(owner_disconnect_frees_session_for_next_client) {
+  auto a = makeClient(51);
+  auto b = makeClient(52);
+  std::vector<uint8_t> image_a = makeImage(30000, CONFIG_IDF_FIRMWARE_CHIP_ID, 7);
+  std::vector<uint8_t> image_b = makeImage(30000, CONFIG_IDF_FIRMWARE_CHIP_ID, 8);
+  Device device;
+
+  startSession(device, a.get());
+  {
+    Upload up_a(device, image_a, a.get());
+    up_a.send();
+    up_a.send();
+    up_a.req->hostDisconnect();
+  }
+  // the partition stays reserved until the session times out
+  startSession(device, b.get(), 409);
+  host::advance(31000);
+  device.ota.loop();
+  CHECK_EQ(device.ends, 1);
+  CHECK_EQ(device.successes, 0);
+
+  startSession(device, b.get());
+  std::string body;
+  CHECK_EQ(upload(device, image_b, b.get(), 1436, &body), 200);
+  CHECK_STR(body, "OK");
+  CHECK(partitionHolds(image_b));
+}
+
+TEST(stale_session_of_another_instance_is_released_before_update_begins) {
+  auto a = makeClient(53);
+  auto b = makeClient(54);
+  std::vector<uint8_t> image_a = makeImage(30000, CONFIG_IDF_FIRMWARE_CHIP_ID, 9);
+  std::vector<uint8_t> image_b = makeImage(30000, CONFIG_IDF_FIRMWARE_CHIP_ID, 10);
+  Device first;
+  Device second;
+
+  startSession(first, a.get());
+  {
+    Upload up_a(first, image_a, a.get());
+    up_a.send();
+  }
+  CHECK(Update.isRunning());
+  startSession(second, b.get(), 409);
+
+  // the first instance never runs loop() again, the second one takes its Update object over
+  host::advance(31000);
+  startSession(second, b.get());
+  CHECK_EQ(first.ends, 1);
+  CHECK_EQ(first.successes, 0);
+  CHECK_EQ(second.starts, 1);
+  std::string body;
+  CHECK_EQ(upload(second, image_b, b.get(), 1436, &body), 200);
+  CHECK_STR(body, "OK");
+  CHECK_EQ(second.successes, 1);
+  CHECK(partitionHolds(image_b));
+}
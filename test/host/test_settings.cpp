@@ -0,0 +1,120 @@
+// Inline string settings: truncation, credentials and the heap over many sessions
+#include "ota_fixture.h"
+
+TEST(fixed_string_reports_truncation) {
+  ElegantOTAFixedString<8> s;
+  CHECK(s.assign("12345678"));
+  CHECK_STR(s.c_str(), "12345678");
+  CHECK(!s.assign("123456789"));
+  CHECK_STR(s.c_str(), "12345678");
+  CHECK(s.assign(NULL));
+  CHECK(s.isEmpty());
+
+  s = "abc";
+  CHECK(s.append("def"));
+  CHECK(!s.append("ghi"));
+  CHECK_STR(s.c_str(), "abcdefgh");
+}
+
+TEST(fixed_string_self_assignment) {
+  ElegantOTAFixedString<16> s("firmware");
+  s = s.c_str();
+  CHECK_STR(s.c_str(), "firmware");
+  // a tail of the own buffer moves to the front
+  CHECK(s.assign(s.c_str() + 4));
+  CHECK_STR(s.c_str(), "ware");
+  s.append(s.c_str(), s.length());
+  CHECK_STR(s.c_str(), "wareware");
+}
+
+TEST(long_git_environment_is_served_complete) {
+  Device device;
+  std::string repo(90, 'r');
+  device.ota.setGitEnv("an-organisation-with-a-long-name", repo.c_str(), "feature/some-long-branch-name", 7);
+  auto req = request(device, HTTP_GET, "/getdeviceinfo");
+  CHECK_EQ(req->hostEnd(), 200);
+  JsonDocument doc;
+  CHECK(!deserializeJson(doc, req->body().c_str()));
+  CHECK_STR(doc["owner"] | "", "an-organisation-with-a-long-name");
+  CHECK_STR(doc["repository"] | "", repo);
+  CHECK_STR(doc["branch"] | "", "feature/some-long-branch-name");
+}
+
+TEST(truncated_setting_is_logged) {
+  Device device;
+  host::clearLog();
+  device.ota.setFWVersion("1.0.0");
+  CHECK(!host::logContains("truncated"));
+  device.ota.setFWVersion("1.0.0-rc.1+build.20261019.abcdef0123456789");
+  CHECK(host::logContains("FWVersion is longer than 32 characters and was truncated"));
+}
+
+TEST(long_credentials_lock_instead_of_truncating) {
+  std::string password(ELEGANTOTA_CREDENTIAL_LEN + 1, 'p');
+  host::clearLog();
+  Device device("admin", password.c_str());
+  CHECK(host::logContains("OTA access is locked"));
+
+  // neither the full nor the truncated password opens the endpoints
+  std::string truncated(ELEGANTOTA_CREDENTIAL_LEN, 'p');
+  for (const std::string *pass : {&password, &truncated}) {
+    auto req = request(device, HTTP_GET, "/ota/start");
+    req->_user = "admin";
+    req->_pass = pass->c_str();
+    CHECK_EQ(req->hostEnd(), 401);
+  }
+  // the empty credentials the buffers would hold are no way in either
+  auto empty = request(device, HTTP_GET, "/ota/start");
+  empty->_user = "";
+  empty->_pass = "";
+  CHECK_EQ(empty->hostEnd(), 401);
+
+  // credentials that fit replace the lock
+  device.ota.setAuth("admin", truncated.c_str());
+  auto ok = request(device, HTTP_GET, "/getdeviceinfo");
+  ok->_user = "admin";
+  ok->_pass = truncated.c_str();
+  CHECK_EQ(ok->hostEnd(), 200);
+}
+
+// Every session reserves its buffers at /ota/start and releases them when it closes, so
+// the heap must look the same after each of many sessions: no leak and no growing
+// number of allocations per session.
+TEST(soak_10000_sessions_keep_the_heap_flat) {
+  Device device;
+  std::vector<uint8_t> image = makeImage(8192);
+  std::string hash = md5Hex(image);
+  std::string start = "/ota/start?hash=" + hash;
+
+  size_t live_after_warmup = 0;
+  size_t allocs_first = 0;
+  size_t max_live = 0;
+  int failures = 0;
+  bool steady = true;
+  for (int cycle = 0; cycle < 10000; cycle++) {
+    host::resetAllocStats();
+    size_t live_before = host::allocStats().live;
+    int started = get(device, start.c_str());
+    std::string body;
+    int uploaded = upload(device, image, NULL, 1436, &body);
+    if (started != 200 || uploaded != 200) {
+      if (!failures) fprintf(stderr, "  cycle %d: start %d, upload %d %s\n", cycle, started, uploaded, body.c_str());
+      failures++;
+    }
+    device.ota.loop();
+    host::advance(100);
+    host::AllocStats stats = host::allocStats();
+    if (stats.peak > max_live) max_live = stats.peak;
+    if (cycle == 10) {
+      live_after_warmup = stats.live;
+      allocs_first = stats.allocs;
+    } else if (cycle > 10 && (stats.live != live_after_warmup || stats.allocs != allocs_first || stats.live != live_before)) {
+      if (steady) fprintf(stderr, "  cycle %d: %zu allocs, %zu live, %zu before\n", cycle, stats.allocs, stats.live, live_before);
+      steady = false;
+    }
+  }
+  CHECK_EQ(failures, 0);
+  CHECK_EQ(device.successes, 10000);
+  CHECK(steady);
+  printf("     soak: %zu allocations per session (requests included), %zu bytes live, peak %zu\n", allocs_first, live_after_warmup, max_live);
+}
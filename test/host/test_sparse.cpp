@@ -0,0 +1,81 @@
+// Sparse images: the MD5 of the header and the one given to /ota/start
+#include "ota_fixture.h"
+#include <cstring>
+
+namespace {
+
+/**
+ * @brief sparse form of image (see scripts/sparse_image.py), md5 is the digest in its header
+ */
+std::vector<uint8_t> makeSparse(const std::vector<uint8_t>& image, const uint8_t md5[16]) {
+  std::vector<uint8_t> out(ElegantOTASparse::HEADER_LEN, 0);
+  auto put32 = [&out](size_t at, uint32_t v) {
+    for (int i = 0; i < 4; i++) out[at + i] = (uint8_t)(v >> (8 * i));
+  };
+  memcpy(out.data(), "EOTS", 4);
+  out[4] = 1;
+  put32(8, (uint32_t)image.size());
+  put32(12, 1);
+  if (md5 != NULL) memcpy(out.data() + 16, md5, 16);
+  // one extent with all of the image, the parser does not care for holes here
+  out.resize(out.size() + ElegantOTASparse::EXTENT_HEADER_LEN, 0);
+  put32(ElegantOTASparse::HEADER_LEN + 4, (uint32_t)image.size());
+  out.insert(out.end(), image.begin(), image.end());
+  return out;
+}
+
+std::vector<uint8_t> digest(const std::vector<uint8_t>& data) {
+  MD5Builder md5;
+  md5.begin();
+  md5.add(data.data(), data.size());
+  md5.calculate();
+  std::vector<uint8_t> bytes(16);
+  md5.getBytes(bytes.data());
+  return bytes;
+}
+
+std::string upper(std::string s) {
+  for (char& c : s) c = (char)toupper((unsigned char)c);
+  return s;
+}
+
+}  // namespace
+
+TEST(sparse_header_hash_is_verified) {
+  std::vector<uint8_t> image = makeImage(12288);
+  std::vector<uint8_t> wrong = digest(makeImage(12288, CONFIG_IDF_FIRMWARE_CHIP_ID, 9));
+  Device device;
+
+  CHECK_EQ(get(device, "/ota/start?sparse=1"), 200);
+  CHECK_EQ(upload(device, makeSparse(image, wrong.data())), 400);
+  CHECK_EQ(device.successes, 0);
+
+  CHECK_EQ(get(device, "/ota/start?sparse=1"), 200);
+  CHECK_EQ(upload(device, makeSparse(image, digest(image).data())), 200);
+  CHECK_EQ(device.successes, 1);
+}
+
+TEST(sparse_header_hash_must_agree_with_start_hash) {
+  std::vector<uint8_t> image = makeImage(12288);
+  std::vector<uint8_t> other = makeImage(12288, CONFIG_IDF_FIRMWARE_CHIP_ID, 9);
+  Device device;
+
+  // the header names another image than /ota/start: rejected before anything is written
+  std::string start = "/ota/start?sparse=1&hash=" + md5Hex(image);
+  CHECK_EQ(get(device, start.c_str()), 200);
+  std::string body;
+  CHECK_EQ(upload(device, makeSparse(image, digest(other).data()), NULL, 1436, &body), 400);
+  CHECK_STR(body, "MD5 of sparse image does not match");
+  CHECK_EQ(device.successes, 0);
+
+  // both agree, in any case of the hex digits
+  start = "/ota/start?sparse=1&hash=" + upper(md5Hex(image));
+  CHECK_EQ(get(device, start.c_str()), 200);
+  CHECK_EQ(upload(device, makeSparse(image, digest(image).data())), 200);
+
+  // a header without hash leaves the one of /ota/start
+  start = "/ota/start?sparse=1&hash=" + md5Hex(other);
+  CHECK_EQ(get(device, start.c_str()), 200);
+  CHECK_EQ(upload(device, makeSparse(image, NULL)), 400);
+  CHECK_EQ(device.successes, 1);
+}
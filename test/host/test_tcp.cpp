@@ -0,0 +1,152 @@
+// Raw TCP upload: nonce challenge instead of credentials on the wire
+#include "ota_fixture.h"
+#include <cstring>
+
+namespace {
+
+void tcpListener(ElegantOTAClass& ota) {
+  ota.enableTcpUpload(3232);
+}
+
+/**
+ * @brief connection of the test, the listener deletes it on disconnect, the bytes it got stay in log
+ */
+struct TcpClient : public AsyncClient {
+  std::string *log;
+  explicit TcpClient(std::string *log) : log(log) {}
+  ~TcpClient() { *log = _sent; }
+};
+
+/**
+ * @brief header of scripts/elegantota_tcp.py, version 2
+ */
+std::vector<uint8_t> header(uint32_t size, const std::string& md5 = "", uint8_t version = 2) {
+  std::vector<uint8_t> h = {'E', 'O', 'T', 'U', version, 0, 0, 0,
+                            (uint8_t)size, (uint8_t)(size >> 8), (uint8_t)(size >> 16), (uint8_t)(size >> 24)};
+  for (size_t i = 0; i < 16; i++) h.push_back(md5.empty() ? 0 : (uint8_t)strtoul(md5.substr(i * 2, 2).c_str(), NULL, 16));
+  return h;
+}
+
+std::vector<uint8_t> respond(const std::string& nonceHex, const std::vector<uint8_t>& h, const char *username, const char *password) {
+  uint8_t nonce[16];
+  for (size_t i = 0; i < 16; i++) nonce[i] = (uint8_t)strtoul(nonceHex.substr(i * 2, 2).c_str(), NULL, 16);
+  const uint8_t * const parts[] = {nonce, h.data(), (const uint8_t *)username};
+  const size_t lens[] = {sizeof(nonce), h.size(), strlen(username)};
+  std::vector<uint8_t> mac(ElegantOTAHmac::LEN);
+  ElegantOTAHmac::sha256((const uint8_t *)password, strlen(password), parts, lens, 3, mac.data());
+  return mac;
+}
+
+/**
+ * @brief accept a connection and send the header, the device answers with the challenge
+ * @return the nonce, empty if the answer was not a challenge
+ */
+std::string challenge(TcpClient *client, const std::vector<uint8_t>& h) {
+  host::listeners.back()->hostAccept(client);
+  client->hostReceive(h.data(), h.size());
+  if (client->_sent.compare(0, 4, "101 ") != 0 || client->_sent.size() != 4 + 32 + 1) return "";
+  std::string nonce = client->_sent.substr(4, 32);
+  client->_sent.clear();
+  return nonce;
+}
+
+}  // namespace
+
+TEST(hmac_matches_rfc_4231) {
+  const char *data = "what do ya want for nothing?";
+  const uint8_t * const parts[] = {(const uint8_t *)data, (const uint8_t *)data + 10};
+  const size_t lens[] = {10, strlen(data) - 10};
+  uint8_t mac[ElegantOTAHmac::LEN];
+  ElegantOTAHmac::sha256((const uint8_t *)"Jefe", 4, parts, lens, 2, mac);
+  std::string hex;
+  for (uint8_t b : mac) {
+    char buf[3];
+    snprintf(buf, sizeof(buf), "%02x", b);
+    hex += buf;
+  }
+  CHECK_STR(hex, "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+}
+
+TEST(tcp_upload_answers_a_challenge_without_sending_the_password) {
+  std::vector<uint8_t> image = makeImage(20000, CONFIG_IDF_FIRMWARE_CHIP_ID, 11);
+  std::vector<uint8_t> h = header(image.size(), md5Hex(image));
+  Device device("admin", "secret", tcpListener);
+
+  std::string log;
+  TcpClient *client = new TcpClient(&log);
+  std::string nonce = challenge(client, h);
+  CHECK_EQ(nonce.size(), 32u);
+  CHECK_EQ(device.starts, 0);
+  std::vector<uint8_t> mac = respond(nonce, h, "admin", "secret");
+  client->hostReceive(mac.data(), mac.size());
+  CHECK_STR(client->_sent, "100 Ready\n");
+  CHECK_EQ(device.starts, 1);
+
+  for (size_t offset = 0; offset < image.size(); offset += 1436) {
+    client->hostReceive(image.data() + offset, image.size() - offset < 1436 ? image.size() - offset : 1436);
+  }
+  CHECK_STR(log, "100 Ready\n200 OK\n");
+  CHECK_EQ(device.successes, 1);
+
+  // every connection gets another nonce
+  TcpClient *other = new TcpClient(&log);
+  CHECK(challenge(other, h) != nonce);
+  other->hostDisconnect();
+}
+
+TEST(tcp_upload_rejects_wrong_and_replayed_answers) {
+  std::vector<uint8_t> h = header(20000);
+  Device device("admin", "secret", tcpListener);
+
+  std::string log;
+  TcpClient *client = new TcpClient(&log);
+  std::string nonce = challenge(client, h);
+  std::vector<uint8_t> mac = respond(nonce, h, "admin", "wrong");
+  client->hostReceive(mac.data(), mac.size());
+  CHECK_STR(log, "401 Unauthorized\n");
+
+  // the MAC covers the header, another size is not accepted with it
+  client = new TcpClient(&log);
+  nonce = challenge(client, h);
+  mac = respond(nonce, header(30000), "admin", "secret");
+  client->hostReceive(mac.data(), mac.size());
+  CHECK_STR(log, "401 Unauthorized\n");
+
+  // a valid answer is worthless on the next connection
+  client = new TcpClient(&log);
+  nonce = challenge(client, h);
+  std::vector<uint8_t> recorded = respond(nonce, h, "admin", "secret");
+  client->hostDisconnect();
+  client = new TcpClient(&log);
+  challenge(client, h);
+  client->hostReceive(recorded.data(), recorded.size());
+  CHECK_STR(log, "401 Unauthorized\n");
+
+  // the old plaintext credentials after the header are not read as an answer
+  std::vector<uint8_t> v1 = header(20000, "", 1);
+  client = new TcpClient(&log);
+  host::listeners.back()->hostAccept(client);
+  client->hostReceive(v1.data(), v1.size());
+  CHECK_STR(log, "400 Bad header\n");
+  client = new TcpClient(&log);
+  host::listeners.back()->hostAccept(client);
+  std::vector<uint8_t> early = h;
+  early.insert(early.end(), {'a', 'd', 'm', 'i', 'n', ':', 's', 'e', 'c', 'r', 'e', 't'});
+  client->hostReceive(early.data(), early.size());
+  CHECK_STR(log, "400 Data before the challenge was answered\n");
+  CHECK_EQ(device.starts, 0);
+}
+
+TEST(tcp_upload_without_credentials_is_ready_at_once) {
+  std::vector<uint8_t> image = makeImage(10000, CONFIG_IDF_FIRMWARE_CHIP_ID, 12);
+  std::vector<uint8_t> data = header(image.size(), md5Hex(image));
+  data.insert(data.end(), image.begin(), image.end());
+  Device device("", "", tcpListener);
+
+  std::string log;
+  TcpClient *client = new TcpClient(&log);
+  host::listeners.back()->hostAccept(client);
+  client->hostReceive(data.data(), data.size());
+  CHECK_STR(log, "100 Ready\n200 OK\n");
+  CHECK_EQ(device.successes, 1);
+}
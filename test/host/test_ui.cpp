@@ -0,0 +1,75 @@
+// UI page: the default headers are sent, concurrent page loads hold little heap
+#include "ota_fixture.h"
+#include <cstdio>
+#include <memory>
+
+namespace {
+
+// begin() adds the CORS headers, the application one more
+void frameHeader(ElegantOTAClass&) {
+  DefaultHeaders::Instance().addHeader("X-Frame-Options", "DENY");
+}
+
+std::string headOf(const std::string& sent) {
+  size_t end = sent.find("\r\n\r\n");
+  return end == std::string::npos ? "" : sent.substr(0, end + 4);
+}
+
+}  // namespace
+
+TEST(ui_page_carries_the_default_headers) {
+  Device device("", "", frameHeader);
+  auto client = makeClient(70);
+  auto req = request(device, HTTP_GET, "/update", client.get());
+  CHECK_EQ(req->hostEnd(), 200);
+  std::string head = headOf(client->_sent);
+  CHECK(head.find("HTTP/1.1 200 OK\r\n") == 0);
+  CHECK(head.find("\r\nContent-Encoding: gzip\r\n") != std::string::npos);
+  CHECK(head.find("\r\nAccess-Control-Allow-Origin: *\r\n") != std::string::npos);
+  CHECK(head.find("\r\nAccess-Control-Allow-Methods: GET, POST, PUT\r\n") != std::string::npos);
+  CHECK(head.find("\r\nAccess-Control-Allow-Headers: Content-Type\r\n") != std::string::npos);
+  CHECK(head.find("\r\nX-Frame-Options: DENY\r\n") != std::string::npos);
+}
+
+TEST(concurrent_page_loads_hold_little_heap) {
+  const int loads = 5;
+  std::vector<std::unique_ptr<AsyncClient>> clients;
+  for (int i = 0; i < loads; i++) {
+    clients.push_back(makeClient(80 + i));
+    // the bytes on the wire are not part of the device heap, their buffer is allocated up front
+    clients.back()->_sent.reserve(8192);
+  }
+  Device device("", "", frameHeader);
+  const ElegantOTAAsset *page = elegantota_find_asset("/update");
+
+  host::resetAllocStats();
+  size_t base = host::allocStats().live;
+  std::vector<std::unique_ptr<AsyncWebServerRequest>> reqs;
+  std::vector<size_t> sent(loads, 0);
+  for (int i = 0; i < loads; i++) {
+    reqs.push_back(request(device, HTTP_GET, "/update", clients[i].get()));
+    reqs.back()->hostEnd();
+  }
+  std::string head = headOf(clients[0]->_sent);
+  CHECK(head.find("\r\nX-Frame-Options: DENY\r\n") != std::string::npos);
+  // the fifth one is sent to the retry page
+  CHECK_EQ(reqs[loads - 1]->code(), 503);
+  bool busy = true;
+  while (busy) {
+    busy = false;
+    for (int i = 0; i < loads - 1; i++) {
+      if (clients[i]->_queued == 0) continue;
+      sent[i] += clients[i]->_sent.size();
+      clients[i]->_sent.clear();
+      reqs[i]->hostAck(clients[i]->_queued);
+      busy = true;
+    }
+  }
+  for (int i = 0; i < loads - 1; i++) {
+    CHECK_EQ(sent[i], head.size() + page->len);
+  }
+  // requests, responses and header lists, the page itself stays in flash
+  size_t peak = host::allocStats().peak - base;
+  CHECK(peak < loads * 2048);
+  printf("     ui: %d page loads, peak %zu bytes (requests included)\n", loads, peak);
+}